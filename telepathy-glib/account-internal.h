@@ -35,6 +35,10 @@ const GQuark * _tp_account_get_missing_features (TpAccount *account);
 
 void _tp_account_refresh_properties (TpAccount *account);
 
+GVariant *_tp_account_dup_snapshot (TpAccount *account);
+void _tp_account_apply_snapshot (TpAccount *account,
+    GVariant *snapshot);
+
 G_END_DECLS
 
 #endif
@@ -23,9 +23,11 @@
 
 #include "telepathy-glib/account-manager-internal.h"
 #include "telepathy-glib/account-internal.h"
+#include "telepathy-glib/account-snapshot-internal.h"
 
 #include <telepathy-glib/defs.h>
 #include <telepathy-glib/gtypes.h>
+#include <telepathy-glib/heap.h>
 #include <telepathy-glib/interfaces.h>
 #include <telepathy-glib/proxy-subclass.h>
 #include <telepathy-glib/util-internal.h>
@@ -70,6 +72,20 @@
  * The #TpAccountManager::account-removed signal is emitted when
  * existing accounts are removed.
  *
+ * Preparing %TP_ACCOUNT_MANAGER_FEATURE_CORE prepares every valid account,
+ * which can take a long time if there are hundreds of them. Setting
+ * #TpAccountManager:max-preparing-accounts limits how many accounts are
+ * prepared at the same time, in which case the accounts that are enabled
+ * and online have their features prepared first. Setting
+ * #TpAccountManager:progressive-preparation makes the feature ready as soon
+ * as the list of accounts has been retrieved, with each account being
+ * announced by #TpAccountManager::account-prepared when it's ready.
+ *
+ * Clients which need to show accounts as soon as possible can set
+ * #TpAccountManager:use-snapshot, in which case the properties of valid
+ * accounts are saved to disk, and used as provisional values by the next
+ * process: see tp_account_manager_dup_provisional_accounts().
+ *
  * Since: 0.7.32
  */
 
@@ -118,7 +134,27 @@ struct _TpAccountManagerPrivate {
   gchar *requested_status;
   gchar *requested_status_message;
 
+  /* number of accounts from the initial ValidAccounts which are still
+   * being prepared */
   guint n_preparing_accounts;
+  /* TRUE once we have had the initial ValidAccounts */
+  gboolean got_all;
+
+  /* 0 for no limit */
+  guint max_preparing_accounts;
+  gboolean progressive_preparation;
+  /* owned PreparationJob, ordered by preparation_job_cmp() */
+  TpHeap *preparation_queue;
+  /* number of calls to tp_proxy_prepare_async() in progress for jobs */
+  guint n_running_jobs;
+  guint next_job_serial;
+
+  gboolean use_snapshot;
+  /* (owned) object path -> (reffed) TpAccount, for accounts from the
+   * snapshot, until TP_ACCOUNT_MANAGER_FEATURE_CORE is prepared */
+  GHashTable *provisional_accounts;
+  /* timeout to save the snapshot, or 0 */
+  guint save_snapshot_id;
 };
 
 typedef struct {
@@ -139,9 +175,17 @@ enum {
   ACCOUNT_ENABLED,
   ACCOUNT_DISABLED,
   MOST_AVAILABLE_PRESENCE_CHANGED,
+  ACCOUNT_PREPARED,
   LAST_SIGNAL
 };
 
+enum {
+  PROP_MAX_PREPARING_ACCOUNTS = 1,
+  PROP_PROGRESSIVE_PREPARATION,
+  PROP_USE_SNAPSHOT,
+  N_PROPS
+};
+
 static guint signals[LAST_SIGNAL];
 
 G_DEFINE_TYPE (TpAccountManager, tp_account_manager, TP_TYPE_PROXY)
@@ -204,6 +248,9 @@ _tp_account_manager_list_features (TpProxyClass *cls G_GNUC_UNUSED)
   return features;
 }
 
+static gint preparation_job_cmp (gconstpointer a, gconstpointer b);
+static void preparation_job_free (gpointer p);
+
 static void
 tp_account_manager_init (TpAccountManager *self)
 {
@@ -220,6 +267,69 @@ tp_account_manager_init (TpAccountManager *self)
       g_free, (GDestroyNotify) g_object_unref);
   self->priv->legacy_accounts = g_hash_table_new_full (
       g_str_hash, g_str_equal, g_free, g_object_unref);
+  priv->preparation_queue = tp_heap_new (preparation_job_cmp,
+      preparation_job_free);
+  priv->provisional_accounts = g_hash_table_new_full (g_str_hash,
+      g_str_equal, g_free, g_object_unref);
+}
+
+static void
+tp_account_manager_get_property (GObject *object,
+    guint property_id,
+    GValue *value,
+    GParamSpec *pspec)
+{
+  TpAccountManager *self = TP_ACCOUNT_MANAGER (object);
+
+  switch (property_id)
+    {
+      case PROP_MAX_PREPARING_ACCOUNTS:
+        g_value_set_uint (value, self->priv->max_preparing_accounts);
+        break;
+
+      case PROP_PROGRESSIVE_PREPARATION:
+        g_value_set_boolean (value, self->priv->progressive_preparation);
+        break;
+
+      case PROP_USE_SNAPSHOT:
+        g_value_set_boolean (value, self->priv->use_snapshot);
+        break;
+
+      default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+        break;
+    }
+}
+
+static void
+tp_account_manager_set_property (GObject *object,
+    guint property_id,
+    const GValue *value,
+    GParamSpec *pspec)
+{
+  TpAccountManager *self = TP_ACCOUNT_MANAGER (object);
+
+  switch (property_id)
+    {
+      case PROP_MAX_PREPARING_ACCOUNTS:
+        tp_account_manager_set_max_preparing_accounts (self,
+            g_value_get_uint (value));
+        break;
+
+      case PROP_PROGRESSIVE_PREPARATION:
+        tp_account_manager_set_progressive_preparation (self,
+            g_value_get_boolean (value));
+        break;
+
+      case PROP_USE_SNAPSHOT:
+        tp_account_manager_set_use_snapshot (self,
+            g_value_get_boolean (value));
+        break;
+
+      default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+        break;
+    }
 }
 
 static void
@@ -258,6 +368,92 @@ _tp_account_manager_name_owner_cb (TpDBusDaemon *proxy,
 
 static void insert_account (TpAccountManager *self, TpAccount *account);
 
+static void
+_tp_account_manager_save_snapshot (TpAccountManager *self)
+{
+  GVariantBuilder builder;
+  GHashTableIter iter;
+  gpointer k, v;
+  GVariant *accounts;
+
+  g_variant_builder_init (&builder, _TP_ACCOUNT_SNAPSHOT_TYPE);
+  g_hash_table_iter_init (&iter, self->priv->accounts);
+
+  while (g_hash_table_iter_next (&iter, &k, &v))
+    {
+      GVariant *properties = _tp_account_dup_snapshot (v);
+
+      g_variant_builder_add (&builder, "{o@a{sv}}", k, properties);
+      g_variant_unref (properties);
+    }
+
+  accounts = g_variant_ref_sink (g_variant_builder_end (&builder));
+  _tp_account_snapshot_save (tp_proxy_get_bus_name (self), accounts);
+  g_variant_unref (accounts);
+}
+
+static gboolean
+save_snapshot_cb (gpointer user_data)
+{
+  TpAccountManager *self = user_data;
+
+  self->priv->save_snapshot_id = 0;
+  _tp_account_manager_save_snapshot (self);
+  return FALSE;
+}
+
+static void
+_tp_account_manager_schedule_snapshot (TpAccountManager *self)
+{
+  if (!self->priv->use_snapshot || self->priv->dispose_run ||
+      !tp_proxy_is_prepared (self, TP_ACCOUNT_MANAGER_FEATURE_CORE))
+    return;
+
+  /* accounts often change several properties in quick succession, for
+   * instance while connecting, so there's no point in saving each time */
+  if (self->priv->save_snapshot_id == 0)
+    self->priv->save_snapshot_id = g_timeout_add_seconds (1,
+        save_snapshot_cb, self);
+}
+
+static void
+_tp_account_manager_load_snapshot (TpAccountManager *self)
+{
+  GVariant *snapshot;
+  GVariantIter iter;
+  const gchar *path;
+  GVariant *properties;
+
+  snapshot = _tp_account_snapshot_load (tp_proxy_get_bus_name (self));
+
+  if (snapshot == NULL)
+    return;
+
+  g_variant_iter_init (&iter, snapshot);
+
+  while (g_variant_iter_loop (&iter, "{&o@a{sv}}", &path, &properties))
+    {
+      TpAccount *account;
+      GError *error = NULL;
+
+      account = tp_simple_client_factory_ensure_account (
+          tp_proxy_get_factory (self), path, NULL, &error);
+
+      if (account == NULL)
+        {
+          DEBUG ("failed to create TpAccount: %s", error->message);
+          g_clear_error (&error);
+          continue;
+        }
+
+      _tp_account_apply_snapshot (account, properties);
+      g_hash_table_insert (self->priv->provisional_accounts,
+          g_strdup (path), account);
+    }
+
+  g_variant_unref (snapshot);
+}
+
 static void
 validity_changed_account_prepared_cb (GObject *object,
     GAsyncResult *res,
@@ -314,6 +510,7 @@ _tp_account_manager_validity_changed_cb (TpAccountManager *proxy,
           account, FALSE);
 
       g_object_unref (account);
+      _tp_account_manager_schedule_snapshot (manager);
 
       return;
     }
@@ -412,7 +609,10 @@ _tp_account_manager_check_core_ready (TpAccountManager *manager)
   if (tp_proxy_is_prepared (manager, TP_ACCOUNT_MANAGER_FEATURE_CORE))
     return;
 
-  if (priv->n_preparing_accounts > 0)
+  if (!priv->got_all)
+    return;
+
+  if (priv->n_preparing_accounts > 0 && !priv->progressive_preparation)
     return;
 
   /* Rerequest most available presence on the initial set of accounts for cases
@@ -427,42 +627,302 @@ _tp_account_manager_check_core_ready (TpAccountManager *manager)
 
   _tp_account_manager_update_most_available_presence (manager);
 
+  /* from now on, tp_account_manager_dup_provisional_accounts() returns the
+   * real accounts */
+  if (priv->provisional_accounts != NULL)
+    g_hash_table_remove_all (priv->provisional_accounts);
+
   _tp_proxy_set_feature_prepared ((TpProxy *) manager,
       TP_ACCOUNT_MANAGER_FEATURE_CORE, TRUE);
+
+  _tp_account_manager_schedule_snapshot (manager);
+}
+
+/*
+ * If the number of accounts being prepared at once is limited, each account
+ * in the initial ValidAccounts is prepared in two steps: first
+ * %TP_ACCOUNT_FEATURE_CORE alone, which tells us whether it's enabled and
+ * online, then the rest of the factory's features. Jobs waiting for a slot
+ * are kept in priv->preparation_queue, so that enabled and online accounts
+ * can jump the queue for their second step. If there is no limit, there is
+ * no queue to jump, so all the features are prepared in one step.
+ */
+
+typedef enum {
+    /* the second step, for accounts that are online */
+    PREPARATION_RANK_ONLINE,
+    /* the second step, for accounts that are enabled */
+    PREPARATION_RANK_ENABLED,
+    /* the first step, for any account */
+    PREPARATION_RANK_UNKNOWN,
+    /* the second step, for accounts that are disabled */
+    PREPARATION_RANK_DISABLED
+} PreparationRank;
+
+typedef struct {
+    /* borrowed: jobs don't outlive the manager's dispose, and the manager
+     * is reffed while a job is running */
+    TpAccountManager *manager;
+    TpAccount *account;
+    /* NULL for the first step; otherwise the factory's features */
+    GArray *features;
+    PreparationRank rank;
+    guint serial;
+} PreparationJob;
+
+static PreparationJob *
+preparation_job_new (TpAccountManager *self,
+    TpAccount *account)
+{
+  PreparationJob *job = g_slice_new0 (PreparationJob);
+
+  job->manager = self;
+  job->account = g_object_ref (account);
+  job->rank = PREPARATION_RANK_UNKNOWN;
+  job->serial = self->priv->next_job_serial++;
+  return job;
+}
+
+static void
+preparation_job_free (gpointer p)
+{
+  PreparationJob *job = p;
+
+  g_object_unref (job->account);
+  tp_clear_pointer (&job->features, g_array_unref);
+  g_slice_free (PreparationJob, job);
+}
+
+static gint
+preparation_job_cmp (gconstpointer a,
+    gconstpointer b)
+{
+  const PreparationJob *ja = a;
+  const PreparationJob *jb = b;
+
+  if (ja->rank != jb->rank)
+    return (ja->rank < jb->rank ? -1 : 1);
+
+  /* first come, first served */
+  if (ja->serial != jb->serial)
+    return (ja->serial < jb->serial ? -1 : 1);
+
+  return 0;
+}
+
+static void preparation_job_prepared_cb (GObject *object,
+    GAsyncResult *res,
+    gpointer user_data);
+
+static void
+_tp_account_manager_run_preparation_queue (TpAccountManager *self)
+{
+  TpAccountManagerPrivate *priv = self->priv;
+
+  while (tp_heap_size (priv->preparation_queue) > 0 &&
+      (priv->max_preparing_accounts == 0 ||
+       priv->n_running_jobs < priv->max_preparing_accounts))
+    {
+      PreparationJob *job = tp_heap_extract_first (priv->preparation_queue);
+      GQuark core_only[] = { 0, 0 };
+
+      core_only[0] = TP_ACCOUNT_FEATURE_CORE;
+
+      if (job->features == NULL && priv->max_preparing_accounts == 0)
+        job->features = tp_simple_client_factory_dup_account_features (
+            tp_proxy_get_factory (self), job->account);
+
+      DEBUG ("preparing %s (%s)",
+          tp_proxy_get_object_path (job->account),
+          job->features == NULL ? "core" : "all features");
+
+      /* the callback owns a ref to us, like any other async call */
+      g_object_ref (self);
+      priv->n_running_jobs++;
+      tp_proxy_prepare_async (job->account,
+          job->features == NULL ? core_only : (GQuark *) job->features->data,
+          preparation_job_prepared_cb, job);
+    }
 }
 
 static void
-account_prepared_cb (GObject *object,
+_tp_account_manager_preparation_job_done (TpAccountManager *self,
+    PreparationJob *job)
+{
+  TpAccountManagerPrivate *priv = self->priv;
+  TpAccount *account = job->account;
+
+  /* Account could have been invalidated while we were preparing it */
+  if (tp_account_is_valid (account) &&
+      tp_proxy_get_invalidated (account) == NULL)
+    {
+      DEBUG ("Account %s was prepared", tp_proxy_get_object_path (account));
+      insert_account (self, account);
+
+      if (tp_proxy_is_prepared (self, TP_ACCOUNT_MANAGER_FEATURE_CORE))
+        {
+          TpConnectionPresenceType old_presence;
+          TpConnectionPresenceType presence;
+          gchar *old_status, *status;
+          gchar *old_message, *message;
+
+          /* progressive preparation: the most available presence might
+           * have changed */
+          old_presence = tp_account_manager_get_most_available_presence (self,
+              &old_status, &old_message);
+          _tp_account_manager_update_most_available_presence (self);
+          presence = tp_account_manager_get_most_available_presence (self,
+              &status, &message);
+
+          if (presence != old_presence || tp_strdiff (status, old_status) ||
+              tp_strdiff (message, old_message))
+            g_signal_emit (self, signals[MOST_AVAILABLE_PRESENCE_CHANGED], 0,
+                presence, status, message);
+
+          g_free (old_status);
+          g_free (old_message);
+          g_free (status);
+          g_free (message);
+
+          g_signal_emit (self, signals[ACCOUNT_PREPARED], 0, account);
+        }
+    }
+
+  priv->n_preparing_accounts--;
+  preparation_job_free (job);
+}
+
+static void
+preparation_job_prepared_cb (GObject *object,
     GAsyncResult *res,
     gpointer user_data)
 {
-  TpAccountManager *self = user_data;
+  PreparationJob *job = user_data;
   TpAccount *account = (TpAccount *) object;
+  TpAccountManager *self = job->manager;
+  TpAccountManagerPrivate *priv = self->priv;
   GError *error = NULL;
+  guint i;
+
+  priv->n_running_jobs--;
+
+  if (priv->dispose_run)
+    {
+      preparation_job_free (job);
+      goto OUT;
+    }
 
   if (!tp_proxy_prepare_finish (object, res, &error))
     {
       DEBUG ("Error preparing account: %s", error->message);
       g_clear_error (&error);
-      goto OUT;
+      priv->n_preparing_accounts--;
+      preparation_job_free (job);
+      goto NEXT;
     }
 
-  /* Account could have been invalidated while we were preparing it */
-  if (tp_account_is_valid (account) &&
-      tp_proxy_get_invalidated (account) == NULL)
+  if (job->features != NULL)
     {
-      insert_account (self, account);
+      _tp_account_manager_preparation_job_done (self, job);
+      goto NEXT;
     }
 
-  DEBUG ("Account %s was prepared",
-      tp_proxy_get_object_path (object));
+  /* We've done the first step, and now know enough to decide how urgent
+   * the rest is */
+  job->features = tp_simple_client_factory_dup_account_features (
+      tp_proxy_get_factory (self), account);
 
-OUT:
-  self->priv->n_preparing_accounts--;
+  for (i = 0; i < job->features->len; i++)
+    {
+      if (!tp_proxy_is_prepared (account,
+            g_array_index (job->features, GQuark, i)))
+        break;
+    }
+
+  if (i == job->features->len)
+    {
+      /* nothing else to prepare */
+      _tp_account_manager_preparation_job_done (self, job);
+      goto NEXT;
+    }
+
+  if (tp_account_get_connection_status (account, NULL) ==
+      TP_CONNECTION_STATUS_CONNECTED)
+    job->rank = PREPARATION_RANK_ONLINE;
+  else if (tp_account_is_enabled (account))
+    job->rank = PREPARATION_RANK_ENABLED;
+  else
+    job->rank = PREPARATION_RANK_DISABLED;
+
+  tp_heap_add (priv->preparation_queue, job);
+
+NEXT:
+  _tp_account_manager_run_preparation_queue (self);
   _tp_account_manager_check_core_ready (self);
+
+OUT:
   g_object_unref (self);
 }
 
+static gboolean
+path_array_contains (const GPtrArray *paths,
+    const gchar *path)
+{
+  guint i;
+
+  if (paths == NULL)
+    return FALSE;
+
+  for (i = 0; i < paths->len; i++)
+    {
+      if (!tp_strdiff (g_ptr_array_index (paths, i), path))
+        return TRUE;
+    }
+
+  return FALSE;
+}
+
+/*
+ * Forget the provisional accounts from the snapshot which the real
+ * ValidAccounts doesn't include. If the account has been deleted since the
+ * snapshot was saved, invalidate it, so that anyone who was shown it by
+ * tp_account_manager_dup_provisional_accounts() finds out; if it has merely
+ * become invalid, the #TpAccount is still usable, and will get its real
+ * properties in the usual way.
+ */
+static void
+_tp_account_manager_drop_provisional_accounts (TpAccountManager *self,
+    const GPtrArray *valid_accounts,
+    const GPtrArray *invalid_accounts)
+{
+  GHashTableIter iter;
+  gpointer path, account;
+
+  g_hash_table_iter_init (&iter, self->priv->provisional_accounts);
+
+  while (g_hash_table_iter_next (&iter, &path, &account))
+    {
+      if (path_array_contains (valid_accounts, path))
+        continue;
+
+      if (!path_array_contains (invalid_accounts, path))
+        {
+          GError e = { TP_DBUS_ERRORS, TP_DBUS_ERROR_OBJECT_REMOVED,
+              "Account was removed after the snapshot was saved" };
+
+          DEBUG ("provisional account %s no longer exists", (gchar *) path);
+          tp_proxy_invalidate (account, &e);
+        }
+      else
+        {
+          DEBUG ("provisional account %s is no longer valid",
+              (gchar *) path);
+        }
+
+      g_hash_table_iter_remove (&iter);
+    }
+}
+
 static void
 _tp_account_manager_got_all_cb (TpProxy *proxy,
     GHashTable *properties,
@@ -488,7 +948,6 @@ _tp_account_manager_got_all_cb (TpProxy *proxy,
     {
       const gchar *path = g_ptr_array_index (valid_accounts, i);
       TpAccount *account;
-      GArray *features;
       GError *e = NULL;
 
       account = tp_simple_client_factory_ensure_account (
@@ -500,17 +959,18 @@ _tp_account_manager_got_all_cb (TpProxy *proxy,
           continue;
         }
 
-      features = tp_simple_client_factory_dup_account_features (
-          tp_proxy_get_factory (manager), account);
-
       manager->priv->n_preparing_accounts++;
-      tp_proxy_prepare_async (account, (GQuark *) features->data,
-          account_prepared_cb, g_object_ref (manager));
-
-      g_array_unref (features);
+      tp_heap_add (manager->priv->preparation_queue,
+          preparation_job_new (manager, account));
       g_object_unref (account);
     }
 
+  _tp_account_manager_drop_provisional_accounts (manager, valid_accounts,
+      tp_asv_get_boxed (properties, "InvalidAccounts",
+          TP_ARRAY_TYPE_OBJECT_PATH_LIST));
+
+  manager->priv->got_all = TRUE;
+  _tp_account_manager_run_preparation_queue (manager);
   _tp_account_manager_check_core_ready (manager);
 }
 
@@ -565,9 +1025,19 @@ _tp_account_manager_dispose (GObject *object)
   if (priv->dispose_run)
     return;
 
+  if (priv->save_snapshot_id != 0)
+    {
+      /* don't lose the last changes */
+      g_source_remove (priv->save_snapshot_id);
+      priv->save_snapshot_id = 0;
+      _tp_account_manager_save_snapshot (self);
+    }
+
   priv->dispose_run = TRUE;
 
   g_hash_table_unref (priv->accounts);
+  tp_clear_pointer (&priv->provisional_accounts, g_hash_table_unref);
+  tp_clear_pointer (&priv->preparation_queue, tp_heap_destroy);
 
   g_hash_table_iter_init (&iter, self->priv->legacy_accounts);
   while (g_hash_table_iter_next (&iter, NULL, &value))
@@ -594,11 +1064,74 @@ tp_account_manager_class_init (TpAccountManagerClass *klass)
   object_class->constructed = _tp_account_manager_constructed;
   object_class->finalize = _tp_account_manager_finalize;
   object_class->dispose = _tp_account_manager_dispose;
+  object_class->get_property = tp_account_manager_get_property;
+  object_class->set_property = tp_account_manager_set_property;
 
   proxy_class->interface = TP_IFACE_QUARK_ACCOUNT_MANAGER;
   proxy_class->list_features = _tp_account_manager_list_features;
   tp_account_manager_init_known_interfaces ();
 
+  /**
+   * TpAccountManager:max-preparing-accounts:
+   *
+   * The maximum number of accounts from the initial list of valid accounts
+   * that will be prepared at the same time while preparing
+   * %TP_ACCOUNT_MANAGER_FEATURE_CORE, or 0 for no limit.
+   *
+   * With a limit, accounts that are online, then accounts that are
+   * enabled, have the features requested by the #TpProxy:factory prepared
+   * before the others. This avoids making hundreds of D-Bus calls at once
+   * when there are many accounts.
+   *
+   * Since: 0.UNRELEASED
+   */
+  g_object_class_install_property (object_class, PROP_MAX_PREPARING_ACCOUNTS,
+      g_param_spec_uint ("max-preparing-accounts", "Max preparing accounts",
+        "Maximum number of accounts prepared concurrently, or 0",
+        0, G_MAXUINT, 0,
+        G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * TpAccountManager:progressive-preparation:
+   *
+   * If %TRUE, %TP_ACCOUNT_MANAGER_FEATURE_CORE is prepared as soon as
+   * the list of valid accounts has been retrieved, rather than when all
+   * of those accounts have been prepared. Each of them is then added to
+   * tp_account_manager_dup_valid_accounts() when it has been prepared, and
+   * #TpAccountManager::account-prepared is emitted.
+   *
+   * This must be set before %TP_ACCOUNT_MANAGER_FEATURE_CORE has been
+   * prepared to have any effect.
+   *
+   * Since: 0.UNRELEASED
+   */
+  g_object_class_install_property (object_class, PROP_PROGRESSIVE_PREPARATION,
+      g_param_spec_boolean ("progressive-preparation",
+        "Progressive preparation",
+        "If TRUE, the core feature doesn't wait for accounts to be prepared",
+        FALSE,
+        G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * TpAccountManager:use-snapshot:
+   *
+   * If %TRUE, the properties of valid accounts are saved in a snapshot
+   * under the user's cache directory whenever they change, and the snapshot
+   * saved by an earlier process is used to provide provisional accounts
+   * until %TP_ACCOUNT_MANAGER_FEATURE_CORE has been prepared. See
+   * tp_account_manager_dup_provisional_accounts() and
+   * tp_account_is_provisional().
+   *
+   * Account parameters are not saved, since they might contain passwords.
+   *
+   * Since: 0.UNRELEASED
+   */
+  g_object_class_install_property (object_class, PROP_USE_SNAPSHOT,
+      g_param_spec_boolean ("use-snapshot", "Use snapshot",
+        "If TRUE, account properties are saved to disk for the next process",
+        FALSE,
+        G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * TpAccountManager::account-validity-changed:
    * @manager: a #TpAccountManager
@@ -701,6 +1234,32 @@ tp_account_manager_class_init (TpAccountManagerClass *klass)
         3, G_TYPE_UINT, /* Presence type */
         G_TYPE_STRING,  /* status */
         G_TYPE_STRING); /* stauts message*/
+
+  /**
+   * TpAccountManager::account-prepared:
+   * @manager: a #TpAccountManager
+   * @account: a #TpAccount
+   *
+   * Emitted when one of the accounts that were valid when @manager was
+   * created has been prepared, after %TP_ACCOUNT_MANAGER_FEATURE_CORE
+   * was prepared. This only happens if
+   * #TpAccountManager:progressive-preparation is %TRUE; otherwise, all such
+   * accounts are ready by the time the feature is prepared.
+   *
+   * @account is guaranteed to have %TP_ACCOUNT_FEATURE_CORE prepared, along
+   * with all the features previously passed to the #TpProxy:factory<!-- -->'s
+   * tp_simple_client_factory_add_account_features(), and to be in
+   * tp_account_manager_dup_valid_accounts().
+   *
+   * Since: 0.UNRELEASED
+   */
+  signals[ACCOUNT_PREPARED] = g_signal_new ("account-prepared",
+      G_TYPE_FROM_CLASS (klass),
+      G_SIGNAL_RUN_LAST,
+      0,
+      NULL, NULL, NULL,
+      G_TYPE_NONE,
+      1, TP_TYPE_ACCOUNT);
 }
 
 /**
@@ -990,6 +1549,8 @@ _tp_account_manager_account_invalidated_cb (TpProxy *proxy,
 
   g_signal_emit (manager, signals[ACCOUNT_REMOVED], 0, account);
   g_object_unref (account);
+
+  _tp_account_manager_schedule_snapshot (manager);
 }
 
 static void
@@ -1005,6 +1566,14 @@ legacy_account_invalidated_cb (TpProxy *account,
       tp_proxy_get_object_path (account));
 }
 
+static void
+_tp_account_manager_account_notify_cb (TpAccount *account,
+    GParamSpec *pspec,
+    gpointer manager)
+{
+  _tp_account_manager_schedule_snapshot (manager);
+}
+
 static void
 insert_account (TpAccountManager *self,
     TpAccount *account)
@@ -1034,6 +1603,12 @@ insert_account (TpAccountManager *self,
   tp_g_signal_connect_object (account, "invalidated",
       G_CALLBACK (_tp_account_manager_account_invalidated_cb),
       G_OBJECT (self), 0);
+
+  tp_g_signal_connect_object (account, "notify",
+      G_CALLBACK (_tp_account_manager_account_notify_cb),
+      G_OBJECT (self), 0);
+
+  _tp_account_manager_schedule_snapshot (self);
 }
 
 /**
@@ -1307,6 +1882,209 @@ tp_account_manager_get_most_available_presence (TpAccountManager *manager,
   return priv->most_available_presence;
 }
 
+/**
+ * tp_account_manager_set_max_preparing_accounts:
+ * @manager: a #TpAccountManager
+ * @max: the new value of #TpAccountManager:max-preparing-accounts
+ *
+ * Limit how many accounts are prepared at the same time while preparing
+ * %TP_ACCOUNT_MANAGER_FEATURE_CORE. This should usually be called just
+ * after @manager is created.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_account_manager_set_max_preparing_accounts (TpAccountManager *manager,
+    guint max)
+{
+  g_return_if_fail (TP_IS_ACCOUNT_MANAGER (manager));
+
+  if (manager->priv->max_preparing_accounts == max)
+    return;
+
+  manager->priv->max_preparing_accounts = max;
+
+  /* the limit might have been raised */
+  if (manager->priv->preparation_queue != NULL)
+    _tp_account_manager_run_preparation_queue (manager);
+
+  g_object_notify ((GObject *) manager, "max-preparing-accounts");
+}
+
+/**
+ * tp_account_manager_get_max_preparing_accounts:
+ * @manager: a #TpAccountManager
+ *
+ * <!-- -->
+ *
+ * Returns: the value of #TpAccountManager:max-preparing-accounts
+ *
+ * Since: 0.UNRELEASED
+ */
+guint
+tp_account_manager_get_max_preparing_accounts (TpAccountManager *manager)
+{
+  g_return_val_if_fail (TP_IS_ACCOUNT_MANAGER (manager), 0);
+
+  return manager->priv->max_preparing_accounts;
+}
+
+/**
+ * tp_account_manager_set_progressive_preparation:
+ * @manager: a #TpAccountManager
+ * @progressive: the new value of #TpAccountManager:progressive-preparation
+ *
+ * Set whether %TP_ACCOUNT_MANAGER_FEATURE_CORE is prepared without
+ * waiting for each account to be prepared. This should be called just after
+ * @manager is created.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_account_manager_set_progressive_preparation (TpAccountManager *manager,
+    gboolean progressive)
+{
+  g_return_if_fail (TP_IS_ACCOUNT_MANAGER (manager));
+
+  progressive = !!progressive;
+
+  if (manager->priv->progressive_preparation == progressive)
+    return;
+
+  manager->priv->progressive_preparation = progressive;
+
+  if (!manager->priv->dispose_run)
+    _tp_account_manager_check_core_ready (manager);
+
+  g_object_notify ((GObject *) manager, "progressive-preparation");
+}
+
+/**
+ * tp_account_manager_get_progressive_preparation:
+ * @manager: a #TpAccountManager
+ *
+ * <!-- -->
+ *
+ * Returns: the value of #TpAccountManager:progressive-preparation
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_account_manager_get_progressive_preparation (TpAccountManager *manager)
+{
+  g_return_val_if_fail (TP_IS_ACCOUNT_MANAGER (manager), FALSE);
+
+  return manager->priv->progressive_preparation;
+}
+
+/**
+ * tp_account_manager_set_use_snapshot:
+ * @manager: a #TpAccountManager
+ * @use_snapshot: the new value of #TpAccountManager:use-snapshot
+ *
+ * Set whether @manager saves a snapshot of its accounts' properties, and
+ * uses the snapshot saved by an earlier process. If this is set to %TRUE
+ * before %TP_ACCOUNT_MANAGER_FEATURE_CORE has been prepared, which is
+ * usually just after @manager is created, the snapshot is loaded
+ * immediately.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_account_manager_set_use_snapshot (TpAccountManager *manager,
+    gboolean use_snapshot)
+{
+  TpAccountManagerPrivate *priv;
+
+  g_return_if_fail (TP_IS_ACCOUNT_MANAGER (manager));
+  priv = manager->priv;
+
+  use_snapshot = !!use_snapshot;
+
+  if (priv->use_snapshot == use_snapshot || priv->dispose_run)
+    return;
+
+  priv->use_snapshot = use_snapshot;
+
+  if (!use_snapshot)
+    {
+      g_hash_table_remove_all (priv->provisional_accounts);
+
+      if (priv->save_snapshot_id != 0)
+        {
+          g_source_remove (priv->save_snapshot_id);
+          priv->save_snapshot_id = 0;
+        }
+    }
+  else if (!tp_proxy_is_prepared (manager, TP_ACCOUNT_MANAGER_FEATURE_CORE))
+    {
+      _tp_account_manager_load_snapshot (manager);
+    }
+  else
+    {
+      _tp_account_manager_schedule_snapshot (manager);
+    }
+
+  g_object_notify ((GObject *) manager, "use-snapshot");
+}
+
+/**
+ * tp_account_manager_get_use_snapshot:
+ * @manager: a #TpAccountManager
+ *
+ * <!-- -->
+ *
+ * Returns: the value of #TpAccountManager:use-snapshot
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_account_manager_get_use_snapshot (TpAccountManager *manager)
+{
+  g_return_val_if_fail (TP_IS_ACCOUNT_MANAGER (manager), FALSE);
+
+  return manager->priv->use_snapshot;
+}
+
+/**
+ * tp_account_manager_dup_provisional_accounts:
+ * @manager: a #TpAccountManager
+ *
+ * Return the accounts that are expected to be valid. Before
+ * %TP_ACCOUNT_MANAGER_FEATURE_CORE has been prepared, these are the valid
+ * accounts from the snapshot saved by an earlier process, if
+ * #TpAccountManager:use-snapshot is %TRUE. Their properties are provisional
+ * (see tp_account_is_provisional()), and none of their features are
+ * prepared, but they are the same objects that the #TpProxy:factory will
+ * return later.
+ *
+ * Once the account manager has said which accounts are really valid,
+ * accounts from the snapshot which are no longer valid are no longer
+ * included; those which have been deleted are invalidated with
+ * %TP_DBUS_ERROR_OBJECT_REMOVED. Once %TP_ACCOUNT_MANAGER_FEATURE_CORE has
+ * been prepared, this returns the same as
+ * tp_account_manager_dup_valid_accounts().
+ *
+ * Returns: (transfer full) (element-type TelepathyGLib.Account): a list
+ *  of #TpAccount
+ *
+ * Since: 0.UNRELEASED
+ */
+GList *
+tp_account_manager_dup_provisional_accounts (TpAccountManager *manager)
+{
+  GList *ret;
+
+  g_return_val_if_fail (TP_IS_ACCOUNT_MANAGER (manager), NULL);
+
+  if (tp_proxy_is_prepared (manager, TP_ACCOUNT_MANAGER_FEATURE_CORE))
+    return tp_account_manager_dup_valid_accounts (manager);
+
+  ret = g_hash_table_get_values (manager->priv->provisional_accounts);
+  g_list_foreach (ret, (GFunc) g_object_ref, NULL);
+  return ret;
+}
+
 static void
 create_account_prepared_cb (GObject *object,
     GAsyncResult *res,
@@ -112,6 +112,27 @@ void tp_account_manager_set_all_requested_presences (TpAccountManager *manager,
 TpConnectionPresenceType tp_account_manager_get_most_available_presence (
     TpAccountManager *manager, gchar **status, gchar **message);
 
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_account_manager_set_max_preparing_accounts (TpAccountManager *manager,
+    guint max);
+_TP_AVAILABLE_IN_UNRELEASED
+guint tp_account_manager_get_max_preparing_accounts (
+    TpAccountManager *manager);
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_account_manager_set_progressive_preparation (
+    TpAccountManager *manager, gboolean progressive);
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_account_manager_get_progressive_preparation (
+    TpAccountManager *manager);
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_account_manager_set_use_snapshot (TpAccountManager *manager,
+    gboolean use_snapshot);
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_account_manager_get_use_snapshot (TpAccountManager *manager);
+_TP_AVAILABLE_IN_UNRELEASED
+GList *tp_account_manager_dup_provisional_accounts (TpAccountManager *manager)
+  G_GNUC_WARN_UNUSED_RESULT;
+
 void tp_account_manager_create_account_async (TpAccountManager *manager,
     const gchar *connection_manager, const gchar *protocol,
     const gchar *display_name, GHashTable *parameters, GHashTable *properties,
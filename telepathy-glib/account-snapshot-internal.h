@@ -0,0 +1,38 @@
+/*<private_header>*/
+/* On-disk snapshot of account properties - internal header
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef TP_ACCOUNT_SNAPSHOT_INTERNAL_H
+#define TP_ACCOUNT_SNAPSHOT_INTERNAL_H
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+/* the type of a snapshot: object path => Account properties */
+#define _TP_ACCOUNT_SNAPSHOT_TYPE ((const GVariantType *) "a{oa{sv}}")
+
+GVariant *_tp_account_snapshot_load (const gchar *bus_name);
+
+void _tp_account_snapshot_save (const gchar *bus_name,
+    GVariant *accounts);
+
+G_END_DECLS
+
+#endif
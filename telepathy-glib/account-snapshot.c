@@ -0,0 +1,181 @@
+/*
+ * account-snapshot.c - on-disk snapshot of account properties
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "config.h"
+
+#include "telepathy-glib/account-snapshot-internal.h"
+
+#include <errno.h>
+
+#include <glib/gstdio.h>
+
+#define DEBUG_FLAG TP_DEBUG_ACCOUNTS
+#include "telepathy-glib/debug-internal.h"
+
+/*
+ * If TpAccountManager:use-snapshot is set, the properties of each valid
+ * account are saved under $XDG_CACHE_HOME/telepathy/accounts whenever they
+ * change, so that the next process to use the same account manager can
+ * show them before the account manager has replied to it.
+ *
+ * Each snapshot file holds a single GVariant of type SNAPSHOT_TYPE:
+ *
+ * - the version of this format, SNAPSHOT_VERSION
+ * - the well-known bus name of the account manager
+ * - the Account properties of each valid account, keyed by object path
+ *
+ * A snapshot is only ever used as a hint: everything in it is replaced
+ * by the account manager's replies.
+ */
+
+/* Increment this whenever SNAPSHOT_TYPE or the meaning of its contents
+ * changes. */
+#define SNAPSHOT_VERSION 1
+
+#define SNAPSHOT_TYPE ((const GVariantType *) "(usa{oa{sv}})")
+
+static gchar *
+snapshot_path_for (const gchar *bus_name)
+{
+  gchar *basename;
+  gchar *path;
+
+  basename = g_strdup_printf ("%s.snapshot", bus_name);
+  path = g_build_filename (g_get_user_cache_dir (), "telepathy", "accounts",
+      basename, NULL);
+
+  g_free (basename);
+  return path;
+}
+
+/*
+ * _tp_account_snapshot_load:
+ * @bus_name: the well-known name of an account manager
+ *
+ * Returns: (transfer full): a #GVariant of type %_TP_ACCOUNT_SNAPSHOT_TYPE,
+ *  or %NULL if there is no usable snapshot
+ */
+GVariant *
+_tp_account_snapshot_load (const gchar *bus_name)
+{
+  gchar *path = snapshot_path_for (bus_name);
+  gchar *contents = NULL;
+  gsize length;
+  GBytes *bytes;
+  GVariant *snapshot;
+  GVariant *ret = NULL;
+  GError *error = NULL;
+  guint32 version;
+  const gchar *name;
+
+  /* the snapshot is small, and we'll be replacing it soon, so there's no
+   * point in mapping it */
+  if (!g_file_get_contents (path, &contents, &length, &error))
+    {
+      DEBUG ("no snapshot for %s: %s", bus_name, error->message);
+      g_clear_error (&error);
+      goto finally;
+    }
+
+  bytes = g_bytes_new_take (contents, length);
+
+  /* The file isn't trusted: GVariant will cope with it being truncated or
+   * corrupt, by returning default values. */
+  snapshot = g_variant_ref_sink (g_variant_new_from_bytes (SNAPSHOT_TYPE,
+        bytes, FALSE));
+  g_bytes_unref (bytes);
+
+  g_variant_get_child (snapshot, 0, "u", &version);
+  g_variant_get_child (snapshot, 1, "&s", &name);
+
+  if (version != SNAPSHOT_VERSION || g_strcmp0 (name, bus_name) != 0)
+    {
+      DEBUG ("ignoring snapshot for %s (version %u)", bus_name, version);
+    }
+  else
+    {
+      ret = g_variant_get_child_value (snapshot, 2);
+      DEBUG ("loaded snapshot of %" G_GSIZE_FORMAT " accounts from %s",
+          g_variant_n_children (ret), path);
+    }
+
+  g_variant_unref (snapshot);
+
+finally:
+  g_free (path);
+  return ret;
+}
+
+/*
+ * _tp_account_snapshot_save:
+ * @bus_name: the well-known name of an account manager
+ * @accounts: a #GVariant of type %_TP_ACCOUNT_SNAPSHOT_TYPE
+ *
+ * Replace the snapshot for @bus_name.
+ *
+ * Failure to write the snapshot is not an error, since it only makes the
+ * next client start up more slowly.
+ */
+void
+_tp_account_snapshot_save (const gchar *bus_name,
+    GVariant *accounts)
+{
+  gchar *path;
+  gchar *dir;
+  GVariant *snapshot;
+  GError *error = NULL;
+
+  g_return_if_fail (g_variant_is_of_type (accounts,
+        _TP_ACCOUNT_SNAPSHOT_TYPE));
+
+  path = snapshot_path_for (bus_name);
+  dir = g_path_get_dirname (path);
+
+  /* display names, nicknames and status messages are personal, so keep
+   * them private */
+  if (g_mkdir_with_parents (dir, 0700) != 0)
+    {
+      DEBUG ("unable to create %s: %s", dir, g_strerror (errno));
+      goto finally;
+    }
+
+  snapshot = g_variant_ref_sink (g_variant_new ("(us@a{oa{sv}})",
+        (guint32) SNAPSHOT_VERSION, bus_name, accounts));
+
+  /* this writes to a temporary file and renames it, so concurrent readers
+   * never see a partial snapshot */
+  if (!g_file_set_contents (path, g_variant_get_data (snapshot),
+        g_variant_get_size (snapshot), &error))
+    {
+      DEBUG ("unable to write %s: %s", path, error->message);
+      g_clear_error (&error);
+    }
+  else
+    {
+      DEBUG ("saved snapshot of %" G_GSIZE_FORMAT " accounts to %s",
+          g_variant_n_children (accounts), path);
+    }
+
+  g_variant_unref (snapshot);
+
+finally:
+  g_free (dir);
+  g_free (path);
+}
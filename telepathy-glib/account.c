@@ -141,6 +141,10 @@ struct _TpAccountPrivate {
   GStrv uri_schemes;
 
   gboolean connection_prepared;
+
+  /* TRUE if our properties came from _tp_account_apply_snapshot() and we
+   * haven't had the account manager's reply yet */
+  gboolean provisional;
 };
 
 G_DEFINE_TYPE (TpAccount, tp_account, TP_TYPE_PROXY)
@@ -623,7 +627,7 @@ tp_account_prepare_storage_async (TpProxy *proxy,
 }
 
 static void
-_tp_account_update (TpAccount *account,
+_tp_account_apply_properties (TpAccount *account,
     GHashTable *properties)
 {
   TpProxy *proxy = TP_PROXY (account);
@@ -989,8 +993,16 @@ _tp_account_update (TpAccount *account,
       if (old != priv->has_been_online)
         g_object_notify (G_OBJECT (account), "has-been-online");
     }
+}
 
-  _tp_proxy_set_feature_prepared (proxy, TP_ACCOUNT_FEATURE_CORE, TRUE);
+static void
+_tp_account_update (TpAccount *account,
+    GHashTable *properties)
+{
+  _tp_account_apply_properties (account, properties);
+  account->priv->provisional = FALSE;
+  _tp_proxy_set_feature_prepared ((TpProxy *) account,
+      TP_ACCOUNT_FEATURE_CORE, TRUE);
 }
 
 static void
@@ -3872,6 +3884,179 @@ _tp_account_refresh_properties (TpAccount *account)
       _tp_account_got_all_cb, NULL, NULL, G_OBJECT (account));
 }
 
+/* The properties which are saved in a snapshot by _tp_account_dup_snapshot(),
+ * and their types. Parameters are deliberately not included, since they
+ * might contain passwords; nor is Connection, which is only meaningful
+ * while the connection exists. */
+static const struct {
+    const gchar *name;
+    const gchar *type;
+} snapshot_properties[] = {
+    { "DisplayName", "s" },
+    { "Icon", "s" },
+    { "Nickname", "s" },
+    { "NormalizedName", "s" },
+    { "Service", "s" },
+    { "Enabled", "b" },
+    { "Valid", "b" },
+    { "ConnectAutomatically", "b" },
+    { "HasBeenOnline", "b" },
+    { "ChangingPresence", "b" },
+    { "ConnectionStatus", "u" },
+    { "ConnectionStatusReason", "u" },
+    { "ConnectionError", "s" },
+    { "ConnectionErrorDetails", "a{sv}" },
+    { "CurrentPresence", "(uss)" },
+    { "RequestedPresence", "(uss)" },
+    { "AutomaticPresence", "(uss)" },
+    { "Supersedes", "ao" },
+    { NULL }
+};
+
+/*
+ * _tp_account_dup_snapshot:
+ * @account: a #TpAccount with %TP_ACCOUNT_FEATURE_CORE prepared
+ *
+ * Returns: (transfer full): the properties of @account that are suitable for
+ *  _tp_account_apply_snapshot(), as a #GVariant of type
+ *  %G_VARIANT_TYPE_VARDICT
+ */
+GVariant *
+_tp_account_dup_snapshot (TpAccount *account)
+{
+  TpAccountPrivate *priv;
+  static const gchar * const no_supersedes[] = { NULL };
+  GVariantBuilder builder;
+  GVariant *details;
+
+  g_return_val_if_fail (TP_IS_ACCOUNT (account), NULL);
+  priv = account->priv;
+
+  g_variant_builder_init (&builder, G_VARIANT_TYPE_VARDICT);
+
+#define ADD(name, format, value) \
+  g_variant_builder_add (&builder, "{sv}", name, \
+      g_variant_new (format, value))
+
+  ADD ("DisplayName", "s", tp_str_empty (priv->display_name) ? "" :
+      priv->display_name);
+  ADD ("Icon", "s", tp_str_empty (priv->icon_name) ? "" : priv->icon_name);
+  ADD ("Nickname", "s", tp_str_empty (priv->nickname) ? "" :
+      priv->nickname);
+  ADD ("NormalizedName", "s", tp_str_empty (priv->normalized_name) ? "" :
+      priv->normalized_name);
+  ADD ("Service", "s", tp_str_empty (priv->service) ? "" : priv->service);
+  ADD ("Enabled", "b", priv->enabled);
+  ADD ("Valid", "b", priv->valid);
+  ADD ("ConnectAutomatically", "b", priv->connect_automatically);
+  ADD ("HasBeenOnline", "b", priv->has_been_online);
+  ADD ("ChangingPresence", "b", priv->changing_presence);
+  ADD ("ConnectionStatus", "u", priv->connection_status);
+  ADD ("ConnectionStatusReason", "u", priv->reason);
+  ADD ("ConnectionError", "s", priv->error == NULL ? "" : priv->error);
+  ADD ("Supersedes", "^ao", priv->supersedes == NULL ?
+      (gchar **) no_supersedes : priv->supersedes);
+
+#undef ADD
+
+  details = _tp_asv_to_vardict (priv->error_details);
+  g_variant_builder_add (&builder, "{sv}", "ConnectionErrorDetails",
+      details);
+  g_variant_unref (details);
+
+  g_variant_builder_add (&builder, "{sv}", "CurrentPresence",
+      g_variant_new ("(uss)", priv->cur_presence,
+        priv->cur_status == NULL ? "" : priv->cur_status,
+        priv->cur_message == NULL ? "" : priv->cur_message));
+  g_variant_builder_add (&builder, "{sv}", "RequestedPresence",
+      g_variant_new ("(uss)", priv->requested_presence,
+        priv->requested_status == NULL ? "" : priv->requested_status,
+        priv->requested_message == NULL ? "" : priv->requested_message));
+  g_variant_builder_add (&builder, "{sv}", "AutomaticPresence",
+      g_variant_new ("(uss)", priv->auto_presence,
+        priv->auto_status == NULL ? "" : priv->auto_status,
+        priv->auto_message == NULL ? "" : priv->auto_message));
+
+  return g_variant_ref_sink (g_variant_builder_end (&builder));
+}
+
+/*
+ * _tp_account_apply_snapshot:
+ * @account: a #TpAccount
+ * @snapshot: a #GVariant of type %G_VARIANT_TYPE_VARDICT, as returned by
+ *  _tp_account_dup_snapshot() in this or an earlier process
+ *
+ * If the account manager hasn't told us about @account yet, use @snapshot
+ * as provisional values for its properties. They will be replaced, with
+ * change notification, when %TP_ACCOUNT_FEATURE_CORE is prepared.
+ *
+ * Anything in @snapshot which doesn't have the expected type is ignored.
+ */
+void
+_tp_account_apply_snapshot (TpAccount *account,
+    GVariant *snapshot)
+{
+  GVariantBuilder builder;
+  GVariant *filtered;
+  GHashTable *properties;
+  guint i;
+
+  g_return_if_fail (TP_IS_ACCOUNT (account));
+  g_return_if_fail (g_variant_is_of_type (snapshot, G_VARIANT_TYPE_VARDICT));
+
+  if (tp_proxy_is_prepared (account, TP_ACCOUNT_FEATURE_CORE) ||
+      tp_proxy_get_invalidated (account) != NULL)
+    return;
+
+  g_variant_builder_init (&builder, G_VARIANT_TYPE_VARDICT);
+
+  for (i = 0; snapshot_properties[i].name != NULL; i++)
+    {
+      GVariant *value = g_variant_lookup_value (snapshot,
+          snapshot_properties[i].name,
+          G_VARIANT_TYPE (snapshot_properties[i].type));
+
+      if (value != NULL)
+        g_variant_builder_add (&builder, "{s@v}", snapshot_properties[i].name,
+            g_variant_new_variant (value));
+
+      tp_clear_pointer (&value, g_variant_unref);
+    }
+
+  filtered = g_variant_ref_sink (g_variant_builder_end (&builder));
+  properties = _tp_asv_from_vardict (filtered);
+  g_variant_unref (filtered);
+
+  DEBUG ("%s: using %u provisional properties",
+      tp_proxy_get_object_path (account), g_hash_table_size (properties));
+
+  account->priv->provisional = TRUE;
+  _tp_account_apply_properties (account, properties);
+  g_hash_table_unref (properties);
+}
+
+/**
+ * tp_account_is_provisional:
+ * @account: a #TpAccount
+ *
+ * Return whether @account's properties are provisional values, taken from
+ * a snapshot saved by an earlier process (see
+ * #TpAccountManager:use-snapshot). This is the case until
+ * %TP_ACCOUNT_FEATURE_CORE has been prepared, at which point the properties
+ * are updated from the account manager, and notified if they changed.
+ *
+ * Returns: %TRUE if @account's properties are provisional
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_account_is_provisional (TpAccount *account)
+{
+  g_return_val_if_fail (TP_IS_ACCOUNT (account), FALSE);
+
+  return account->priv->provisional;
+}
+
 /**
  * tp_account_set_avatar_finish:
  * @self: a #TpAccount
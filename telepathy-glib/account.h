@@ -209,6 +209,9 @@ gboolean tp_account_set_connect_automatically_finish (TpAccount *account,
 
 gboolean tp_account_get_has_been_online (TpAccount *account);
 
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_account_is_provisional (TpAccount *account);
+
 TpConnectionStatus tp_account_get_connection_status (TpAccount *account,
     TpConnectionStatusReason *reason);
 
@@ -0,0 +1,48 @@
+/*<private_header>*/
+/* Allocation counters - internal header
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef TP_ALLOCATION_STATISTICS_INTERNAL_H
+#define TP_ALLOCATION_STATISTICS_INTERNAL_H
+
+#include <glib-object.h>
+
+#include <telepathy-glib/allocation-statistics.h>
+
+G_BEGIN_DECLS
+
+/* @name must be a static string. Returns TRUE if the instance was counted,
+ * in which case _tp_allocation_statistics_freed() must be called when it is
+ * freed, even if statistics have been disabled since. */
+gboolean _tp_allocation_statistics_created (const gchar *name);
+void _tp_allocation_statistics_freed (const gchar *name);
+
+/* the same, for instances that can't remember whether they were counted:
+ * only the total is counted, and their live and peak counts stay at 0 */
+void _tp_allocation_statistics_allocated (const gchar *name);
+
+/* the same, counting @object under the name of its concrete type */
+gboolean _tp_allocation_statistics_object_created (gpointer object);
+void _tp_allocation_statistics_object_freed (gpointer object);
+
+GPtrArray *_tp_allocation_statistics_dup_value_arrays (void);
+
+G_END_DECLS
+
+#endif
@@ -0,0 +1,324 @@
+/*
+ * allocation-statistics.c - live and total counts of Telepathy objects
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "config.h"
+
+#include "telepathy-glib/allocation-statistics.h"
+#include "telepathy-glib/allocation-statistics-internal.h"
+
+#include <telepathy-glib/util.h>
+
+#define DEBUG_FLAG TP_DEBUG_MISC
+#include "telepathy-glib/debug-internal.h"
+
+/**
+ * SECTION:allocation-statistics
+ * @title: Allocation statistics
+ * @short_description: count the Telepathy objects a process creates and
+ *  frees
+ * @see_also: #TpDebugSender
+ *
+ * While enabled, telepathy-glib counts how many instances of its busiest
+ * types are alive, the most that have been alive at once, and how many have
+ * been created in total: every #TpProxy subclass (such as #TpConnection and
+ * #TpChannel and their subclasses), #TpContact, every #TpMessage subclass
+ * (such as #TpCMMessage) and #TpProxySignalConnection. Each type is counted
+ * under its own name, so a #TpTextChannel is not also counted as a
+ * #TpChannel. The #GValue<!-- -->s allocated by tp_g_value_slice_new() and
+ * friends are counted too, but only their total: a #GValue can't remember
+ * whether it was counted, and can be freed with g_slice_free(), so its
+ * live and peak counts are always 0.
+ *
+ * A live count that keeps growing suggests a leak; a total that grows much
+ * faster than the live count shows churn. The same statistics are
+ * available to other processes through the AllocationStatistics interface
+ * of the #TpDebugSender object, so a long-running client can be examined
+ * without valgrind.
+ *
+ * Collection is off by default; while it is off, creating or freeing one
+ * of these instances costs one extra atomic read. Only instances created
+ * while it is on are counted, so it is best turned on early.
+ *
+ * Since: 0.UNRELEASED
+ */
+
+typedef struct {
+    /* static */
+    const gchar *name;
+    guint live;
+    guint peak;
+    guint64 total;
+} TypeCounts;
+
+static volatile gint enabled = FALSE;
+
+/* protects the counts */
+G_LOCK_DEFINE_STATIC (counts);
+/* static string => owned TypeCounts */
+static GHashTable *counts = NULL;
+
+/**
+ * tp_allocation_statistics_set_enabled:
+ * @enable: whether to count instances
+ *
+ * Start or stop counting instances of the types listed above. The counts
+ * are kept when this is set to %FALSE, and instances that were counted are
+ * still counted when they are freed.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_allocation_statistics_set_enabled (gboolean enable)
+{
+  g_atomic_int_set (&enabled, !!enable);
+  DEBUG ("%s allocations", enable ? "counting" : "stopped counting");
+}
+
+/**
+ * tp_allocation_statistics_get_enabled:
+ *
+ * <!-- -->
+ *
+ * Returns: %TRUE if instances are being counted, as set by
+ *  tp_allocation_statistics_set_enabled()
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_allocation_statistics_get_enabled (void)
+{
+  return g_atomic_int_get (&enabled);
+}
+
+/**
+ * tp_allocation_statistics_dup_snapshot:
+ *
+ * Return the counts so far, as an array of one tuple per type, of type
+ * <code>a(suut)</code>. The members of each tuple are the name of the
+ * type, the number of counted instances that are alive, the largest number
+ * that have been alive at once since the counts were last reset, and the
+ * number that have been created since then.
+ *
+ * Returns: (transfer full): a new non-floating #GVariant
+ *
+ * Since: 0.UNRELEASED
+ */
+GVariant *
+tp_allocation_statistics_dup_snapshot (void)
+{
+  GVariantBuilder builder;
+  GHashTableIter iter;
+  gpointer v;
+
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a(suut)"));
+
+  G_LOCK (counts);
+
+  if (counts != NULL)
+    {
+      g_hash_table_iter_init (&iter, counts);
+
+      while (g_hash_table_iter_next (&iter, NULL, &v))
+        {
+          TypeCounts *c = v;
+
+          g_variant_builder_add (&builder, "(suut)", c->name, c->live,
+              c->peak, c->total);
+        }
+    }
+
+  G_UNLOCK (counts);
+
+  return g_variant_ref_sink (g_variant_builder_end (&builder));
+}
+
+/**
+ * tp_allocation_statistics_reset:
+ *
+ * Start a new period of counting: set the peak number of instances of each
+ * type to the number that are alive now, and the total number created to
+ * zero. The live counts are not changed.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_allocation_statistics_reset (void)
+{
+  GHashTableIter iter;
+  gpointer v;
+
+  G_LOCK (counts);
+
+  if (counts != NULL)
+    {
+      g_hash_table_iter_init (&iter, counts);
+
+      while (g_hash_table_iter_next (&iter, NULL, &v))
+        {
+          TypeCounts *c = v;
+
+          c->peak = c->live;
+          c->total = 0;
+        }
+    }
+
+  G_UNLOCK (counts);
+}
+
+static void
+type_counts_free (gpointer p)
+{
+  g_slice_free (TypeCounts, p);
+}
+
+static gboolean
+count_created (const gchar *name,
+    gboolean track_live)
+{
+  TypeCounts *c;
+
+  if (!g_atomic_int_get (&enabled))
+    return FALSE;
+
+  G_LOCK (counts);
+
+  if (G_UNLIKELY (counts == NULL))
+    counts = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
+        type_counts_free);
+
+  c = g_hash_table_lookup (counts, name);
+
+  if (c == NULL)
+    {
+      c = g_slice_new0 (TypeCounts);
+      c->name = name;
+      g_hash_table_insert (counts, (gchar *) name, c);
+    }
+
+  c->total++;
+
+  if (track_live)
+    {
+      c->live++;
+
+      if (c->live > c->peak)
+        c->peak = c->live;
+    }
+
+  G_UNLOCK (counts);
+
+  return TRUE;
+}
+
+gboolean
+_tp_allocation_statistics_created (const gchar *name)
+{
+  return count_created (name, TRUE);
+}
+
+void
+_tp_allocation_statistics_allocated (const gchar *name)
+{
+  count_created (name, FALSE);
+}
+
+void
+_tp_allocation_statistics_freed (const gchar *name)
+{
+  TypeCounts *c = NULL;
+  gboolean ok = FALSE;
+
+  G_LOCK (counts);
+
+  if (counts != NULL)
+    c = g_hash_table_lookup (counts, name);
+
+  if (c != NULL && c->live > 0)
+    {
+      c->live--;
+      ok = TRUE;
+    }
+
+  G_UNLOCK (counts);
+
+  /* everything freed here was counted when it was created, so this can
+   * only fail if the caller got it wrong */
+  if (!ok)
+    CRITICAL ("freed an uncounted %s", name);
+}
+
+gboolean
+_tp_allocation_statistics_object_created (gpointer object)
+{
+  if (!g_atomic_int_get (&enabled))
+    return FALSE;
+
+  return _tp_allocation_statistics_created (G_OBJECT_TYPE_NAME (object));
+}
+
+void
+_tp_allocation_statistics_object_freed (gpointer object)
+{
+  _tp_allocation_statistics_freed (G_OBJECT_TYPE_NAME (object));
+}
+
+static void
+value_array_free (gpointer p)
+{
+  tp_value_array_free (p);
+}
+
+/*
+ * _tp_allocation_statistics_dup_value_arrays:
+ *
+ * Returns: the same as tp_allocation_statistics_dup_snapshot(), as a
+ *  #TP_ARRAY_TYPE_ALLOCATION_STATISTICS_LIST, which frees its elements
+ *  when it is unreffed
+ */
+GPtrArray *
+_tp_allocation_statistics_dup_value_arrays (void)
+{
+  GPtrArray *ret = g_ptr_array_new_with_free_func (value_array_free);
+  GHashTableIter iter;
+  gpointer v;
+
+  G_LOCK (counts);
+
+  if (counts != NULL)
+    {
+      g_hash_table_iter_init (&iter, counts);
+
+      while (g_hash_table_iter_next (&iter, NULL, &v))
+        {
+          TypeCounts *c = v;
+
+          g_ptr_array_add (ret, tp_value_array_build (4,
+                G_TYPE_STRING, c->name,
+                G_TYPE_UINT, c->live,
+                G_TYPE_UINT, c->peak,
+                G_TYPE_UINT64, c->total,
+                G_TYPE_INVALID));
+        }
+    }
+
+  G_UNLOCK (counts);
+
+  return ret;
+}
@@ -187,6 +187,7 @@
 #include <telepathy-glib/add-dispatch-operation-context-internal.h>
 #include <telepathy-glib/automatic-proxy-factory.h>
 #include <telepathy-glib/channel-dispatch-operation-internal.h>
+#include <telepathy-glib/channel-filter-set.h>
 #include <telepathy-glib/channel-dispatcher.h>
 #include <telepathy-glib/channel-request.h>
 #include <telepathy-glib/channel.h>
@@ -1109,6 +1110,83 @@ tp_base_client_dup_handled_channels (TpBaseClient *self)
   return ret;
 }
 
+static TpChannelFilterSet *
+_tp_base_client_filter_set_new (GPtrArray *filters)
+{
+  TpChannelFilterSet *set = tp_channel_filter_set_new ();
+  guint i;
+
+  for (i = 0; i < filters->len; i++)
+    {
+      GHashTable *filter = g_ptr_array_index (filters, i);
+
+      tp_channel_filter_set_add (set, filter, g_hash_table_ref (filter),
+          (GDestroyNotify) g_hash_table_unref);
+    }
+
+  return set;
+}
+
+/**
+ * tp_base_client_dup_observer_filter_set:
+ * @self: a #TpBaseClient
+ *
+ * Return the filters added with tp_base_client_add_observer_filter() and
+ * similar functions, indexed so that a channel's immutable properties can
+ * be matched against them with tp_channel_filter_set_match(). The user data
+ * associated with each filter is the filter itself, as a #GHashTable
+ * borrowed from the #TpChannelFilterSet.
+ *
+ * Returns: (transfer full): the observer filters
+ *
+ * Since: 0.UNRELEASED
+ */
+TpChannelFilterSet *
+tp_base_client_dup_observer_filter_set (TpBaseClient *self)
+{
+  g_return_val_if_fail (TP_IS_BASE_CLIENT (self), NULL);
+
+  return _tp_base_client_filter_set_new (self->priv->observer_filters);
+}
+
+/**
+ * tp_base_client_dup_approver_filter_set:
+ * @self: a #TpBaseClient
+ *
+ * The same as tp_base_client_dup_observer_filter_set(), but for the filters
+ * added with tp_base_client_add_approver_filter() and similar functions.
+ *
+ * Returns: (transfer full): the approver filters
+ *
+ * Since: 0.UNRELEASED
+ */
+TpChannelFilterSet *
+tp_base_client_dup_approver_filter_set (TpBaseClient *self)
+{
+  g_return_val_if_fail (TP_IS_BASE_CLIENT (self), NULL);
+
+  return _tp_base_client_filter_set_new (self->priv->approver_filters);
+}
+
+/**
+ * tp_base_client_dup_handler_filter_set:
+ * @self: a #TpBaseClient
+ *
+ * The same as tp_base_client_dup_observer_filter_set(), but for the filters
+ * added with tp_base_client_add_handler_filter() and similar functions.
+ *
+ * Returns: (transfer full): the handler filters
+ *
+ * Since: 0.UNRELEASED
+ */
+TpChannelFilterSet *
+tp_base_client_dup_handler_filter_set (TpBaseClient *self)
+{
+  g_return_val_if_fail (TP_IS_BASE_CLIENT (self), NULL);
+
+  return _tp_base_client_filter_set_new (self->priv->handler_filters);
+}
+
 static void
 tp_base_client_init (TpBaseClient *self)
 {
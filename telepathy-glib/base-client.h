@@ -31,6 +31,7 @@
 #include <telepathy-glib/account.h>
 #include <telepathy-glib/account-manager.h>
 #include <telepathy-glib/add-dispatch-operation-context.h>
+#include <telepathy-glib/channel-filter-set.h>
 #include <telepathy-glib/client-channel-factory.h>
 #include <telepathy-glib/handle-channels-context.h>
 #include <telepathy-glib/observe-channels-context.h>
@@ -218,6 +219,16 @@ GList *tp_base_client_dup_pending_requests (TpBaseClient *self);
 _TP_AVAILABLE_IN_0_20
 GList *tp_base_client_dup_handled_channels (TpBaseClient *self);
 
+_TP_AVAILABLE_IN_UNRELEASED
+TpChannelFilterSet *tp_base_client_dup_observer_filter_set (
+    TpBaseClient *self);
+_TP_AVAILABLE_IN_UNRELEASED
+TpChannelFilterSet *tp_base_client_dup_approver_filter_set (
+    TpBaseClient *self);
+_TP_AVAILABLE_IN_UNRELEASED
+TpChannelFilterSet *tp_base_client_dup_handler_filter_set (
+    TpBaseClient *self);
+
 gboolean tp_base_client_is_handling_channel (TpBaseClient *self,
     TpChannel *channel);
 
@@ -37,13 +37,16 @@
 
 #include <string.h>
 
+#include <dbus/dbus-glib-lowlevel.h>
 #include <dbus/dbus-protocol.h>
 
 #include <telepathy-glib/telepathy-glib.h>
 
 #define DEBUG_FLAG TP_DEBUG_PARAMS
 #include "telepathy-glib/base-protocol-internal.h"
+#include "telepathy-glib/dbus-internal.h"
 #include "telepathy-glib/debug-internal.h"
+#include "telepathy-glib/timer-wheel-internal.h"
 
 /**
  * TpCMProtocolSpec:
@@ -105,9 +108,10 @@ _tp_legacy_protocol_get_parameters (TpBaseProtocol *protocol)
   return self->protocol_spec->parameters;
 }
 
-static gboolean parse_parameters (const TpCMParamSpec *paramspec,
-    GHashTable *provided, TpIntset *params_present,
-    const TpCMParamSetter set_param, void *params, GError **error);
+static gboolean parse_parameters (TpBaseProtocol *protocol,
+    const TpCMParamSpec *paramspec, GHashTable *provided,
+    TpIntset *params_present, const TpCMParamSetter set_param, void *params,
+    GError **error);
 
 static TpBaseConnection *
 _tp_legacy_protocol_new_connection (TpBaseProtocol *protocol,
@@ -145,7 +149,7 @@ _tp_legacy_protocol_new_connection (TpBaseProtocol *protocol,
   if (set_param == NULL)
     set_param = tp_cm_param_setter_offset;
 
-  if (!parse_parameters (protospec->parameters, (GHashTable *) asv,
+  if (!parse_parameters (protocol, protospec->parameters, asv,
         params_present, set_param, params, error))
     {
       goto finally;
@@ -306,6 +310,14 @@ struct _TpBaseConnectionManagerPrivate
   GHashTable *protocols;
 
   TpDBusDaemon *dbus_daemon;
+
+  /* owned Shard *, empty unless n-shards has been set */
+  GPtrArray *shards;
+  /* connections in shards, including those still being requested; they
+   * are not in the connections set */
+  guint n_sharded_connections;
+  /* successful RequestConnection calls so far */
+  guint n_requests;
 };
 
 enum
@@ -313,6 +325,7 @@ enum
     PROP_DBUS_DAEMON = 1,
     PROP_INTERFACES,
     PROP_PROTOCOLS,
+    PROP_N_SHARDS,
     N_PROPS
 };
 
@@ -324,6 +337,22 @@ enum
 
 static guint signals[N_SIGNALS] = {0};
 
+static void tp_base_connection_manager_stop_shards (
+    TpBaseConnectionManager *self);
+
+/* The first RequestConnection has to page in (and maybe compile) things
+ * that later ones find ready, so log it separately. */
+static void
+tp_base_connection_manager_log_request (TpBaseConnectionManager *self,
+    const gchar *proto,
+    gint64 started)
+{
+  DEBUG ("RequestConnection for %s took %" G_GINT64_FORMAT " us%s", proto,
+      g_get_monotonic_time () - started,
+      self->priv->n_requests == 0 ? " (the first since startup)" : "");
+  self->priv->n_requests++;
+}
+
 static void
 tp_base_connection_manager_dispose (GObject *object)
 {
@@ -337,6 +366,8 @@ tp_base_connection_manager_dispose (GObject *object)
 
   priv->dispose_has_run = TRUE;
 
+  tp_base_connection_manager_stop_shards (self);
+
   if (priv->dbus_daemon != NULL)
     {
       g_object_unref (priv->dbus_daemon);
@@ -360,6 +391,7 @@ tp_base_connection_manager_finalize (GObject *object)
   TpBaseConnectionManagerPrivate *priv = self->priv;
 
   g_hash_table_unref (priv->connections);
+  g_ptr_array_unref (priv->shards);
 
   G_OBJECT_CLASS (tp_base_connection_manager_parent_class)->finalize (object);
 }
@@ -460,6 +492,10 @@ tp_base_connection_manager_get_property (GObject *object,
         }
       break;
 
+    case PROP_N_SHARDS:
+      g_value_set_uint (value, self->priv->shards->len);
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -578,6 +614,21 @@ tp_base_connection_manager_class_init (TpBaseConnectionManagerClass *klass)
         TP_HASH_TYPE_PROTOCOL_PROPERTIES_MAP,
         G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * TpBaseConnectionManager:n-shards:
+   *
+   * The number of worker threads among which new connections are shared
+   * out, or 0 if connections are created in the same thread as this
+   * object. Use tp_base_connection_manager_set_n_shards() to change it.
+   *
+   * Since: 0.UNRELEASED
+   */
+  g_object_class_install_property (object_class, PROP_N_SHARDS,
+      g_param_spec_uint ("n-shards", "Number of shards",
+        "Number of worker threads for connections, or 0 for none",
+        0, G_MAXUINT, 0,
+        G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
   /**
    * TpBaseConnectionManager::no-more-connections:
    *
@@ -611,6 +662,7 @@ tp_base_connection_manager_init (TpBaseConnectionManager *self)
   priv->connections = g_hash_table_new (g_direct_hash, g_direct_equal);
   priv->protocols = g_hash_table_new_full (g_str_hash, g_str_equal,
       g_free, g_object_unref);
+  priv->shards = g_ptr_array_new ();
 }
 
 /**
@@ -637,7 +689,8 @@ connection_shutdown_finished_cb (TpBaseConnection *conn,
   g_hash_table_remove (priv->connections, conn);
 
   DEBUG ("dereferenced connection");
-  if (g_hash_table_size (priv->connections) == 0)
+  if (g_hash_table_size (priv->connections) == 0 &&
+      priv->n_sharded_connections == 0)
     {
       g_signal_emit (self, signals[NO_MORE_CONNECTIONS], 0);
     }
@@ -878,32 +931,35 @@ set_param_from_value (const TpCMParamSpec *paramspec,
 }
 
 static gboolean
-parse_parameters (const TpCMParamSpec *paramspec,
+parse_parameters (TpBaseProtocol *protocol,
+                  const TpCMParamSpec *paramspec,
                   GHashTable *provided,
                   TpIntset *params_present,
                   const TpCMParamSetter set_param,
                   void *params,
                   GError **error)
 {
-  int i;
-  GValue *value;
+  GHashTableIter iter;
+  gpointer name, value;
 
-  for (i = 0; paramspec[i].name; i++)
-    {
-      value = g_hash_table_lookup (provided, paramspec[i].name);
+  g_hash_table_iter_init (&iter, provided);
 
-      if (value != NULL)
-        {
-          if (!set_param_from_value (&paramspec[i], value, set_param, params,
-                error))
-            {
-              return FALSE;
-            }
+  while (g_hash_table_iter_next (&iter, &name, &value))
+    {
+      gint i = _tp_base_protocol_find_parameter (protocol, name);
 
-          tp_intset_add (params_present, i);
+      /* tp_base_protocol_new_connection() has already rejected unknown
+       * parameters */
+      if (i < 0)
+        continue;
 
-          g_hash_table_remove (provided, paramspec[i].name);
+      if (!set_param_from_value (&paramspec[i], value, set_param, params,
+            error))
+        {
+          return FALSE;
         }
+
+      tp_intset_add (params_present, i);
     }
 
   return TRUE;
@@ -998,6 +1054,388 @@ tp_base_connection_manager_list_protocols (TpSvcConnectionManager *iface,
   g_ptr_array_unref (protocols);
 }
 
+/* Sharding
+ *
+ * With n-shards > 0, each connection lives in one of that many worker
+ * threads ("shards"), each running its own GMainContext with its own private
+ * connection to the bus, so that one busy connection doesn't hold up the
+ * others and the D-Bus traffic for many connections is spread across several
+ * sockets. The connection manager object itself, and RequestConnection,
+ * stay in the thread that registered it; only the construction and
+ * registration of the connection, and everything it does afterwards,
+ * happen in the shard.
+ */
+
+typedef struct {
+    /* atomic: one for the main thread, plus one for each pending call into
+     * the main thread */
+    gint refcount;
+    /* borrowed; set to NULL by the main thread when the shard is stopped */
+    TpBaseConnectionManager *cm;
+    GMainContext *main_context;
+    GMainContext *context;
+    GMainLoop *loop;
+    GThread *thread;
+
+    /* only used in the main thread: connections in this shard, including
+     * those still being requested */
+    guint n_connections;
+
+    /* only used in the shard's thread */
+    DBusGConnection *bus;
+    TpDBusDaemon *dbus_daemon;
+    /* used as a set: key is TpBaseConnection *, value is TRUE */
+    GHashTable *connections;
+
+    /* protect the hand-over of the startup result */
+    GMutex lock;
+    GCond cond;
+    gboolean started;
+    GError *error;
+} Shard;
+
+static Shard *
+shard_ref (Shard *shard)
+{
+  g_atomic_int_inc (&shard->refcount);
+  return shard;
+}
+
+static void
+shard_unref (Shard *shard)
+{
+  if (!g_atomic_int_dec_and_test (&shard->refcount))
+    return;
+
+  g_assert (shard->thread == NULL);
+  g_assert (g_hash_table_size (shard->connections) == 0);
+
+  g_hash_table_unref (shard->connections);
+  g_main_loop_unref (shard->loop);
+  g_main_context_unref (shard->context);
+  g_main_context_unref (shard->main_context);
+  g_clear_error (&shard->error);
+  g_mutex_clear (&shard->lock);
+  g_cond_clear (&shard->cond);
+  g_slice_free (Shard, shard);
+}
+
+static void shard_connection_shutdown_finished_cb (TpBaseConnection *conn,
+    gpointer data);
+
+static gpointer
+shard_thread (gpointer data)
+{
+  Shard *shard = data;
+  GError *error = NULL;
+  GHashTableIter iter;
+  gpointer conn;
+
+  g_main_context_push_thread_default (shard->context);
+  /* so that connections' timers fire in this thread */
+  _tp_timer_wheel_bind (shard->context);
+
+  shard->bus = dbus_g_bus_get_private (DBUS_BUS_STARTER, shard->context,
+      &error);
+
+  if (shard->bus != NULL)
+    {
+      dbus_connection_set_exit_on_disconnect (
+          dbus_g_connection_get_connection (shard->bus), FALSE);
+      shard->dbus_daemon = tp_dbus_daemon_new (shard->bus);
+      /* so that connections created in this thread use this bus */
+      _tp_dbus_daemon_set_thread_default (shard->dbus_daemon);
+    }
+
+  g_mutex_lock (&shard->lock);
+  shard->started = TRUE;
+  shard->error = error;
+  g_cond_signal (&shard->cond);
+  g_mutex_unlock (&shard->lock);
+
+  if (shard->bus == NULL)
+    goto finally;
+
+  g_main_loop_run (shard->loop);
+
+  /* We're only stopped while connections remain if the connection manager
+   * itself is going away, which ought to mean the process is exiting. */
+  g_hash_table_iter_init (&iter, shard->connections);
+
+  while (g_hash_table_iter_next (&iter, &conn, NULL))
+    {
+      g_signal_handlers_disconnect_by_func (conn,
+          shard_connection_shutdown_finished_cb, shard);
+      g_object_unref (conn);
+      g_hash_table_iter_remove (&iter);
+    }
+
+  _tp_dbus_daemon_set_thread_default (NULL);
+  g_object_unref (shard->dbus_daemon);
+  shard->dbus_daemon = NULL;
+  dbus_connection_close (dbus_g_connection_get_connection (shard->bus));
+  dbus_g_connection_unref (shard->bus);
+  shard->bus = NULL;
+
+finally:
+  /* the connections, and hence their timers, have gone by now */
+  _tp_timer_wheel_release ();
+  g_main_context_pop_thread_default (shard->context);
+  return NULL;
+}
+
+static Shard *
+shard_new (TpBaseConnectionManager *cm,
+    GError **error)
+{
+  Shard *shard = g_slice_new0 (Shard);
+
+  shard->refcount = 1;
+  shard->cm = cm;
+  shard->main_context = g_main_context_ref_thread_default ();
+  shard->context = g_main_context_new ();
+  shard->loop = g_main_loop_new (shard->context, FALSE);
+  shard->connections = g_hash_table_new (g_direct_hash, g_direct_equal);
+  g_mutex_init (&shard->lock);
+  g_cond_init (&shard->cond);
+
+  shard->thread = g_thread_try_new ("tp-cm-shard", shard_thread, shard,
+      error);
+
+  if (shard->thread == NULL)
+    goto error;
+
+  g_mutex_lock (&shard->lock);
+
+  while (!shard->started)
+    g_cond_wait (&shard->cond, &shard->lock);
+
+  g_mutex_unlock (&shard->lock);
+
+  if (shard->error != NULL)
+    {
+      g_thread_join (shard->thread);
+      shard->thread = NULL;
+      g_propagate_error (error, shard->error);
+      shard->error = NULL;
+      goto error;
+    }
+
+  return shard;
+
+error:
+  shard->cm = NULL;
+  shard_unref (shard);
+  return NULL;
+}
+
+static gboolean
+shard_quit_cb (gpointer data)
+{
+  Shard *shard = data;
+
+  g_main_loop_quit (shard->loop);
+  return G_SOURCE_REMOVE;
+}
+
+static void
+shard_stop (Shard *shard)
+{
+  shard->cm = NULL;
+
+  /* quitting from within the loop means it must already be running */
+  g_main_context_invoke (shard->context, shard_quit_cb, shard);
+  g_thread_join (shard->thread);
+  shard->thread = NULL;
+
+  shard_unref (shard);
+}
+
+/* called in the main thread */
+static gboolean
+shard_connection_gone_cb (gpointer data)
+{
+  Shard *shard = data;
+  TpBaseConnectionManager *self = shard->cm;
+
+  if (self != NULL)
+    {
+      g_assert (shard->n_connections > 0);
+      g_assert (self->priv->n_sharded_connections > 0);
+      shard->n_connections--;
+      self->priv->n_sharded_connections--;
+
+      DEBUG ("dereferenced sharded connection");
+      if (self->priv->n_sharded_connections == 0 &&
+          g_hash_table_size (self->priv->connections) == 0)
+        {
+          g_object_ref (self);
+          g_signal_emit (self, signals[NO_MORE_CONNECTIONS], 0);
+          g_object_unref (self);
+        }
+    }
+
+  shard_unref (shard);
+  return G_SOURCE_REMOVE;
+}
+
+/* called in the shard's thread */
+static void
+shard_connection_shutdown_finished_cb (TpBaseConnection *conn,
+    gpointer data)
+{
+  Shard *shard = data;
+
+  g_assert (g_hash_table_lookup (shard->connections, conn));
+  g_hash_table_remove (shard->connections, conn);
+
+  g_signal_handlers_disconnect_by_func (conn,
+      shard_connection_shutdown_finished_cb, data);
+  g_object_unref (conn);
+
+  g_main_context_invoke (shard->main_context, shard_connection_gone_cb,
+      shard_ref (shard));
+}
+
+typedef struct {
+    /* only used in the main thread */
+    TpBaseConnectionManager *cm;
+    Shard *shard;
+    DBusGMethodInvocation *context;
+    gchar *proto;
+    gint64 started;
+
+    /* owned; handed to the shard's thread */
+    TpBaseProtocol *protocol;
+    /* already sanitized by _tp_base_protocol_sanitize_parameters() in the
+     * main thread; the protocol's parameter plan has been frozen, so the
+     * legacy new_connection can look parameters up in the shard */
+    GHashTable *parameters;
+
+    /* results, set in the shard's thread */
+    gchar *bus_name;
+    gchar *object_path;
+    GError *error;
+} ShardRequest;
+
+static void
+shard_request_free (ShardRequest *req)
+{
+  g_object_unref (req->cm);
+  g_free (req->proto);
+  g_object_unref (req->protocol);
+  g_hash_table_unref (req->parameters);
+  g_free (req->bus_name);
+  g_free (req->object_path);
+  g_clear_error (&req->error);
+  g_slice_free (ShardRequest, req);
+}
+
+/* called in the main thread */
+static gboolean
+shard_request_done_cb (gpointer data)
+{
+  ShardRequest *req = data;
+  TpBaseConnectionManagerPrivate *priv = req->cm->priv;
+
+  if (req->error != NULL)
+    {
+      DEBUG ("failed: %s", req->error->message);
+
+      req->shard->n_connections--;
+      priv->n_sharded_connections--;
+      dbus_g_method_return_error (req->context, req->error);
+    }
+  else
+    {
+      tp_base_connection_manager_log_request (req->cm, req->proto,
+          req->started);
+      tp_svc_connection_manager_emit_new_connection (req->cm,
+          req->bus_name, req->object_path, req->proto);
+      tp_svc_connection_manager_return_from_request_connection (
+          req->context, req->bus_name, req->object_path);
+    }
+
+  shard_request_free (req);
+  return G_SOURCE_REMOVE;
+}
+
+/* called in the shard's thread */
+static gboolean
+shard_request_cb (gpointer data)
+{
+  ShardRequest *req = data;
+  Shard *shard = req->shard;
+  TpBaseConnectionManagerClass *cls =
+    TP_BASE_CONNECTION_MANAGER_GET_CLASS (req->cm);
+  TpBaseProtocolClass *protocol_cls =
+    TP_BASE_PROTOCOL_GET_CLASS (req->protocol);
+  TpBaseConnection *conn;
+
+  conn = protocol_cls->new_connection (req->protocol, req->parameters,
+      &req->error);
+
+  if (conn != NULL &&
+      !tp_base_connection_register (conn, cls->cm_dbus_name,
+        &req->bus_name, &req->object_path, &req->error))
+    {
+      g_object_unref (conn);
+      conn = NULL;
+    }
+
+  if (conn != NULL)
+    {
+      g_signal_connect (conn, "shutdown-finished",
+          G_CALLBACK (shard_connection_shutdown_finished_cb), shard);
+      g_hash_table_insert (shard->connections, conn, GINT_TO_POINTER (TRUE));
+    }
+
+  g_main_context_invoke (shard->main_context, shard_request_done_cb, req);
+  return G_SOURCE_REMOVE;
+}
+
+static void
+tp_base_connection_manager_request_sharded_connection (
+    TpBaseConnectionManager *self,
+    TpBaseProtocol *protocol,
+    const gchar *proto,
+    GHashTable *sanitized,
+    DBusGMethodInvocation *context,
+    gint64 started)
+{
+  TpBaseConnectionManagerPrivate *priv = self->priv;
+  ShardRequest *req = g_slice_new0 (ShardRequest);
+  Shard *shard = NULL;
+  guint i;
+
+  /* the least busy shard gets the new connection */
+  for (i = 0; i < priv->shards->len; i++)
+    {
+      Shard *candidate = g_ptr_array_index (priv->shards, i);
+
+      if (shard == NULL || candidate->n_connections < shard->n_connections)
+        shard = candidate;
+    }
+
+  g_assert (shard != NULL);
+  shard->n_connections++;
+  priv->n_sharded_connections++;
+
+  req->cm = g_object_ref (self);
+  req->shard = shard;
+  req->context = context;
+  req->proto = g_strdup (proto);
+  req->started = started;
+  req->protocol = g_object_ref (protocol);
+  req->parameters = sanitized;
+
+  /* from now on the shard might read the plan, so it mustn't be rebuilt */
+  _tp_base_protocol_freeze_param_plan (protocol);
+
+  DEBUG ("sending %s connection to shard %p with %u connections", proto,
+      shard, shard->n_connections - 1);
+  g_main_context_invoke (shard->context, shard_request_cb, req);
+}
 
 /*
  * tp_base_connection_manager_request_connection:
@@ -1026,6 +1464,7 @@ tp_base_connection_manager_request_connection (TpSvcConnectionManager *iface,
   gchar *object_path;
   GError *error = NULL;
   TpBaseProtocol *protocol;
+  gint64 started = g_get_monotonic_time ();
 
   g_assert (TP_IS_BASE_CONNECTION_MANAGER (iface));
 
@@ -1040,6 +1479,23 @@ tp_base_connection_manager_request_connection (TpSvcConnectionManager *iface,
   if (protocol == NULL)
     goto ERROR;
 
+  if (priv->shards->len > 0)
+    {
+      /* the parameter plan is built lazily and isn't locked, so check the
+       * parameters here rather than in the shard, before the plan is frozen;
+       * this also means that invalid parameters are rejected without
+       * involving a shard */
+      GHashTable *sanitized = _tp_base_protocol_sanitize_parameters (protocol,
+          parameters, &error);
+
+      if (sanitized == NULL)
+        goto ERROR;
+
+      tp_base_connection_manager_request_sharded_connection (self, protocol,
+          proto, sanitized, context, started);
+      return;
+    }
+
   conn = tp_base_protocol_new_connection (protocol, parameters, &error);
 
   if (conn == NULL)
@@ -1063,6 +1519,8 @@ tp_base_connection_manager_request_connection (TpSvcConnectionManager *iface,
   /* store the connection, using a hash table as a set */
   g_hash_table_insert (priv->connections, conn, GINT_TO_POINTER(TRUE));
 
+  tp_base_connection_manager_log_request (self, proto, started);
+
   /* emit the new connection signal */
   tp_svc_connection_manager_emit_new_connection (
       self, bus_name, object_path, proto);
@@ -1232,3 +1690,117 @@ tp_base_connection_manager_add_protocol (TpBaseConnectionManager *self,
       g_strdup (tp_base_protocol_get_name (protocol)),
       g_object_ref (protocol));
 }
+
+static void
+tp_base_connection_manager_stop_shards (TpBaseConnectionManager *self)
+{
+  guint i;
+
+  for (i = 0; i < self->priv->shards->len; i++)
+    shard_stop (g_ptr_array_index (self->priv->shards, i));
+
+  g_ptr_array_set_size (self->priv->shards, 0);
+}
+
+/**
+ * tp_base_connection_manager_set_n_shards:
+ * @self: a connection manager
+ * @n_shards: the number of worker threads to use for connections, or 0 to
+ *  create connections in the thread that called
+ *  tp_base_connection_manager_register()
+ * @error: used to raise an error if %FALSE is returned
+ *
+ * Share out the connections created by RequestConnection between
+ * @n_shards worker threads, each with its own #GMainContext and its own
+ * connection to D-Bus, so that a connection manager with many connections
+ * can use more than one CPU and is not limited by the throughput of a single
+ * D-Bus connection. Each new connection goes to the thread with the fewest
+ * connections, and stays there until it has disconnected.
+ *
+ * Connections are constructed, registered on D-Bus and disposed of in their
+ * worker thread, which is the thread-default main context's thread for all
+ * their signals, timeouts and D-Bus method calls; tp_dbus_daemon_dup()
+ * returns that thread's bus connection. The #TpBaseProtocol objects and
+ * their new_connection implementations are called from all the worker
+ * threads, so they, and anything else shared between connections, must be
+ * thread-safe. The connection manager object and its signals stay in the
+ * calling thread. Once a protocol has had a connection sent to a worker
+ * thread, the result of its tp_base_protocol_get_parameters() at that time
+ * is used for the rest of its life.
+ *
+ * This must be called from the thread that will run @self's main context.
+ * With libdbus older than 1.7, the connection manager must also call
+ * dbus_threads_init_default() before anything else uses D-Bus.
+ *
+ * The number of shards can only be changed while no connections are using
+ * them; otherwise, %TP_ERROR_SERVICE_BUSY is raised. By default there are
+ * no shards, which is the same as in older versions of telepathy-glib.
+ *
+ * Returns: %TRUE on success
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_base_connection_manager_set_n_shards (TpBaseConnectionManager *self,
+    guint n_shards,
+    GError **error)
+{
+  TpBaseConnectionManagerPrivate *priv;
+  guint i;
+
+  g_return_val_if_fail (TP_IS_BASE_CONNECTION_MANAGER (self), FALSE);
+
+  priv = self->priv;
+
+  if (n_shards == priv->shards->len)
+    return TRUE;
+
+  if (priv->n_sharded_connections > 0)
+    {
+      g_set_error (error, TP_ERROR, TP_ERROR_SERVICE_BUSY,
+          "Can't change the number of shards while %u connections are "
+          "using them", priv->n_sharded_connections);
+      return FALSE;
+    }
+
+  tp_base_connection_manager_stop_shards (self);
+
+  if (n_shards > 0)
+    dbus_threads_init_default ();
+
+  for (i = 0; i < n_shards; i++)
+    {
+      Shard *shard = shard_new (self, error);
+
+      if (shard == NULL)
+        {
+          tp_base_connection_manager_stop_shards (self);
+          g_object_notify ((GObject *) self, "n-shards");
+          return FALSE;
+        }
+
+      g_ptr_array_add (priv->shards, shard);
+    }
+
+  DEBUG ("now using %u shards", n_shards);
+  g_object_notify ((GObject *) self, "n-shards");
+  return TRUE;
+}
+
+/**
+ * tp_base_connection_manager_get_n_shards:
+ * @self: a connection manager
+ *
+ * <!-- -->
+ *
+ * Returns: the value of the #TpBaseConnectionManager:n-shards property
+ *
+ * Since: 0.UNRELEASED
+ */
+guint
+tp_base_connection_manager_get_n_shards (TpBaseConnectionManager *self)
+{
+  g_return_val_if_fail (TP_IS_BASE_CONNECTION_MANAGER (self), 0);
+
+  return self->priv->shards->len;
+}
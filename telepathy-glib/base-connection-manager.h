@@ -105,6 +105,16 @@ TpDBusDaemon *tp_base_connection_manager_get_dbus_daemon (
 void tp_base_connection_manager_add_protocol (TpBaseConnectionManager *self,
     TpBaseProtocol *protocol);
 
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_base_connection_manager_set_n_shards (
+    TpBaseConnectionManager *self,
+    guint n_shards,
+    GError **error);
+
+_TP_AVAILABLE_IN_UNRELEASED
+guint tp_base_connection_manager_get_n_shards (
+    TpBaseConnectionManager *self);
+
 /* TYPE MACROS */
 #define TP_TYPE_BASE_CONNECTION_MANAGER \
   (tp_base_connection_manager_get_type ())
@@ -70,6 +70,7 @@
 #include "telepathy-glib/interfaces.h"
 #include "telepathy-glib/svc-call.h"
 #include "telepathy-glib/svc-properties-interface.h"
+#include "telepathy-glib/timer-wheel-internal.h"
 #include "telepathy-glib/util.h"
 #include "telepathy-glib/util-internal.h"
 
@@ -127,7 +128,8 @@ struct _TpBaseMediaCallContentPrivate
   gchar *deferred_tones;
   gboolean multiple_tones;
   gboolean tones_cancelled;
-  guint tones_pause_timeout_id;
+  /* on the wheel of the thread the content lives in */
+  TpTimer tones_pause_timer;
   gulong channel_state_changed_id;
 
   /* GQueue of GSimpleAsyncResult with a TpCallContentMediaDescription
@@ -150,6 +152,7 @@ static gboolean tp_base_media_call_content_multiple_tones (
     const gchar *tones,
     GError **error);
 static void tp_base_media_call_content_dtmf_next (TpBaseMediaCallContent *self);
+static void dtmf_pause_timer_cb (gpointer data);
 
 static void
 tp_base_media_call_content_init (TpBaseMediaCallContent *self)
@@ -162,6 +165,7 @@ tp_base_media_call_content_init (TpBaseMediaCallContent *self)
       NULL, (GDestroyNotify) g_hash_table_unref);
   self->priv->remote_media_descriptions = g_hash_table_new_full (NULL, NULL,
       NULL, (GDestroyNotify) g_hash_table_unref);
+  _tp_timer_init (&self->priv->tones_pause_timer, dtmf_pause_timer_cb, self);
 }
 
 static void
@@ -191,9 +195,7 @@ tp_base_media_call_content_dispose (GObject *object)
   tp_clear_pointer (&self->priv->local_media_descriptions, g_hash_table_unref);
   tp_clear_pointer (&self->priv->remote_media_descriptions, g_hash_table_unref);
 
-  if (self->priv->tones_pause_timeout_id != 0)
-    g_source_remove (self->priv->tones_pause_timeout_id);
-  self->priv->tones_pause_timeout_id = 0;
+  _tp_timer_cancel (&self->priv->tones_pause_timer);
 
   if (self->priv->channel_state_changed_id != 0)
     {
@@ -1027,16 +1029,12 @@ tp_base_media_call_content_multiple_tones (TpBaseCallContent *bcc,
   return TRUE;
 }
 
-static gboolean
-dtmf_pause_timeout_func (gpointer data)
+static void
+dtmf_pause_timer_cb (gpointer data)
 {
   TpBaseMediaCallContent *self = data;
 
-  self->priv->tones_pause_timeout_id = 0;
-
   tp_base_media_call_content_dtmf_next (self);
-
-  return FALSE;
 }
 
 static void
@@ -1095,7 +1093,7 @@ tp_base_media_call_content_dtmf_next (TpBaseMediaCallContent *self)
             TP_BASE_CALL_CONTENT (self));
 
         /* Waiting for timeout */
-        if (self->priv->tones_pause_timeout_id != 0)
+        if (_tp_timer_is_scheduled (&self->priv->tones_pause_timer))
           return;
 
         if (channel &&
@@ -1123,8 +1121,8 @@ tp_base_media_call_content_dtmf_next (TpBaseMediaCallContent *self)
                     self->priv->current_dtmf_state);
                 break;
               case DTMF_CHAR_CLASS_PAUSE:
-                self->priv->tones_pause_timeout_id = g_timeout_add (
-                    DTMF_PAUSE_MS, dtmf_pause_timeout_func, self);
+                _tp_timer_schedule (&self->priv->tones_pause_timer,
+                    DTMF_PAUSE_MS);
                 tp_svc_call_content_interface_dtmf_emit_sending_tones (self,
                     self->priv->currently_sending_tones);
                 break;
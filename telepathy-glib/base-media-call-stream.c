@@ -162,6 +162,7 @@
 #include "telepathy-glib/interfaces.h"
 #include "telepathy-glib/svc-properties-interface.h"
 #include "telepathy-glib/svc-call.h"
+#include "telepathy-glib/timer-wheel-internal.h"
 #include "telepathy-glib/util.h"
 #include "telepathy-glib/util-internal.h"
 
@@ -186,17 +187,33 @@ enum
   PROP_RELAY_INFO,
   PROP_HAS_SERVER_INFO,
   PROP_ENDPOINTS,
-  PROP_ICE_RESTART_PENDING
+  PROP_ICE_RESTART_PENDING,
+  PROP_BATCH_INTERVAL
 };
 
+/* A local candidate; keeping these rather than one GValueArray (and four
+ * GValues) each saves a lot of allocations when trickle-ICE produces dozens
+ * of candidates per stream. */
+typedef struct
+{
+  guint component;
+  gchar *ip;
+  guint port;
+  /* reffed, string => GValue */
+  GHashTable *info;
+} Candidate;
+
 /* private structure */
 struct _TpBaseMediaCallStreamPrivate
 {
   TpStreamFlowState sending_state;
   TpStreamFlowState receiving_state;
   TpStreamTransportType transport;
-  /* GPtrArray of owned GValueArray (dbus struct) */
-  GPtrArray *local_candidates;
+  /* GArray of Candidate */
+  GArray *local_candidates;
+  /* the same candidates as a GPtrArray of owned GValueArray (dbus struct),
+   * or NULL if nobody has asked for them in that form yet */
+  GPtrArray *local_candidates_array;
   gchar *username;
   gchar *password;
   /* GPtrArray of owned GValueArray (dbus struct) */
@@ -215,6 +232,16 @@ struct _TpBaseMediaCallStreamPrivate
   gboolean sending_stop_requested;
   gboolean sending_failure;
   gboolean receiving_failure;
+
+  /* milliseconds to wait for more changes before signalling them, or 0 */
+  guint batch_interval;
+  TpTimer batch_timer;
+  /* how many of the last local_candidates haven't been signalled yet */
+  guint n_unsignalled_candidates;
+  /* owned object paths of endpoints whose addition or removal hasn't been
+   * signalled yet */
+  GPtrArray *unsignalled_added_endpoints;
+  GPtrArray *unsignalled_removed_endpoints;
 };
 
 static GPtrArray *tp_base_media_call_stream_get_interfaces (
@@ -227,6 +254,137 @@ static gboolean tp_base_media_call_stream_request_receiving (
 static gboolean tp_base_media_call_stream_set_sending (TpBaseCallStream *self,
     gboolean sending,
     GError **error);
+static void tp_base_media_call_stream_flush_changes (
+    TpBaseMediaCallStream *self);
+
+static void
+candidate_clear (gpointer p)
+{
+  Candidate *c = p;
+
+  g_free (c->ip);
+  g_hash_table_unref (c->info);
+}
+
+static GValueArray *
+candidate_to_value_array (const Candidate *c)
+{
+  return tp_value_array_build (4,
+      G_TYPE_UINT, c->component,
+      G_TYPE_STRING, c->ip,
+      G_TYPE_UINT, c->port,
+      TP_HASH_TYPE_CANDIDATE_INFO, c->info,
+      G_TYPE_INVALID);
+}
+
+static GPtrArray *
+tp_base_media_call_stream_dup_candidate_array (TpBaseMediaCallStream *self,
+    guint first)
+{
+  GPtrArray *arr = g_ptr_array_new_full (self->priv->local_candidates->len -
+      first, (GDestroyNotify) tp_value_array_free);
+  guint i;
+
+  for (i = first; i < self->priv->local_candidates->len; i++)
+    g_ptr_array_add (arr, candidate_to_value_array (
+          &g_array_index (self->priv->local_candidates, Candidate, i)));
+
+  return arr;
+}
+
+static GPtrArray *
+tp_base_media_call_stream_get_candidate_array (TpBaseMediaCallStream *self)
+{
+  if (self->priv->local_candidates_array == NULL)
+    self->priv->local_candidates_array =
+        tp_base_media_call_stream_dup_candidate_array (self, 0);
+
+  return self->priv->local_candidates_array;
+}
+
+static void
+tp_base_media_call_stream_reset_candidates (TpBaseMediaCallStream *self)
+{
+  tp_clear_pointer (&self->priv->local_candidates, g_array_unref);
+  tp_clear_pointer (&self->priv->local_candidates_array, g_ptr_array_unref);
+
+  self->priv->local_candidates = g_array_new (FALSE, FALSE,
+      sizeof (Candidate));
+  g_array_set_clear_func (self->priv->local_candidates, candidate_clear);
+  self->priv->n_unsignalled_candidates = 0;
+}
+
+static void
+batch_timer_cb (gpointer data)
+{
+  tp_base_media_call_stream_flush_changes (data);
+}
+
+/* Signal the changes made so far, or arrange to do so when the batch
+ * interval is up. */
+static void
+tp_base_media_call_stream_queue_changes (TpBaseMediaCallStream *self)
+{
+  if (self->priv->batch_interval == 0)
+    tp_base_media_call_stream_flush_changes (self);
+  else if (!_tp_timer_is_scheduled (&self->priv->batch_timer))
+    _tp_timer_schedule (&self->priv->batch_timer,
+        self->priv->batch_interval);
+}
+
+static void
+tp_base_media_call_stream_flush_changes (TpBaseMediaCallStream *self)
+{
+  _tp_timer_cancel (&self->priv->batch_timer);
+
+  if (self->priv->n_unsignalled_candidates > 0)
+    {
+      GPtrArray *added = tp_base_media_call_stream_dup_candidate_array (self,
+          self->priv->local_candidates->len -
+          self->priv->n_unsignalled_candidates);
+
+      DEBUG ("Signalling %u new local candidates on stream %s", added->len,
+          tp_base_call_stream_get_object_path ((TpBaseCallStream *) self));
+
+      self->priv->n_unsignalled_candidates = 0;
+      tp_svc_call_stream_interface_media_emit_local_candidates_added (self,
+          added);
+      g_ptr_array_unref (added);
+    }
+
+  if (self->priv->unsignalled_added_endpoints->len > 0 ||
+      self->priv->unsignalled_removed_endpoints->len > 0)
+    {
+      GPtrArray *added = self->priv->unsignalled_added_endpoints;
+      GPtrArray *removed = self->priv->unsignalled_removed_endpoints;
+
+      self->priv->unsignalled_added_endpoints = g_ptr_array_new_with_free_func (
+          g_free);
+      self->priv->unsignalled_removed_endpoints =
+          g_ptr_array_new_with_free_func (g_free);
+
+      tp_svc_call_stream_interface_media_emit_endpoints_changed (self,
+          added, removed);
+
+      g_ptr_array_unref (added);
+      g_ptr_array_unref (removed);
+    }
+}
+
+static gint
+find_path (GPtrArray *paths,
+    const gchar *path)
+{
+  guint i;
+
+  for (i = 0; i < paths->len; i++)
+    {
+      if (!tp_strdiff (g_ptr_array_index (paths, i), path))
+        return i;
+    }
+
+  return -1;
+}
 
 static void
 tp_base_media_call_stream_init (TpBaseMediaCallStream *self)
@@ -234,8 +392,12 @@ tp_base_media_call_stream_init (TpBaseMediaCallStream *self)
   self->priv = G_TYPE_INSTANCE_GET_PRIVATE (self,
       TP_TYPE_BASE_MEDIA_CALL_STREAM, TpBaseMediaCallStreamPrivate);
 
-  self->priv->local_candidates = g_ptr_array_new_with_free_func (
-      (GDestroyNotify) tp_value_array_free);
+  tp_base_media_call_stream_reset_candidates (self);
+  self->priv->unsignalled_added_endpoints = g_ptr_array_new_with_free_func (
+      g_free);
+  self->priv->unsignalled_removed_endpoints = g_ptr_array_new_with_free_func (
+      g_free);
+  _tp_timer_init (&self->priv->batch_timer, batch_timer_cb, self);
   self->priv->username = g_strdup ("");
   self->priv->password = g_strdup ("");
   self->priv->receiving_requests = tp_intset_new ();
@@ -255,6 +417,9 @@ tp_base_media_call_stream_dispose (GObject *object)
 {
   TpBaseMediaCallStream *self = TP_BASE_MEDIA_CALL_STREAM (object);
 
+  /* changes that are still waiting to be signalled are lost with the
+   * stream */
+  _tp_timer_cancel (&self->priv->batch_timer);
   tp_clear_pointer (&self->priv->endpoints, _tp_object_list_free);
 
   if (G_OBJECT_CLASS (tp_base_media_call_stream_parent_class)->dispose)
@@ -266,7 +431,12 @@ tp_base_media_call_stream_finalize (GObject *object)
 {
   TpBaseMediaCallStream *self = TP_BASE_MEDIA_CALL_STREAM (object);
 
-  tp_clear_pointer (&self->priv->local_candidates, g_ptr_array_unref);
+  tp_clear_pointer (&self->priv->local_candidates, g_array_unref);
+  tp_clear_pointer (&self->priv->local_candidates_array, g_ptr_array_unref);
+  tp_clear_pointer (&self->priv->unsignalled_added_endpoints,
+      g_ptr_array_unref);
+  tp_clear_pointer (&self->priv->unsignalled_removed_endpoints,
+      g_ptr_array_unref);
   tp_clear_pointer (&self->priv->stun_servers, g_ptr_array_unref);
   tp_clear_pointer (&self->priv->relay_info, g_ptr_array_unref);
   tp_clear_pointer (&self->priv->username, g_free);
@@ -296,7 +466,8 @@ tp_base_media_call_stream_get_property (GObject *object,
         g_value_set_uint (value, self->priv->transport);
         break;
       case PROP_LOCAL_CANDIDATES:
-        g_value_set_boxed (value, self->priv->local_candidates);
+        g_value_set_boxed (value,
+            tp_base_media_call_stream_get_candidate_array (self));
         break;
       case PROP_LOCAL_CREDENTIALS:
         {
@@ -344,6 +515,9 @@ tp_base_media_call_stream_get_property (GObject *object,
       case PROP_ICE_RESTART_PENDING:
         g_value_set_boolean (value, self->priv->ice_restart_pending);
         break;
+      case PROP_BATCH_INTERVAL:
+        g_value_set_uint (value, self->priv->batch_interval);
+        break;
       default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
         break;
@@ -363,6 +537,12 @@ tp_base_media_call_stream_set_property (GObject *object,
       case PROP_TRANSPORT:
         self->priv->transport = g_value_get_uint (value);
         break;
+      case PROP_BATCH_INTERVAL:
+        self->priv->batch_interval = g_value_get_uint (value);
+
+        if (self->priv->batch_interval == 0)
+          tp_base_media_call_stream_flush_changes (self);
+        break;
       default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
         break;
@@ -550,6 +730,30 @@ tp_base_media_call_stream_class_init (TpBaseMediaCallStreamClass *klass)
   g_object_class_install_property (object_class, PROP_ICE_RESTART_PENDING,
       param_spec);
 
+  /**
+   * TpBaseMediaCallStream:batch-interval:
+   *
+   * If non-zero, the LocalCandidatesAdded and EndpointsChanged D-Bus signals
+   * are not emitted as soon as candidates or endpoints are added, but up to
+   * this many milliseconds later, together with any other additions in that
+   * time. This avoids a storm of signals when candidates trickle in one by
+   * one while a call is set up. #TpBaseMediaCallStream:local-candidates and
+   * #TpBaseMediaCallStream:endpoints are always updated immediately.
+   *
+   * Pending changes are signalled straight away if the streaming
+   * implementation calls FinishInitialCandidates or SetCredentials, or if
+   * this property is set to 0.
+   *
+   * Since: 0.UNRELEASED
+   */
+  param_spec = g_param_spec_uint ("batch-interval", "Batch interval",
+      "Milliseconds to wait for more candidates or endpoints before "
+      "signalling them",
+      0, G_MAXUINT, 0,
+      G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+  g_object_class_install_property (object_class, PROP_BATCH_INTERVAL,
+      param_spec);
+
   tp_dbus_properties_mixin_implement_interface (object_class,
       TP_IFACE_QUARK_CALL_STREAM_INTERFACE_MEDIA,
       tp_dbus_properties_mixin_getter_gobject_properties,
@@ -705,7 +909,8 @@ tp_base_media_call_stream_set_relay_info (TpBaseMediaCallStream *self,
  * @endpoint: a #TpCallStreamEndpoint
  *
  * Add @endpoint to #TpBaseMediaCallStream:endpoints list, and emits
- * EndpointsChanged DBus signal.
+ * EndpointsChanged DBus signal (after #TpBaseMediaCallStream:batch-interval,
+ * if set).
  *
  * Since: 0.17.5
  */
@@ -714,8 +919,6 @@ tp_base_media_call_stream_add_endpoint (TpBaseMediaCallStream *self,
     TpCallStreamEndpoint *endpoint)
 {
   const gchar *object_path;
-  GPtrArray *added;
-  GPtrArray *removed;
 
   g_return_if_fail (TP_IS_BASE_MEDIA_CALL_STREAM (self));
   g_return_if_fail (TP_IS_CALL_STREAM_ENDPOINT (endpoint));
@@ -729,15 +932,14 @@ tp_base_media_call_stream_add_endpoint (TpBaseMediaCallStream *self,
   self->priv->endpoints = g_list_append (self->priv->endpoints,
       g_object_ref (endpoint));
 
-  added = g_ptr_array_new ();
-  removed = g_ptr_array_new ();
-  g_ptr_array_add (added, (gpointer) object_path);
-
-  tp_svc_call_stream_interface_media_emit_endpoints_changed (self,
-      added, removed);
+  /* an endpoint that replaces one with the same path mustn't be mistaken
+   * for it */
+  if (find_path (self->priv->unsignalled_removed_endpoints, object_path) >= 0)
+    tp_base_media_call_stream_flush_changes (self);
 
-  g_ptr_array_unref (added);
-  g_ptr_array_unref (removed);
+  g_ptr_array_add (self->priv->unsignalled_added_endpoints,
+      g_strdup (object_path));
+  tp_base_media_call_stream_queue_changes (self);
 }
 
 
@@ -747,7 +949,8 @@ tp_base_media_call_stream_add_endpoint (TpBaseMediaCallStream *self,
  * @endpoint: a #TpCallStreamEndpoint
  *
  * Remove @endpoint from #TpBaseMediaCallStream:endpoints list, and emits
- * EndpointsChanged DBus signal.
+ * EndpointsChanged DBus signal (after #TpBaseMediaCallStream:batch-interval,
+ * if set).
  *
  * Since: 0.17.5
  */
@@ -756,8 +959,7 @@ tp_base_media_call_stream_remove_endpoint (TpBaseMediaCallStream *self,
     TpCallStreamEndpoint *endpoint)
 {
   const gchar *object_path;
-  GPtrArray *added;
-  GPtrArray *removed;
+  gint i;
 
   g_return_if_fail (TP_IS_BASE_MEDIA_CALL_STREAM (self));
   g_return_if_fail (TP_IS_CALL_STREAM_ENDPOINT (endpoint));
@@ -770,15 +972,20 @@ tp_base_media_call_stream_remove_endpoint (TpBaseMediaCallStream *self,
   self->priv->endpoints = g_list_remove (self->priv->endpoints,
       endpoint);
 
-  added = g_ptr_array_new ();
-  removed = g_ptr_array_new ();
-  g_ptr_array_add (removed, (gpointer) object_path);
+  i = find_path (self->priv->unsignalled_added_endpoints, object_path);
 
-  tp_svc_call_stream_interface_media_emit_endpoints_changed (self,
-      added, removed);
+  /* if its addition hasn't been signalled yet, there's nothing to say */
+  if (i >= 0)
+    {
+      g_ptr_array_remove_index (self->priv->unsignalled_added_endpoints, i);
+    }
+  else
+    {
+      g_ptr_array_add (self->priv->unsignalled_removed_endpoints,
+          g_strdup (object_path));
+      tp_base_media_call_stream_queue_changes (self);
+    }
 
-  g_ptr_array_unref (added);
-  g_ptr_array_unref (removed);
   g_object_unref (endpoint);
 }
 
@@ -1084,7 +1291,7 @@ tp_base_media_call_stream_get_local_candidates (TpBaseMediaCallStream *self)
 {
   g_return_val_if_fail (TP_IS_BASE_MEDIA_CALL_STREAM (self), NULL);
 
-  return self->priv->local_candidates;
+  return tp_base_media_call_stream_get_candidate_array (self);
 }
 
 
@@ -1390,9 +1597,10 @@ tp_base_media_call_stream_set_credentials (TpSvcCallStreamInterfaceMedia *iface,
   self->priv->username = g_strdup (username);
   self->priv->password = g_strdup (password);
 
-  tp_clear_pointer (&self->priv->local_candidates, g_ptr_array_unref);
-  self->priv->local_candidates = g_ptr_array_new_with_free_func (
-      (GDestroyNotify) tp_value_array_free);
+  /* candidates for the old credentials must be signalled before they're
+   * forgotten */
+  tp_base_media_call_stream_flush_changes (self);
+  tp_base_media_call_stream_reset_candidates (self);
 
   g_object_notify (G_OBJECT (self), "local-candidates");
   g_object_notify (G_OBJECT (self), "local-credentials");
@@ -1437,16 +1645,24 @@ tp_base_media_call_stream_add_candidates (TpSvcCallStreamInterfaceMedia *iface,
 
   for (i = 0; i < accepted_candidates->len; i++)
     {
-      GValueArray *c = g_ptr_array_index (accepted_candidates, i);
-
-      G_GNUC_BEGIN_IGNORE_DEPRECATIONS
-      g_ptr_array_add (self->priv->local_candidates,
-          g_value_array_copy (c));
-      G_GNUC_END_IGNORE_DEPRECATIONS
+      GValueArray *va = g_ptr_array_index (accepted_candidates, i);
+      Candidate c;
+      const gchar *ip;
+
+      tp_value_array_unpack (va, 4, &c.component, &ip, &c.port, &c.info);
+      c.ip = g_strdup (ip);
+      g_hash_table_ref (c.info);
+      g_array_append_val (self->priv->local_candidates, c);
+
+      if (self->priv->local_candidates_array != NULL)
+        g_ptr_array_add (self->priv->local_candidates_array,
+            candidate_to_value_array (&c));
     }
 
-  tp_svc_call_stream_interface_media_emit_local_candidates_added (self,
-      accepted_candidates);
+  /* If batching is off, LocalCandidatesAdded must still be emitted before
+   * the reply, as it always was */
+  self->priv->n_unsignalled_candidates += accepted_candidates->len;
+  tp_base_media_call_stream_queue_changes (self);
   tp_svc_call_stream_interface_media_return_from_add_candidates (context);
 
   g_ptr_array_unref (accepted_candidates);
@@ -1462,6 +1678,8 @@ tp_base_media_call_stream_finish_initial_candidates (
       TP_BASE_MEDIA_CALL_STREAM_GET_CLASS (self);
   GError *error = NULL;
 
+  tp_base_media_call_stream_flush_changes (self);
+
   if (klass->finish_initial_candidates != NULL)
     if (!klass->finish_initial_candidates (self, &error))
       {
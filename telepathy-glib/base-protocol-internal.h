@@ -28,6 +28,15 @@ G_BEGIN_DECLS
 
 GValueArray *_tp_cm_param_spec_to_dbus (const TpCMParamSpec *paramspec);
 
+void _tp_base_protocol_freeze_param_plan (TpBaseProtocol *self);
+
+gint _tp_base_protocol_find_parameter (TpBaseProtocol *self,
+    const gchar *name);
+
+GHashTable *_tp_base_protocol_sanitize_parameters (TpBaseProtocol *self,
+    GHashTable *asv,
+    GError **error);
+
 G_END_DECLS
 
 #endif
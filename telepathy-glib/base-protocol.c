@@ -599,6 +599,31 @@ typedef struct
   guint max_bytes;
 } AvatarSpecs;
 
+typedef GValue *(*ParamCoerceFunc) (const TpCMParamSpec *param_spec,
+    GHashTable *asv,
+    const GValue *value,
+    GError **error);
+
+/* Everything needed to check a set of parameters against a protocol's
+ * TpCMParamSpec array without searching it: RequestConnection and
+ * IdentifyAccount may be called for thousands of parameter sets. */
+typedef struct
+{
+  /* borrowed from tp_base_protocol_get_parameters () */
+  const TpCMParamSpec *parameters;
+  guint n_parameters;
+  /* borrowed name => GUINT_TO_POINTER (1 + index into parameters) */
+  GHashTable *indices;
+  /* the function that converts each parameter to its gtype */
+  ParamCoerceFunc *coerce;
+  /* indices of the parameters that must be supplied, normally and when
+   * registering a new account */
+  TpIntset *required;
+  TpIntset *required_to_register;
+} ParamPlan;
+
+static void param_plan_free (ParamPlan *plan);
+
 struct _TpBaseProtocolPrivate
 {
   gchar *name;
@@ -610,6 +635,11 @@ struct _TpBaseProtocolPrivate
   gchar *english_name;
   gchar *vcard_field;
   AvatarSpecs avatar_specs;
+  /* compiled from tp_base_protocol_get_parameters() when first needed */
+  ParamPlan *param_plan;
+  /* if TRUE, param_plan may be read from other threads, so it is never
+   * rebuilt or freed until the protocol is */
+  gboolean param_plan_frozen;
 };
 
 enum
@@ -903,6 +933,7 @@ tp_base_protocol_finalize (GObject *object)
   g_free (self->priv->vcard_field);
 
   g_strfreev (self->priv->avatar_specs.supported_mime_types);
+  tp_clear_pointer (&self->priv->param_plan, param_plan_free);
 
   if (self->priv->requestable_channel_classes != NULL)
     g_boxed_free (TP_ARRAY_TYPE_REQUESTABLE_CHANNEL_CLASS_LIST,
@@ -1348,256 +1379,398 @@ tp_base_protocol_get_parameters (TpBaseProtocol *self)
   return cls->get_parameters (self);
 }
 
-static gboolean
-_tp_cm_param_spec_check_all_allowed (const TpCMParamSpec *parameters,
+/* These types only accept an exactly-matching GType. */
+static GValue *
+param_coerce_exact (const TpCMParamSpec *param_spec,
+    GHashTable *asv,
+    const GValue *value,
+    GError **error)
+{
+  if (G_VALUE_TYPE (value) != param_spec->gtype)
+    {
+      g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
+          "%s has type %s, but %s was expected",
+          param_spec->name, G_VALUE_TYPE_NAME (value),
+          g_type_name (param_spec->gtype));
+      return NULL;
+    }
+
+  return tp_g_value_slice_dup (value);
+}
+
+/* Coerce any sensible integer to G_TYPE_INT */
+static GValue *
+param_coerce_int (const TpCMParamSpec *param_spec,
     GHashTable *asv,
+    const GValue *value,
     GError **error)
 {
-  GHashTable *tmp = g_hash_table_new (g_str_hash, g_str_equal);
-  const TpCMParamSpec *iter;
-  gboolean ret = TRUE;
+  gboolean valid;
+  gint i;
 
-  tp_g_hash_table_update (tmp, asv, NULL, NULL);
+  i = tp_asv_get_int32 (asv, param_spec->name, &valid);
 
-  for (iter = parameters; iter->name != NULL; iter++)
+  if (!valid)
     {
-      g_hash_table_remove (tmp, iter->name);
+      g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
+          "%s has a non-integer type or is out of range (type=%s)",
+          param_spec->name, G_VALUE_TYPE_NAME (value));
+      return NULL;
     }
 
-  if (g_hash_table_size (tmp) != 0)
+  if (param_spec->dtype[0] == DBUS_TYPE_INT16 &&
+      (i < -0x8000 || i > 0x7fff))
     {
-      gchar *error_txt;
-      GString *error_str = g_string_new ("unknown parameters provided:");
-      GHashTableIter h_iter;
-      gpointer k;
+      g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
+          "%s is out of range for a 16-bit signed integer", param_spec->name);
+      return NULL;
+    }
 
-      g_hash_table_iter_init (&h_iter, tmp);
+  return tp_g_value_slice_new_int (i);
+}
 
-      while (g_hash_table_iter_next (&h_iter, &k, NULL))
-        {
-          g_string_append_c (error_str, ' ');
-          g_string_append (error_str, k);
-        }
+/* Coerce any sensible integer to G_TYPE_UINT (or G_TYPE_UCHAR for bytes) */
+static GValue *
+param_coerce_uint (const TpCMParamSpec *param_spec,
+    GHashTable *asv,
+    const GValue *value,
+    GError **error)
+{
+  gboolean valid;
+  guint i;
+
+  i = tp_asv_get_uint32 (asv, param_spec->name, &valid);
 
-      error_txt = g_string_free (error_str, FALSE);
+  if (!valid)
+    {
+      g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
+          "%s has a non-integer type or is out of range (type=%s)",
+          param_spec->name, G_VALUE_TYPE_NAME (value));
+      return NULL;
+    }
 
-      DEBUG ("%s", error_txt);
+  if (param_spec->dtype[0] == DBUS_TYPE_BYTE && i > 0xff)
+    {
       g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-          "%s", error_txt);
-      g_free (error_txt);
-      ret = FALSE;
+          "%s is out of range for a byte", param_spec->name);
+      return NULL;
     }
 
-  g_hash_table_unref (tmp);
+  if (param_spec->dtype[0] == DBUS_TYPE_UINT16 && i > 0xffff)
+    {
+      g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
+          "%s is out of range for a 16-bit unsigned integer",
+          param_spec->name);
+      return NULL;
+    }
 
-  return ret;
+  if (param_spec->dtype[0] == DBUS_TYPE_BYTE)
+    return tp_g_value_slice_new_byte (i);
+  else
+    return tp_g_value_slice_new_uint (i);
 }
 
+/* Coerce any sensible integer to G_TYPE_INT64 */
 static GValue *
-_tp_cm_param_spec_coerce (const TpCMParamSpec *param_spec,
+param_coerce_int64 (const TpCMParamSpec *param_spec,
     GHashTable *asv,
+    const GValue *value,
+    GError **error)
+{
+  gboolean valid;
+  gint64 i;
+
+  i = tp_asv_get_int64 (asv, param_spec->name, &valid);
+
+  if (!valid)
+    {
+      g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
+          "%s is not a valid 64-bit signed integer (type=%s)",
+          param_spec->name, G_VALUE_TYPE_NAME (value));
+      return NULL;
+    }
+
+  return tp_g_value_slice_new_int64 (i);
+}
+
+/* Coerce any sensible integer to G_TYPE_UINT64 */
+static GValue *
+param_coerce_uint64 (const TpCMParamSpec *param_spec,
+    GHashTable *asv,
+    const GValue *value,
+    GError **error)
+{
+  gboolean valid;
+  guint64 i;
+
+  i = tp_asv_get_uint64 (asv, param_spec->name, &valid);
+
+  if (!valid)
+    {
+      g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
+          "%s is not a valid 64-bit unsigned integer (type=%s)",
+          param_spec->name, G_VALUE_TYPE_NAME (value));
+      return NULL;
+    }
+
+  return tp_g_value_slice_new_uint64 (i);
+}
+
+/* Coerce any sensible number to G_TYPE_DOUBLE */
+static GValue *
+param_coerce_double (const TpCMParamSpec *param_spec,
+    GHashTable *asv,
+    const GValue *value,
     GError **error)
 {
-  const gchar *name = param_spec->name;
-  const GValue *value = tp_asv_lookup (asv, name);
+  gboolean valid;
+  gdouble d;
+
+  d = tp_asv_get_double (asv, param_spec->name, &valid);
 
-  if (tp_asv_lookup (asv, name) == NULL)
+  if (!valid)
     {
       g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-          "%s not found in parameters", name);
+          "%s is not a valid double (type=%s)", param_spec->name,
+          G_VALUE_TYPE_NAME (value));
       return NULL;
     }
 
+  return tp_g_value_slice_new_double (d);
+}
+
+static GValue *
+param_coerce_unhandled (const TpCMParamSpec *param_spec,
+    GHashTable *asv,
+    const GValue *value,
+    GError **error)
+{
+  g_error ("%s: encountered unhandled D-Bus type %s on argument %s",
+      G_STRFUNC, param_spec->dtype, param_spec->name);
+
+  return NULL;
+}
+
+static ParamCoerceFunc
+param_coerce_func (const TpCMParamSpec *param_spec)
+{
   switch (param_spec->dtype[0])
     {
     case DBUS_TYPE_BOOLEAN:
     case DBUS_TYPE_OBJECT_PATH:
     case DBUS_TYPE_STRING:
     case DBUS_TYPE_ARRAY:
-        {
-          /* These types only accept an exactly-matching GType. */
-
-          if (G_VALUE_TYPE (value) != param_spec->gtype)
-            {
-              g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-                  "%s has type %s, but %s was expected",
-                  name, G_VALUE_TYPE_NAME (value),
-                  g_type_name (param_spec->gtype));
-              return NULL;
-            }
-
-          return tp_g_value_slice_dup (value);
-        }
+      return param_coerce_exact;
 
     case DBUS_TYPE_INT16:
     case DBUS_TYPE_INT32:
-        {
-          /* Coerce any sensible integer to G_TYPE_INT */
-          gboolean valid;
-          gint i;
+      return param_coerce_int;
 
-          i = tp_asv_get_int32 (asv, name, &valid);
+    case DBUS_TYPE_BYTE:
+    case DBUS_TYPE_UINT16:
+    case DBUS_TYPE_UINT32:
+      return param_coerce_uint;
 
-          if (!valid)
-            {
-              g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-                  "%s has a non-integer type or is out of range (type=%s)",
-                  name, G_VALUE_TYPE_NAME (value));
-              return NULL;
-            }
+    case DBUS_TYPE_INT64:
+      return param_coerce_int64;
 
-          if (param_spec->dtype[0] == DBUS_TYPE_INT16 &&
-              (i < -0x8000 || i > 0x7fff))
-            {
-              g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-                  "%s is out of range for a 16-bit signed integer", name);
-              return NULL;
-            }
+    case DBUS_TYPE_UINT64:
+      return param_coerce_uint64;
 
-          return tp_g_value_slice_new_int (i);
-        }
+    case DBUS_TYPE_DOUBLE:
+      return param_coerce_double;
 
-    case DBUS_TYPE_BYTE:
-    case DBUS_TYPE_UINT16:
-    case DBUS_TYPE_UINT32:
-        {
-          /* Coerce any sensible integer to G_TYPE_UINT */
-          gboolean valid;
-          guint i;
+    default:
+      /* only a problem if a value is actually supplied */
+      return param_coerce_unhandled;
+    }
+}
 
-          i = tp_asv_get_uint32 (asv, name, &valid);
+static ParamPlan *
+param_plan_new (const TpCMParamSpec *parameters)
+{
+  ParamPlan *plan = g_slice_new0 (ParamPlan);
+  guint i;
 
-          if (!valid)
-            {
-              g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-                  "%s has a non-integer type or is out of range (type=%s)",
-                  name, G_VALUE_TYPE_NAME (value));
-              return NULL;
-            }
+  plan->parameters = parameters;
 
-          if (param_spec->dtype[0] == DBUS_TYPE_BYTE && i > 0xff)
-            {
-              g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-                  "%s is out of range for a byte", name);
-              return NULL;
-            }
+  while (parameters[plan->n_parameters].name != NULL)
+    plan->n_parameters++;
 
-          if (param_spec->dtype[0] == DBUS_TYPE_UINT16 && i > 0xffff)
-            {
-              g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-                  "%s is out of range for a 16-bit unsigned integer", name);
-              return NULL;
-            }
+  plan->indices = g_hash_table_new (g_str_hash, g_str_equal);
+  plan->coerce = g_new (ParamCoerceFunc, plan->n_parameters);
+  plan->required = tp_intset_sized_new (plan->n_parameters);
+  plan->required_to_register = tp_intset_sized_new (plan->n_parameters);
 
-          if (param_spec->dtype[0] == DBUS_TYPE_BYTE)
-            return tp_g_value_slice_new_byte (i);
-          else
-            return tp_g_value_slice_new_uint (i);
-        }
+  for (i = 0; i < plan->n_parameters; i++)
+    {
+      const TpCMParamSpec *param_spec = parameters + i;
 
-    case DBUS_TYPE_INT64:
-        {
-          /* Coerce any sensible integer to G_TYPE_INT64 */
-          gboolean valid;
-          gint64 i;
+      /* if a name appears twice, the first one wins */
+      if (g_hash_table_lookup (plan->indices, param_spec->name) == NULL)
+        g_hash_table_insert (plan->indices, (gpointer) param_spec->name,
+            GUINT_TO_POINTER (i + 1));
 
-          i = tp_asv_get_int64 (asv, name, &valid);
+      plan->coerce[i] = param_coerce_func (param_spec);
 
-          if (!valid)
-            {
-              g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-                  "%s is not a valid 64-bit signed integer (type=%s)", name,
-                  G_VALUE_TYPE_NAME (value));
-              return NULL;
-            }
+      if (param_spec->flags & TP_CONN_MGR_PARAM_FLAG_REQUIRED)
+        tp_intset_add (plan->required, i);
 
-          return tp_g_value_slice_new_int64 (i);
-        }
+      if (param_spec->flags & TP_CONN_MGR_PARAM_FLAG_REGISTER)
+        tp_intset_add (plan->required_to_register, i);
+    }
 
-    case DBUS_TYPE_UINT64:
-        {
-          /* Coerce any sensible integer to G_TYPE_UINT64 */
-          gboolean valid;
-          guint64 i;
+  return plan;
+}
 
-          i = tp_asv_get_uint64 (asv, name, &valid);
+static void
+param_plan_free (ParamPlan *plan)
+{
+  g_hash_table_unref (plan->indices);
+  g_free (plan->coerce);
+  tp_intset_destroy (plan->required);
+  tp_intset_destroy (plan->required_to_register);
+  g_slice_free (ParamPlan, plan);
+}
 
-          if (!valid)
-            {
-              g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-                  "%s is not a valid 64-bit unsigned integer (type=%s)", name,
-                  G_VALUE_TYPE_NAME (value));
-              return NULL;
-            }
+static const ParamPlan *
+tp_base_protocol_get_param_plan (TpBaseProtocol *self)
+{
+  const TpCMParamSpec *parameters;
 
-          return tp_g_value_slice_new_uint64 (i);
-        }
+  if (self->priv->param_plan_frozen)
+    return self->priv->param_plan;
 
-    case DBUS_TYPE_DOUBLE:
-        {
-          /* Coerce any sensible number to G_TYPE_DOUBLE */
-          gboolean valid;
-          gdouble d;
+  parameters = tp_base_protocol_get_parameters (self);
 
-          d = tp_asv_get_double (asv, name, &valid);
+  /* get_parameters() normally returns the same static array every time,
+   * but nothing guarantees it */
+  if (self->priv->param_plan != NULL &&
+      self->priv->param_plan->parameters != parameters)
+    tp_clear_pointer (&self->priv->param_plan, param_plan_free);
 
-          if (!valid)
-            {
-              g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-                  "%s is not a valid double (type=%s)", name,
-                  G_VALUE_TYPE_NAME (value));
-              return NULL;
-            }
+  if (self->priv->param_plan == NULL)
+    self->priv->param_plan = param_plan_new (parameters);
 
-          return tp_g_value_slice_new_double (d);
-        }
+  return self->priv->param_plan;
+}
 
-    default:
-        {
-          g_error ("%s: encountered unhandled D-Bus type %s on argument %s",
-              G_STRFUNC, param_spec->dtype, param_spec->name);
-        }
-    }
+/*
+ * _tp_base_protocol_freeze_param_plan:
+ * @self: a protocol
+ *
+ * Build the parameter plan if necessary, and never change it again, even if
+ * tp_base_protocol_get_parameters() starts returning a different array.
+ * After this, the plan is only read, so _tp_base_protocol_find_parameter()
+ * and _tp_base_protocol_sanitize_parameters() may be called from any thread.
+ * This must be called from the main thread, before anything that might use
+ * the plan is handed to another thread.
+ */
+void
+_tp_base_protocol_freeze_param_plan (TpBaseProtocol *self)
+{
+  tp_base_protocol_get_param_plan (self);
+  self->priv->param_plan_frozen = TRUE;
+}
+
+/*
+ * _tp_base_protocol_find_parameter:
+ * @self: a protocol
+ * @name: a parameter name
+ *
+ * Look up @name in the parameter plan. Unless
+ * _tp_base_protocol_freeze_param_plan() has been called, this must be
+ * called from the main thread.
+ *
+ * Returns: the index of @name in tp_base_protocol_get_parameters(), or -1
+ */
+gint
+_tp_base_protocol_find_parameter (TpBaseProtocol *self,
+    const gchar *name)
+{
+  const ParamPlan *plan = tp_base_protocol_get_param_plan (self);
 
-  g_assert_not_reached ();
+  return (gint) GPOINTER_TO_UINT (g_hash_table_lookup (plan->indices,
+        name)) - 1;
 }
 
-static GHashTable *
-tp_base_protocol_sanitize_parameters (TpBaseProtocol *self,
+/*
+ * _tp_base_protocol_sanitize_parameters:
+ * @self: a protocol
+ * @asv: the parameters provided via D-Bus
+ * @error: used to raise an error if %NULL is returned
+ *
+ * Check @asv against the parameter plan, coercing each value to the expected
+ * type and filling in defaults. Unless
+ * _tp_base_protocol_freeze_param_plan() has been called, this must be called
+ * from the main thread.
+ *
+ * Returns: (transfer full): a copy of @asv suitable for
+ *  #TpBaseProtocolClass.new_connection, or %NULL
+ */
+GHashTable *
+_tp_base_protocol_sanitize_parameters (TpBaseProtocol *self,
     GHashTable *asv,
     GError **error)
 {
-  GHashTable *combined;
-  const TpCMParamSpec *parameters;
+  const ParamPlan *plan = tp_base_protocol_get_param_plan (self);
+  const TpCMParamSpec *parameters = plan->parameters;
+  GHashTable *combined = NULL;
+  /* the supplied value of each parameter, or NULL */
+  const GValue **supplied;
+  GString *unknown = NULL;
+  GHashTableIter h_iter;
+  gpointer k, v;
+  TpIntset *required;
   guint i;
-  guint mandatory_flag;
 
-  parameters = tp_base_protocol_get_parameters (self);
+  supplied = g_new0 (const GValue *, plan->n_parameters + 1);
+  g_hash_table_iter_init (&h_iter, asv);
 
-  combined = g_hash_table_new_full (g_str_hash, g_str_equal,
-      g_free, (GDestroyNotify) tp_g_value_slice_free);
+  while (g_hash_table_iter_next (&h_iter, &k, &v))
+    {
+      guint index = GPOINTER_TO_UINT (g_hash_table_lookup (plan->indices, k));
+
+      if (index != 0)
+        {
+          supplied[index - 1] = v;
+        }
+      else
+        {
+          if (unknown == NULL)
+            unknown = g_string_new ("unknown parameters provided:");
 
-  if (!_tp_cm_param_spec_check_all_allowed (parameters, asv, error))
-    goto except;
+          g_string_append_c (unknown, ' ');
+          g_string_append (unknown, k);
+        }
+    }
 
-  if (tp_asv_get_boolean (asv, "register", NULL))
+  if (unknown != NULL)
     {
-      mandatory_flag = TP_CONN_MGR_PARAM_FLAG_REGISTER;
+      DEBUG ("%s", unknown->str);
+      g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
+          "%s", unknown->str);
+      g_string_free (unknown, TRUE);
+      goto except;
     }
+
+  if (tp_asv_get_boolean (asv, "register", NULL))
+    required = plan->required_to_register;
   else
-    {
-      mandatory_flag = TP_CONN_MGR_PARAM_FLAG_REQUIRED;
-    }
+    required = plan->required;
+
+  combined = g_hash_table_new_full (g_str_hash, g_str_equal,
+      g_free, (GDestroyNotify) tp_g_value_slice_free);
 
-  for (i = 0; parameters[i].name != NULL; i++)
+  for (i = 0; i < plan->n_parameters; i++)
     {
       const gchar *name = parameters[i].name;
 
-      if (tp_asv_lookup (asv, name) != NULL)
+      if (supplied[i] != NULL)
         {
           /* coerce to the expected type */
-          GValue *coerced = _tp_cm_param_spec_coerce (parameters + i, asv,
-              error);
+          GValue *coerced = plan->coerce[i] (parameters + i, asv,
+              supplied[i], error);
 
           if (coerced == NULL)
             goto except;
@@ -1644,7 +1817,7 @@ tp_base_protocol_sanitize_parameters (TpBaseProtocol *self,
 
           g_hash_table_insert (combined, g_strdup (name), coerced);
         }
-      else if ((parameters[i].flags & mandatory_flag) != 0)
+      else if (tp_intset_is_member (required, i))
         {
           DEBUG ("missing mandatory account parameter %s", name);
           g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
@@ -1664,10 +1837,12 @@ tp_base_protocol_sanitize_parameters (TpBaseProtocol *self,
         }
     }
 
+  g_free (supplied);
   return combined;
 
 except:
-  g_hash_table_unref (combined);
+  g_free (supplied);
+  tp_clear_pointer (&combined, g_hash_table_unref);
   return NULL;
 }
 
@@ -1708,7 +1883,7 @@ tp_base_protocol_new_connection (TpBaseProtocol *self,
   g_return_val_if_fail (cls != NULL, NULL);
   g_return_val_if_fail (cls->new_connection != NULL, NULL);
 
-  combined = tp_base_protocol_sanitize_parameters (self, asv, error);
+  combined = _tp_base_protocol_sanitize_parameters (self, asv, error);
 
   if (combined != NULL)
     {
@@ -1767,7 +1942,7 @@ protocol_identify_account (TpSvcProtocol *protocol,
 
   if (cls->identify_account != NULL)
     {
-      GHashTable *sanitized = tp_base_protocol_sanitize_parameters (self,
+      GHashTable *sanitized = _tp_base_protocol_sanitize_parameters (self,
           parameters, &error);
 
       if (sanitized != NULL)
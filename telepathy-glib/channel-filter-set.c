@@ -0,0 +1,650 @@
+/*
+ * TpChannelFilterSet - an index of channel filters
+ *
+ * Copyright © 2026 Collabora Ltd. <http://www.collabora.co.uk/>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * SECTION:channel-filter-set
+ * @title: TpChannelFilterSet
+ * @short_description: an index of channel filters
+ * @see_also: #TpBaseClient
+ *
+ * A #TpChannelFilterSet holds a number of channel filters, in the form
+ * used by the Observer, Approver and Handler interfaces: each filter is a
+ * map from D-Bus property names to values, and a channel matches the filter
+ * if each of those properties is present in the channel's immutable
+ * properties with an equal value. An empty filter matches every channel.
+ *
+ * Filters are indexed by their #TP_PROP_CHANNEL_CHANNEL_TYPE and
+ * #TP_PROP_CHANNEL_TARGET_HANDLE_TYPE, so matching a channel against the
+ * set only compares its remaining properties against filters which could
+ * possibly match, rather than every filter in the set. This makes it
+ * suitable for dispatchers with many clients.
+ *
+ * Integer values are considered to be equal if they are numerically equal,
+ * regardless of their exact type, as in tp_asv_get_uint32() and similar
+ * functions.
+ *
+ * A #TpChannelFilterSet is not thread-safe.
+ *
+ * Since: 0.UNRELEASED
+ */
+
+#include "config.h"
+
+#include <telepathy-glib/channel-filter-set.h>
+
+#include <dbus/dbus-glib.h>
+
+#include <telepathy-glib/dbus.h>
+#include <telepathy-glib/gtypes.h>
+#include <telepathy-glib/interfaces.h>
+#include <telepathy-glib/util.h>
+
+/**
+ * TpChannelFilterSet:
+ *
+ * A set of channel filters, indexed for matching. All fields are private.
+ *
+ * Since: 0.UNRELEASED
+ */
+
+G_DEFINE_BOXED_TYPE (TpChannelFilterSet, tp_channel_filter_set,
+    tp_channel_filter_set_ref, tp_channel_filter_set_unref);
+
+/* The filters whose channel type (or lack of one) is the same */
+typedef struct {
+    /* handle type => owned GPtrArray<borrowed Filter> */
+    GHashTable *by_handle_type;
+    /* owned GPtrArray<borrowed Filter> without a handle type */
+    GPtrArray *any_handle_type;
+} Bucket;
+
+typedef struct {
+    guint id;
+    /* owned, or NULL if the filter doesn't constrain ChannelType */
+    gchar *channel_type;
+    gboolean has_handle_type;
+    TpHandleType handle_type;
+    /* array of n_criteria property names and values, for the properties
+     * other than ChannelType and TargetHandleType */
+    guint n_criteria;
+    gchar **names;
+    GValue *values;
+    gpointer user_data;
+    GDestroyNotify destroy;
+} Filter;
+
+struct _TpChannelFilterSet {
+    gint ref_count;
+    guint next_id;
+    /* owned channel type => owned Bucket */
+    GHashTable *by_channel_type;
+    /* filters without a channel type */
+    Bucket *any_channel_type;
+    /* id => owned Filter */
+    GHashTable *by_id;
+};
+
+static Bucket *
+bucket_new (void)
+{
+  Bucket *bucket = g_slice_new (Bucket);
+
+  bucket->by_handle_type = g_hash_table_new_full (NULL, NULL, NULL,
+      (GDestroyNotify) g_ptr_array_unref);
+  bucket->any_handle_type = g_ptr_array_new ();
+  return bucket;
+}
+
+static void
+bucket_free (gpointer p)
+{
+  Bucket *bucket = p;
+
+  g_hash_table_unref (bucket->by_handle_type);
+  g_ptr_array_unref (bucket->any_handle_type);
+  g_slice_free (Bucket, bucket);
+}
+
+static gboolean
+bucket_is_empty (Bucket *bucket)
+{
+  return (bucket->any_handle_type->len == 0 &&
+      g_hash_table_size (bucket->by_handle_type) == 0);
+}
+
+static void
+filter_free (gpointer p)
+{
+  Filter *filter = p;
+  guint i;
+
+  if (filter->destroy != NULL)
+    filter->destroy (filter->user_data);
+
+  for (i = 0; i < filter->n_criteria; i++)
+    g_value_unset (filter->values + i);
+
+  g_free (filter->values);
+  g_strfreev (filter->names);
+  g_free (filter->channel_type);
+  g_slice_free (Filter, filter);
+}
+
+/**
+ * tp_channel_filter_set_new:
+ *
+ * <!-- -->
+ *
+ * Returns: (transfer full): a new, empty set of channel filters
+ *
+ * Since: 0.UNRELEASED
+ */
+TpChannelFilterSet *
+tp_channel_filter_set_new (void)
+{
+  TpChannelFilterSet *self = g_slice_new (TpChannelFilterSet);
+
+  self->ref_count = 1;
+  self->next_id = 1;
+  self->by_channel_type = g_hash_table_new_full (g_str_hash, g_str_equal,
+      g_free, bucket_free);
+  self->any_channel_type = bucket_new ();
+  self->by_id = g_hash_table_new_full (NULL, NULL, NULL, filter_free);
+  return self;
+}
+
+/**
+ * tp_channel_filter_set_ref:
+ * @self: a set of channel filters
+ *
+ * <!-- -->
+ *
+ * Returns: (transfer full): @self
+ *
+ * Since: 0.UNRELEASED
+ */
+TpChannelFilterSet *
+tp_channel_filter_set_ref (TpChannelFilterSet *self)
+{
+  g_return_val_if_fail (self != NULL, NULL);
+
+  g_atomic_int_inc (&self->ref_count);
+  return self;
+}
+
+/**
+ * tp_channel_filter_set_unref:
+ * @self: (transfer full): a set of channel filters
+ *
+ * Release a reference to @self. When the last reference is released, the
+ * @destroy function passed to tp_channel_filter_set_add() is called on each
+ * filter's user data.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_channel_filter_set_unref (TpChannelFilterSet *self)
+{
+  g_return_if_fail (self != NULL);
+
+  if (!g_atomic_int_dec_and_test (&self->ref_count))
+    return;
+
+  /* the buckets borrow the filters, so free them first */
+  g_hash_table_unref (self->by_channel_type);
+  bucket_free (self->any_channel_type);
+  g_hash_table_unref (self->by_id);
+  g_slice_free (TpChannelFilterSet, self);
+}
+
+/* Return the array in which @filter is (or should be) stored, creating it
+ * if @create is TRUE. */
+static GPtrArray *
+tp_channel_filter_set_get_array (TpChannelFilterSet *self,
+    Filter *filter,
+    gboolean create)
+{
+  Bucket *bucket;
+  GPtrArray *array;
+
+  if (filter->channel_type == NULL)
+    {
+      bucket = self->any_channel_type;
+    }
+  else
+    {
+      bucket = g_hash_table_lookup (self->by_channel_type,
+          filter->channel_type);
+
+      if (bucket == NULL)
+        {
+          if (!create)
+            return NULL;
+
+          bucket = bucket_new ();
+          g_hash_table_insert (self->by_channel_type,
+              g_strdup (filter->channel_type), bucket);
+        }
+    }
+
+  if (!filter->has_handle_type)
+    return bucket->any_handle_type;
+
+  array = g_hash_table_lookup (bucket->by_handle_type,
+      GUINT_TO_POINTER (filter->handle_type));
+
+  if (array == NULL && create)
+    {
+      array = g_ptr_array_new ();
+      g_hash_table_insert (bucket->by_handle_type,
+          GUINT_TO_POINTER (filter->handle_type), array);
+    }
+
+  return array;
+}
+
+/**
+ * tp_channel_filter_set_add:
+ * @self: a set of channel filters
+ * @filter: (transfer none) (element-type utf8 GObject.Value): a map from
+ *  D-Bus property names to the values they must have
+ * @user_data: data to be returned by tp_channel_filter_set_match() for
+ *  channels matching @filter
+ * @destroy: (allow-none): called on @user_data when the filter is removed,
+ *  or when @self is freed
+ *
+ * Add a filter to @self. The contents of @filter are copied, so it may be
+ * modified or freed afterwards.
+ *
+ * Returns: a non-zero identifier for the new filter, which can be passed to
+ *  tp_channel_filter_set_remove()
+ *
+ * Since: 0.UNRELEASED
+ */
+guint
+tp_channel_filter_set_add (TpChannelFilterSet *self,
+    GHashTable *filter,
+    gpointer user_data,
+    GDestroyNotify destroy)
+{
+  Filter *f;
+  GHashTableIter iter;
+  gpointer k, v;
+  guint n = 0;
+  gboolean valid;
+
+  g_return_val_if_fail (self != NULL, 0);
+  g_return_val_if_fail (filter != NULL, 0);
+
+  f = g_slice_new0 (Filter);
+  f->id = self->next_id++;
+  f->user_data = user_data;
+  f->destroy = destroy;
+
+  /* a ChannelType or TargetHandleType of an unexpected type can't be
+   * indexed, but is still compared in the same way as any other criterion */
+  f->channel_type = g_strdup (tp_asv_get_string (filter,
+        TP_PROP_CHANNEL_CHANNEL_TYPE));
+  f->handle_type = tp_asv_get_uint32 (filter,
+      TP_PROP_CHANNEL_TARGET_HANDLE_TYPE, &valid);
+  f->has_handle_type = valid;
+
+  f->names = g_new0 (gchar *, g_hash_table_size (filter) + 1);
+  f->values = g_new0 (GValue, g_hash_table_size (filter));
+
+  g_hash_table_iter_init (&iter, filter);
+
+  while (g_hash_table_iter_next (&iter, &k, &v))
+    {
+      if (f->channel_type != NULL &&
+          !tp_strdiff (k, TP_PROP_CHANNEL_CHANNEL_TYPE))
+        continue;
+
+      if (f->has_handle_type &&
+          !tp_strdiff (k, TP_PROP_CHANNEL_TARGET_HANDLE_TYPE))
+        continue;
+
+      f->names[n] = g_strdup (k);
+      g_value_init (f->values + n, G_VALUE_TYPE (v));
+      g_value_copy (v, f->values + n);
+      n++;
+    }
+
+  f->n_criteria = n;
+
+  g_ptr_array_add (tp_channel_filter_set_get_array (self, f, TRUE), f);
+  g_hash_table_insert (self->by_id, GUINT_TO_POINTER (f->id), f);
+  return f->id;
+}
+
+/**
+ * tp_channel_filter_set_remove:
+ * @self: a set of channel filters
+ * @id: an identifier returned by tp_channel_filter_set_add()
+ *
+ * Remove a filter from @self, calling the @destroy function that was passed
+ * to tp_channel_filter_set_add(), if any.
+ *
+ * Returns: %TRUE if the filter was removed, or %FALSE if there was no such
+ *  filter
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_channel_filter_set_remove (TpChannelFilterSet *self,
+    guint id)
+{
+  Filter *f;
+  GPtrArray *array;
+  Bucket *bucket;
+
+  g_return_val_if_fail (self != NULL, FALSE);
+
+  f = g_hash_table_lookup (self->by_id, GUINT_TO_POINTER (id));
+
+  if (f == NULL)
+    return FALSE;
+
+  array = tp_channel_filter_set_get_array (self, f, FALSE);
+  g_assert (array != NULL);
+  /* the order within an array doesn't matter: matches are sorted by id */
+  g_ptr_array_remove_fast (array, f);
+
+  if (f->channel_type == NULL)
+    bucket = self->any_channel_type;
+  else
+    bucket = g_hash_table_lookup (self->by_channel_type, f->channel_type);
+
+  if (array->len == 0 && f->has_handle_type)
+    g_hash_table_remove (bucket->by_handle_type,
+        GUINT_TO_POINTER (f->handle_type));
+
+  if (f->channel_type != NULL && bucket_is_empty (bucket))
+    g_hash_table_remove (self->by_channel_type, f->channel_type);
+
+  g_hash_table_remove (self->by_id, GUINT_TO_POINTER (id));
+  return TRUE;
+}
+
+/**
+ * tp_channel_filter_set_get_size:
+ * @self: a set of channel filters
+ *
+ * <!-- -->
+ *
+ * Returns: the number of filters in @self
+ *
+ * Since: 0.UNRELEASED
+ */
+guint
+tp_channel_filter_set_get_size (TpChannelFilterSet *self)
+{
+  g_return_val_if_fail (self != NULL, 0);
+
+  return g_hash_table_size (self->by_id);
+}
+
+/* If @value holds an integer, set *@negative to whether it's negative,
+ * *@magnitude to its absolute value, and return TRUE. */
+static gboolean
+value_get_integer (const GValue *value,
+    gboolean *negative,
+    guint64 *magnitude)
+{
+  gint64 i;
+
+  switch (G_VALUE_TYPE (value))
+    {
+      case G_TYPE_UCHAR:
+        *negative = FALSE;
+        *magnitude = g_value_get_uchar (value);
+        return TRUE;
+
+      case G_TYPE_UINT:
+        *negative = FALSE;
+        *magnitude = g_value_get_uint (value);
+        return TRUE;
+
+      case G_TYPE_UINT64:
+        *negative = FALSE;
+        *magnitude = g_value_get_uint64 (value);
+        return TRUE;
+
+      case G_TYPE_INT:
+        i = g_value_get_int (value);
+        break;
+
+      case G_TYPE_INT64:
+        i = g_value_get_int64 (value);
+        break;
+
+      default:
+        return FALSE;
+    }
+
+  *negative = (i < 0);
+  /* this avoids overflow for G_MININT64 */
+  *magnitude = (i < 0 ? ((guint64) (-(i + 1))) + 1 : (guint64) i);
+  return TRUE;
+}
+
+static gboolean
+values_equal (const GValue *a,
+    const GValue *b)
+{
+  gboolean a_negative, b_negative;
+  guint64 a_magnitude, b_magnitude;
+  GVariant *va, *vb;
+  gboolean ret;
+
+  if (G_VALUE_HOLDS_STRING (a) && G_VALUE_HOLDS_STRING (b))
+    return !tp_strdiff (g_value_get_string (a), g_value_get_string (b));
+
+  if (G_VALUE_HOLDS (a, DBUS_TYPE_G_OBJECT_PATH) &&
+      G_VALUE_HOLDS (b, DBUS_TYPE_G_OBJECT_PATH))
+    return !tp_strdiff (g_value_get_boxed (a), g_value_get_boxed (b));
+
+  if (G_VALUE_HOLDS_BOOLEAN (a) && G_VALUE_HOLDS_BOOLEAN (b))
+    return (!g_value_get_boolean (a) == !g_value_get_boolean (b));
+
+  if (value_get_integer (a, &a_negative, &a_magnitude) &&
+      value_get_integer (b, &b_negative, &b_magnitude))
+    return (a_negative == b_negative && a_magnitude == b_magnitude);
+
+  if (G_VALUE_TYPE (a) != G_VALUE_TYPE (b))
+    return FALSE;
+
+  /* anything else (doubles, arrays, structs...) is unusual in a filter, so
+   * it's fine for it to be slow */
+  va = g_variant_ref_sink (dbus_g_value_build_g_variant (a));
+  vb = g_variant_ref_sink (dbus_g_value_build_g_variant (b));
+  ret = g_variant_equal (va, vb);
+  g_variant_unref (va);
+  g_variant_unref (vb);
+  return ret;
+}
+
+static gboolean
+filter_matches (Filter *f,
+    GHashTable *channel_properties)
+{
+  guint i;
+
+  for (i = 0; i < f->n_criteria; i++)
+    {
+      GValue *value = g_hash_table_lookup (channel_properties, f->names[i]);
+
+      if (value == NULL || !values_equal (f->values + i, value))
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
+/* Append the filters in @bucket which match to @matches, or if @matches
+ * is NULL, stop at the first match. Returns TRUE if anything matched. */
+static gboolean
+bucket_match (Bucket *bucket,
+    gboolean has_handle_type,
+    TpHandleType handle_type,
+    GHashTable *channel_properties,
+    GPtrArray *matches)
+{
+  GPtrArray *arrays[2] = { bucket->any_handle_type, NULL };
+  gboolean ret = FALSE;
+  guint i, j;
+
+  if (has_handle_type)
+    arrays[1] = g_hash_table_lookup (bucket->by_handle_type,
+        GUINT_TO_POINTER (handle_type));
+
+  for (i = 0; i < G_N_ELEMENTS (arrays); i++)
+    {
+      if (arrays[i] == NULL)
+        continue;
+
+      for (j = 0; j < arrays[i]->len; j++)
+        {
+          Filter *f = g_ptr_array_index (arrays[i], j);
+
+          if (filter_matches (f, channel_properties))
+            {
+              if (matches == NULL)
+                return TRUE;
+
+              g_ptr_array_add (matches, f);
+              ret = TRUE;
+            }
+        }
+    }
+
+  return ret;
+}
+
+/* Append the matching filters to @matches, or if @matches is NULL, stop at
+ * the first match. Returns TRUE if anything matched. */
+static gboolean
+tp_channel_filter_set_collect (TpChannelFilterSet *self,
+    GHashTable *channel_properties,
+    GPtrArray *matches)
+{
+  const gchar *channel_type;
+  TpHandleType handle_type;
+  gboolean has_handle_type;
+  gboolean ret;
+
+  channel_type = tp_asv_get_string (channel_properties,
+      TP_PROP_CHANNEL_CHANNEL_TYPE);
+  handle_type = tp_asv_get_uint32 (channel_properties,
+      TP_PROP_CHANNEL_TARGET_HANDLE_TYPE, &has_handle_type);
+
+  ret = bucket_match (self->any_channel_type, has_handle_type, handle_type,
+      channel_properties, matches);
+
+  if (ret && matches == NULL)
+    return TRUE;
+
+  if (channel_type != NULL)
+    {
+      Bucket *bucket = g_hash_table_lookup (self->by_channel_type,
+          channel_type);
+
+      if (bucket != NULL &&
+          bucket_match (bucket, has_handle_type, handle_type,
+            channel_properties, matches))
+        ret = TRUE;
+    }
+
+  return ret;
+}
+
+static gint
+filter_cmp_id (gconstpointer a,
+    gconstpointer b)
+{
+  const Filter *fa = *(Filter * const *) a;
+  const Filter *fb = *(Filter * const *) b;
+
+  return (fa->id < fb->id ? -1 : (fa->id > fb->id ? 1 : 0));
+}
+
+/**
+ * tp_channel_filter_set_match:
+ * @self: a set of channel filters
+ * @channel_properties: (transfer none) (element-type utf8 GObject.Value):
+ *  the immutable properties of a channel
+ *
+ * Find the filters in @self which match a channel.
+ *
+ * Returns: (transfer container): the @user_data passed to
+ *  tp_channel_filter_set_add() for each matching filter, in the order in
+ *  which they were added. Free the list with g_list_free().
+ *
+ * Since: 0.UNRELEASED
+ */
+GList *
+tp_channel_filter_set_match (TpChannelFilterSet *self,
+    GHashTable *channel_properties)
+{
+  GPtrArray *matches;
+  GList *ret = NULL;
+  guint i;
+
+  g_return_val_if_fail (self != NULL, NULL);
+  g_return_val_if_fail (channel_properties != NULL, NULL);
+
+  matches = g_ptr_array_new ();
+  tp_channel_filter_set_collect (self, channel_properties, matches);
+  g_ptr_array_sort (matches, filter_cmp_id);
+
+  for (i = matches->len; i > 0; i--)
+    {
+      Filter *f = g_ptr_array_index (matches, i - 1);
+
+      ret = g_list_prepend (ret, f->user_data);
+    }
+
+  g_ptr_array_unref (matches);
+  return ret;
+}
+
+/**
+ * tp_channel_filter_set_matches:
+ * @self: a set of channel filters
+ * @channel_properties: (transfer none) (element-type utf8 GObject.Value):
+ *  the immutable properties of a channel
+ *
+ * Return whether any filter in @self matches a channel. This is more
+ * efficient than tp_channel_filter_set_match(), since it stops at the first
+ * match.
+ *
+ * Returns: %TRUE if at least one filter matches
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_channel_filter_set_matches (TpChannelFilterSet *self,
+    GHashTable *channel_properties)
+{
+  g_return_val_if_fail (self != NULL, FALSE);
+  g_return_val_if_fail (channel_properties != NULL, FALSE);
+
+  return tp_channel_filter_set_collect (self, channel_properties, NULL);
+}
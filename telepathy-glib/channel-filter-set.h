@@ -0,0 +1,67 @@
+/*
+ * Header file for TpChannelFilterSet - an index of channel filters
+ *
+ * Copyright © 2026 Collabora Ltd. <http://www.collabora.co.uk/>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#if defined (TP_DISABLE_SINGLE_INCLUDE) && !defined (_TP_IN_META_HEADER) && !defined (_TP_COMPILATION)
+#error "Only <telepathy-glib/telepathy-glib.h> and <telepathy-glib/telepathy-glib-dbus.h> can be included directly."
+#endif
+
+#ifndef __TP_CHANNEL_FILTER_SET_H__
+#define __TP_CHANNEL_FILTER_SET_H__
+
+#include <glib-object.h>
+
+#include <telepathy-glib/defs.h>
+
+G_BEGIN_DECLS
+
+typedef struct _TpChannelFilterSet TpChannelFilterSet;
+
+#define TP_TYPE_CHANNEL_FILTER_SET (tp_channel_filter_set_get_type ())
+_TP_AVAILABLE_IN_UNRELEASED
+GType tp_channel_filter_set_get_type (void);
+
+_TP_AVAILABLE_IN_UNRELEASED
+TpChannelFilterSet *tp_channel_filter_set_new (void) G_GNUC_WARN_UNUSED_RESULT;
+_TP_AVAILABLE_IN_UNRELEASED
+TpChannelFilterSet *tp_channel_filter_set_ref (TpChannelFilterSet *self);
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_channel_filter_set_unref (TpChannelFilterSet *self);
+
+_TP_AVAILABLE_IN_UNRELEASED
+guint tp_channel_filter_set_add (TpChannelFilterSet *self,
+    GHashTable *filter,
+    gpointer user_data,
+    GDestroyNotify destroy);
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_channel_filter_set_remove (TpChannelFilterSet *self,
+    guint id);
+_TP_AVAILABLE_IN_UNRELEASED
+guint tp_channel_filter_set_get_size (TpChannelFilterSet *self);
+
+_TP_AVAILABLE_IN_UNRELEASED
+GList *tp_channel_filter_set_match (TpChannelFilterSet *self,
+    GHashTable *channel_properties) G_GNUC_WARN_UNUSED_RESULT;
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_channel_filter_set_matches (TpChannelFilterSet *self,
+    GHashTable *channel_properties);
+
+G_END_DECLS
+
+#endif
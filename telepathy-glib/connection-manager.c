@@ -36,8 +36,10 @@
 
 #define DEBUG_FLAG TP_DEBUG_MANAGER
 #include "telepathy-glib/debug-internal.h"
+#include "telepathy-glib/manager-file-cache-internal.h"
 #include "telepathy-glib/protocol-internal.h"
 #include "telepathy-glib/util-internal.h"
+#include "telepathy-glib/variant-util-internal.h"
 
 #include "telepathy-glib/_gen/tp-cli-connection-manager-body.h"
 
@@ -1040,6 +1042,39 @@ tp_connection_manager_name_owner_changed_cb (TpDBusDaemon *bus,
   g_object_unref (self);
 }
 
+static GHashTable *
+tp_connection_manager_protocols_from_cache (TpDBusDaemon *dbus_daemon,
+    const gchar *cm_name,
+    GVariant *cached)
+{
+  GHashTable *protocols;
+  GVariantIter iter;
+  const gchar *name;
+  GVariant *immutables;
+
+  protocols = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+      g_object_unref);
+
+  g_variant_iter_init (&iter, cached);
+
+  while (g_variant_iter_loop (&iter, "(&s@a{sv})", &name, &immutables))
+    {
+      TpProtocol *proto_object;
+
+      /* the cache isn't trusted any more than the .manager file is */
+      if (!tp_connection_manager_check_valid_protocol_name (name, NULL))
+        continue;
+
+      proto_object = tp_protocol_new_vardict (dbus_daemon, cm_name, name,
+          immutables, NULL);
+
+      if (proto_object != NULL)
+        g_hash_table_insert (protocols, g_strdup (name), proto_object);
+    }
+
+  return protocols;
+}
+
 static gboolean
 tp_connection_manager_read_file (TpDBusDaemon *dbus_daemon,
     const gchar *cm_name,
@@ -1054,11 +1089,29 @@ tp_connection_manager_read_file (TpDBusDaemon *dbus_daemon,
   TpProtocol *proto_object;
   GHashTable *protocols = NULL;
   GStrv interfaces = NULL;
+  gboolean use_cache = g_path_is_absolute (filename);
+  gint64 mtime = -1;
+  guint64 size = 0;
+  GVariant *cached = NULL;
+  GVariantBuilder cache_builder;
+
+  if (use_cache &&
+      _tp_manager_file_cache_load (filename, &mtime, &size, &interfaces,
+        &cached))
+    {
+      protocols = tp_connection_manager_protocols_from_cache (dbus_daemon,
+          cm_name, cached);
+      g_variant_unref (cached);
+      goto finally;
+    }
 
   file = g_key_file_new ();
 
   if (!g_key_file_load_from_file (file, filename, G_KEY_FILE_NONE, error))
-    return FALSE;
+    {
+      g_key_file_free (file);
+      return FALSE;
+    }
 
   /* if missing, it's not an error, so ignore @error */
   interfaces = g_key_file_get_string_list (file, "ConnectionManager",
@@ -1067,6 +1120,9 @@ tp_connection_manager_read_file (TpDBusDaemon *dbus_daemon,
   protocols = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
       g_object_unref);
 
+  g_variant_builder_init (&cache_builder,
+      _TP_MANAGER_FILE_CACHE_PROTOCOLS_TYPE);
+
   groups = g_key_file_get_groups (file, NULL);
 
   if (groups == NULL)
@@ -1087,6 +1143,14 @@ tp_connection_manager_read_file (TpDBusDaemon *dbus_daemon,
           immutables, NULL);
       g_assert (proto_object != NULL);
 
+      if (use_cache)
+        {
+          GVariant *vardict = _tp_asv_to_vardict (immutables);
+
+          g_variant_builder_add (&cache_builder, "(s@a{sv})", name, vardict);
+          g_variant_unref (vardict);
+        }
+
       /* steals @name */
       g_hash_table_insert (protocols, name, proto_object);
 
@@ -1097,6 +1161,19 @@ success:
   g_strfreev (groups);
   g_key_file_free (file);
 
+  if (use_cache)
+    {
+      cached = g_variant_ref_sink (g_variant_builder_end (&cache_builder));
+      _tp_manager_file_cache_save (filename, mtime, size,
+          (const gchar * const *) interfaces, cached);
+      g_variant_unref (cached);
+    }
+  else
+    {
+      g_variant_builder_clear (&cache_builder);
+    }
+
+finally:
   if (protocols_out != NULL)
     *protocols_out = protocols;
   else
@@ -28,6 +28,7 @@
 #include <telepathy-glib/channel.h>
 #include <telepathy-glib/dbus.h>
 #include <telepathy-glib/util.h>
+#include <telepathy-glib/util-internal.h>
 
 #define DEBUG_FLAG TP_DEBUG_CHANNEL
 #include "telepathy-glib/channel-internal.h"
@@ -57,7 +58,17 @@
  * #GObject::notify for details.
  *
  * You can search as many times as you want on a #TpContactSearch object,
- * but you need to call tp_contact_search_reset_async() between searches.
+ * but you need to call tp_contact_search_reset_async() between searches,
+ * or use tp_contact_search_restart_async() to do both at once. A running
+ * search can be cancelled with tp_contact_search_stop().
+ *
+ * Directory searches can return a very large number of results. If
+ * #TpContactSearch:window-size is set, results are also kept in a window
+ * which can be read with tp_contact_search_get_results(); once the
+ * application has consumed results, it releases them with
+ * tp_contact_search_release_results(), and if #TpContactSearch:limit is
+ * set and the server supports it, further pages of results are only
+ * requested when there is room for them in the window.
  *
  * Since: 0.13.11
  */
@@ -97,6 +108,17 @@ struct _TpContactSearchPrivate
 
   GCancellable *cancellable;
   GSimpleAsyncResult *async_res;
+  /* owned; if not NULL, the search to start once the channel requested by
+   * tp_contact_search_restart_async() is ready */
+  GHashTable *restart_criteria;
+
+  /* If nonzero, results are kept in @results, and More() is only called
+   * while fewer than this many are kept */
+  guint window_size;
+  /* owned TpContactSearchResult; the index of results[i] in the search is
+   * n_released + i */
+  GPtrArray *results;
+  guint n_released;
 };
 
 enum /* properties */
@@ -106,6 +128,7 @@ enum /* properties */
   PROP_SERVER,
   PROP_LIMIT,
   PROP_STATE,
+  PROP_WINDOW_SIZE,
 };
 
 enum /* signals */
@@ -129,6 +152,41 @@ close_search_channel (TpContactSearch *self)
     }
 }
 
+static void
+clear_results (TpContactSearch *self)
+{
+  g_ptr_array_set_size (self->priv->results, 0);
+  self->priv->n_released = 0;
+}
+
+static void
+more_cb (TpChannel *channel,
+    const GError *error,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  if (error != NULL)
+    DEBUG ("More() failed: %s", error->message);
+}
+
+/* Ask for the next page of results if the server has some, and there is
+ * room for them */
+static void
+maybe_request_more (TpContactSearch *self)
+{
+  if (self->priv->window_size == 0 ||
+      self->priv->channel == NULL ||
+      self->priv->state != TP_CHANNEL_CONTACT_SEARCH_STATE_MORE_AVAILABLE ||
+      self->priv->results->len >= self->priv->window_size)
+    return;
+
+  DEBUG ("%u results in the window; asking for more",
+      self->priv->results->len);
+
+  tp_cli_channel_type_contact_search_call_more (self->priv->channel, -1,
+      more_cb, NULL, NULL, G_OBJECT (self));
+}
+
 static void
 _search_state_changed (TpChannel *channel,
     guint state,
@@ -139,11 +197,17 @@ _search_state_changed (TpChannel *channel,
 {
   TpContactSearch *self = TP_CONTACT_SEARCH (weak_object);
 
+  /* ignore a channel that has been replaced by a reset or restart */
+  if (channel != self->priv->channel)
+    return;
+
   if (self->priv->state != state)
     {
       DEBUG ("SearchStateChanged: %u", state);
       self->priv->state = state;
       g_object_notify (weak_object, "state");
+
+      maybe_request_more (self);
     }
 }
 
@@ -153,11 +217,15 @@ _search_results_received (TpChannel *channel,
     gpointer user_data,
     GObject *object)
 {
+  TpContactSearch *self = TP_CONTACT_SEARCH (object);
   GHashTableIter iter;
   gchar *contact;
   GPtrArray *info;
   GList *results = NULL;
 
+  if (channel != self->priv->channel)
+    return;
+
   g_hash_table_iter_init (&iter, result);
   while (g_hash_table_iter_next (&iter, (gpointer) &contact, (gpointer) &info))
     {
@@ -179,6 +247,11 @@ _search_results_received (TpChannel *channel,
           _tp_contact_search_result_insert_field (search_result, contact_field);
         }
       results = g_list_prepend (results, search_result);
+
+      if (self->priv->window_size != 0)
+        g_ptr_array_add (self->priv->results, g_object_ref (search_result));
+      else
+        self->priv->n_released++;
     }
 
   DEBUG ("SearchResultsReceived (%i results)", g_hash_table_size (result));
@@ -187,13 +260,61 @@ _search_results_received (TpChannel *channel,
   g_list_free_full (results, g_object_unref);
 }
 
+/* If a reset or restart is in progress, make it fail with
+ * G_IO_ERROR_CANCELLED, so that another can be started straight away */
+static void
+cancel_pending_operation (TpContactSearch *self)
+{
+  if (self->priv->async_res == NULL)
+    return;
+
+  DEBUG ("Cancelling the previous reset or restart");
+
+  g_cancellable_cancel (self->priv->cancellable);
+  g_object_unref (self->priv->cancellable);
+  self->priv->cancellable = g_cancellable_new ();
+
+  tp_clear_pointer (&self->priv->restart_criteria, g_hash_table_unref);
+
+  g_simple_async_result_set_error (self->priv->async_res, G_IO_ERROR,
+      G_IO_ERROR_CANCELLED, "Superseded by another reset or restart");
+  g_simple_async_result_complete_in_idle (self->priv->async_res);
+  tp_clear_object (&self->priv->async_res);
+}
+
+static void
+restart_search_cb (TpChannel *channel,
+    const GError *error,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  TpContactSearch *self = TP_CONTACT_SEARCH (weak_object);
+  GSimpleAsyncResult *operation = user_data;
+
+  /* if it has been superseded, it has already been completed */
+  if (operation != self->priv->async_res)
+    return;
+
+  if (error != NULL)
+    {
+      DEBUG ("Search() failed: %s", error->message);
+      g_simple_async_result_set_from_error (self->priv->async_res, error);
+    }
+
+  g_simple_async_result_complete (self->priv->async_res);
+  tp_clear_object (&self->priv->async_res);
+}
+
 static void
 _create_search_channel_cb (GObject *source_object,
     GAsyncResult *result,
     gpointer user_data)
 {
   TpAccountChannelRequest *channel_request;
-  TpContactSearch *self = TP_CONTACT_SEARCH (user_data);
+  GSimpleAsyncResult *operation = user_data;
+  TpContactSearch *self = TP_CONTACT_SEARCH (
+      g_async_result_get_source_object (G_ASYNC_RESULT (operation)));
+  TpChannel *channel;
   GHashTable *properties;
   GError *error = NULL;
   const gchar *server;
@@ -202,9 +323,26 @@ _create_search_channel_cb (GObject *source_object,
 
   channel_request = TP_ACCOUNT_CHANNEL_REQUEST (source_object);
 
-  self->priv->channel =
-      tp_account_channel_request_create_and_handle_channel_finish (
-          channel_request, result, NULL, &error);
+  channel = tp_account_channel_request_create_and_handle_channel_finish (
+      channel_request, result, NULL, &error);
+
+  if (operation != self->priv->async_res)
+    {
+      /* superseded by a later reset or restart, which has already
+       * completed this one */
+      DEBUG ("Discarding channel for a superseded search");
+
+      if (channel != NULL)
+        {
+          tp_cli_channel_call_close (channel, -1, NULL, NULL, NULL, NULL);
+          g_object_unref (channel);
+        }
+
+      g_clear_error (&error);
+      goto finally;
+    }
+
+  self->priv->channel = channel;
 
   if (self->priv->channel == NULL)
     {
@@ -256,9 +394,27 @@ _create_search_channel_cb (GObject *source_object,
       /* This function is safe if self->priv->channel is NULL. */
       close_search_channel (self);
     }
+  else if (self->priv->restart_criteria != NULL)
+    {
+      GHashTable *criteria = self->priv->restart_criteria;
+
+      /* tp_contact_search_restart_async() completes when the search has
+       * started */
+      self->priv->restart_criteria = NULL;
+      tp_cli_channel_type_contact_search_call_search (self->priv->channel,
+          -1, criteria, restart_search_cb, g_object_ref (operation),
+          g_object_unref, G_OBJECT (self));
+      g_hash_table_unref (criteria);
+      goto finally;
+    }
 
+  tp_clear_pointer (&self->priv->restart_criteria, g_hash_table_unref);
   g_simple_async_result_complete (self->priv->async_res);
   tp_clear_object (&self->priv->async_res);
+
+finally:
+  g_object_unref (operation);
+  g_object_unref (self);
 }
 
 static void
@@ -268,6 +424,7 @@ tp_contact_search_open_new_channel (TpContactSearch *self)
   TpAccountChannelRequest *channel_request;
 
   close_search_channel (self);
+  clear_results (self);
 
   DEBUG ("Requesting new search channel");
 
@@ -295,7 +452,7 @@ tp_contact_search_open_new_channel (TpContactSearch *self)
       channel_request,
       self->priv->cancellable,
       _create_search_channel_cb,
-      G_OBJECT (self));
+      g_object_ref (self->priv->async_res));
   g_object_unref (channel_request);
 
   g_hash_table_unref (request);
@@ -325,6 +482,10 @@ tp_contact_search_set_property (GObject *object,
         self->priv->limit = g_value_get_uint (value);
         break;
 
+      case PROP_WINDOW_SIZE:
+        tp_contact_search_set_window_size (self, g_value_get_uint (value));
+        break;
+
       default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID (self, prop_id, pspec);
         break;
@@ -357,6 +518,10 @@ tp_contact_search_get_property (GObject *object,
         g_value_set_uint (value, self->priv->state);
         break;
 
+      case PROP_WINDOW_SIZE:
+        g_value_set_uint (value, self->priv->window_size);
+        break;
+
       default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
         break;
@@ -371,10 +536,22 @@ tp_contact_search_dispose (GObject *object)
   close_search_channel (self);
   g_object_unref (self->priv->account);
   g_object_unref (self->priv->cancellable);
+  clear_results (self);
 
   G_OBJECT_CLASS (tp_contact_search_parent_class)->dispose (object);
 }
 
+static void
+tp_contact_search_finalize (GObject *object)
+{
+  TpContactSearch *self = TP_CONTACT_SEARCH (object);
+
+  g_ptr_array_unref (self->priv->results);
+  tp_clear_pointer (&self->priv->restart_criteria, g_hash_table_unref);
+
+  G_OBJECT_CLASS (tp_contact_search_parent_class)->finalize (object);
+}
+
 static void
 tp_contact_search_class_init (TpContactSearchClass *klass)
 {
@@ -383,6 +560,7 @@ tp_contact_search_class_init (TpContactSearchClass *klass)
   gobject_class->set_property = tp_contact_search_set_property;
   gobject_class->get_property = tp_contact_search_get_property;
   gobject_class->dispose = tp_contact_search_dispose;
+  gobject_class->finalize = tp_contact_search_finalize;
 
   /**
    * TpContactSearch:account:
@@ -459,6 +637,32 @@ tp_contact_search_class_init (TpContactSearchClass *klass)
         TP_CHANNEL_CONTACT_SEARCH_STATE_NOT_STARTED,
         G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * TpContactSearch:window-size:
+   *
+   * If zero (the default), search results are only passed to
+   * #TpContactSearch::search-results-received, and are not kept.
+   *
+   * Otherwise, results are also kept until they are released with
+   * tp_contact_search_release_results(), and can be retrieved with
+   * tp_contact_search_get_results(). When the server has more results
+   * available (which requires #TpContactSearch:limit to be set), they are
+   * only requested while fewer than this many results are kept, so the
+   * number of results in memory is bounded by about this plus
+   * #TpContactSearch:limit.
+   *
+   * Since: 0.UNRELEASED
+   */
+  g_object_class_install_property (gobject_class,
+      PROP_WINDOW_SIZE,
+      g_param_spec_uint ("window-size",
+        "Window size",
+        "The number of results to keep before asking for more, or 0",
+        0,
+        G_MAXUINT32,
+        0,
+        G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * TpContactSearch::search-results-received:
    * @self: a contact search
@@ -490,6 +694,7 @@ tp_contact_search_init (TpContactSearch *self)
       TpContactSearchPrivate);
 
   self->priv->cancellable = g_cancellable_new ();
+  self->priv->results = g_ptr_array_new_with_free_func (g_object_unref);
 }
 
 /**
@@ -582,15 +787,7 @@ tp_contact_search_reset_async (TpContactSearch *self,
 {
   g_return_if_fail (TP_IS_CONTACT_SEARCH (self));
 
-  if (self->priv->async_res != NULL)
-    {
-      g_cancellable_cancel (self->priv->cancellable);
-      g_object_unref (self->priv->cancellable);
-
-      self->priv->cancellable = g_cancellable_new ();
-    }
-
-  g_return_if_fail (self->priv->async_res == NULL);
+  cancel_pending_operation (self);
 
   g_free (self->priv->server);
   self->priv->server = g_strdup (server);
@@ -744,6 +941,222 @@ tp_contact_search_get_limit (TpContactSearch *self)
   return self->priv->limit;
 }
 
+/**
+ * tp_contact_search_set_window_size:
+ * @self: a #TpContactSearch
+ * @window_size: the new value of #TpContactSearch:window-size
+ *
+ * Set #TpContactSearch:window-size. This should be done before calling
+ * tp_contact_search_start().
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_contact_search_set_window_size (TpContactSearch *self,
+    guint window_size)
+{
+  g_return_if_fail (TP_IS_CONTACT_SEARCH (self));
+
+  if (self->priv->window_size == window_size)
+    return;
+
+  self->priv->window_size = window_size;
+
+  if (window_size == 0)
+    {
+      /* keep the indices of future results right */
+      self->priv->n_released += self->priv->results->len;
+      g_ptr_array_set_size (self->priv->results, 0);
+    }
+
+  g_object_notify (G_OBJECT (self), "window-size");
+  maybe_request_more (self);
+}
+
+/**
+ * tp_contact_search_get_n_results:
+ * @self: a #TpContactSearch
+ *
+ * Return the number of results received so far by the current search,
+ * including those which have been released, and those which were not kept
+ * because #TpContactSearch:window-size is 0. Results are numbered from 0
+ * in the order they were received.
+ *
+ * Returns: the number of results received
+ *
+ * Since: 0.UNRELEASED
+ */
+guint
+tp_contact_search_get_n_results (TpContactSearch *self)
+{
+  g_return_val_if_fail (TP_IS_CONTACT_SEARCH (self), 0);
+
+  return self->priv->n_released + self->priv->results->len;
+}
+
+/**
+ * tp_contact_search_get_results:
+ * @self: a #TpContactSearch
+ * @offset: the index of the first result to return
+ * @limit: the maximum number of results to return, or 0 for no limit
+ *
+ * Return the results of the current search numbered from @offset to
+ * @offset + @limit - 1, omitting those which have been released with
+ * tp_contact_search_release_results() or have not been received yet. This
+ * is only useful if #TpContactSearch:window-size is nonzero.
+ *
+ * Returns: (transfer container) (element-type TelepathyGLib.ContactSearchResult):
+ *  a #GList of results, in the order they were received; free it with
+ *  g_list_free()
+ *
+ * Since: 0.UNRELEASED
+ */
+GList *
+tp_contact_search_get_results (TpContactSearch *self,
+    guint offset,
+    guint limit)
+{
+  GList *ret = NULL;
+  guint first, end, i;
+
+  g_return_val_if_fail (TP_IS_CONTACT_SEARCH (self), NULL);
+
+  first = MAX (offset, self->priv->n_released) - self->priv->n_released;
+  end = self->priv->results->len;
+
+  if (limit != 0 && offset + limit > self->priv->n_released)
+    end = MIN (end, offset + limit - self->priv->n_released);
+  else if (limit != 0)
+    end = 0;
+
+  for (i = end; i > first; i--)
+    ret = g_list_prepend (ret, g_ptr_array_index (self->priv->results, i - 1));
+
+  return ret;
+}
+
+/**
+ * tp_contact_search_release_results:
+ * @self: a #TpContactSearch
+ * @n_results: the index of the first result which should be kept
+ *
+ * Release the results of the current search numbered below @n_results,
+ * once the application has consumed them: @self no longer keeps a
+ * reference to them, and they are no longer counted against
+ * #TpContactSearch:window-size, so more results may be requested from the
+ * server.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_contact_search_release_results (TpContactSearch *self,
+    guint n_results)
+{
+  guint n;
+
+  g_return_if_fail (TP_IS_CONTACT_SEARCH (self));
+
+  if (n_results <= self->priv->n_released)
+    return;
+
+  n = MIN (n_results - self->priv->n_released, self->priv->results->len);
+  g_ptr_array_remove_range (self->priv->results, 0, n);
+  self->priv->n_released += n;
+
+  maybe_request_more (self);
+}
+
+/**
+ * tp_contact_search_stop:
+ * @self: a #TpContactSearch
+ *
+ * Cancel the current search, if it is in progress or more results are
+ * available. The connection manager will move the search to
+ * %TP_CHANNEL_CONTACT_SEARCH_STATE_FAILED or
+ * %TP_CHANNEL_CONTACT_SEARCH_STATE_COMPLETED and stop sending results.
+ * Results which have already been received are kept.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_contact_search_stop (TpContactSearch *self)
+{
+  g_return_if_fail (TP_IS_CONTACT_SEARCH (self));
+
+  if (self->priv->channel == NULL ||
+      (self->priv->state != TP_CHANNEL_CONTACT_SEARCH_STATE_IN_PROGRESS &&
+       self->priv->state != TP_CHANNEL_CONTACT_SEARCH_STATE_MORE_AVAILABLE))
+    return;
+
+  DEBUG ("Stopping search");
+
+  tp_cli_channel_type_contact_search_call_stop (self->priv->channel, -1,
+      NULL, NULL, NULL, NULL);
+}
+
+/**
+ * tp_contact_search_restart_async:
+ * @self: a #TpContactSearch
+ * @criteria: (transfer none) (element-type utf8 utf8): a map
+ * from keys returned by tp_contact_search_get_search_keys()
+ * to values to search for
+ * @callback: a #GAsyncReadyCallback to call when the new search has started
+ * @user_data: data to pass to the callback function
+ *
+ * Stop the current search if it is still running, discard its results,
+ * and start a new search for @criteria on the same server and with the same
+ * limit, typically to refine the query as the user types.
+ *
+ * A search channel can only be used for one search, so this replaces the
+ * channel used by @self, as tp_contact_search_reset_async() would; but
+ * @self, its signal connections and its #TpContactSearch:window-size are
+ * kept. As with tp_contact_search_reset_async(), a reset or restart which
+ * is already in progress is cancelled.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_contact_search_restart_async (TpContactSearch *self,
+    GHashTable *criteria,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_return_if_fail (TP_IS_CONTACT_SEARCH (self));
+  g_return_if_fail (criteria != NULL);
+
+  cancel_pending_operation (self);
+  tp_contact_search_stop (self);
+
+  self->priv->restart_criteria = g_hash_table_ref (criteria);
+
+  self->priv->async_res = g_simple_async_result_new (G_OBJECT (self),
+      callback,
+      user_data,
+      tp_contact_search_restart_async);
+
+  tp_contact_search_open_new_channel (self);
+}
+
+/**
+ * tp_contact_search_restart_finish:
+ * @self: a #TpContactSearch
+ * @result: the #GAsyncResult from the callback
+ * @error: a #GError location to store an error, or %NULL
+ *
+ * <!-- -->
+ *
+ * Returns: %TRUE if the new search was started
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_contact_search_restart_finish (TpContactSearch *self,
+    GAsyncResult *result,
+    GError **error)
+{
+  _tp_implement_finish_void (self, tp_contact_search_restart_async);
+}
+
 static void
 contact_search_init_async (GAsyncInitable *initable,
     gint io_priority,
@@ -100,6 +100,31 @@ TpAccount * tp_contact_search_get_account (TpContactSearch *self);
 const gchar * tp_contact_search_get_server (TpContactSearch *self);
 guint tp_contact_search_get_limit (TpContactSearch *self);
 
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_contact_search_set_window_size (TpContactSearch *self,
+    guint window_size);
+_TP_AVAILABLE_IN_UNRELEASED
+guint tp_contact_search_get_n_results (TpContactSearch *self);
+_TP_AVAILABLE_IN_UNRELEASED
+GList *tp_contact_search_get_results (TpContactSearch *self,
+    guint offset,
+    guint limit) G_GNUC_WARN_UNUSED_RESULT;
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_contact_search_release_results (TpContactSearch *self,
+    guint n_results);
+
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_contact_search_stop (TpContactSearch *self);
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_contact_search_restart_async (TpContactSearch *self,
+    GHashTable *criteria,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_contact_search_restart_finish (TpContactSearch *self,
+    GAsyncResult *result,
+    GError **error);
+
 G_END_DECLS
 
 #endif
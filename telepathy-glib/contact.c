@@ -32,6 +32,7 @@
 #include <telepathy-glib/util.h>
 
 #define DEBUG_FLAG TP_DEBUG_CONTACTS
+#include "telepathy-glib/allocation-statistics-internal.h"
 #include "telepathy-glib/base-contact-list-internal.h"
 #include "telepathy-glib/connection-contact-list.h"
 #include "telepathy-glib/connection-internal.h"
@@ -267,6 +268,9 @@ struct _TpContactPrivate {
 
     /* ContactBlocking */
     gboolean is_blocked;
+
+    /* TRUE if counted by the allocation statistics */
+    gboolean counted;
 };
 
 
@@ -925,9 +929,25 @@ tp_contact_finalize (GObject *object)
   tp_contact_info_list_free (self->priv->contact_info);
   g_free (self->priv->publish_request);
 
+  if (self->priv->counted)
+    _tp_allocation_statistics_object_freed (self);
+
   ((GObjectClass *) tp_contact_parent_class)->finalize (object);
 }
 
+static void
+tp_contact_constructed (GObject *object)
+{
+  TpContact *self = TP_CONTACT (object);
+  void (*chain_up) (GObject *) =
+    ((GObjectClass *) tp_contact_parent_class)->constructed;
+
+  if (chain_up != NULL)
+    chain_up (object);
+
+  self->priv->counted = _tp_allocation_statistics_object_created (self);
+}
+
 
 static void
 tp_contact_get_property (GObject *object,
@@ -1037,6 +1057,7 @@ tp_contact_class_init (TpContactClass *klass)
 
   g_type_class_add_private (klass, sizeof (TpContactPrivate));
   object_class->get_property = tp_contact_get_property;
+  object_class->constructed = tp_contact_constructed;
   object_class->dispose = tp_contact_dispose;
   object_class->finalize = tp_contact_finalize;
 
@@ -36,6 +36,7 @@
 
 #define DEBUG_FLAG TP_DEBUG_PROXY
 #include "debug-internal.h"
+#include "util-internal.h"
 
 /**
  * TpDBusDaemonClass:
@@ -79,6 +80,10 @@ G_DEFINE_TYPE (TpDBusDaemon, tp_dbus_daemon, TP_TYPE_PROXY)
 
 static gpointer starter_bus_daemon = NULL;
 
+/* owned; overrides starter_bus_daemon in the worker threads of a sharded
+ * TpBaseConnectionManager */
+static GPrivate thread_default_daemon = G_PRIVATE_INIT (g_object_unref);
+
 /**
  * tp_dbus_daemon_dup:
  * @error: Used to indicate error if %NULL is returned
@@ -94,6 +99,10 @@ static gpointer starter_bus_daemon = NULL;
  * be returned by this function repeatedly, as long as at least one reference
  * exists.
  *
+ * In the worker threads of a #TpBaseConnectionManager that has
+ * #TpBaseConnectionManager:n-shards set, this function returns a proxy for
+ * that thread's own connection to the bus instead.
+ *
  * Returns: (transfer full): a reference to a proxy for signals and method
  *  calls on the bus daemon, or %NULL
  *
@@ -103,6 +112,10 @@ TpDBusDaemon *
 tp_dbus_daemon_dup (GError **error)
 {
   DBusGConnection *conn;
+  TpDBusDaemon *thread_default = g_private_get (&thread_default_daemon);
+
+  if (thread_default != NULL)
+    return g_object_ref (thread_default);
 
   if (starter_bus_daemon != NULL)
     return g_object_ref (starter_bus_daemon);
@@ -329,7 +342,7 @@ _tp_dbus_daemon_name_owner_changed_filter (DBusConnection *libdbus,
   if (dbus_message_is_signal (message, DBUS_INTERFACE_DBUS,
         "NameOwnerChanged") &&
       dbus_message_has_sender (message, DBUS_SERVICE_DBUS))
-    g_idle_add_full (G_PRIORITY_HIGH, noc_idle_context_invoke,
+    _tp_idle_add_thread_default (G_PRIORITY_HIGH, noc_idle_context_invoke,
         noc_idle_context_new (libdbus, message),
         noc_idle_context_free);
 
@@ -462,8 +475,9 @@ _tp_dbus_daemon_get_name_owner_notify (DBusPendingCall *pc,
   /* We have to do the real work in an idle, so we don't break re-entrant
    * calls (the dbus-glib event source isn't re-entrant) */
   context->refs++;
-  g_idle_add_full (G_PRIORITY_HIGH, _tp_dbus_daemon_get_name_owner_idle,
-      context, get_name_owner_context_unref);
+  _tp_idle_add_thread_default (G_PRIORITY_HIGH,
+      _tp_dbus_daemon_get_name_owner_idle, context,
+      get_name_owner_context_unref);
 
   if (pc != NULL)
     dbus_pending_call_unref (pc);
@@ -1111,8 +1125,8 @@ _tp_dbus_daemon_list_names_notify (DBusPendingCall *pc,
   /* We have to do the real work in an idle, so we don't break re-entrant
    * calls (the dbus-glib event source isn't re-entrant) */
   context->refs++;
-  g_idle_add_full (G_PRIORITY_HIGH, _tp_dbus_daemon_list_names_idle,
-      context, list_names_context_unref);
+  _tp_idle_add_thread_default (G_PRIORITY_HIGH,
+      _tp_dbus_daemon_list_names_idle, context, list_names_context_unref);
 
   if (pc != NULL)
     dbus_pending_call_unref (pc);
@@ -1428,5 +1442,23 @@ _tp_dbus_daemon_is_the_shared_one (TpDBusDaemon *self)
   return (self != NULL && self == starter_bus_daemon);
 }
 
+/*
+ * _tp_dbus_daemon_set_thread_default:
+ * @self: (allow-none): a bus daemon proxy, or %NULL
+ *
+ * Make tp_dbus_daemon_dup() return @self, rather than the shared proxy for
+ * the starter bus, when called from this thread; %NULL reverts to the
+ * shared proxy. This thread holds a reference to @self until it is
+ * replaced or the thread exits.
+ */
+void
+_tp_dbus_daemon_set_thread_default (TpDBusDaemon *self)
+{
+  if (self != NULL)
+    g_object_ref (self);
+
+  g_private_replace (&thread_default_daemon, self);
+}
+
 /* Auto-generated implementation of _tp_register_dbus_glib_marshallers */
 #include "_gen/register-dbus-glib-marshallers-body.h"
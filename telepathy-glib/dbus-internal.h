@@ -37,6 +37,8 @@ DBusGConnection *_tp_dbus_starter_bus_conn (GError **error)
 
 gboolean _tp_dbus_daemon_is_the_shared_one (TpDBusDaemon *self);
 
+void _tp_dbus_daemon_set_thread_default (TpDBusDaemon *self);
+
 G_END_DECLS
 
 #endif /* __TP_INTERNAL_DBUS_GLIB_H__ */
@@ -22,6 +22,8 @@
 
 #include <telepathy-glib/dbus-properties-mixin.h>
 
+#include <string.h>
+
 #include <telepathy-glib/errors.h>
 #include <telepathy-glib/svc-generic.h>
 #include <telepathy-glib/util.h>
@@ -126,6 +128,145 @@
  * Since: 0.7.3
  */
 
+/*
+ * Properties are looked up by name when they are implemented, and on every
+ * Get, Set and GetAll call. Rather than comparing quarks (which means
+ * taking the global quark lock to convert the name), each interface has an
+ * IfaceIndex listing its properties sorted by name, so they can be found
+ * with a binary search; the position of a property in the index is then
+ * used to find its implementation.
+ *
+ * glib-ginterface-gen.py emits property tables that are already sorted by
+ * name, in which case sorted is NULL and the positions are the same as in
+ * info->props.
+ */
+typedef struct {
+    TpDBusPropertiesMixinIfaceInfo *info;
+    guint n_props;
+    /* n_props property names, in strcmp() order */
+    const gchar **names;
+    /* the position in info->props of each of names, or NULL if they are
+     * already in that order */
+    guint *sorted;
+} IfaceIndex;
+
+/* The mixin_priv of each TpDBusPropertiesMixinIfaceImpl. */
+typedef struct {
+    TpDBusPropertiesMixinIfaceInfo *info;
+    const IfaceIndex *iface_index;
+    /* iface_index->n_props implementations, in the same order as
+     * iface_index->names; NULL for properties that are not implemented */
+    TpDBusPropertiesMixinPropImpl **impls;
+} IfaceImplPriv;
+
+static GQuark
+_iface_prop_index_quark (void)
+{
+  static GQuark q = 0;
+
+  if (G_UNLIKELY (q == 0))
+    q = g_quark_from_static_string
+        ("tp_svc_interface_set_dbus_properties_info@TELEPATHY_GLIB_0.UNRELEASED");
+
+  return q;
+}
+
+static gint
+compare_prop_positions (gconstpointer a,
+    gconstpointer b,
+    gpointer user_data)
+{
+  TpDBusPropertiesMixinPropInfo *props = user_data;
+
+  return strcmp (g_quark_to_string (props[*(const guint *) a].name),
+      g_quark_to_string (props[*(const guint *) b].name));
+}
+
+static IfaceIndex *
+iface_index_new (TpDBusPropertiesMixinIfaceInfo *info)
+{
+  IfaceIndex *iface_index = g_slice_new0 (IfaceIndex);
+  guint i;
+
+  iface_index->info = info;
+
+  while (info->props[iface_index->n_props].name != 0)
+    iface_index->n_props++;
+
+  iface_index->names = g_new (const gchar *, iface_index->n_props);
+
+  for (i = 0; i < iface_index->n_props; i++)
+    {
+      iface_index->names[i] = g_quark_to_string (info->props[i].name);
+
+      if (i > 0 && iface_index->sorted == NULL &&
+          strcmp (iface_index->names[i - 1], iface_index->names[i]) >= 0)
+        {
+          /* not generated by a recent glib-ginterface-gen.py; we'll have to
+           * sort it ourselves */
+          iface_index->sorted = g_new (guint, iface_index->n_props);
+        }
+    }
+
+  if (iface_index->sorted != NULL)
+    {
+      for (i = 0; i < iface_index->n_props; i++)
+        iface_index->sorted[i] = i;
+
+      g_qsort_with_data (iface_index->sorted, iface_index->n_props,
+          sizeof (guint), compare_prop_positions, info->props);
+
+      for (i = 0; i < iface_index->n_props; i++)
+        iface_index->names[i] = g_quark_to_string (
+            info->props[iface_index->sorted[i]].name);
+    }
+
+  return iface_index;
+}
+
+static TpDBusPropertiesMixinPropInfo *
+iface_index_get (const IfaceIndex *iface_index,
+    guint position)
+{
+  if (iface_index->sorted != NULL)
+    position = iface_index->sorted[position];
+
+  return iface_index->info->props + position;
+}
+
+/* Returns the position of @name in @iface_index, or -1 if there is no such
+ * property. */
+static gint
+iface_index_lookup (const IfaceIndex *iface_index,
+    const gchar *name)
+{
+  guint lo = 0;
+  guint hi = iface_index->n_props;
+
+  while (lo < hi)
+    {
+      guint mid = lo + (hi - lo) / 2;
+      gint cmp = strcmp (name, iface_index->names[mid]);
+
+      if (cmp == 0)
+        return mid;
+      else if (cmp < 0)
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+
+  return -1;
+}
+
+static inline TpDBusPropertiesMixinIfaceInfo *
+iface_impl_get_info (TpDBusPropertiesMixinIfaceImpl *iface_impl)
+{
+  IfaceImplPriv *priv = iface_impl->mixin_priv;
+
+  return priv->info;
+}
+
 static GQuark
 _iface_prop_info_quark (void)
 {
@@ -150,6 +291,11 @@ _iface_prop_info_quark (void)
  * This is typically only used within generated code; there is normally no
  * reason to call it manually.
  *
+ * Changed in 0.UNRELEASED: properties are looked up by binary search.
+ * If the properties in @info are sorted by name in strcmp() order, as they
+ * are in code generated by telepathy-glib >= 0.UNRELEASED, they are used
+ * as-is; otherwise they are sorted into a separate index.
+ *
  * Since: 0.7.3
  */
 void
@@ -158,6 +304,8 @@ tp_svc_interface_set_dbus_properties_info (GType g_interface,
 {
   GQuark q = _iface_prop_info_quark ();
   TpDBusPropertiesMixinPropInfo *prop;
+  IfaceIndex *iface_index;
+  guint i;
 
   g_return_if_fail (G_TYPE_IS_INTERFACE (g_interface));
   g_return_if_fail (g_type_get_qdata (g_interface, q) == NULL);
@@ -190,7 +338,22 @@ tp_svc_interface_set_dbus_properties_info (GType g_interface,
       g_return_if_fail (prop->type != 0);
     }
 
+  /* never freed - intentional per-interface leak, like @info itself */
+  iface_index = iface_index_new (info);
+
+  for (i = 1; i < iface_index->n_props; i++)
+    {
+      if (G_UNLIKELY (strcmp (iface_index->names[i - 1],
+                iface_index->names[i]) == 0))
+        {
+          CRITICAL ("%s.%s is declared more than once",
+              g_quark_to_string (info->dbus_interface), iface_index->names[i]);
+          g_return_if_reached ();
+        }
+    }
+
   g_type_set_qdata (g_interface, q, info);
+  g_type_set_qdata (g_interface, _iface_prop_index_quark (), iface_index);
 }
 
 /**
@@ -377,6 +540,8 @@ link_interface (GType type,
                 TpDBusPropertiesMixinIfaceImpl *iface_impl)
 {
   TpDBusPropertiesMixinIfaceInfo *iface_info = NULL;
+  const IfaceIndex *iface_index = NULL;
+  IfaceImplPriv *priv;
   TpDBusPropertiesMixinPropImpl *prop_impl;
 
   g_return_val_if_fail (iface_impl->props != NULL, FALSE);
@@ -392,13 +557,19 @@ link_interface (GType type,
 
           if (iface_info != NULL &&
               iface_info->dbus_interface == iface_quark)
-            break;
+            {
+              iface_index = g_type_get_qdata (*iface,
+                  _iface_prop_index_quark ());
+              break;
+            }
           else
-            iface_info = NULL;
+            {
+              iface_info = NULL;
+            }
         }
     }
 
-  if (iface_info == NULL)
+  if (iface_info == NULL || iface_index == NULL)
     {
       CRITICAL ("%s tried to implement undefined interface %s "
           "(perhaps you forgot to call G_IMPLEMENT_INTERFACE?)",
@@ -406,28 +577,27 @@ link_interface (GType type,
       return FALSE;
     }
 
-  iface_impl->mixin_priv = iface_info;
+  /* never freed - intentional per-class leak */
+  priv = g_slice_new0 (IfaceImplPriv);
+  priv->info = iface_info;
+  priv->iface_index = iface_index;
+  priv->impls = g_new0 (TpDBusPropertiesMixinPropImpl *,
+      iface_index->n_props);
+  iface_impl->mixin_priv = priv;
 
   for (prop_impl = iface_impl->props; prop_impl->name != NULL; prop_impl++)
     {
-      TpDBusPropertiesMixinPropInfo *prop_info;
-      GQuark name_quark = g_quark_try_string (prop_impl->name);
+      gint position = iface_index_lookup (iface_index, prop_impl->name);
 
       prop_impl->mixin_priv = NULL;
 
-      /* no point bothering if there is no quark for this name */
-      if (name_quark != 0)
+      if (position >= 0)
         {
-          for (prop_info = iface_info->props;
-               prop_info->name != 0;
-               prop_info++)
-            {
-              if (prop_info->name == name_quark)
-                {
-                  prop_impl->mixin_priv = prop_info;
-                  break;
-                }
-            }
+          prop_impl->mixin_priv = iface_index_get (iface_index, position);
+
+          /* if a property is implemented twice, the first one wins */
+          if (priv->impls[position] == NULL)
+            priv->impls[position] = prop_impl;
         }
 
       if (prop_impl->mixin_priv == NULL)
@@ -523,7 +693,8 @@ tp_dbus_properties_mixin_implement_interface (GObjectClass *cls,
            iter != NULL && iter->name != NULL;
            iter = iter->mixin_next)
         {
-          TpDBusPropertiesMixinIfaceInfo *other_info = iter->mixin_priv;
+          TpDBusPropertiesMixinIfaceInfo *other_info =
+              iface_impl_get_info (iter);
 
           g_assert (other_info != NULL);
 
@@ -544,7 +715,8 @@ tp_dbus_properties_mixin_implement_interface (GObjectClass *cls,
                iter->name != NULL;
                iter++)
             {
-              TpDBusPropertiesMixinIfaceInfo *other_info = iter->mixin_priv;
+              TpDBusPropertiesMixinIfaceInfo *other_info =
+                  iface_impl_get_info (iter);
 
               g_assert (other_info != NULL);
 
@@ -646,7 +818,8 @@ tp_dbus_properties_mixin_class_init (GObjectClass *cls,
            other_impl != iface_impl;
            other_impl++)
         {
-          TpDBusPropertiesMixinIfaceInfo *other_info = other_impl->mixin_priv;
+          TpDBusPropertiesMixinIfaceInfo *other_info =
+              iface_impl_get_info (other_impl);
 
           if (G_UNLIKELY (iface_quark == other_info->dbus_interface))
             {
@@ -694,7 +867,7 @@ _tp_dbus_properties_mixin_find_iface_impl (GObject *self,
                iface_impl->name != NULL;
                iface_impl++)
             {
-              iface_info = iface_impl->mixin_priv;
+              iface_info = iface_impl_get_info (iface_impl);
 
               if (iface_info->dbus_interface == iface_quark)
                 return iface_impl;
@@ -705,7 +878,7 @@ _tp_dbus_properties_mixin_find_iface_impl (GObject *self,
            iface_impl != NULL;
            iface_impl = iface_impl->mixin_next)
         {
-          iface_info = iface_impl->mixin_priv;
+          iface_info = iface_impl_get_info (iface_impl);
 
           if (iface_info->dbus_interface == iface_quark)
             return iface_impl;
@@ -720,23 +893,13 @@ _tp_dbus_properties_mixin_find_prop_impl
     (TpDBusPropertiesMixinIfaceImpl *iface_impl,
      const gchar *name)
 {
-  GQuark prop_quark = g_quark_try_string (name);
-  TpDBusPropertiesMixinPropImpl *prop_impl;
+  IfaceImplPriv *priv = iface_impl->mixin_priv;
+  gint position = iface_index_lookup (priv->iface_index, name);
 
-  if (prop_quark == 0)
+  if (position < 0)
     return NULL;
 
-  for (prop_impl = iface_impl->props;
-       prop_impl->name != NULL;
-       prop_impl++)
-    {
-      TpDBusPropertiesMixinPropInfo *prop_info = prop_impl->mixin_priv;
-
-      if (prop_info->name == prop_quark)
-        return prop_impl;
-    }
-
-  return NULL;
+  return priv->impls[position];
 }
 
 static TpDBusPropertiesMixinPropImpl *
@@ -828,7 +991,8 @@ tp_dbus_properties_mixin_get (GObject *self,
 
   if (prop_impl != NULL)
     {
-      TpDBusPropertiesMixinIfaceInfo *iface_info = iface_impl->mixin_priv;
+      TpDBusPropertiesMixinIfaceInfo *iface_info =
+          iface_impl_get_info (iface_impl);
       TpDBusPropertiesMixinPropInfo *prop_info = prop_impl->mixin_priv;
 
       g_value_init (value, prop_info->type);
@@ -1026,7 +1190,7 @@ tp_dbus_properties_mixin_emit_properties_changed (
       interface_name);
   g_return_if_fail (iface_impl != NULL);
 
-  iface_info = iface_impl->mixin_priv;
+  iface_info = iface_impl_get_info (iface_impl);
 
   /* If someone passes no property names, well … that's fine, we have nothing
    * to do.
@@ -1166,7 +1330,8 @@ tp_dbus_properties_mixin_dup_all (GObject *self,
 {
   TpDBusPropertiesMixinIfaceImpl *iface_impl;
   TpDBusPropertiesMixinIfaceInfo *iface_info;
-  TpDBusPropertiesMixinPropImpl *prop_impl;
+  IfaceImplPriv *priv;
+  guint i;
   /* no key destructor needed - the keys are immortal */
   GHashTable *values = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
       (GDestroyNotify) tp_g_value_slice_free);
@@ -1177,15 +1342,20 @@ tp_dbus_properties_mixin_dup_all (GObject *self,
   if (iface_impl == NULL || iface_impl->getter == NULL)
     return values;
 
-  iface_info = iface_impl->mixin_priv;
+  priv = iface_impl->mixin_priv;
+  iface_info = priv->info;
 
-  for (prop_impl = iface_impl->props;
-       prop_impl->name != NULL;
-       prop_impl++)
+  for (i = 0; i < priv->iface_index->n_props; i++)
     {
-      TpDBusPropertiesMixinPropInfo *prop_info = prop_impl->mixin_priv;
+      TpDBusPropertiesMixinPropImpl *prop_impl = priv->impls[i];
+      TpDBusPropertiesMixinPropInfo *prop_info;
       GValue *value;
 
+      if (prop_impl == NULL)
+        continue;
+
+      prop_info = prop_impl->mixin_priv;
+
       if ((prop_info->flags & TP_DBUS_PROPERTIES_MIXIN_FLAG_READ) == 0)
         continue;
 
@@ -1256,7 +1426,7 @@ tp_dbus_properties_mixin_set (
       return FALSE;
     }
 
-  iface_info = iface_impl->mixin_priv;
+  iface_info = iface_impl_get_info (iface_impl);
 
   prop_impl = _tp_dbus_properties_mixin_find_prop_impl (iface_impl,
       property_name);
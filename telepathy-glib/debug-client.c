@@ -142,6 +142,27 @@ new_debug_message_cb (TpDebugClient *self,
   g_object_unref (msg);
 }
 
+static void
+new_debug_messages_cb (TpDebugClient *self,
+    const GPtrArray *messages,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  guint i;
+
+  for (i = 0; i < messages->len; i++)
+    {
+      gdouble timestamp;
+      const gchar *domain, *message;
+      TpDebugLevel level;
+
+      tp_value_array_unpack (g_ptr_array_index (messages, i), 4,
+          &timestamp, &domain, &level, &message);
+      new_debug_message_cb (self, timestamp, domain, level, message, NULL,
+          NULL);
+    }
+}
+
 static void
 tp_debug_client_constructed (GObject *object)
 {
@@ -162,6 +183,13 @@ tp_debug_client_constructed (GObject *object)
         NULL, NULL, NULL, &error))
     {
       WARNING ("Failed to connect to NewDebugMessage: %s", error->message);
+      g_clear_error (&error);
+    }
+
+  if (!tp_cli_debug_connect_to_new_debug_messages (self,
+        new_debug_messages_cb, NULL, NULL, NULL, &error))
+    {
+      WARNING ("Failed to connect to NewDebugMessages: %s", error->message);
       g_error_free (error);
     }
 }
@@ -217,7 +245,8 @@ tp_debug_client_class_init (TpDebugClientClass *klass)
    * @message: a #TpDebugMessage
    *
    * Emitted when a #TpDebugMessage is generated if the TpDebugMessage:enabled
-   * property is set to %TRUE.
+   * property is set to %TRUE, or when a message that matches the filter
+   * passed to tp_debug_client_subscribe_async() arrives.
    *
    * Since: 0.19.0
    */
@@ -549,3 +578,150 @@ tp_debug_client_get_messages_finish (TpDebugClient *self,
   _tp_implement_finish_return_copy_pointer (self,
       tp_debug_client_set_enabled_async, g_ptr_array_ref)
 }
+
+/* the inverse of debug_level_to_log_level_flags() in debug-message.c */
+static TpDebugLevel
+log_level_flags_to_debug_level (GLogLevelFlags level)
+{
+  if (level & G_LOG_LEVEL_ERROR)
+    return TP_DEBUG_LEVEL_ERROR;
+  else if (level & G_LOG_LEVEL_CRITICAL)
+    return TP_DEBUG_LEVEL_CRITICAL;
+  else if (level & G_LOG_LEVEL_WARNING)
+    return TP_DEBUG_LEVEL_WARNING;
+  else if (level & G_LOG_LEVEL_MESSAGE)
+    return TP_DEBUG_LEVEL_MESSAGE;
+  else if (level & G_LOG_LEVEL_INFO)
+    return TP_DEBUG_LEVEL_INFO;
+  else
+    return TP_DEBUG_LEVEL_DEBUG;
+}
+
+static void
+subscribe_cb (TpDebugClient *self,
+    const GError *error,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  GSimpleAsyncResult *result = user_data;
+
+  if (error != NULL)
+    {
+      DEBUG ("Subscribe() failed: %s", error->message);
+      g_simple_async_result_set_from_error (result, error);
+    }
+
+  g_simple_async_result_complete (result);
+}
+
+/**
+ * tp_debug_client_subscribe_async:
+ * @self: a #TpDebugClient
+ * @domains: (array zero-terminated=1) (allow-none): the domains whose
+ *  messages should be received, such as "gabble", which also matches
+ *  categories such as "gabble/jingle"; or %NULL or empty for all domains
+ * @level: the least severe level of message that should be received, such
+ *  as %G_LOG_LEVEL_WARNING for warnings, critical messages and errors
+ * @interval_ms: how long the service may collect messages before sending
+ *  them together, or 0 to have each one sent immediately
+ * @callback: a callback to call when the request is satisfied
+ * @user_data: data to pass to @callback
+ *
+ * Ask the component owning @self's bus name to send this process the debug
+ * messages that match the given filter, and only those; they will be
+ * emitted as #TpDebugClient::new-debug-message signals. Unlike setting
+ * #TpDebugClient:enabled, other messages are not put on the bus at all, and
+ * other processes watching the same component do not receive these
+ * messages. Sending messages in batches every @interval_ms milliseconds is
+ * much cheaper for a busy component than sending each one separately.
+ *
+ * Calling this function again replaces the filter. There is one
+ * subscription per process, shared by every #TpDebugClient for the same
+ * component on the same bus connection. Don't also set
+ * #TpDebugClient:enabled, or each message will be signalled twice.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_debug_client_subscribe_async (TpDebugClient *self,
+    const gchar * const *domains,
+    GLogLevelFlags level,
+    guint interval_ms,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  GSimpleAsyncResult *result = g_simple_async_result_new (G_OBJECT (self),
+      callback, user_data, tp_debug_client_subscribe_async);
+  const gchar * const no_domains[] = { NULL };
+
+  if (domains == NULL)
+    domains = no_domains;
+
+  tp_cli_debug_call_subscribe (self, -1, (const gchar **) domains,
+      log_level_flags_to_debug_level (level), interval_ms, subscribe_cb,
+      result, g_object_unref, NULL);
+}
+
+/**
+ * tp_debug_client_subscribe_finish:
+ * @self: a #TpDebugClient
+ * @result: a #GAsyncResult
+ * @error: a #GError to fill
+ *
+ * Finishes tp_debug_client_subscribe_async().
+ *
+ * Returns: %TRUE, if the operation suceeded, %FALSE otherwise
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_debug_client_subscribe_finish (TpDebugClient *self,
+    GAsyncResult *result,
+    GError **error)
+{
+  _tp_implement_finish_void (self, tp_debug_client_subscribe_async)
+}
+
+/**
+ * tp_debug_client_unsubscribe_async:
+ * @self: a #TpDebugClient
+ * @callback: a callback to call when the request is satisfied
+ * @user_data: data to pass to @callback
+ *
+ * Cancel the effect of tp_debug_client_subscribe_async(). Any messages that
+ * were waiting to be sent are signalled first.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_debug_client_unsubscribe_async (TpDebugClient *self,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  GSimpleAsyncResult *result = g_simple_async_result_new (G_OBJECT (self),
+      callback, user_data, tp_debug_client_unsubscribe_async);
+
+  /* the callback signature is the same */
+  tp_cli_debug_call_unsubscribe (self, -1, subscribe_cb, result,
+      g_object_unref, NULL);
+}
+
+/**
+ * tp_debug_client_unsubscribe_finish:
+ * @self: a #TpDebugClient
+ * @result: a #GAsyncResult
+ * @error: a #GError to fill
+ *
+ * Finishes tp_debug_client_unsubscribe_async().
+ *
+ * Returns: %TRUE, if the operation suceeded, %FALSE otherwise
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_debug_client_unsubscribe_finish (TpDebugClient *self,
+    GAsyncResult *result,
+    GError **error)
+{
+  _tp_implement_finish_void (self, tp_debug_client_unsubscribe_async)
+}
@@ -62,6 +62,29 @@ gboolean tp_debug_client_set_enabled_finish (
 _TP_AVAILABLE_IN_0_20
 gboolean tp_debug_client_is_enabled (TpDebugClient *self);
 
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_debug_client_subscribe_async (TpDebugClient *self,
+    const gchar * const *domains,
+    GLogLevelFlags level,
+    guint interval_ms,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_debug_client_subscribe_finish (TpDebugClient *self,
+    GAsyncResult *result,
+    GError **error);
+
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_debug_client_unsubscribe_async (TpDebugClient *self,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_debug_client_unsubscribe_finish (TpDebugClient *self,
+    GAsyncResult *result,
+    GError **error);
+
 /* Tedious GObject boilerplate */
 
 _TP_AVAILABLE_IN_0_20
@@ -21,13 +21,24 @@
 
 #include "debug-sender.h"
 
+#include <string.h>
+
+#include <dbus/dbus-glib-lowlevel.h>
+
 #include <telepathy-glib/dbus.h>
 #include <telepathy-glib/defs.h>
+#include <telepathy-glib/errors.h>
 #include <telepathy-glib/gtypes.h>
 #include <telepathy-glib/interfaces.h>
 #include <telepathy-glib/util.h>
 #include <telepathy-glib/svc-generic.h>
 
+#include "telepathy-glib/allocation-statistics-internal.h"
+#include "telepathy-glib/debug-spool-internal.h"
+#include "telepathy-glib/method-statistics-internal.h"
+#include "telepathy-glib/stall-detector-internal.h"
+#include "telepathy-glib/timer-wheel-internal.h"
+
 /**
  * SECTION:debug-sender
  * @title: TpDebugSender
@@ -43,6 +54,22 @@
  * be used by any other part of the Telepathy stack which wants to expose its
  * debugging information over the debug interface.
  *
+ * As well as broadcasting every message while #TpDebugSender:enabled is
+ * %TRUE, a #TpDebugSender sends each client that has called the Subscribe
+ * method only the messages that match that client's choice of domains and
+ * minimum level, in batches, addressed to that client alone. Since
+ * 0.UNRELEASED.
+ *
+ * A #TpDebugSender also implements the MethodStatistics interface, which
+ * lets other processes switch on and read the statistics described in
+ * <link linkend="telepathy-glib-method-statistics">D-Bus method
+ * statistics</link>. Since 0.UNRELEASED.
+ *
+ * Similarly, it implements the AllocationStatistics interface for the
+ * counts described in <link
+ * linkend="telepathy-glib-allocation-statistics">Allocation
+ * statistics</link>. Since 0.UNRELEASED.
+ *
  * In a Connection Manager, one would probably keep a ref to the #TpDebugSender
  * in the connection manager object, and when this said object is finalized, so
  * is the process's #TpDebugSender. A GLib log handler is also provided:
@@ -75,7 +102,15 @@ static gpointer debug_sender = NULL;
 
 #define DEBUG_MESSAGE_LIMIT 800
 
+/* Send a subscriber's batch early if it gets this long, so that a busy
+ * service doesn't build up huge signals. */
+#define SUBSCRIPTION_BATCH_LIMIT 100
+
 static void debug_iface_init (gpointer g_iface, gpointer iface_data);
+static void method_statistics_iface_init (gpointer g_iface,
+    gpointer iface_data);
+static void allocation_statistics_iface_init (gpointer g_iface,
+    gpointer iface_data);
 
 struct _TpDebugSenderPrivate
 {
@@ -83,6 +118,15 @@ struct _TpDebugSenderPrivate
   gboolean timestamps;
   GQueue *messages;
   GMutex messages_lock;
+
+  /* the bus we're registered on, or NULL */
+  TpDBusDaemon *dbus_daemon;
+  /* unique name => owned Subscription */
+  GHashTable *subscriptions;
+  /* owned, or NULL if messages aren't being written to a file */
+  TpDebugSpool *spool;
+  /* in milliseconds, or 0 if the stall detector isn't running for us */
+  guint stall_threshold;
 };
 
 typedef struct {
@@ -92,15 +136,34 @@ typedef struct {
   gchar *string;
 } DebugMessage;
 
+typedef struct {
+  TpDebugSender *self;
+  gchar *unique_name;
+  /* domains to send, or NULL for all */
+  gchar **domains;
+  /* least severe level to send */
+  TpDebugLevel level;
+  guint interval;
+  /* owned DebugMessage *, waiting for the timer */
+  GPtrArray *pending;
+  TpTimer timer;
+} Subscription;
+
 G_DEFINE_TYPE_WITH_CODE (TpDebugSender, tp_debug_sender, G_TYPE_OBJECT,
     G_IMPLEMENT_INTERFACE (TP_TYPE_SVC_DBUS_PROPERTIES,
         tp_dbus_properties_mixin_iface_init);
-    G_IMPLEMENT_INTERFACE (TP_TYPE_SVC_DEBUG, debug_iface_init))
+    G_IMPLEMENT_INTERFACE (TP_TYPE_SVC_DEBUG, debug_iface_init);
+    G_IMPLEMENT_INTERFACE (TP_TYPE_SVC_DEBUG_INTERFACE_METHOD_STATISTICS,
+        method_statistics_iface_init);
+    G_IMPLEMENT_INTERFACE (TP_TYPE_SVC_DEBUG_INTERFACE_ALLOCATION_STATISTICS,
+        allocation_statistics_iface_init))
 
 /* properties */
 enum
 {
   PROP_ENABLED = 1,
+  PROP_METHOD_STATISTICS_ENABLED,
+  PROP_ALLOCATION_STATISTICS_ENABLED,
   NUM_PROPERTIES
 };
 
@@ -150,6 +213,164 @@ debug_message_free (DebugMessage *msg)
   g_slice_free (DebugMessage, msg);
 }
 
+static DebugMessage *
+debug_message_copy (const DebugMessage *msg)
+{
+  DebugMessage *copy = g_slice_new0 (DebugMessage);
+
+  copy->timestamp = msg->timestamp;
+  copy->domain = g_strdup (msg->domain);
+  copy->level = msg->level;
+  copy->string = g_strdup (msg->string);
+  return copy;
+}
+
+/* "foo" matches "foo" and "foo/bar", but not "foobar" */
+static gboolean
+subscription_wants (Subscription *sub,
+    const DebugMessage *msg)
+{
+  guint i;
+
+  /* lower levels are more severe */
+  if (msg->level > sub->level)
+    return FALSE;
+
+  if (sub->domains == NULL)
+    return TRUE;
+
+  for (i = 0; sub->domains[i] != NULL; i++)
+    {
+      gsize len = strlen (sub->domains[i]);
+
+      if (msg->domain != NULL &&
+          strncmp (msg->domain, sub->domains[i], len) == 0 &&
+          (msg->domain[len] == '\0' || msg->domain[len] == '/'))
+        return TRUE;
+    }
+
+  return FALSE;
+}
+
+/* Sends the pending messages in a NewDebugMessages signal addressed to the
+ * subscriber. dbus-glib can only broadcast signals, so build it by hand. */
+static void
+subscription_flush (Subscription *sub)
+{
+  DBusConnection *conn;
+  DBusMessage *message;
+  DBusMessageIter iter, array;
+  guint i;
+
+  _tp_timer_cancel (&sub->timer);
+
+  if (sub->pending->len == 0 || sub->self->priv->dbus_daemon == NULL)
+    goto finally;
+
+  conn = dbus_g_connection_get_connection (
+      tp_proxy_get_dbus_connection (sub->self->priv->dbus_daemon));
+  message = dbus_message_new_signal (TP_DEBUG_OBJECT_PATH, TP_IFACE_DEBUG,
+      "NewDebugMessages");
+
+  if (message == NULL || !dbus_message_set_destination (message,
+        sub->unique_name))
+    g_error ("Out of memory");
+
+  dbus_message_iter_init_append (message, &iter);
+
+  if (!dbus_message_iter_open_container (&iter, DBUS_TYPE_ARRAY, "(dsus)",
+        &array))
+    g_error ("Out of memory");
+
+  for (i = 0; i < sub->pending->len; i++)
+    {
+      DebugMessage *msg = g_ptr_array_index (sub->pending, i);
+      const gchar *domain = (msg->domain == NULL ? "" : msg->domain);
+      const gchar *string = (msg->string == NULL ? "" : msg->string);
+      dbus_uint32_t level = msg->level;
+      DBusMessageIter item;
+
+      if (!dbus_message_iter_open_container (&array, DBUS_TYPE_STRUCT, NULL,
+            &item) ||
+          !dbus_message_iter_append_basic (&item, DBUS_TYPE_DOUBLE,
+            &msg->timestamp) ||
+          !dbus_message_iter_append_basic (&item, DBUS_TYPE_STRING,
+            &domain) ||
+          !dbus_message_iter_append_basic (&item, DBUS_TYPE_UINT32,
+            &level) ||
+          !dbus_message_iter_append_basic (&item, DBUS_TYPE_STRING,
+            &string) ||
+          !dbus_message_iter_close_container (&array, &item))
+        g_error ("Out of memory");
+    }
+
+  if (!dbus_message_iter_close_container (&iter, &array))
+    g_error ("Out of memory");
+
+  dbus_connection_send (conn, message, NULL);
+  dbus_message_unref (message);
+
+finally:
+  g_ptr_array_set_size (sub->pending, 0);
+}
+
+static void
+subscription_timer_cb (gpointer data)
+{
+  subscription_flush (data);
+}
+
+static void subscriber_owner_changed_cb (TpDBusDaemon *dbus_daemon,
+    const gchar *name,
+    const gchar *new_owner,
+    gpointer user_data);
+
+static Subscription *
+subscription_new (TpDebugSender *self,
+    const gchar *unique_name)
+{
+  Subscription *sub = g_slice_new0 (Subscription);
+
+  sub->self = self;
+  sub->unique_name = g_strdup (unique_name);
+  sub->pending = g_ptr_array_new_with_free_func (
+      (GDestroyNotify) debug_message_free);
+  _tp_timer_init (&sub->timer, subscription_timer_cb, sub);
+
+  tp_dbus_daemon_watch_name_owner (self->priv->dbus_daemon, unique_name,
+      subscriber_owner_changed_cb, self, NULL);
+
+  return sub;
+}
+
+static void
+subscription_free (gpointer p)
+{
+  Subscription *sub = p;
+
+  _tp_timer_cancel (&sub->timer);
+  tp_dbus_daemon_cancel_name_owner_watch (sub->self->priv->dbus_daemon,
+      sub->unique_name, subscriber_owner_changed_cb, sub->self);
+
+  g_free (sub->unique_name);
+  g_strfreev (sub->domains);
+  g_ptr_array_unref (sub->pending);
+  g_slice_free (Subscription, sub);
+}
+
+static void
+subscriber_owner_changed_cb (TpDBusDaemon *dbus_daemon,
+    const gchar *name,
+    const gchar *new_owner,
+    gpointer user_data)
+{
+  TpDebugSender *self = user_data;
+
+  /* a unique name never comes back, so its messages have nowhere to go */
+  if (tp_str_empty (new_owner))
+    g_hash_table_remove (self->priv->subscriptions, name);
+}
+
 static void
 tp_debug_sender_get_property (GObject *object,
     guint property_id,
@@ -164,6 +385,14 @@ tp_debug_sender_get_property (GObject *object,
         g_value_set_boolean (value, self->priv->enabled);
         break;
 
+      case PROP_METHOD_STATISTICS_ENABLED:
+        g_value_set_boolean (value, tp_method_statistics_get_enabled ());
+        break;
+
+      case PROP_ALLOCATION_STATISTICS_ENABLED:
+        g_value_set_boolean (value, tp_allocation_statistics_get_enabled ());
+        break;
+
       default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
     }
@@ -183,6 +412,14 @@ tp_debug_sender_set_property (GObject *object,
         self->priv->enabled = g_value_get_boolean (value);
         break;
 
+      case PROP_METHOD_STATISTICS_ENABLED:
+        tp_method_statistics_set_enabled (g_value_get_boolean (value));
+        break;
+
+      case PROP_ALLOCATION_STATISTICS_ENABLED:
+        tp_allocation_statistics_set_enabled (g_value_get_boolean (value));
+        break;
+
      default:
        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
   }
@@ -193,6 +430,13 @@ tp_debug_sender_finalize (GObject *object)
 {
   TpDebugSender *self = TP_DEBUG_SENDER (object);
 
+  g_hash_table_unref (self->priv->subscriptions);
+  tp_clear_object (&self->priv->dbus_daemon);
+  tp_clear_pointer (&self->priv->spool, _tp_debug_spool_free);
+
+  if (self->priv->stall_threshold != 0)
+    _tp_stall_detector_stop ();
+
   g_mutex_lock (&self->priv->messages_lock);
   g_queue_foreach (self->priv->messages, (GFunc) debug_message_free, NULL);
   g_mutex_unlock (&self->priv->messages_lock);
@@ -227,16 +471,15 @@ tp_debug_sender_constructor (GType type,
 static void
 tp_debug_sender_constructed (GObject *object)
 {
-  TpDBusDaemon *dbus_daemon;
+  TpDebugSender *self = TP_DEBUG_SENDER (object);
 
-  dbus_daemon = tp_dbus_daemon_dup (NULL);
+  /* kept for sending NewDebugMessages to subscribers */
+  self->priv->dbus_daemon = tp_dbus_daemon_dup (NULL);
 
-  if (dbus_daemon != NULL)
+  if (self->priv->dbus_daemon != NULL)
     {
-      tp_dbus_daemon_register_object (dbus_daemon,
+      tp_dbus_daemon_register_object (self->priv->dbus_daemon,
           TP_DEBUG_OBJECT_PATH, debug_sender);
-
-      g_object_unref (dbus_daemon);
     }
 }
 
@@ -248,12 +491,31 @@ tp_debug_sender_class_init (TpDebugSenderClass *klass)
       { "Enabled", "enabled", "enabled" },
       { NULL }
   };
+  static TpDBusPropertiesMixinPropImpl method_statistics_props[] = {
+      { "Enabled", "method-statistics-enabled", "method-statistics-enabled" },
+      { NULL }
+  };
+  static TpDBusPropertiesMixinPropImpl allocation_statistics_props[] = {
+      { "Enabled", "allocation-statistics-enabled",
+        "allocation-statistics-enabled" },
+      { NULL }
+  };
   static TpDBusPropertiesMixinIfaceImpl prop_interfaces[] = {
       { TP_IFACE_DEBUG,
         tp_dbus_properties_mixin_getter_gobject_properties,
         tp_dbus_properties_mixin_setter_gobject_properties,
         debug_props,
       },
+      { TP_IFACE_DEBUG_INTERFACE_METHOD_STATISTICS,
+        tp_dbus_properties_mixin_getter_gobject_properties,
+        tp_dbus_properties_mixin_setter_gobject_properties,
+        method_statistics_props,
+      },
+      { TP_IFACE_DEBUG_INTERFACE_ALLOCATION_STATISTICS,
+        tp_dbus_properties_mixin_getter_gobject_properties,
+        tp_dbus_properties_mixin_setter_gobject_properties,
+        allocation_statistics_props,
+      },
       { NULL }
   };
 
@@ -277,6 +539,42 @@ tp_debug_sender_class_init (TpDebugSenderClass *klass)
           FALSE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * TpDebugSender:method-statistics-enabled:
+   *
+   * %TRUE if statistics about D-Bus method calls are being collected, as
+   * for tp_method_statistics_set_enabled(). This is shared by the whole
+   * process, and is exposed on D-Bus as the Enabled property of the
+   * MethodStatistics interface.
+   *
+   * Since: 0.UNRELEASED
+   */
+  g_object_class_install_property (object_class,
+      PROP_METHOD_STATISTICS_ENABLED,
+      g_param_spec_boolean ("method-statistics-enabled",
+          "Method statistics enabled?",
+          "True if D-Bus method statistics are being collected.",
+          FALSE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * TpDebugSender:allocation-statistics-enabled:
+   *
+   * %TRUE if instances of telepathy-glib's types are being counted, as for
+   * tp_allocation_statistics_set_enabled(). This is shared by the whole
+   * process, and is exposed on D-Bus as the Enabled property of the
+   * AllocationStatistics interface.
+   *
+   * Since: 0.UNRELEASED
+   */
+  g_object_class_install_property (object_class,
+      PROP_ALLOCATION_STATISTICS_ENABLED,
+      g_param_spec_boolean ("allocation-statistics-enabled",
+          "Allocation statistics enabled?",
+          "True if instances of telepathy-glib types are being counted.",
+          FALSE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   klass->dbus_props_class.interfaces = prop_interfaces;
   tp_dbus_properties_mixin_class_init (object_class,
       G_STRUCT_OFFSET (TpDebugSenderClass, dbus_props_class));
@@ -320,13 +618,158 @@ get_messages (TpSvcDebug *self,
   g_ptr_array_unref (messages);
 }
 
+static void
+subscribe (TpSvcDebug *iface,
+    const gchar **domains,
+    guint level,
+    guint interval,
+    DBusGMethodInvocation *context)
+{
+  TpDebugSender *self = TP_DEBUG_SENDER (iface);
+  gchar *unique_name = dbus_g_method_get_sender (context);
+  Subscription *sub;
+
+  if (level > TP_DEBUG_LEVEL_DEBUG)
+    {
+      GError e = { TP_ERROR, TP_ERROR_INVALID_ARGUMENT, "Unknown level" };
+
+      dbus_g_method_return_error (context, &e);
+      goto finally;
+    }
+
+  if (self->priv->dbus_daemon == NULL)
+    {
+      GError e = { TP_ERROR, TP_ERROR_NOT_AVAILABLE,
+          "Not connected to D-Bus" };
+
+      dbus_g_method_return_error (context, &e);
+      goto finally;
+    }
+
+  sub = g_hash_table_lookup (self->priv->subscriptions, unique_name);
+
+  if (sub == NULL)
+    {
+      sub = subscription_new (self, unique_name);
+      g_hash_table_insert (self->priv->subscriptions, sub->unique_name, sub);
+    }
+  else
+    {
+      /* the messages so far were collected under the old filter */
+      subscription_flush (sub);
+      g_strfreev (sub->domains);
+    }
+
+  if (domains == NULL || domains[0] == NULL)
+    sub->domains = NULL;
+  else
+    sub->domains = g_strdupv ((gchar **) domains);
+
+  sub->level = level;
+  sub->interval = interval;
+
+  tp_svc_debug_return_from_subscribe (context);
+
+finally:
+  g_free (unique_name);
+}
+
+static void
+unsubscribe (TpSvcDebug *iface,
+    DBusGMethodInvocation *context)
+{
+  TpDebugSender *self = TP_DEBUG_SENDER (iface);
+  gchar *unique_name = dbus_g_method_get_sender (context);
+  Subscription *sub = g_hash_table_lookup (self->priv->subscriptions,
+      unique_name);
+
+  if (sub != NULL)
+    {
+      subscription_flush (sub);
+      g_hash_table_remove (self->priv->subscriptions, unique_name);
+    }
+
+  tp_svc_debug_return_from_unsubscribe (context);
+  g_free (unique_name);
+}
+
 static void
 debug_iface_init (gpointer g_iface,
     gpointer iface_data)
 {
   TpSvcDebugClass *klass = (TpSvcDebugClass *) g_iface;
 
-  tp_svc_debug_implement_get_messages (klass, get_messages);
+#define IMPLEMENT(x) tp_svc_debug_implement_##x (klass, x)
+  IMPLEMENT (get_messages);
+  IMPLEMENT (subscribe);
+  IMPLEMENT (unsubscribe);
+#undef IMPLEMENT
+}
+
+static void
+get_method_statistics (TpSvcDebugInterfaceMethodStatistics *iface,
+    DBusGMethodInvocation *context)
+{
+  GPtrArray *statistics = _tp_method_statistics_dup_value_arrays ();
+
+  tp_svc_debug_interface_method_statistics_return_from_get_method_statistics (
+      context, statistics);
+  g_ptr_array_unref (statistics);
+}
+
+static void
+reset_method_statistics (TpSvcDebugInterfaceMethodStatistics *iface,
+    DBusGMethodInvocation *context)
+{
+  tp_method_statistics_reset ();
+  tp_svc_debug_interface_method_statistics_return_from_reset_method_statistics (
+      context);
+}
+
+static void
+method_statistics_iface_init (gpointer g_iface,
+    gpointer iface_data)
+{
+  TpSvcDebugInterfaceMethodStatisticsClass *klass = g_iface;
+
+#define IMPLEMENT(x) \
+  tp_svc_debug_interface_method_statistics_implement_##x (klass, x)
+  IMPLEMENT (get_method_statistics);
+  IMPLEMENT (reset_method_statistics);
+#undef IMPLEMENT
+}
+
+static void
+get_allocation_statistics (TpSvcDebugInterfaceAllocationStatistics *iface,
+    DBusGMethodInvocation *context)
+{
+  GPtrArray *statistics = _tp_allocation_statistics_dup_value_arrays ();
+
+  tp_svc_debug_interface_allocation_statistics_return_from_get_allocation_statistics (
+      context, statistics);
+  g_ptr_array_unref (statistics);
+}
+
+static void
+reset_allocation_statistics (TpSvcDebugInterfaceAllocationStatistics *iface,
+    DBusGMethodInvocation *context)
+{
+  tp_allocation_statistics_reset ();
+  tp_svc_debug_interface_allocation_statistics_return_from_reset_allocation_statistics (
+      context);
+}
+
+static void
+allocation_statistics_iface_init (gpointer g_iface,
+    gpointer iface_data)
+{
+  TpSvcDebugInterfaceAllocationStatisticsClass *klass = g_iface;
+
+#define IMPLEMENT(x) \
+  tp_svc_debug_interface_allocation_statistics_implement_##x (klass, x)
+  IMPLEMENT (get_allocation_statistics);
+  IMPLEMENT (reset_allocation_statistics);
+#undef IMPLEMENT
 }
 
 static void
@@ -336,6 +779,8 @@ tp_debug_sender_init (TpDebugSender *self)
       TpDebugSenderPrivate);
 
   self->priv->messages = g_queue_new ();
+  self->priv->subscriptions = g_hash_table_new_full (g_str_hash, g_str_equal,
+      NULL, subscription_free);
 }
 
 /**
@@ -360,6 +805,21 @@ tp_debug_sender_dup (void)
   return g_object_new (TP_TYPE_DEBUG_SENDER, NULL);
 }
 
+static void
+_tp_debug_sender_queue_for_subscriber (Subscription *sub,
+    const DebugMessage *msg)
+{
+  if (!subscription_wants (sub, msg))
+    return;
+
+  g_ptr_array_add (sub->pending, debug_message_copy (msg));
+
+  if (sub->interval == 0 || sub->pending->len >= SUBSCRIPTION_BATCH_LIMIT)
+    subscription_flush (sub);
+  else if (!_tp_timer_is_scheduled (&sub->timer))
+    _tp_timer_schedule (&sub->timer, sub->interval);
+}
+
 static void
 _tp_debug_sender_take (TpDebugSender *self,
     DebugMessage *new_msg)
@@ -384,6 +844,22 @@ _tp_debug_sender_take (TpDebugSender *self,
           new_msg->domain, new_msg->level, new_msg->string);
     }
 
+  if (g_hash_table_size (self->priv->subscriptions) > 0)
+    {
+      GHashTableIter iter;
+      gpointer sub;
+
+      g_hash_table_iter_init (&iter, self->priv->subscriptions);
+
+      while (g_hash_table_iter_next (&iter, NULL, &sub))
+        _tp_debug_sender_queue_for_subscriber (sub, new_msg);
+    }
+
+  if (self->priv->spool != NULL)
+    _tp_debug_spool_append (self->priv->spool,
+        (gint64) (new_msg->timestamp * G_USEC_PER_SEC), new_msg->domain,
+        new_msg->level, new_msg->string);
+
 #ifndef ENABLE_DEBUG_CACHE
   /* if there's cache, these are freed when they fall of its end instead */
   debug_message_free (new_msg);
@@ -452,7 +928,9 @@ tp_debug_sender_add_message_vprintf (TpDebugSender *self,
 
   /* disabled cache? we might have no need to format the message at all */
 #ifndef ENABLE_DEBUG_CACHE
-  if (!self->priv->enabled && formatted == NULL)
+  if (!self->priv->enabled && formatted == NULL &&
+      g_hash_table_size (self->priv->subscriptions) == 0 &&
+      self->priv->spool == NULL)
     return;
 #endif
 
@@ -627,3 +1105,94 @@ tp_debug_sender_set_timestamps (TpDebugSender *self,
 
   self->priv->timestamps = maybe;
 }
+
+/**
+ * tp_debug_sender_set_spool:
+ * @self: a #TpDebugSender
+ * @filename: (allow-none) (type filename): a file to write messages to, or
+ *  %NULL to stop writing them
+ * @max_file_size: start a new file when @filename would grow beyond this
+ *  many bytes, or 0 to let it grow without limit
+ * @n_old_files: how many previous files to keep, as @filename.1 (the most
+ *  recent), @filename.2 and so on
+ * @error: used to raise an error if %FALSE is returned
+ *
+ * Write every message this debug sender receives to @filename, whether or
+ * not a debugger is connected, so that they can be inspected after the
+ * fact, for instance once a user has noticed a problem. The messages are
+ * written in a compact binary format by a separate thread, so logging
+ * never waits for the disk; tools/tp-debug-spool.py in the telepathy-glib
+ * source tree decodes, filters and follows the files.
+ *
+ * If @filename already exists, it is kept as @filename.1 (or deleted if
+ * @n_old_files is 0), the same as when it reaches @max_file_size. Calling
+ * this function again closes the previous file first.
+ *
+ * Returns: %TRUE on success, or %FALSE if @filename couldn't be opened
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_debug_sender_set_spool (TpDebugSender *self,
+    const gchar *filename,
+    gsize max_file_size,
+    guint n_old_files,
+    GError **error)
+{
+  g_return_val_if_fail (TP_IS_DEBUG_SENDER (self), FALSE);
+
+  tp_clear_pointer (&self->priv->spool, _tp_debug_spool_free);
+
+  if (filename == NULL)
+    return TRUE;
+
+  self->priv->spool = _tp_debug_spool_new (filename, max_file_size,
+      n_old_files, error);
+
+  return (self->priv->spool != NULL);
+}
+
+static void
+stall_report_cb (const gchar *report,
+    gpointer user_data)
+{
+  TpDebugSender *self = user_data;
+
+  tp_debug_sender_add_message (self, NULL, "tp-glib/stall",
+      G_LOG_LEVEL_WARNING, report);
+}
+
+/**
+ * tp_debug_sender_set_stall_threshold:
+ * @self: a #TpDebugSender
+ * @threshold_ms: the shortest main loop iteration to report, in
+ *  milliseconds, or 0 to stop reporting them
+ *
+ * Watch for iterations of the default main context that take at least
+ * @threshold_ms, during which the process can't respond to anything, and
+ * add a warning to @self for each of them, in the domain
+ * <literal>tp-glib/stall</literal>. The warning says which D-Bus method
+ * implementation, method reply callback or signal callback took longest
+ * during the iteration, and in which #GSource it ran, so that the handlers
+ * that freeze a busy connection manager or client can be found.
+ *
+ * This replaces the default main context's poll function with one that
+ * calls the previous one, so it must be called from the thread that runs
+ * the default main context, and the poll function must not be replaced
+ * again while stalls are being reported.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_debug_sender_set_stall_threshold (TpDebugSender *self,
+    guint threshold_ms)
+{
+  g_return_if_fail (TP_IS_DEBUG_SENDER (self));
+
+  self->priv->stall_threshold = threshold_ms;
+
+  if (threshold_ms == 0)
+    _tp_stall_detector_stop ();
+  else
+    _tp_stall_detector_start (threshold_ms, stall_report_cb, self);
+}
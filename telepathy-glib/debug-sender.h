@@ -96,6 +96,17 @@ void tp_debug_sender_log_handler (const gchar *log_domain,
 _TP_AVAILABLE_IN_0_16
 void tp_debug_sender_set_timestamps (TpDebugSender *self, gboolean maybe);
 
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_debug_sender_set_spool (TpDebugSender *self,
+    const gchar *filename,
+    gsize max_file_size,
+    guint n_old_files,
+    GError **error);
+
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_debug_sender_set_stall_threshold (TpDebugSender *self,
+    guint threshold_ms);
+
 G_END_DECLS
 
 #endif /* __TP_DEBUG_SENDER_H__ */
@@ -0,0 +1,71 @@
+/*<private_header>*/
+/* Binary debug log spooler - internal header
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef TP_DEBUG_SPOOL_INTERNAL_H
+#define TP_DEBUG_SPOOL_INTERNAL_H
+
+#include <glib.h>
+
+#include <telepathy-glib/enums.h>
+
+G_BEGIN_DECLS
+
+/*
+ * The spool file format, which tools/tp-debug-spool.py also knows about.
+ * All integers are little-endian.
+ *
+ * Each file starts with an 8-byte header: the magic bytes "TpDS", a
+ * version byte (currently 1) and three zero bytes. It is followed by
+ * records, each of which is a 32-bit length of the rest of the record, then:
+ *
+ *   64-bit signed time, in microseconds since the Unix epoch
+ *   8-bit TpDebugLevel
+ *   8-bit zero padding
+ *   16-bit length of the domain, in bytes
+ *   the domain, in UTF-8, not terminated
+ *   the message, in UTF-8, not terminated, to the end of the record
+ *
+ * A process that is killed might leave a truncated record at the end of a
+ * file; readers should ignore it.
+ */
+#define TP_DEBUG_SPOOL_MAGIC "TpDS"
+#define TP_DEBUG_SPOOL_VERSION 1
+#define TP_DEBUG_SPOOL_HEADER_SIZE 8
+/* not counting the length itself */
+#define TP_DEBUG_SPOOL_RECORD_FIXED_SIZE 12
+
+typedef struct _TpDebugSpool TpDebugSpool;
+
+TpDebugSpool *_tp_debug_spool_new (const gchar *filename,
+    gsize max_file_size,
+    guint n_old_files,
+    GError **error);
+
+void _tp_debug_spool_append (TpDebugSpool *self,
+    gint64 time_us,
+    const gchar *domain,
+    TpDebugLevel level,
+    const gchar *message);
+
+void _tp_debug_spool_free (TpDebugSpool *self);
+
+G_END_DECLS
+
+#endif
@@ -0,0 +1,421 @@
+/*
+ * debug-spool.c - write debug messages to size-rotated binary files
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "config.h"
+
+#include "telepathy-glib/debug-spool-internal.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <glib/gstdio.h>
+
+#define DEBUG_FLAG TP_DEBUG_MISC
+#include "telepathy-glib/debug-internal.h"
+
+/*
+ * Appending a message only encodes it into a buffer, under a lock; a
+ * thread writes the buffer out, so the thread that logs never waits for
+ * the disk. If the disk can't keep up, messages are counted and dropped
+ * rather than buffered without limit, and the count is written as a message
+ * of its own.
+ */
+
+/* stop buffering if the writer falls this far behind */
+#define MAX_PENDING (1024 * 1024)
+
+struct _TpDebugSpool {
+    gchar *filename;
+    /* 0 means never rotate */
+    gsize max_file_size;
+    guint n_old_files;
+
+    /* only used by the writer thread, once it has started */
+    int fd;
+    gsize file_size;
+
+    GThread *thread;
+
+    /* protects the rest */
+    GMutex lock;
+    GCond cond;
+    /* encoded records waiting to be written */
+    GByteArray *pending;
+    guint n_dropped;
+    gboolean stopping;
+};
+
+static void
+put_u16 (GByteArray *buf,
+    guint16 v)
+{
+  guint16 le = GUINT16_TO_LE (v);
+
+  g_byte_array_append (buf, (const guint8 *) &le, sizeof (le));
+}
+
+static void
+put_u32 (GByteArray *buf,
+    guint32 v)
+{
+  guint32 le = GUINT32_TO_LE (v);
+
+  g_byte_array_append (buf, (const guint8 *) &le, sizeof (le));
+}
+
+static void
+put_i64 (GByteArray *buf,
+    gint64 v)
+{
+  gint64 le = GINT64_TO_LE (v);
+
+  g_byte_array_append (buf, (const guint8 *) &le, sizeof (le));
+}
+
+static void
+encode_record (GByteArray *buf,
+    gint64 time_us,
+    const gchar *domain,
+    TpDebugLevel level,
+    const gchar *message)
+{
+  gsize domain_len = (domain == NULL ? 0 : strlen (domain));
+  gsize message_len = (message == NULL ? 0 : strlen (message));
+  guint8 level_and_padding[2];
+
+  if (domain_len > G_MAXUINT16)
+    domain_len = G_MAXUINT16;
+
+  if (message_len > G_MAXUINT32 - TP_DEBUG_SPOOL_RECORD_FIXED_SIZE -
+      domain_len)
+    message_len = G_MAXUINT32 - TP_DEBUG_SPOOL_RECORD_FIXED_SIZE -
+      domain_len;
+
+  level_and_padding[0] = level;
+  level_and_padding[1] = 0;
+
+  put_u32 (buf, TP_DEBUG_SPOOL_RECORD_FIXED_SIZE + domain_len + message_len);
+  put_i64 (buf, time_us);
+  g_byte_array_append (buf, level_and_padding, 2);
+  put_u16 (buf, domain_len);
+  g_byte_array_append (buf, (const guint8 *) domain, domain_len);
+  g_byte_array_append (buf, (const guint8 *) message, message_len);
+}
+
+static gboolean
+write_all (int fd,
+    const guint8 *data,
+    gsize len,
+    GError **error)
+{
+  while (len > 0)
+    {
+      gssize written = write (fd, data, len);
+
+      if (written < 0)
+        {
+          int e = errno;
+
+          if (e == EINTR)
+            continue;
+
+          g_set_error (error, G_FILE_ERROR, g_file_error_from_errno (e),
+              "%s", g_strerror (e));
+          return FALSE;
+        }
+
+      data += written;
+      len -= written;
+    }
+
+  return TRUE;
+}
+
+/* Moves filename to filename.1, filename.1 to filename.2 and so on, and
+ * starts a new, empty filename. */
+static gboolean
+spool_start_file (TpDebugSpool *self,
+    GError **error)
+{
+  guint8 header[TP_DEBUG_SPOOL_HEADER_SIZE] = { 0 };
+  guint i;
+
+  if (self->fd != -1)
+    {
+      close (self->fd);
+      self->fd = -1;
+    }
+
+  for (i = self->n_old_files; i > 0; i--)
+    {
+      gchar *from = (i == 1 ? g_strdup (self->filename) :
+          g_strdup_printf ("%s.%u", self->filename, i - 1));
+      gchar *to = g_strdup_printf ("%s.%u", self->filename, i);
+
+      /* the older ones might not exist yet */
+      if (g_rename (from, to) != 0 && errno != ENOENT)
+        DEBUG ("Couldn't rename %s to %s: %s", from, to, g_strerror (errno));
+
+      g_free (from);
+      g_free (to);
+    }
+
+  self->fd = g_open (self->filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+  if (self->fd == -1)
+    {
+      int e = errno;
+
+      g_set_error (error, G_FILE_ERROR, g_file_error_from_errno (e),
+          "Can't open debug spool '%s': %s", self->filename, g_strerror (e));
+      return FALSE;
+    }
+
+  memcpy (header, TP_DEBUG_SPOOL_MAGIC, 4);
+  header[4] = TP_DEBUG_SPOOL_VERSION;
+
+  if (!write_all (self->fd, header, sizeof (header), error))
+    {
+      close (self->fd);
+      self->fd = -1;
+      return FALSE;
+    }
+
+  self->file_size = sizeof (header);
+  return TRUE;
+}
+
+/* called in the writer thread; @data is a whole number of records */
+static void
+spool_write_records (TpDebugSpool *self,
+    const guint8 *data,
+    gsize len)
+{
+  gsize offset = 0;
+  GError *error = NULL;
+
+  while (offset < len && self->fd != -1)
+    {
+      gsize start = offset;
+
+      /* write as many whole records as fit in this file, but at least one
+       * per file, however big */
+      while (offset < len)
+        {
+          guint32 rec_len;
+          gsize size;
+
+          memcpy (&rec_len, data + offset, sizeof (rec_len));
+          size = sizeof (rec_len) + GUINT32_FROM_LE (rec_len);
+
+          if (self->max_file_size > 0 &&
+              self->file_size + (offset - start) > TP_DEBUG_SPOOL_HEADER_SIZE &&
+              self->file_size + (offset - start) + size > self->max_file_size)
+            break;
+
+          offset += size;
+        }
+
+      if (offset > start &&
+          !write_all (self->fd, data + start, offset - start, &error))
+        break;
+
+      self->file_size += offset - start;
+
+      if (offset < len && !spool_start_file (self, &error))
+        break;
+    }
+
+  if (error != NULL)
+    {
+      /* this goes into our own spool, of course, so might never be seen */
+      WARNING ("Stopped writing debug spool '%s': %s", self->filename,
+          error->message);
+      g_error_free (error);
+
+      if (self->fd != -1)
+        {
+          close (self->fd);
+          self->fd = -1;
+        }
+    }
+}
+
+static gpointer
+spool_thread (gpointer data)
+{
+  TpDebugSpool *self = data;
+  GByteArray *batch = g_byte_array_new ();
+  gboolean stopping = FALSE;
+
+  while (!stopping)
+    {
+      GByteArray *tmp;
+      guint n_dropped;
+
+      g_mutex_lock (&self->lock);
+
+      while (self->pending->len == 0 && self->n_dropped == 0 &&
+          !self->stopping)
+        g_cond_wait (&self->cond, &self->lock);
+
+      /* take what's there, and give back the (empty) buffer we just wrote */
+      tmp = self->pending;
+      self->pending = batch;
+      batch = tmp;
+      n_dropped = self->n_dropped;
+      self->n_dropped = 0;
+      stopping = self->stopping;
+
+      g_mutex_unlock (&self->lock);
+
+      if (n_dropped > 0)
+        {
+          gchar *text = g_strdup_printf ("%u debug messages were not "
+              "spooled because writing them fell too far behind", n_dropped);
+
+          encode_record (batch, g_get_real_time (), "tp-glib/debug-spool",
+              TP_DEBUG_LEVEL_WARNING, text);
+          g_free (text);
+        }
+
+      spool_write_records (self, batch->data, batch->len);
+      g_byte_array_set_size (batch, 0);
+    }
+
+  g_byte_array_unref (batch);
+  return NULL;
+}
+
+/*
+ * _tp_debug_spool_new:
+ * @filename: the file to write
+ * @max_file_size: start a new file when @filename would grow beyond this
+ *  many bytes, or 0 to never do so
+ * @n_old_files: how many previous files to keep, as @filename.1 (the most
+ *  recent) to @filename.@n_old_files
+ * @error: used to raise an error if %NULL is returned
+ *
+ * Start writing debug messages to @filename. If it already exists, it is
+ * treated as an old file, the same as when it reaches @max_file_size.
+ *
+ * Returns: a new spool, or %NULL if @filename couldn't be opened
+ */
+TpDebugSpool *
+_tp_debug_spool_new (const gchar *filename,
+    gsize max_file_size,
+    guint n_old_files,
+    GError **error)
+{
+  TpDebugSpool *self = g_slice_new0 (TpDebugSpool);
+
+  self->filename = g_strdup (filename);
+  self->max_file_size = max_file_size;
+  self->n_old_files = n_old_files;
+  self->fd = -1;
+  self->pending = g_byte_array_new ();
+  g_mutex_init (&self->lock);
+  g_cond_init (&self->cond);
+
+  /* don't move the existing file out of the way if there's no room for it */
+  if (!g_file_test (filename, G_FILE_TEST_EXISTS))
+    self->n_old_files = 0;
+
+  if (!spool_start_file (self, error))
+    goto error;
+
+  self->n_old_files = n_old_files;
+  self->thread = g_thread_try_new ("tp-debug-spool", spool_thread, self,
+      error);
+
+  if (self->thread == NULL)
+    goto error;
+
+  return self;
+
+error:
+  _tp_debug_spool_free (self);
+  return NULL;
+}
+
+/*
+ * _tp_debug_spool_append:
+ *
+ * Queue a message to be written. This may be called from any thread.
+ */
+void
+_tp_debug_spool_append (TpDebugSpool *self,
+    gint64 time_us,
+    const gchar *domain,
+    TpDebugLevel level,
+    const gchar *message)
+{
+  gboolean was_empty;
+
+  g_mutex_lock (&self->lock);
+
+  if (self->pending->len >= MAX_PENDING)
+    {
+      self->n_dropped++;
+      g_mutex_unlock (&self->lock);
+      return;
+    }
+
+  was_empty = (self->pending->len == 0);
+  encode_record (self->pending, time_us, domain, level, message);
+
+  if (was_empty)
+    g_cond_signal (&self->cond);
+
+  g_mutex_unlock (&self->lock);
+}
+
+/*
+ * _tp_debug_spool_free:
+ *
+ * Write any messages that are still queued, and close the file.
+ */
+void
+_tp_debug_spool_free (TpDebugSpool *self)
+{
+  if (self->thread != NULL)
+    {
+      g_mutex_lock (&self->lock);
+      self->stopping = TRUE;
+      g_cond_signal (&self->cond);
+      g_mutex_unlock (&self->lock);
+
+      g_thread_join (self->thread);
+    }
+
+  if (self->fd != -1)
+    close (self->fd);
+
+  g_byte_array_unref (self->pending);
+  g_mutex_clear (&self->lock);
+  g_cond_clear (&self->cond);
+  g_free (self->filename);
+  g_slice_free (TpDebugSpool, self);
+}
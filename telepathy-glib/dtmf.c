@@ -24,6 +24,7 @@
 
 #include <telepathy-glib/base-call-internal.h>
 #include <telepathy-glib/errors.h>
+#include <telepathy-glib/timer-wheel-internal.h>
 #include <telepathy-glib/util.h>
 
 
@@ -187,7 +188,8 @@ struct _TpDTMFPlayerPrivate
   gchar *dialstring;
   /* a pointer into dialstring, or NULL */
   const gchar *dialstring_remaining;
-  guint timer_id;
+  /* shared with every other player, rather than a GSource each */
+  TpTimer timer;
   guint tone_ms;
   guint gap_ms;
   guint pause_ms;
@@ -250,27 +252,24 @@ tp_dtmf_player_cancel (TpDTMFPlayer *self)
 {
   g_return_if_fail (TP_IS_DTMF_PLAYER (self));
 
-  if (self->priv->timer_id != 0)
+  if (_tp_timer_is_scheduled (&self->priv->timer))
     {
       tp_dtmf_player_maybe_emit_stopped_tone (self);
       tp_dtmf_player_emit_finished (self, TRUE);
 
-      g_source_remove (self->priv->timer_id);
-      self->priv->timer_id = 0;
+      _tp_timer_cancel (&self->priv->timer);
     }
 
   tp_clear_pointer (&self->priv->dialstring, g_free);
 }
 
-static gboolean
+static void
 tp_dtmf_player_timer_cb (gpointer data)
 {
   TpDTMFPlayer *self = data;
   gboolean was_playing = self->priv->playing_tone;
   gboolean was_paused = self->priv->paused;
 
-  self->priv->timer_id = 0;
-
   tp_dtmf_player_maybe_emit_stopped_tone (self);
 
   if ((was_playing || was_paused) &&
@@ -285,7 +284,7 @@ tp_dtmf_player_timer_cb (gpointer data)
       /* die of natural causes */
       tp_dtmf_player_emit_finished (self, FALSE);
       tp_dtmf_player_cancel (self);
-      return FALSE;
+      return;
     }
 
   switch (_tp_dtmf_char_classify (*self->priv->dialstring_remaining))
@@ -294,8 +293,7 @@ tp_dtmf_player_timer_cb (gpointer data)
         if (was_playing)
           {
             /* Play a gap (short silence) before the next tone */
-            self->priv->timer_id = g_timeout_add (self->priv->gap_ms,
-                tp_dtmf_player_timer_cb, self);
+            _tp_timer_schedule (&self->priv->timer, self->priv->gap_ms);
           }
         else
           {
@@ -303,8 +301,7 @@ tp_dtmf_player_timer_cb (gpointer data)
              * Play the tone straight away. */
             tp_dtmf_player_emit_started_tone (self,
                 _tp_dtmf_char_to_event (*self->priv->dialstring_remaining));
-            self->priv->timer_id = g_timeout_add (self->priv->tone_ms,
-                tp_dtmf_player_timer_cb, self);
+            _tp_timer_schedule (&self->priv->timer, self->priv->tone_ms);
           }
         break;
 
@@ -312,8 +309,7 @@ tp_dtmf_player_timer_cb (gpointer data)
         /* Pause, typically for 3 seconds. We don't need to have a gap
          * first. */
         self->priv->paused = TRUE;
-        self->priv->timer_id = g_timeout_add (self->priv->pause_ms,
-            tp_dtmf_player_timer_cb, self);
+        _tp_timer_schedule (&self->priv->timer, self->priv->pause_ms);
         break;
 
       case DTMF_CHAR_CLASS_WAIT_FOR_USER:
@@ -332,8 +328,6 @@ tp_dtmf_player_timer_cb (gpointer data)
       default:
         g_assert_not_reached ();
     }
-
-  return FALSE;
 }
 
 /**
@@ -391,7 +385,7 @@ tp_dtmf_player_play (TpDTMFPlayer *self,
       return FALSE;
     }
 
-  g_assert (self->priv->timer_id == 0);
+  g_assert (!_tp_timer_is_scheduled (&self->priv->timer));
 
   for (i = 0; tones[i] != '\0'; i++)
     {
@@ -446,7 +440,7 @@ tp_dtmf_player_init (TpDTMFPlayer *self)
   self->priv->dialstring = NULL;
   self->priv->dialstring_remaining = NULL;
   self->priv->playing_tone = FALSE;
-  self->priv->timer_id = 0;
+  _tp_timer_init (&self->priv->timer, tp_dtmf_player_timer_cb, self);
 }
 
 static void
@@ -98,6 +98,8 @@
 
 #include "telepathy-glib/file-transfer-channel.h"
 
+#include <telepathy-glib/capabilities.h>
+#include <telepathy-glib/connection.h>
 #include <telepathy-glib/dbus.h>
 #include <telepathy-glib/gnio-util.h>
 #include <telepathy-glib/gtypes.h>
@@ -111,6 +113,7 @@
 #include "telepathy-glib/automatic-client-factory-internal.h"
 #include "telepathy-glib/channel-internal.h"
 #include "telepathy-glib/debug-internal.h"
+#include "telepathy-glib/file-transfer-splice-internal.h"
 
 #include <stdio.h>
 #include <glib.h>
@@ -154,7 +157,10 @@ struct _TpFileTransferChannelPrivate
     GSocketAddress *remote_address;
     /* The value passed to Accept; this shouldn't be stored in
      * initial_offset as they can easily be different. */
-    guint requested_offset;
+    guint64 requested_offset;
+    /* Set if we are resuming into a partially written file, in which case
+     * out_stream is its output stream */
+    GIOStream *file_io_stream;
 
     TpSocketAddressType socket_type;
     TpSocketAccessControl access_control;
@@ -162,6 +168,13 @@ struct _TpFileTransferChannelPrivate
 
     GSimpleAsyncResult *result;
     GCancellable *cancellable;
+
+    /* Coalescing of transferred-bytes notifications */
+    guint progress_interval;
+    guint64 progress_step;
+    guint64 notified_bytes;
+    gint64 last_progress;
+    guint progress_timeout_id;
 };
 
 enum /* properties */
@@ -177,6 +190,8 @@ enum /* properties */
   PROP_INITIAL_OFFSET,
   PROP_SERVICE_NAME,
   PROP_METADATA,
+  PROP_PROGRESS_INTERVAL,
+  PROP_PROGRESS_STEP,
   N_PROPS
 };
 
@@ -231,10 +246,133 @@ splice_stream_ready_cb (GObject *output,
   g_object_unref (self);
 }
 
+static void
+splice_stream (TpFileTransferChannel *self)
+{
+  if (tp_channel_get_requested (TP_CHANNEL (self)))
+    {
+      GOutputStream *stream;
+
+      stream = g_io_stream_get_output_stream (self->priv->stream);
+
+      g_output_stream_splice_async (stream, self->priv->in_stream,
+          G_OUTPUT_STREAM_SPLICE_CLOSE_SOURCE |
+          G_OUTPUT_STREAM_SPLICE_CLOSE_TARGET,
+          G_PRIORITY_DEFAULT, self->priv->cancellable,
+          splice_stream_ready_cb, g_object_ref (self));
+    }
+  else
+    {
+      GInputStream *stream;
+
+      stream = g_io_stream_get_input_stream (self->priv->stream);
+
+      g_output_stream_splice_async (self->priv->out_stream, stream,
+          G_OUTPUT_STREAM_SPLICE_CLOSE_SOURCE |
+          G_OUTPUT_STREAM_SPLICE_CLOSE_TARGET,
+          G_PRIORITY_DEFAULT, self->priv->cancellable,
+          splice_stream_ready_cb, g_object_ref (self));
+    }
+}
+
+static void
+file_transfer_splice_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  TpFileTransferChannel *self = user_data;
+  guint64 transferred;
+  GError *error = NULL;
+
+  if (!_tp_file_transfer_splice_finish (G_SOCKET_CONNECTION (source), result,
+        &transferred, &error))
+    {
+      if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED))
+        {
+          DEBUG ("falling back to copying: %s", error->message);
+          g_clear_error (&error);
+          splice_stream (self);
+          g_object_unref (self);
+          return;
+        }
+
+      if (!g_cancellable_is_cancelled (self->priv->cancellable))
+        DEBUG ("zero-copy transfer failed after %" G_GUINT64_FORMAT
+            " bytes: %s", transferred, error->message);
+
+      g_clear_error (&error);
+    }
+
+  g_io_stream_close_async (self->priv->stream, G_PRIORITY_DEFAULT,
+      NULL, stream_close_cb, g_object_ref (self));
+
+  g_object_unref (self);
+}
+
+/* When resuming, the CM may start before the end of what we already have,
+ * but not after it: we'd have no way to fill in the gap. */
+static gboolean
+check_initial_offset (TpFileTransferChannel *self,
+    GError **error)
+{
+  if ((guint64) self->priv->initial_offset > self->priv->requested_offset)
+    {
+      g_set_error (error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
+          "Can't resume at offset %" G_GUINT64_FORMAT ": only the first %"
+          G_GUINT64_FORMAT " bytes were received",
+          (guint64) self->priv->initial_offset, self->priv->requested_offset);
+      return FALSE;
+    }
+
+  return TRUE;
+}
+
+/* When resuming, the CM has the last word on where the transfer starts:
+ * discard anything in the file beyond InitialOffset, and carry on writing
+ * from there. */
+static gboolean
+seek_to_initial_offset (TpFileTransferChannel *self,
+    GError **error)
+{
+  GSeekable *seekable = G_SEEKABLE (self->priv->out_stream);
+
+  DEBUG ("Resuming transfer at offset %" G_GUINT64_FORMAT
+      " (requested %" G_GUINT64_FORMAT ")",
+      (guint64) self->priv->initial_offset, self->priv->requested_offset);
+
+  if (!check_initial_offset (self, error))
+    return FALSE;
+
+  if (g_seekable_can_truncate (seekable) &&
+      !g_seekable_truncate (seekable, self->priv->initial_offset, NULL,
+        error))
+    return FALSE;
+
+  return g_seekable_seek (seekable, self->priv->initial_offset, G_SEEK_SET,
+      NULL, error);
+}
+
+/* Fail the accept or resume operation, if it hasn't finished yet, and
+ * give up on the transfer */
+static void
+resume_failed (TpFileTransferChannel *self,
+    GError *error)
+{
+  DEBUG ("Failed to resume transfer: %s", error->message);
+
+  if (self->priv->result != NULL)
+    operation_failed (self, error);
+  else
+    g_error_free (error);
+
+  tp_channel_close_async (TP_CHANNEL (self), NULL, NULL);
+}
+
 static void
 client_socket_connected (TpFileTransferChannel *self)
 {
   GSocketConnection *conn;
+  gpointer file_stream;
   GError *error = NULL;
 
   conn = g_socket_connection_factory_create_connection (
@@ -266,31 +404,31 @@ client_socket_connected (TpFileTransferChannel *self)
     }
 #endif
 
+  if (self->priv->file_io_stream != NULL &&
+      !seek_to_initial_offset (self, &error))
+    {
+      g_object_unref (conn);
+      resume_failed (self, error);
+      return;
+    }
+
   self->priv->stream = G_IO_STREAM (conn);
 
   if (tp_channel_get_requested (TP_CHANNEL (self)))
-    {
-      GOutputStream *stream;
-
-      stream = g_io_stream_get_output_stream (G_IO_STREAM (conn));
+    file_stream = self->priv->in_stream;
+  else
+    file_stream = self->priv->out_stream;
 
-      g_output_stream_splice_async (stream, self->priv->in_stream,
-          G_OUTPUT_STREAM_SPLICE_CLOSE_SOURCE |
-          G_OUTPUT_STREAM_SPLICE_CLOSE_TARGET,
-          G_PRIORITY_DEFAULT, self->priv->cancellable,
-          splice_stream_ready_cb, g_object_ref (self));
+  if (_tp_file_transfer_splice_supported (conn, file_stream))
+    {
+      DEBUG ("Using zero-copy transfer");
+      _tp_file_transfer_splice_async (conn, file_stream,
+          self->priv->cancellable, file_transfer_splice_cb,
+          g_object_ref (self));
     }
   else
     {
-      GInputStream *stream;
-
-      stream = g_io_stream_get_input_stream (G_IO_STREAM (conn));
-
-      g_output_stream_splice_async (self->priv->out_stream, stream,
-          G_OUTPUT_STREAM_SPLICE_CLOSE_SOURCE |
-          G_OUTPUT_STREAM_SPLICE_CLOSE_TARGET,
-          G_PRIORITY_DEFAULT, self->priv->cancellable,
-          splice_stream_ready_cb, g_object_ref (self));
+      splice_stream (self);
     }
 }
 
@@ -314,6 +452,73 @@ client_socket_cb (GSocket *socket,
   return FALSE;
 }
 
+static void
+notify_progress (TpFileTransferChannel *self)
+{
+  if (self->priv->progress_timeout_id != 0)
+    {
+      g_source_remove (self->priv->progress_timeout_id);
+      self->priv->progress_timeout_id = 0;
+    }
+
+  self->priv->notified_bytes = self->priv->transferred_bytes;
+  self->priv->last_progress = g_get_monotonic_time ();
+  g_object_notify (G_OBJECT (self), "transferred-bytes");
+}
+
+static gboolean
+progress_timeout_cb (gpointer user_data)
+{
+  TpFileTransferChannel *self = user_data;
+
+  self->priv->progress_timeout_id = 0;
+
+  if (self->priv->transferred_bytes != self->priv->notified_bytes)
+    notify_progress (self);
+
+  return FALSE;
+}
+
+/* Notify transferred-bytes if the transfer has moved on by at least
+ * progress-step bytes, or progress-interval milliseconds have passed since
+ * the last notification; otherwise make sure a notification will follow
+ * when the interval is up. */
+static void
+update_progress (TpFileTransferChannel *self)
+{
+  guint64 bytes = self->priv->transferred_bytes;
+  guint64 notified = self->priv->notified_bytes;
+  gint64 elapsed;
+
+  if (self->priv->progress_interval == 0 && self->priv->progress_step == 0)
+    {
+      notify_progress (self);
+      return;
+    }
+
+  if (bytes == notified)
+    return;
+
+  if (bytes == self->priv->size || bytes < notified ||
+      (self->priv->progress_step != 0 &&
+       bytes - notified >= self->priv->progress_step))
+    {
+      notify_progress (self);
+      return;
+    }
+
+  if (self->priv->progress_interval == 0)
+    return;
+
+  elapsed = (g_get_monotonic_time () - self->priv->last_progress) / 1000;
+
+  if (elapsed >= self->priv->progress_interval)
+    notify_progress (self);
+  else if (self->priv->progress_timeout_id == 0)
+    self->priv->progress_timeout_id = g_timeout_add (
+        self->priv->progress_interval - elapsed, progress_timeout_cb, self);
+}
+
 /* Callbacks */
 
 static void start_transfer (TpFileTransferChannel *self);
@@ -341,6 +546,10 @@ tp_file_transfer_channel_state_changed_cb (TpChannel *proxy,
   self->priv->state = state;
   self->priv->state_reason = reason;
 
+  /* Make sure the final progress has been seen before the state changes */
+  if (self->priv->transferred_bytes != self->priv->notified_bytes)
+    notify_progress (self);
+
   /* If the channel is open AND we have the socket path, we can start the
    * transfer. The socket path could be NULL if we are not doing the actual
    * data transfer but are just an observer for the channel. */
@@ -374,7 +583,7 @@ tp_file_transfer_channel_transferred_bytes_changed_cb (TpChannel *proxy,
   TpFileTransferChannel *self = (TpFileTransferChannel *) proxy;
 
   self->priv->transferred_bytes = count;
-  g_object_notify (G_OBJECT (self), "transferred-bytes");
+  update_progress (self);
 }
 
 static void
@@ -417,6 +626,7 @@ tp_file_transfer_channel_prepare_core_cb (TpProxy *proxy,
 
   self->priv->transferred_bytes = tp_asv_get_uint64 (properties,
       "TransferredBytes", &valid);
+  self->priv->notified_bytes = self->priv->transferred_bytes;
   if (!valid)
     {
       DEBUG ("Channel %s doesn't have FileTransfer.TransferredBytes property",
@@ -674,6 +884,40 @@ tp_file_transfer_channel_get_property (GObject *object,
         g_value_set_boxed (value, self->priv->metadata);
         break;
 
+      case PROP_PROGRESS_INTERVAL:
+        g_value_set_uint (value, self->priv->progress_interval);
+        break;
+
+      case PROP_PROGRESS_STEP:
+        g_value_set_uint64 (value, self->priv->progress_step);
+        break;
+
+      default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+        break;
+    }
+}
+
+static void
+tp_file_transfer_channel_set_property (GObject *object,
+    guint property_id,
+    const GValue *value,
+    GParamSpec *pspec)
+{
+  TpFileTransferChannel *self = (TpFileTransferChannel *) object;
+
+  switch (property_id)
+    {
+      case PROP_PROGRESS_INTERVAL:
+        tp_file_transfer_channel_set_progress_coalescing (self,
+            g_value_get_uint (value), self->priv->progress_step);
+        break;
+
+      case PROP_PROGRESS_STEP:
+        tp_file_transfer_channel_set_progress_coalescing (self,
+            self->priv->progress_interval, g_value_get_uint64 (value));
+        break;
+
       default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
         break;
@@ -710,8 +954,15 @@ tp_file_transfer_channel_dispose (GObject *obj)
 {
   TpFileTransferChannel *self = (TpFileTransferChannel *) obj;
 
+  if (self->priv->progress_timeout_id != 0)
+    {
+      g_source_remove (self->priv->progress_timeout_id);
+      self->priv->progress_timeout_id = 0;
+    }
+
   tp_clear_pointer (&self->priv->date, g_date_time_unref);
   g_clear_object (&self->priv->file);
+  g_clear_object (&self->priv->file_io_stream);
   tp_clear_pointer (&self->priv->metadata, g_hash_table_unref);
   g_clear_object (&self->priv->stream);
 
@@ -751,6 +1002,7 @@ tp_file_transfer_channel_class_init (TpFileTransferChannelClass *klass)
 
   object_class->constructed = tp_file_transfer_channel_constructed;
   object_class->get_property = tp_file_transfer_channel_get_property;
+  object_class->set_property = tp_file_transfer_channel_set_property;
   object_class->dispose = tp_file_transfer_channel_dispose;
 
   proxy_class->list_features = tp_file_transfer_channel_list_features;
@@ -1003,6 +1255,47 @@ tp_file_transfer_channel_class_init (TpFileTransferChannelClass *klass)
   g_object_class_install_property (object_class, PROP_METADATA,
       param_spec);
 
+  /**
+   * TpFileTransferChannel:progress-interval:
+   *
+   * If non-zero, #TpFileTransferChannel:transferred-bytes is notified at
+   * most once every this many milliseconds, however often the connection
+   * manager reports progress. The most recent value is always available
+   * from tp_file_transfer_channel_get_transferred_bytes().
+   *
+   * If both this and #TpFileTransferChannel:progress-step are 0, which is
+   * the default, every change is notified.
+   *
+   * Since: 0.UNRELEASED
+   */
+  param_spec = g_param_spec_uint ("progress-interval",
+      "Progress interval",
+      "Minimum interval between transferred-bytes notifications, in ms",
+      0, G_MAXUINT, 0,
+      G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+  g_object_class_install_property (object_class, PROP_PROGRESS_INTERVAL,
+      param_spec);
+
+  /**
+   * TpFileTransferChannel:progress-step:
+   *
+   * If non-zero, #TpFileTransferChannel:transferred-bytes is notified
+   * whenever the transfer has moved on by at least this many bytes since
+   * the last notification, even if #TpFileTransferChannel:progress-interval
+   * has not elapsed. If #TpFileTransferChannel:progress-interval is 0,
+   * smaller changes are only notified when the transfer finishes or
+   * changes state.
+   *
+   * Since: 0.UNRELEASED
+   */
+  param_spec = g_param_spec_uint64 ("progress-step",
+      "Progress step",
+      "Number of bytes after which transferred-bytes is always notified",
+      0, G_MAXUINT64, 0,
+      G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+  g_object_class_install_property (object_class, PROP_PROGRESS_STEP,
+      param_spec);
+
   g_type_class_add_private (object_class, sizeof
       (TpFileTransferChannelPrivate));
 }
@@ -1156,12 +1449,25 @@ accept_or_provide_file_cb (TpChannel *proxy,
       return;
     }
 
+  /* If the CM has already said where to resume, and it's no good, there's
+   * no point waiting for the transfer to open */
+  if (self->priv->file_io_stream != NULL &&
+      !check_initial_offset (self, &error))
+    {
+      resume_failed (self, error);
+      return;
+    }
+
   /* If the channel state is already Open, start the transfer
    * now. Otherwise, wait for the state change signal. */
   if (tp_file_transfer_channel_get_state (self, NULL)
       == TP_FILE_TRANSFER_STATE_OPEN)
     {
       start_transfer (self);
+
+      /* resuming might have failed already */
+      if (self->priv->result == NULL)
+        return;
     }
 
   g_simple_async_result_complete_in_idle (self->priv->result);
@@ -1259,6 +1565,27 @@ file_transfer_set_uri_cb (TpProxy *proxy,
       G_OBJECT (self));
 }
 
+static void
+file_opened (TpFileTransferChannel *self,
+    GFile *file)
+{
+  gchar *uri;
+  GValue *value;
+
+  g_clear_object (&self->priv->file);
+  self->priv->file = g_object_ref (file);
+
+  /* Try setting FileTransfer.URI before accepting the file */
+  uri = g_file_get_uri (file);
+  value = tp_g_value_slice_new_take_string (uri);
+
+  tp_cli_dbus_properties_call_set (self, -1,
+      TP_IFACE_CHANNEL_TYPE_FILE_TRANSFER, "URI", value,
+      file_transfer_set_uri_cb, NULL, NULL, G_OBJECT (self));
+
+  tp_g_value_slice_free (value);
+}
+
 static void
 file_replace_async_cb (GObject *source,
     GAsyncResult *result,
@@ -1267,9 +1594,7 @@ file_replace_async_cb (GObject *source,
   TpFileTransferChannel *self = user_data;
   GFile *file = G_FILE (source);
   GFileOutputStream *out_stream;
-  gchar *uri;
   GError *error = NULL;
-  GValue *value;
 
   out_stream = g_file_replace_finish (file, result, &error);
 
@@ -1281,19 +1606,43 @@ file_replace_async_cb (GObject *source,
     }
 
   self->priv->out_stream = G_OUTPUT_STREAM (out_stream);
+  file_opened (self, file);
+}
 
-  g_clear_object (&self->priv->file);
-  self->priv->file = g_object_ref (file);
+static gboolean
+check_can_accept (TpFileTransferChannel *self,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  if (self->priv->access_control_param != NULL ||
+      self->priv->result != NULL)
+    {
+      g_simple_async_report_error_in_idle (G_OBJECT (self), callback,
+          user_data, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
+          "Can't accept already accepted transfer");
 
-  /* Try setting FileTransfer.URI before accepting the file */
-  uri = g_file_get_uri (file);
-  value = tp_g_value_slice_new_take_string (uri);
+      return FALSE;
+    }
 
-  tp_cli_dbus_properties_call_set (self, -1,
-      TP_IFACE_CHANNEL_TYPE_FILE_TRANSFER, "URI", value,
-      file_transfer_set_uri_cb, NULL, NULL, G_OBJECT (self));
+  if (self->priv->state != TP_FILE_TRANSFER_STATE_PENDING)
+    {
+      g_simple_async_report_error_in_idle (G_OBJECT (self), callback,
+          user_data, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
+          "Can't accept a transfer that isn't pending");
 
-  tp_g_value_slice_free (value);
+      return FALSE;
+    }
+
+  if (tp_channel_get_requested (TP_CHANNEL (self)))
+    {
+      g_simple_async_report_error_in_idle (G_OBJECT (self), callback,
+          user_data, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
+          "Can't accept outgoing transfer");
+
+      return FALSE;
+    }
+
+  return TRUE;
 }
 
 /**
@@ -1322,60 +1671,191 @@ tp_file_transfer_channel_accept_file_async (TpFileTransferChannel *self,
   g_return_if_fail (TP_IS_FILE_TRANSFER_CHANNEL (self));
   g_return_if_fail (G_IS_FILE (file));
 
-  if (self->priv->access_control_param != NULL)
-    {
-      g_simple_async_report_error_in_idle (G_OBJECT (self), callback,
-          user_data, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-          "Can't accept already accepted transfer");
+  if (!check_can_accept (self, callback, user_data))
+    return;
+
+  self->priv->result = g_simple_async_result_new (G_OBJECT (self), callback,
+      user_data, tp_file_transfer_channel_accept_file_async);
+
+  self->priv->requested_offset = offset;
+
+  g_file_replace_async (file, NULL, FALSE, G_FILE_CREATE_NONE,
+      G_PRIORITY_DEFAULT, NULL, file_replace_async_cb, self);
+}
+
+/**
+ * tp_file_transfer_channel_accept_file_finish:
+ * @self: a #TpFileTransferChannel
+ * @result: a #GAsyncResult
+ * @error: a #GError to fill
+ *
+ * Finishes a call to tp_file_transfer_channel_accept_file_async().
+ *
+ * Returns: %TRUE if the accept operation was a success, or %FALSE
+ *
+ * Since: 0.17.1
+ */
+gboolean
+tp_file_transfer_channel_accept_file_finish (TpFileTransferChannel *self,
+    GAsyncResult *result,
+    GError **error)
+{
+  _tp_implement_finish_void (self, tp_file_transfer_channel_accept_file_async)
+}
+
+static void
+file_open_readwrite_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  TpFileTransferChannel *self = user_data;
+  GFile *file = G_FILE (source);
+  GFileIOStream *io_stream;
+  GError *error = NULL;
+
+  io_stream = g_file_open_readwrite_finish (file, result, &error);
 
+  if (io_stream == NULL)
+    {
+      DEBUG ("Failed to open file: %s", error->message);
+      operation_failed (self, error);
       return;
     }
 
-  if (self->priv->state != TP_FILE_TRANSFER_STATE_PENDING)
-    {
-      g_simple_async_report_error_in_idle (G_OBJECT (self), callback,
-          user_data, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-          "Can't accept a transfer that isn't pending");
+  self->priv->file_io_stream = G_IO_STREAM (io_stream);
+  self->priv->out_stream = g_object_ref (
+      g_io_stream_get_output_stream (self->priv->file_io_stream));
+  file_opened (self, file);
+}
+
+static void
+file_query_partial_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  TpFileTransferChannel *self = user_data;
+  GFile *file = G_FILE (source);
+  GFileInfo *info;
+  TpCapabilities *caps;
+  guint64 partial = 0;
+  GError *error = NULL;
+
+  info = g_file_query_info_finish (file, result, &error);
 
+  if (info != NULL)
+    {
+      partial = g_file_info_get_size (info);
+      g_object_unref (info);
+    }
+  else if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_NOT_FOUND))
+    {
+      g_clear_error (&error);
+    }
+  else
+    {
+      DEBUG ("Failed to query file: %s", error->message);
+      operation_failed (self, error);
       return;
     }
 
-  if (tp_channel_get_requested (TP_CHANNEL (self)))
+  caps = tp_connection_get_capabilities (
+      tp_channel_get_connection (TP_CHANNEL (self)));
+
+  if (partial > 0 && caps != NULL &&
+      !tp_capabilities_supports_file_transfer_initial_offset (caps))
     {
-      g_simple_async_report_error_in_idle (G_OBJECT (self), callback,
-          user_data, TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
-          "Can't accept outgoing transfer");
+      DEBUG ("Connection doesn't support resuming transfers; starting again");
+      partial = 0;
+    }
+  else if (partial > self->priv->size)
+    {
+      DEBUG ("%" G_GUINT64_FORMAT " bytes already received but the file is "
+          "only %" G_GUINT64_FORMAT " bytes long; starting again", partial,
+          self->priv->size);
+      partial = 0;
+    }
 
-      return;
+  self->priv->requested_offset = partial;
+
+  if (partial == 0)
+    {
+      g_file_replace_async (file, NULL, FALSE, G_FILE_CREATE_NONE,
+          G_PRIORITY_DEFAULT, NULL, file_replace_async_cb, self);
     }
+  else
+    {
+      DEBUG ("Asking to resume at offset %" G_GUINT64_FORMAT, partial);
+      g_file_open_readwrite_async (file, G_PRIORITY_DEFAULT, NULL,
+          file_open_readwrite_cb, self);
+    }
+}
 
-  self->priv->result = g_simple_async_result_new (G_OBJECT (self), callback,
-      user_data, tp_file_transfer_channel_accept_file_async);
+/**
+ * tp_file_transfer_channel_resume_file_async:
+ * @self: a #TpFileTransferChannel
+ * @file: a #GFile containing the start of the file, from an earlier transfer
+ *  which was interrupted
+ * @callback: a callback to call when the transfer has been accepted
+ * @user_data: data to pass to @callback
+ *
+ * Accept an incoming file transfer in the
+ * %TP_FILE_TRANSFER_STATE_PENDING state, like
+ * tp_file_transfer_channel_accept_file_async(), but keep what has already
+ * been written to @file, and ask the sender to start from where it ends.
+ *
+ * The connection manager decides where the transfer actually starts,
+ * which is reflected in #TpFileTransferChannel:initial-offset; anything in
+ * @file beyond that point is discarded when the transfer is opened. If
+ * @file doesn't exist, is longer than #TpFileTransferChannel:size, or the
+ * connection's #TpConnection:capabilities say that
+ * #TpFileTransferChannel:initial-offset is not supported (see
+ * tp_capabilities_supports_file_transfer_initial_offset()), the whole file is
+ * transferred again.
+ *
+ * Once the accept has been processed, @callback will be called. You can
+ * then call tp_file_transfer_channel_resume_file_finish() to get the result
+ * of the operation.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_file_transfer_channel_resume_file_async (TpFileTransferChannel *self,
+    GFile *file,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_return_if_fail (TP_IS_FILE_TRANSFER_CHANNEL (self));
+  g_return_if_fail (G_IS_FILE (file));
 
-  self->priv->requested_offset = offset;
+  if (!check_can_accept (self, callback, user_data))
+    return;
 
-  g_file_replace_async (file, NULL, FALSE, G_FILE_CREATE_NONE,
-      G_PRIORITY_DEFAULT, NULL, file_replace_async_cb, self);
+  self->priv->result = g_simple_async_result_new (G_OBJECT (self), callback,
+      user_data, tp_file_transfer_channel_resume_file_async);
+
+  g_file_query_info_async (file, G_FILE_ATTRIBUTE_STANDARD_SIZE,
+      G_FILE_QUERY_INFO_NONE, G_PRIORITY_DEFAULT, NULL,
+      file_query_partial_cb, self);
 }
 
 /**
- * tp_file_transfer_channel_accept_file_finish:
+ * tp_file_transfer_channel_resume_file_finish:
  * @self: a #TpFileTransferChannel
  * @result: a #GAsyncResult
  * @error: a #GError to fill
  *
- * Finishes a call to tp_file_transfer_channel_accept_file_async().
+ * Finishes a call to tp_file_transfer_channel_resume_file_async().
  *
  * Returns: %TRUE if the accept operation was a success, or %FALSE
  *
- * Since: 0.17.1
+ * Since: 0.UNRELEASED
  */
 gboolean
-tp_file_transfer_channel_accept_file_finish (TpFileTransferChannel *self,
+tp_file_transfer_channel_resume_file_finish (TpFileTransferChannel *self,
     GAsyncResult *result,
     GError **error)
 {
-  _tp_implement_finish_void (self, tp_file_transfer_channel_accept_file_async)
+  _tp_implement_finish_void (self, tp_file_transfer_channel_resume_file_async)
 }
 
 static void
@@ -1646,6 +2126,48 @@ tp_file_transfer_channel_get_transferred_bytes (TpFileTransferChannel *self)
   return self->priv->transferred_bytes;
 }
 
+/**
+ * tp_file_transfer_channel_set_progress_coalescing:
+ * @self: a #TpFileTransferChannel
+ * @interval: the new value of #TpFileTransferChannel:progress-interval, in
+ *  milliseconds
+ * @step: the new value of #TpFileTransferChannel:progress-step, in bytes
+ *
+ * Limit how often #TpFileTransferChannel:transferred-bytes is notified, so
+ * that a large transfer doesn't wake up its observers for every
+ * TransferredBytesChanged signal from the connection manager. Passing 0 for
+ * both @interval and @step notifies every change, which is the default.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_file_transfer_channel_set_progress_coalescing (TpFileTransferChannel *self,
+    guint interval,
+    guint64 step)
+{
+  g_return_if_fail (TP_IS_FILE_TRANSFER_CHANNEL (self));
+
+  g_object_freeze_notify (G_OBJECT (self));
+
+  if (self->priv->progress_interval != interval)
+    {
+      self->priv->progress_interval = interval;
+      g_object_notify (G_OBJECT (self), "progress-interval");
+    }
+
+  if (self->priv->progress_step != step)
+    {
+      self->priv->progress_step = step;
+      g_object_notify (G_OBJECT (self), "progress-step");
+    }
+
+  /* if a notification was being held back, it may be due now */
+  if (self->priv->transferred_bytes != self->priv->notified_bytes)
+    update_progress (self);
+
+  g_object_thaw_notify (G_OBJECT (self));
+}
+
 /**
  * tp_file_transfer_channel_get_service_name:
  * @self: a #TpFileTransferChannel
@@ -87,6 +87,18 @@ gboolean tp_file_transfer_channel_accept_file_finish (
     GAsyncResult *result,
     GError **error);
 
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_file_transfer_channel_resume_file_async (TpFileTransferChannel *self,
+    GFile *file,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_file_transfer_channel_resume_file_finish (
+    TpFileTransferChannel *self,
+    GAsyncResult *result,
+    GError **error);
+
 _TP_AVAILABLE_IN_0_18
 void tp_file_transfer_channel_provide_file_async (TpFileTransferChannel *self,
     GFile *file,
@@ -128,6 +140,12 @@ _TP_AVAILABLE_IN_0_16
 guint64 tp_file_transfer_channel_get_transferred_bytes (
     TpFileTransferChannel *self);
 
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_file_transfer_channel_set_progress_coalescing (
+    TpFileTransferChannel *self,
+    guint interval,
+    guint64 step);
+
 /* Metadata */
 
 _TP_AVAILABLE_IN_0_18
@@ -0,0 +1,44 @@
+/*<private_header>*/
+/* Zero-copy transfer between local files and sockets - internal header
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef TP_FILE_TRANSFER_SPLICE_INTERNAL_H
+#define TP_FILE_TRANSFER_SPLICE_INTERNAL_H
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+gboolean _tp_file_transfer_splice_supported (GSocketConnection *connection,
+    gpointer file_stream);
+
+void _tp_file_transfer_splice_async (GSocketConnection *connection,
+    gpointer file_stream,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean _tp_file_transfer_splice_finish (GSocketConnection *connection,
+    GAsyncResult *result,
+    guint64 *transferred,
+    GError **error);
+
+G_END_DECLS
+
+#endif
@@ -0,0 +1,423 @@
+/*
+ * file-transfer-splice.c - zero-copy transfer between local files and sockets
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "config.h"
+
+/* for splice(), pipe2() and F_SETPIPE_SZ */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "telepathy-glib/file-transfer-splice-internal.h"
+
+#if defined (HAVE_GIO_UNIX) && defined (HAVE_SPLICE) && \
+    defined (HAVE_SENDFILE) && defined (HAVE_SYS_SENDFILE_H)
+#define USE_SPLICE
+#endif
+
+#ifdef USE_SPLICE
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <unistd.h>
+
+#include <gio/gfiledescriptorbased.h>
+#endif
+
+#define DEBUG_FLAG TP_DEBUG_CHANNEL
+#include "telepathy-glib/debug-internal.h"
+
+/*
+ * g_output_stream_splice_async() copies each chunk of a file transfer from
+ * the kernel into a GIO buffer and back again, which makes moving large
+ * files CPU-bound. When the file is a local file and the Connection
+ * Manager's end is a stream socket, the kernel can move the data itself:
+ *
+ * - to send a file, sendfile() copies from the file to the socket
+ * - to receive a file, splice() moves data from the socket into a pipe,
+ *   then from the pipe into the file, without it being copied to userspace
+ *
+ * The socket is non-blocking, so this is done in a thread of its own, which
+ * waits for the socket with g_socket_condition_wait() whenever it would
+ * block.
+ *
+ * If the kernel refuses to do this before any data has been moved (for
+ * instance, some filesystems don't support splice()), the operation fails
+ * with G_IO_ERROR_NOT_SUPPORTED, leaving the file stream open so that the
+ * caller can fall back to g_output_stream_splice_async().
+ */
+
+#ifdef USE_SPLICE
+
+/* The size we ask for the pipe used to receive files; unprivileged
+ * processes can't ask for more than /proc/sys/fs/pipe-max-size, which is
+ * 1MiB by default, in which case we stick with the default size */
+#define PIPE_SIZE (1024 * 1024)
+#define DEFAULT_PIPE_SIZE (64 * 1024)
+
+/* the most we ask sendfile() to send at once */
+#define SENDFILE_CHUNK (4 * 1024 * 1024)
+
+typedef struct {
+    /* borrowed from the GSocketConnection, which is the task's source
+     * object */
+    GSocket *socket;
+    /* owned; a GInputStream if sending or a GOutputStream if receiving */
+    GObject *file_stream;
+    gint file_fd;
+    gboolean sending;
+
+    /* only accessed by the transfer thread until it has finished */
+    gboolean started;
+    guint64 transferred;
+} SpliceData;
+
+static void
+splice_data_free (gpointer p)
+{
+  SpliceData *data = p;
+
+  g_object_unref (data->file_stream);
+  g_slice_free (SpliceData, data);
+}
+
+static gboolean
+splice_failed (SpliceData *data,
+    const gchar *what,
+    gint saved_errno,
+    GError **error)
+{
+  /* If nothing has been taken from the source yet, our caller can still
+   * copy it the slow way. */
+  if (!data->started &&
+      (saved_errno == EINVAL || saved_errno == ENOSYS))
+    g_set_error (error, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+        "%s() not supported: %s", what, g_strerror (saved_errno));
+  else
+    g_set_error (error, G_IO_ERROR, g_io_error_from_errno (saved_errno),
+        "%s() failed: %s", what, g_strerror (saved_errno));
+
+  return FALSE;
+}
+
+static gboolean
+send_file (SpliceData *data,
+    GCancellable *cancellable,
+    GError **error)
+{
+  gint socket_fd = g_socket_get_fd (data->socket);
+  off_t offset = g_seekable_tell (G_SEEKABLE (data->file_stream));
+
+  while (TRUE)
+    {
+      gssize n;
+
+      if (g_cancellable_set_error_if_cancelled (cancellable, error))
+        return FALSE;
+
+      n = sendfile (socket_fd, data->file_fd, &offset, SENDFILE_CHUNK);
+
+      if (n > 0)
+        {
+          data->started = TRUE;
+          data->transferred += n;
+        }
+      else if (n == 0)
+        {
+          /* end of file */
+          return TRUE;
+        }
+      else if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+          if (!g_socket_condition_wait (data->socket, G_IO_OUT, cancellable,
+                error))
+            return FALSE;
+        }
+      else if (errno != EINTR)
+        {
+          return splice_failed (data, "sendfile", errno, error);
+        }
+    }
+}
+
+static gboolean
+receive_file (SpliceData *data,
+    GCancellable *cancellable,
+    GError **error)
+{
+  gint socket_fd = g_socket_get_fd (data->socket);
+  gint pipe_fds[2];
+  gsize pipe_size = DEFAULT_PIPE_SIZE;
+  gboolean ret = FALSE;
+
+  if (pipe2 (pipe_fds, O_CLOEXEC) != 0)
+    return splice_failed (data, "pipe2", errno, error);
+
+#ifdef F_SETPIPE_SZ
+  if (fcntl (pipe_fds[1], F_SETPIPE_SZ, PIPE_SIZE) > 0)
+    pipe_size = PIPE_SIZE;
+#endif
+
+  while (TRUE)
+    {
+      gssize in;
+
+      if (g_cancellable_set_error_if_cancelled (cancellable, error))
+        goto finally;
+
+      in = splice (socket_fd, NULL, pipe_fds[1], NULL, pipe_size,
+          SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+
+      if (in == 0)
+        {
+          /* the CM has closed its end */
+          ret = TRUE;
+          goto finally;
+        }
+      else if (in < 0)
+        {
+          if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+              if (!g_socket_condition_wait (data->socket, G_IO_IN,
+                    cancellable, error))
+                goto finally;
+            }
+          else if (errno != EINTR)
+            {
+              splice_failed (data, "splice", errno, error);
+              goto finally;
+            }
+
+          continue;
+        }
+
+      data->started = TRUE;
+
+      /* The file is a regular file, so this blocks rather than failing
+       * with EAGAIN; the pipe is empty again when it finishes. */
+      while (in > 0)
+        {
+          gssize out = splice (pipe_fds[0], NULL, data->file_fd, NULL, in,
+              SPLICE_F_MOVE);
+
+          if (out > 0)
+            {
+              in -= out;
+              data->transferred += out;
+            }
+          else if (out == 0)
+            {
+              splice_failed (data, "splice", EIO, error);
+              goto finally;
+            }
+          else if (errno != EINTR)
+            {
+              splice_failed (data, "splice", errno, error);
+              goto finally;
+            }
+        }
+    }
+
+finally:
+  close (pipe_fds[0]);
+  close (pipe_fds[1]);
+  return ret;
+}
+
+static gpointer
+splice_thread (gpointer p)
+{
+  GTask *task = p;
+  SpliceData *data = g_task_get_task_data (task);
+  GCancellable *cancellable = g_task_get_cancellable (task);
+  gint64 start = g_get_monotonic_time ();
+  GError *error = NULL;
+  gboolean ok;
+
+  if (data->sending)
+    ok = send_file (data, cancellable, &error);
+  else
+    ok = receive_file (data, cancellable, &error);
+
+  if (ok)
+    {
+      gdouble elapsed = (g_get_monotonic_time () - start) /
+          (gdouble) G_USEC_PER_SEC;
+
+      DEBUG ("%s %" G_GUINT64_FORMAT " bytes in %.3fs",
+          data->sending ? "sent" : "received", data->transferred, elapsed);
+    }
+
+  /* Like g_output_stream_splice() with CLOSE_SOURCE and CLOSE_TARGET, we're
+   * responsible for closing the file, unless our caller is going to fall
+   * back to doing exactly that. Errors closing the file we've written
+   * matter, so we report them if nothing else went wrong. */
+  if (!g_error_matches (error, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED))
+    {
+      gboolean closed;
+
+      if (data->sending)
+        closed = g_input_stream_close (G_INPUT_STREAM (data->file_stream),
+            NULL, ok ? &error : NULL);
+      else
+        closed = g_output_stream_close (G_OUTPUT_STREAM (data->file_stream),
+            NULL, ok ? &error : NULL);
+
+      ok = ok && closed;
+    }
+
+  /* this calls the callback in the caller's main context */
+  if (ok)
+    g_task_return_boolean (task, TRUE);
+  else
+    g_task_return_error (task, error);
+
+  g_object_unref (task);
+  return NULL;
+}
+
+#endif /* USE_SPLICE */
+
+/*
+ * _tp_file_transfer_splice_supported:
+ * @connection: the connection to the Connection Manager
+ * @file_stream: a #GInputStream for a file to be sent, or a #GOutputStream
+ *  for a file to be received
+ *
+ * Returns: %TRUE if _tp_file_transfer_splice_async() can be used to move
+ *  data between @connection and @file_stream
+ */
+gboolean
+_tp_file_transfer_splice_supported (GSocketConnection *connection,
+    gpointer file_stream)
+{
+#ifdef USE_SPLICE
+  GSocket *socket;
+
+  g_return_val_if_fail (G_IS_SOCKET_CONNECTION (connection), FALSE);
+  g_return_val_if_fail (G_IS_INPUT_STREAM (file_stream) ||
+      G_IS_OUTPUT_STREAM (file_stream), FALSE);
+
+  /* not a local file */
+  if (!G_IS_FILE_DESCRIPTOR_BASED (file_stream))
+    return FALSE;
+
+  /* sendfile() needs to know where to start */
+  if (G_IS_INPUT_STREAM (file_stream) &&
+      !G_IS_SEEKABLE (file_stream))
+    return FALSE;
+
+  socket = g_socket_connection_get_socket (connection);
+
+  return (g_socket_get_socket_type (socket) == G_SOCKET_TYPE_STREAM);
+#else
+  return FALSE;
+#endif
+}
+
+/*
+ * _tp_file_transfer_splice_async:
+ * @connection: the connection to the Connection Manager
+ * @file_stream: a #GInputStream for a file to be sent, or a #GOutputStream
+ *  for a file to be received, for which
+ *  _tp_file_transfer_splice_supported() returned %TRUE
+ * @cancellable: (allow-none): optional #GCancellable object
+ * @callback: called when the file has been sent, or received up to the end
+ *  of the stream, or on error
+ * @user_data: data to pass to @callback
+ *
+ * Move the contents of @file_stream to @connection, or the contents of
+ * @connection to @file_stream, without copying them into userspace. If
+ * this succeeds, or fails with any error other than
+ * %G_IO_ERROR_NOT_SUPPORTED, @file_stream is closed.
+ */
+void
+_tp_file_transfer_splice_async (GSocketConnection *connection,
+    gpointer file_stream,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  GTask *task;
+#ifdef USE_SPLICE
+  SpliceData *data;
+#endif
+
+  g_return_if_fail (G_IS_SOCKET_CONNECTION (connection));
+  g_return_if_fail (G_IS_INPUT_STREAM (file_stream) ||
+      G_IS_OUTPUT_STREAM (file_stream));
+
+  task = g_task_new (connection, cancellable, callback, user_data);
+
+#ifdef USE_SPLICE
+  data = g_slice_new0 (SpliceData);
+  data->socket = g_socket_connection_get_socket (connection);
+  data->file_stream = g_object_ref (file_stream);
+  data->file_fd = g_file_descriptor_based_get_fd (file_stream);
+  data->sending = G_IS_INPUT_STREAM (file_stream);
+  g_task_set_task_data (task, data, splice_data_free);
+
+  /* A transfer can take a long time, so it gets a thread of its own
+   * rather than tying up one from the pool shared with GIO's own
+   * asynchronous operations. */
+  g_thread_unref (g_thread_new ("tp-file-transfer", splice_thread,
+        g_object_ref (task)));
+#else
+  g_task_return_new_error (task, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+      "Zero-copy file transfer is not supported on this platform");
+#endif
+
+  g_object_unref (task);
+}
+
+/*
+ * _tp_file_transfer_splice_finish:
+ * @connection: the connection passed to _tp_file_transfer_splice_async()
+ * @result: the result passed to the callback
+ * @transferred: (out) (allow-none): used to return the number of bytes
+ *  moved, even on error
+ * @error: used to raise an error if %FALSE is returned
+ *
+ * Returns: %TRUE if the whole file was moved
+ */
+gboolean
+_tp_file_transfer_splice_finish (GSocketConnection *connection,
+    GAsyncResult *result,
+    guint64 *transferred,
+    GError **error)
+{
+#ifdef USE_SPLICE
+  SpliceData *data;
+#endif
+
+  g_return_val_if_fail (g_task_is_valid (result, connection), FALSE);
+
+  if (transferred != NULL)
+    *transferred = 0;
+
+#ifdef USE_SPLICE
+  data = g_task_get_task_data (G_TASK (result));
+
+  if (transferred != NULL && data != NULL)
+    *transferred = data->transferred;
+#endif
+
+  return g_task_propagate_boolean (G_TASK (result), error);
+}
@@ -0,0 +1,75 @@
+/*<private_header>*/
+/* GNIO utility functions - internal header
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef TP_GNIO_UTIL_INTERNAL_H
+#define TP_GNIO_UTIL_INTERNAL_H
+
+#include <gio/gio.h>
+
+#ifdef HAVE_GIO_UNIX
+#include <gio/gunixfdlist.h>
+#endif
+
+G_BEGIN_DECLS
+
+#ifdef HAVE_GIO_UNIX
+
+/* @error is borrowed */
+typedef void (*TpUnixMessageSentCallback) (GSocketConnection *connection,
+    const GError *error,
+    gpointer user_data);
+
+/* @len is the number of bytes received, 0 at the end of the stream;
+ * @fds, @credentials and @error are borrowed; take a reference to @fds, or
+ * steal its fds, to keep them open after the callback returns */
+typedef void (*TpUnixMessageReceivedCallback) (GSocketConnection *connection,
+    gsize len,
+    GUnixFDList *fds,
+    GCredentials *credentials,
+    const GError *error,
+    gpointer user_data);
+
+/* Unlike the usual GIO convention, @callback is called before these
+ * functions return if the message can be sent or received without waiting
+ * for the socket. */
+
+void _tp_unix_connection_send_message_async (GSocketConnection *connection,
+    GOutputVector *vectors,
+    gint n_vectors,
+    const gint *fds,
+    gint n_fds,
+    gboolean send_credentials,
+    GCancellable *cancellable,
+    TpUnixMessageSentCallback callback,
+    gpointer user_data);
+
+void _tp_unix_connection_receive_message_async (GSocketConnection *connection,
+    GInputVector *vectors,
+    gint n_vectors,
+    gboolean receive_credentials,
+    GCancellable *cancellable,
+    TpUnixMessageReceivedCallback callback,
+    gpointer user_data);
+
+#endif /* HAVE_GIO_UNIX */
+
+G_END_DECLS
+
+#endif
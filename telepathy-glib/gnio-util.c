@@ -45,6 +45,8 @@
 #include <telepathy-glib/errors.h>
 #include <telepathy-glib/util-internal.h>
 
+#include "telepathy-glib/gnio-util-internal.h"
+
 #include <string.h>
 
 #ifdef __linux__
@@ -60,6 +62,9 @@
 #include <gio/gunixconnection.h>
 #include <gio/gunixsocketaddress.h>
 #include <gio/gunixcredentialsmessage.h>
+#include <gio/gunixfdlist.h>
+#include <gio/gunixfdmessage.h>
+#include <unistd.h>
 #endif /* HAVE_GIO_UNIX */
 
 /**
@@ -347,7 +352,241 @@ tp_address_g_variant_from_g_socket_address (GSocketAddress *address,
   return ret;
 }
 
+
 #ifdef HAVE_GIO_UNIX
+#ifdef __linux__
+/* On Linux, we need to turn on SO_PASSCRED if it isn't enabled
+ * already. We also need to turn it off when we're done.  See
+ * #617483 for more discussion.
+ *
+ * This code has been copied from glib/gunixconnection.c
+ *
+ * Copyright © 2009 Codethink Limited
+ */
+static gboolean
+passcred_enable (GSocket *socket,
+    gboolean *turn_off_so_passcreds,
+    GError **error)
+{
+  gint opt_val;
+  socklen_t opt_len;
+
+  *turn_off_so_passcreds = FALSE;
+  opt_val = 0;
+  opt_len = sizeof (gint);
+  if (getsockopt (g_socket_get_fd (socket),
+                  SOL_SOCKET,
+                  SO_PASSCRED,
+                  &opt_val,
+                  &opt_len) != 0)
+    {
+      g_set_error (error,
+                   G_IO_ERROR,
+                   g_io_error_from_errno (errno),
+                   "Error checking if SO_PASSCRED is enabled for socket: %s",
+                   strerror (errno));
+      return FALSE;
+    }
+  if (opt_len != sizeof (gint))
+    {
+      g_set_error (error,
+                   G_IO_ERROR,
+                   G_IO_ERROR_FAILED,
+                   "Unexpected option length while checking if SO_PASSCRED is enabled for socket. "
+                     "Expected %d bytes, got %d",
+                   (gint) sizeof (gint), (gint) opt_len);
+      return FALSE;
+    }
+  if (opt_val == 0)
+    {
+      opt_val = 1;
+      if (setsockopt (g_socket_get_fd (socket),
+                      SOL_SOCKET,
+                      SO_PASSCRED,
+                      &opt_val,
+                      sizeof opt_val) != 0)
+        {
+          g_set_error (error,
+                       G_IO_ERROR,
+                       g_io_error_from_errno (errno),
+                       "Error enabling SO_PASSCRED: %s",
+                       strerror (errno));
+          return FALSE;
+        }
+      *turn_off_so_passcreds = TRUE;
+    }
+
+  return TRUE;
+}
+
+static gboolean
+passcred_restore (GSocket *socket,
+    gboolean turn_off_so_passcreds,
+    GError **error)
+{
+  gint opt_val;
+
+  if (!turn_off_so_passcreds)
+    return TRUE;
+
+  opt_val = 0;
+  if (setsockopt (g_socket_get_fd (socket),
+                  SOL_SOCKET,
+                  SO_PASSCRED,
+                  &opt_val,
+                  sizeof opt_val) != 0)
+    {
+      g_set_error (error,
+                   G_IO_ERROR,
+                   g_io_error_from_errno (errno),
+                   "Error while disabling SO_PASSCRED: %s",
+                   strerror (errno));
+      return FALSE;
+    }
+
+  return TRUE;
+}
+#endif
+
+/* Send @vectors with @fds and our credentials attached, in a single
+ * sendmsg(). If @blocking is FALSE, fail with G_IO_ERROR_WOULD_BLOCK instead
+ * of waiting for the socket to become writable; GSocket only emulates
+ * blocking, so switching it is free. */
+static gssize
+send_message (GSocket *socket,
+    GOutputVector *vectors,
+    gint n_vectors,
+    const gint *fds,
+    gint n_fds,
+    gboolean send_credentials,
+    gboolean blocking,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GSocketControlMessage *scms[2];
+  GUnixFDList *fd_list = NULL;
+  gint nscm = 0;
+  gboolean was_blocking;
+  gssize ret;
+
+  if (send_credentials)
+    scms[nscm++] = g_unix_credentials_message_new ();
+
+  if (n_fds > 0)
+    {
+      /* Lend the caller's fds to the list rather than dup()ing each of them;
+       * we steal them back below, before the list can close them */
+      fd_list = g_unix_fd_list_new_from_array (fds, n_fds);
+      scms[nscm++] = g_unix_fd_message_new_with_fd_list (fd_list);
+    }
+
+  was_blocking = g_socket_get_blocking (socket);
+  g_socket_set_blocking (socket, blocking);
+
+  ret = g_socket_send_message (socket,
+                               NULL, /* address */
+                               vectors,
+                               n_vectors,
+                               nscm > 0 ? scms : NULL,
+                               nscm,
+                               G_SOCKET_MSG_NONE,
+                               cancellable,
+                               error);
+
+  g_socket_set_blocking (socket, was_blocking);
+
+  if (fd_list != NULL)
+    g_free (g_unix_fd_list_steal_fds (fd_list, NULL));
+
+  while (nscm > 0)
+    g_object_unref (scms[--nscm]);
+
+  tp_clear_object (&fd_list);
+  return ret;
+}
+
+/* Receive into @vectors with a single recvmsg(). If @fds or @credentials
+ * are not %NULL, they must point to %NULL and are used to return the fds
+ * and credentials attached to the message, if any; unwanted fds are
+ * closed. */
+static gssize
+receive_message (GSocket *socket,
+    GInputVector *vectors,
+    gint n_vectors,
+    GUnixFDList **fds,
+    GCredentials **credentials,
+    gboolean blocking,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GSocketControlMessage **scms = NULL;
+  gint nscm = 0;
+  gboolean was_blocking;
+  gssize ret;
+  gint i;
+
+  /* ensure the control message types have been registered with the type
+   * system, so GSocket can deserialize them */
+  (void) (G_TYPE_UNIX_CREDENTIALS_MESSAGE);
+  (void) (G_TYPE_UNIX_FD_MESSAGE);
+
+  was_blocking = g_socket_get_blocking (socket);
+  g_socket_set_blocking (socket, blocking);
+
+  ret = g_socket_receive_message (socket,
+                                  NULL, /* GSocketAddress **address */
+                                  vectors,
+                                  n_vectors,
+                                  &scms,
+                                  &nscm,
+                                  NULL,
+                                  cancellable,
+                                  error);
+
+  g_socket_set_blocking (socket, was_blocking);
+
+  for (i = 0; i < nscm; i++)
+    {
+      if (fds != NULL && G_IS_UNIX_FD_MESSAGE (scms[i]))
+        {
+          GUnixFDList *list = g_unix_fd_message_get_fd_list (
+              G_UNIX_FD_MESSAGE (scms[i]));
+
+          if (*fds == NULL)
+            {
+              *fds = g_object_ref (list);
+            }
+          else
+            {
+              gint *stolen;
+              gint n, j;
+
+              stolen = g_unix_fd_list_steal_fds (list, &n);
+
+              for (j = 0; j < n; j++)
+                {
+                  g_unix_fd_list_append (*fds, stolen[j], NULL);
+                  close (stolen[j]);
+                }
+
+              g_free (stolen);
+            }
+        }
+      else if (credentials != NULL && *credentials == NULL &&
+          G_IS_UNIX_CREDENTIALS_MESSAGE (scms[i]))
+        {
+          *credentials = g_object_ref (
+              g_unix_credentials_message_get_credentials (
+                  G_UNIX_CREDENTIALS_MESSAGE (scms[i])));
+        }
+
+      g_object_unref (scms[i]);
+    }
+
+  g_free (scms);
+  return ret;
+}
+
 static gboolean
 _tp_unix_connection_send_credentials_with_byte (GUnixConnection *connection,
     guchar byte,
@@ -355,50 +594,24 @@ _tp_unix_connection_send_credentials_with_byte (GUnixConnection *connection,
     GError **error)
 {
   /* There is not variant of g_unix_connection_send_credentials allowing us to
-   * choose the byte sent :( See bgo #629267
-   *
-   * This code has been copied from glib/gunixconnection.c
-   *
-   * Copyright © 2009 Codethink Limited
-   */
-  GCredentials *credentials;
-  GSocketControlMessage *scm;
-  GSocket *_socket;
-  gboolean ret;
+   * choose the byte sent :( See bgo #629267 */
   GOutputVector vector;
 
   g_return_val_if_fail (G_IS_UNIX_CONNECTION (connection), FALSE);
   g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
 
-  ret = FALSE;
-
-  credentials = g_credentials_new ();
-
   vector.buffer = &byte;
   vector.size = 1;
-  scm = g_unix_credentials_message_new_with_credentials (credentials);
-  g_object_get (connection, "socket", &_socket, NULL);
-  if (g_socket_send_message (_socket,
-                             NULL, /* address */
-                             &vector,
-                             1,
-                             &scm,
-                             1,
-                             G_SOCKET_MSG_NONE,
-                             cancellable,
-                             error) != 1)
+
+  if (send_message (g_socket_connection_get_socket (
+              G_SOCKET_CONNECTION (connection)),
+          &vector, 1, NULL, 0, TRUE, TRUE, cancellable, error) != 1)
     {
       g_prefix_error (error, "Error sending credentials: ");
-      goto out;
+      return FALSE;
     }
 
-  ret = TRUE;
-
- out:
-  g_object_unref (_socket);
-  g_object_unref (scm);
-  g_object_unref (credentials);
-  return ret;
+  return TRUE;
 }
 #endif
 
@@ -432,22 +645,26 @@ tp_unix_connection_send_credentials_with_byte (GSocketConnection *connection,
 #endif
 }
 
+#ifdef HAVE_GIO_UNIX
 static void
-send_credentials_with_byte_async_thread (GSimpleAsyncResult *res,
-    GObject *object,
-    GCancellable *cancellable)
+send_credentials_with_byte_cb (GSocketConnection *connection,
+    const GError *error,
+    gpointer user_data)
 {
-  guchar byte;
-  GError *error = NULL;
-
-  byte = GPOINTER_TO_UINT (g_simple_async_result_get_op_res_gpointer (res));
+  GSimpleAsyncResult *res = user_data;
 
-  if (!tp_unix_connection_send_credentials_with_byte (
-          (GSocketConnection *) object, byte, cancellable, &error))
+  if (error != NULL)
     {
-      g_simple_async_result_take_error (res, error);
+      GError *e = g_error_copy (error);
+
+      g_prefix_error (&e, "Error sending credentials: ");
+      g_simple_async_result_take_error (res, e);
     }
+
+  g_simple_async_result_complete_in_idle (res);
+  g_object_unref (res);
 }
+#endif
 
 /**
  * tp_unix_connection_send_credentials_with_byte_async:
@@ -477,18 +694,26 @@ tp_unix_connection_send_credentials_with_byte_async (
     gpointer user_data)
 {
   GSimpleAsyncResult *res;
+#ifdef HAVE_GIO_UNIX
+  GOutputVector vector;
+#endif
 
   res = g_simple_async_result_new (G_OBJECT (connection), callback, user_data,
       tp_unix_connection_send_credentials_with_byte_async);
 
-  /* Extra casting to guint to work around GNOME#661546 for GLib < 2.32 */
-  g_simple_async_result_set_op_res_gpointer (res,
-      GUINT_TO_POINTER ((guint) byte), NULL);
-
-  g_simple_async_result_run_in_thread (res,
-      send_credentials_with_byte_async_thread, G_PRIORITY_DEFAULT, cancellable);
-
+#ifdef HAVE_GIO_UNIX
+  /* The socket is polled from the main loop, rather than blocking a thread
+   * from the pool for each connection */
+  vector.buffer = &byte;
+  vector.size = 1;
+  _tp_unix_connection_send_message_async (connection, &vector, 1, NULL, 0,
+      TRUE, cancellable, send_credentials_with_byte_cb, res);
+#else
+  g_simple_async_result_set_error (res, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+      "Unix sockets not supported");
+  g_simple_async_result_complete_in_idle (res);
   g_object_unref (res);
+#endif
 }
 
 /**
@@ -515,6 +740,32 @@ tp_unix_connection_send_credentials_with_byte_finish (
 }
 
 #ifdef HAVE_GIO_UNIX
+static GCredentials *
+check_credentials_with_byte (gssize num_bytes_read,
+    GCredentials *credentials,
+    GError **error)
+{
+  if (num_bytes_read != 1)
+    {
+      g_set_error_literal (error,
+                           G_IO_ERROR,
+                           G_IO_ERROR_FAILED,
+                           "Expecting to read a single byte for receiving credentials but read zero bytes");
+      return NULL;
+    }
+
+  if (credentials == NULL)
+    {
+      g_set_error_literal (error,
+                           G_IO_ERROR,
+                           G_IO_ERROR_FAILED,
+                           "Expecting credentials with the byte but none were received");
+      return NULL;
+    }
+
+  return g_object_ref (credentials);
+}
+
 static GCredentials *
 _tp_unix_connection_receive_credentials_with_byte (GUnixConnection *connection,
     guchar *byte,
@@ -522,17 +773,10 @@ _tp_unix_connection_receive_credentials_with_byte (GUnixConnection *connection,
     GError **error)
 {
   /* There is not variant of g_unix_connection_receive_credentials allowing us
-   * to choose the byte sent :( See bgo #629267
-   *
-   * This code has been copied from glib/gunixconnection.c
-   *
-   * Copyright © 2009 Codethink Limited
-   */
-  GCredentials *ret;
-  GSocketControlMessage **scms;
-  gint nscm;
+   * to choose the byte sent :( See bgo #629267 */
+  GCredentials *ret = NULL;
+  GCredentials *credentials = NULL;
   GSocket *_socket;
-  gint n;
   gssize num_bytes_read;
 #ifdef __linux__
   gboolean turn_off_so_passcreds;
@@ -543,153 +787,35 @@ _tp_unix_connection_receive_credentials_with_byte (GUnixConnection *connection,
   g_return_val_if_fail (G_IS_UNIX_CONNECTION (connection), NULL);
   g_return_val_if_fail (error == NULL || *error == NULL, NULL);
 
-  ret = NULL;
-  scms = NULL;
-
-  g_object_get (connection, "socket", &_socket, NULL);
+  _socket = g_socket_connection_get_socket (G_SOCKET_CONNECTION (connection));
 
-  /* On Linux, we need to turn on SO_PASSCRED if it isn't enabled
-   * already. We also need to turn it off when we're done.  See
-   * #617483 for more discussion.
-   */
 #ifdef __linux__
-  {
-    gint opt_val;
-    socklen_t opt_len;
-
-    turn_off_so_passcreds = FALSE;
-    opt_val = 0;
-    opt_len = sizeof (gint);
-    if (getsockopt (g_socket_get_fd (_socket),
-                    SOL_SOCKET,
-                    SO_PASSCRED,
-                    &opt_val,
-                    &opt_len) != 0)
-      {
-        g_set_error (error,
-                     G_IO_ERROR,
-                     g_io_error_from_errno (errno),
-                     "Error checking if SO_PASSCRED is enabled for socket: %s",
-                     strerror (errno));
-        goto out;
-      }
-    if (opt_len != sizeof (gint))
-      {
-        g_set_error (error,
-                     G_IO_ERROR,
-                     G_IO_ERROR_FAILED,
-                     "Unexpected option length while checking if SO_PASSCRED is enabled for socket. "
-                       "Expected %d bytes, got %d",
-                     (gint) sizeof (gint), (gint) opt_len);
-        goto out;
-      }
-    if (opt_val == 0)
-      {
-        opt_val = 1;
-        if (setsockopt (g_socket_get_fd (_socket),
-                        SOL_SOCKET,
-                        SO_PASSCRED,
-                        &opt_val,
-                        sizeof opt_val) != 0)
-          {
-            g_set_error (error,
-                         G_IO_ERROR,
-                         g_io_error_from_errno (errno),
-                         "Error enabling SO_PASSCRED: %s",
-                         strerror (errno));
-            goto out;
-          }
-        turn_off_so_passcreds = TRUE;
-      }
-  }
+  if (!passcred_enable (_socket, &turn_off_so_passcreds, error))
+    return NULL;
 #endif
 
   vector.buffer = buffer;
   vector.size = 1;
 
-  /* ensure the type of GUnixCredentialsMessage has been registered with the type system */
-  (void) (G_TYPE_UNIX_CREDENTIALS_MESSAGE);
-  num_bytes_read = g_socket_receive_message (_socket,
-                                             NULL, /* GSocketAddress **address */
-                                             &vector,
-                                             1,
-                                             &scms,
-                                             &nscm,
-                                             NULL,
-                                             cancellable,
-                                             error);
-  if (num_bytes_read != 1)
-    {
-      /* Handle situation where g_socket_receive_message() returns
-       * 0 bytes and not setting @error
-       */
-      if (num_bytes_read == 0 && error != NULL && *error == NULL)
-        {
-          g_set_error_literal (error,
-                               G_IO_ERROR,
-                               G_IO_ERROR_FAILED,
-                               "Expecting to read a single byte for receiving credentials but read zero bytes");
-        }
-      goto out;
-    }
-
-  if (nscm != 1)
-    {
-      g_set_error (error,
-                   G_IO_ERROR,
-                   G_IO_ERROR_FAILED,
-                   "Expecting 1 control message, got %d",
-                   nscm);
-      goto out;
-    }
+  num_bytes_read = receive_message (_socket, &vector, 1, NULL, &credentials,
+      TRUE, cancellable, error);
 
-  if (!G_IS_UNIX_CREDENTIALS_MESSAGE (scms[0]))
+  if (num_bytes_read >= 0)
     {
-      g_set_error_literal (error,
-                           G_IO_ERROR,
-                           G_IO_ERROR_FAILED,
-                           "Unexpected type of ancillary data");
-      goto out;
-    }
+      ret = check_credentials_with_byte (num_bytes_read, credentials, error);
 
-  if (byte != NULL)
-    {
-      *byte = buffer[0];
+      if (ret != NULL && byte != NULL)
+        *byte = buffer[0];
     }
 
-  ret = g_unix_credentials_message_get_credentials (G_UNIX_CREDENTIALS_MESSAGE (scms[0]));
-  g_object_ref (ret);
-
- out:
-
 #ifdef __linux__
-  if (turn_off_so_passcreds)
-    {
-      gint opt_val;
-      opt_val = 0;
-      if (setsockopt (g_socket_get_fd (_socket),
-                      SOL_SOCKET,
-                      SO_PASSCRED,
-                      &opt_val,
-                      sizeof opt_val) != 0)
-        {
-          g_set_error (error,
-                       G_IO_ERROR,
-                       g_io_error_from_errno (errno),
-                       "Error while disabling SO_PASSCRED: %s",
-                       strerror (errno));
-          goto out;
-        }
-    }
+  if (ret != NULL && !passcred_restore (_socket, turn_off_so_passcreds, error))
+    tp_clear_object (&ret);
+  else if (ret == NULL)
+    passcred_restore (_socket, turn_off_so_passcreds, NULL);
 #endif
 
-  if (scms != NULL)
-    {
-      for (n = 0; n < nscm; n++)
-        g_object_unref (scms[n]);
-      g_free (scms);
-    }
-  g_object_unref (_socket);
+  tp_clear_object (&credentials);
   return ret;
 }
 #endif
@@ -731,49 +857,44 @@ typedef struct
   guchar byte;
 } ReceiveCredentialsWithByteData;
 
-static ReceiveCredentialsWithByteData *
-receive_credentials_with_byte_data_new (GCredentials *creds,
-    guchar byte)
-{
-  ReceiveCredentialsWithByteData *data;
-
-  data = g_slice_new0 (ReceiveCredentialsWithByteData);
-  data->creds = g_object_ref (creds);
-  data->byte = byte;
-
-  return data;
-}
-
+#ifdef HAVE_GIO_UNIX
 static void
 receive_credentials_with_byte_data_free (ReceiveCredentialsWithByteData *data)
 {
-  g_object_unref (data->creds);
+  tp_clear_object (&data->creds);
   g_slice_free (ReceiveCredentialsWithByteData, data);
 }
 
 static void
-receive_credentials_with_byte_async_thread (GSimpleAsyncResult *res,
-    GObject *object,
-    GCancellable *cancellable)
+receive_credentials_with_byte_cb (GSocketConnection *connection,
+    gsize len,
+    GUnixFDList *fds,
+    GCredentials *credentials,
+    const GError *error,
+    gpointer user_data)
 {
-  guchar byte;
-  GCredentials *creds;
-  GError *error = NULL;
+  GSimpleAsyncResult *res = user_data;
+  ReceiveCredentialsWithByteData *data;
+  GError *e = NULL;
 
-  creds = tp_unix_connection_receive_credentials_with_byte (
-      (GSocketConnection *) object, &byte, cancellable, &error);
-  if (creds == NULL)
+  if (error != NULL)
     {
-      g_simple_async_result_take_error (res, error);
-      return;
+      g_simple_async_result_set_from_error (res, error);
+      goto out;
     }
 
-  g_simple_async_result_set_op_res_gpointer (res,
-      receive_credentials_with_byte_data_new (creds, byte),
-      (GDestroyNotify) receive_credentials_with_byte_data_free);
+  /* the byte has been received straight into it */
+  data = g_simple_async_result_get_op_res_gpointer (res);
+  data->creds = check_credentials_with_byte ((gssize) len, credentials, &e);
+
+  if (data->creds == NULL)
+    g_simple_async_result_take_error (res, e);
 
-  g_object_unref (creds);
+out:
+  g_simple_async_result_complete_in_idle (res);
+  g_object_unref (res);
 }
+#endif
 
 /**
  * tp_unix_connection_receive_credentials_with_byte_async:
@@ -801,15 +922,29 @@ tp_unix_connection_receive_credentials_with_byte_async (
     gpointer user_data)
 {
   GSimpleAsyncResult *res;
+#ifdef HAVE_GIO_UNIX
+  ReceiveCredentialsWithByteData *data;
+  GInputVector vector;
+#endif
 
   res = g_simple_async_result_new (G_OBJECT (connection), callback, user_data,
       tp_unix_connection_receive_credentials_with_byte_async);
 
-  g_simple_async_result_run_in_thread (res,
-      receive_credentials_with_byte_async_thread, G_PRIORITY_DEFAULT,
-      cancellable);
+#ifdef HAVE_GIO_UNIX
+  data = g_slice_new0 (ReceiveCredentialsWithByteData);
+  g_simple_async_result_set_op_res_gpointer (res, data,
+      (GDestroyNotify) receive_credentials_with_byte_data_free);
 
+  vector.buffer = &data->byte;
+  vector.size = 1;
+  _tp_unix_connection_receive_message_async (connection, &vector, 1, TRUE,
+      cancellable, receive_credentials_with_byte_cb, res);
+#else
+  g_simple_async_result_set_error (res, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+      "Unix sockets not supported");
+  g_simple_async_result_complete_in_idle (res);
   g_object_unref (res);
+#endif
 }
 
 /**
@@ -852,3 +987,763 @@ tp_unix_connection_receive_credentials_with_byte_finish (
 
   return g_object_ref (data->creds);
 }
+
+/**
+ * tp_unix_connection_send_message:
+ * @connection: a #GUnixConnection
+ * @vectors: (array length=n_vectors): the payload to send
+ * @n_vectors: the number of elements in @vectors
+ * @fds: (array length=n_fds) (allow-none): file descriptors to pass to the
+ *  peer, which remain owned by the caller
+ * @n_fds: the number of elements in @fds
+ * @send_credentials: if %TRUE, send the credentials of this process too
+ * @cancellable: (allow-none): a #GCancellable, or %NULL
+ * @error: a #GError to fill
+ *
+ * Send a message made of @vectors over @connection, with @fds and
+ * optionally this process's credentials attached to it, using a single
+ * sendmsg() call. This generalizes
+ * tp_unix_connection_send_credentials_with_byte() to several bytes of
+ * payload and several file descriptors.
+ *
+ * At least one byte of payload must be sent for the file descriptors and
+ * credentials to be delivered. As with g_socket_send_message(), the payload
+ * might only be sent partially; the ancillary data always goes with the
+ * first byte sent.
+ *
+ * Returns: the number of bytes of payload sent, or -1 if @error is set
+ *
+ * Since: 0.UNRELEASED
+ */
+gssize
+tp_unix_connection_send_message (GSocketConnection *connection,
+    GOutputVector *vectors,
+    gint n_vectors,
+    const gint *fds,
+    gint n_fds,
+    gboolean send_credentials,
+    GCancellable *cancellable,
+    GError **error)
+{
+#ifdef HAVE_GIO_UNIX
+  g_return_val_if_fail (G_IS_UNIX_CONNECTION (connection), -1);
+  g_return_val_if_fail (n_fds == 0 || fds != NULL, -1);
+
+  return send_message (g_socket_connection_get_socket (connection),
+      vectors, n_vectors, fds, n_fds, send_credentials, TRUE, cancellable,
+      error);
+#else
+  g_set_error_literal (error, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+      "Unix sockets not supported");
+  return -1;
+#endif
+}
+
+/**
+ * tp_unix_connection_receive_message:
+ * @connection: a #GUnixConnection
+ * @vectors: (array length=n_vectors): buffers for the payload
+ * @n_vectors: the number of elements in @vectors
+ * @fds: (out) (array length=n_fds) (allow-none): if not %NULL, used to return
+ *  a newly allocated array of the file descriptors which were received, or
+ *  %NULL if there were none. Close them and free the array with g_free().
+ * @n_fds: (out) (allow-none): used to return the number of elements in @fds;
+ *  must be non-%NULL if @fds is
+ * @credentials: (out) (transfer full) (allow-none): if not %NULL, used to
+ *  return the peer's credentials, or %NULL if it did not send any
+ * @cancellable: (allow-none): a #GCancellable, or %NULL
+ * @error: a #GError to fill
+ *
+ * Receive a message sent with tp_unix_connection_send_message() (or any
+ * other sendmsg()) over @connection into @vectors, with its attached file
+ * descriptors and credentials, using a single recvmsg() call. If @fds is
+ * %NULL, any file descriptors received are closed.
+ *
+ * Returns: the number of bytes of payload received, 0 at the end of the
+ *  stream, or -1 if @error is set
+ *
+ * Since: 0.UNRELEASED
+ */
+gssize
+tp_unix_connection_receive_message (GSocketConnection *connection,
+    GInputVector *vectors,
+    gint n_vectors,
+    gint **fds,
+    gint *n_fds,
+    GCredentials **credentials,
+    GCancellable *cancellable,
+    GError **error)
+{
+#ifdef HAVE_GIO_UNIX
+  GSocket *_socket;
+  GUnixFDList *fd_list = NULL;
+  GCredentials *creds = NULL;
+  gssize ret;
+#ifdef __linux__
+  gboolean turn_off_so_passcreds = FALSE;
+#endif
+
+  g_return_val_if_fail (G_IS_UNIX_CONNECTION (connection), -1);
+  g_return_val_if_fail (fds == NULL || n_fds != NULL, -1);
+
+  _socket = g_socket_connection_get_socket (connection);
+
+#ifdef __linux__
+  if (credentials != NULL &&
+      !passcred_enable (_socket, &turn_off_so_passcreds, error))
+    return -1;
+#endif
+
+  ret = receive_message (_socket, vectors, n_vectors,
+      fds != NULL ? &fd_list : NULL,
+      credentials != NULL ? &creds : NULL,
+      TRUE, cancellable, error);
+
+#ifdef __linux__
+  if (ret >= 0 && !passcred_restore (_socket, turn_off_so_passcreds, error))
+    {
+      ret = -1;
+    }
+  else if (ret < 0)
+    {
+      passcred_restore (_socket, turn_off_so_passcreds, NULL);
+    }
+#endif
+
+  if (ret < 0)
+    {
+      tp_clear_object (&fd_list);
+      tp_clear_object (&creds);
+      return -1;
+    }
+
+  if (fds != NULL)
+    {
+      if (fd_list != NULL)
+        {
+          *fds = g_unix_fd_list_steal_fds (fd_list, n_fds);
+          g_object_unref (fd_list);
+        }
+      else
+        {
+          *fds = NULL;
+          *n_fds = 0;
+        }
+    }
+
+  if (credentials != NULL)
+    *credentials = creds;
+
+  return ret;
+#else
+  g_set_error_literal (error, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+      "Unix sockets not supported");
+  return -1;
+#endif
+}
+
+#ifdef HAVE_GIO_UNIX
+static void
+send_message_cb (GSocketConnection *connection,
+    const GError *error,
+    gpointer user_data)
+{
+  GSimpleAsyncResult *res = user_data;
+
+  if (error != NULL)
+    g_simple_async_result_set_from_error (res, error);
+
+  g_simple_async_result_complete_in_idle (res);
+  g_object_unref (res);
+}
+#endif
+
+/**
+ * tp_unix_connection_send_message_async:
+ * @connection: a #GUnixConnection
+ * @vectors: (array length=n_vectors): the payload to send
+ * @n_vectors: the number of elements in @vectors
+ * @fds: (array length=n_fds) (allow-none): file descriptors to pass to the
+ *  peer, which remain owned by the caller
+ * @n_fds: the number of elements in @fds
+ * @send_credentials: if %TRUE, send the credentials of this process too
+ * @cancellable: (allow-none): a #GCancellable, or %NULL
+ * @callback: (scope async): a #GAsyncReadyCallback to call when the whole
+ *  payload has been sent
+ * @user_data: (closure): the data to pass to @callback
+ *
+ * Asynchronously send a message made of @vectors over @connection, with
+ * @fds and optionally this process's credentials attached to it.
+ *
+ * Unlike tp_unix_connection_send_message(), this always sends the whole
+ * payload. It is first attempted straight away, with a single sendmsg(),
+ * so no thread is involved; if the socket is full, whatever was not sent
+ * is copied and sent from the thread-default main context. @vectors and
+ * the buffers they point to may therefore be freed as soon as this function
+ * returns, but @fds must remain open until @callback is called.
+ *
+ * When the operation is finished, @callback will be called. You can then
+ * call tp_unix_connection_send_message_finish() to get the result of the
+ * operation.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_unix_connection_send_message_async (GSocketConnection *connection,
+    GOutputVector *vectors,
+    gint n_vectors,
+    const gint *fds,
+    gint n_fds,
+    gboolean send_credentials,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  GSimpleAsyncResult *res;
+#ifdef HAVE_GIO_UNIX
+  gsize len = 0;
+  gint i;
+#endif
+
+  res = g_simple_async_result_new (G_OBJECT (connection), callback, user_data,
+      tp_unix_connection_send_message_async);
+
+#ifdef HAVE_GIO_UNIX
+  for (i = 0; i < n_vectors; i++)
+    len += vectors[i].size;
+
+  g_simple_async_result_set_op_res_gssize (res, len);
+
+  _tp_unix_connection_send_message_async (connection, vectors, n_vectors,
+      fds, n_fds, send_credentials, cancellable, send_message_cb, res);
+#else
+  g_simple_async_result_set_error (res, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+      "Unix sockets not supported");
+  g_simple_async_result_complete_in_idle (res);
+  g_object_unref (res);
+#endif
+}
+
+/**
+ * tp_unix_connection_send_message_finish:
+ * @connection: a #GUnixConnection
+ * @result: a #GAsyncResult
+ * @error: a #GError, or %NULL
+ *
+ * Finishes an asynchronous send operation started with
+ * tp_unix_connection_send_message_async().
+ *
+ * Returns: the number of bytes of payload sent, which is all of it, or -1
+ *  if @error is set
+ *
+ * Since: 0.UNRELEASED
+ */
+gssize
+tp_unix_connection_send_message_finish (GSocketConnection *connection,
+    GAsyncResult *result,
+    GError **error)
+{
+  GSimpleAsyncResult *simple = (GSimpleAsyncResult *) result;
+
+  g_return_val_if_fail (g_simple_async_result_is_valid (result,
+      G_OBJECT (connection), tp_unix_connection_send_message_async), -1);
+
+  if (g_simple_async_result_propagate_error (simple, error))
+    return -1;
+
+  return g_simple_async_result_get_op_res_gssize (simple);
+}
+
+#ifdef HAVE_GIO_UNIX
+typedef struct
+{
+  gssize len;
+  GUnixFDList *fds;
+  GCredentials *credentials;
+} ReceiveMessageData;
+
+static void
+receive_message_data_free (ReceiveMessageData *data)
+{
+  tp_clear_object (&data->fds);
+  tp_clear_object (&data->credentials);
+  g_slice_free (ReceiveMessageData, data);
+}
+
+static void
+receive_message_cb (GSocketConnection *connection,
+    gsize len,
+    GUnixFDList *fds,
+    GCredentials *credentials,
+    const GError *error,
+    gpointer user_data)
+{
+  GSimpleAsyncResult *res = user_data;
+  ReceiveMessageData *data;
+
+  if (error != NULL)
+    {
+      g_simple_async_result_set_from_error (res, error);
+    }
+  else
+    {
+      data = g_slice_new0 (ReceiveMessageData);
+      data->len = len;
+      data->fds = (fds != NULL ? g_object_ref (fds) : NULL);
+      data->credentials = (credentials != NULL ?
+          g_object_ref (credentials) : NULL);
+      g_simple_async_result_set_op_res_gpointer (res, data,
+          (GDestroyNotify) receive_message_data_free);
+    }
+
+  g_simple_async_result_complete_in_idle (res);
+  g_object_unref (res);
+}
+#endif
+
+/**
+ * tp_unix_connection_receive_message_async:
+ * @connection: a #GUnixConnection
+ * @vectors: (array length=n_vectors): buffers for the payload
+ * @n_vectors: the number of elements in @vectors
+ * @receive_credentials: if %TRUE, ask for the peer's credentials too
+ * @cancellable: (allow-none): a #GCancellable, or %NULL
+ * @callback: (scope async): a #GAsyncReadyCallback to call when a message
+ *  has been received
+ * @user_data: (closure): the data to pass to @callback
+ *
+ * Asynchronously receive a message sent with
+ * tp_unix_connection_send_message() or
+ * tp_unix_connection_send_message_async() (or any other sendmsg()) over
+ * @connection into @vectors, with its attached file descriptors and
+ * credentials.
+ *
+ * If a message is already waiting, it is received straight away with a
+ * single recvmsg(); otherwise the socket is polled from the thread-default
+ * main context, so no thread is involved. @vectors itself is copied, but
+ * the buffers it points to must remain valid until @callback is called.
+ *
+ * When the operation is finished, @callback will be called. You can then
+ * call tp_unix_connection_receive_message_finish() to get the result of the
+ * operation.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_unix_connection_receive_message_async (GSocketConnection *connection,
+    GInputVector *vectors,
+    gint n_vectors,
+    gboolean receive_credentials,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  GSimpleAsyncResult *res;
+
+  res = g_simple_async_result_new (G_OBJECT (connection), callback, user_data,
+      tp_unix_connection_receive_message_async);
+
+#ifdef HAVE_GIO_UNIX
+  _tp_unix_connection_receive_message_async (connection, vectors, n_vectors,
+      receive_credentials, cancellable, receive_message_cb, res);
+#else
+  g_simple_async_result_set_error (res, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+      "Unix sockets not supported");
+  g_simple_async_result_complete_in_idle (res);
+  g_object_unref (res);
+#endif
+}
+
+/**
+ * tp_unix_connection_receive_message_finish:
+ * @connection: a #GUnixConnection
+ * @result: a #GAsyncResult
+ * @fds: (out) (array length=n_fds) (allow-none): if not %NULL, used to return
+ *  a newly allocated array of the file descriptors which were received, or
+ *  %NULL if there were none. Close them and free the array with g_free().
+ * @n_fds: (out) (allow-none): used to return the number of elements in @fds;
+ *  must be non-%NULL if @fds is
+ * @credentials: (out) (transfer full) (allow-none): if not %NULL, used to
+ *  return the peer's credentials, or %NULL if it did not send any
+ * @error: a #GError, or %NULL
+ *
+ * Finishes an asynchronous receive operation started with
+ * tp_unix_connection_receive_message_async(). If @fds is %NULL, any file
+ * descriptors received are closed when @result is freed.
+ *
+ * Returns: the number of bytes of payload received, 0 at the end of the
+ *  stream, or -1 if @error is set
+ *
+ * Since: 0.UNRELEASED
+ */
+gssize
+tp_unix_connection_receive_message_finish (GSocketConnection *connection,
+    GAsyncResult *result,
+    gint **fds,
+    gint *n_fds,
+    GCredentials **credentials,
+    GError **error)
+{
+  GSimpleAsyncResult *simple = (GSimpleAsyncResult *) result;
+#ifdef HAVE_GIO_UNIX
+  ReceiveMessageData *data;
+#endif
+
+  g_return_val_if_fail (g_simple_async_result_is_valid (result,
+      G_OBJECT (connection), tp_unix_connection_receive_message_async), -1);
+  g_return_val_if_fail (fds == NULL || n_fds != NULL, -1);
+
+  if (g_simple_async_result_propagate_error (simple, error))
+    return -1;
+
+#ifdef HAVE_GIO_UNIX
+  data = g_simple_async_result_get_op_res_gpointer (simple);
+
+  if (fds != NULL)
+    {
+      if (data->fds != NULL)
+        {
+          *fds = g_unix_fd_list_steal_fds (data->fds, n_fds);
+        }
+      else
+        {
+          *fds = NULL;
+          *n_fds = 0;
+        }
+    }
+
+  if (credentials != NULL)
+    *credentials = (data->credentials != NULL ?
+        g_object_ref (data->credentials) : NULL);
+
+  return data->len;
+#else
+  /* it always fails without Unix sockets */
+  g_return_val_if_reached (-1);
+#endif
+}
+
+#ifdef HAVE_GIO_UNIX
+typedef struct
+{
+  GSocketConnection *connection;
+  GCancellable *cancellable;
+  /* what is left to send */
+  guchar *data;
+  gsize len;
+  gint *fds;
+  gint n_fds;
+  gboolean send_credentials;
+  TpUnixMessageSentCallback callback;
+  gpointer user_data;
+} SendMessageOp;
+
+static void
+send_message_op_free (SendMessageOp *op)
+{
+  g_object_unref (op->connection);
+  tp_clear_object (&op->cancellable);
+  g_free (op->data);
+  g_free (op->fds);
+  g_slice_free (SendMessageOp, op);
+}
+
+static gboolean
+send_message_op_ready_cb (GSocket *socket,
+    GIOCondition condition,
+    gpointer user_data)
+{
+  SendMessageOp *op = user_data;
+  GOutputVector vector;
+  GError *error = NULL;
+  gssize n;
+
+  vector.buffer = op->data;
+  vector.size = op->len;
+
+  n = send_message (socket, &vector, 1, op->fds, op->n_fds,
+      op->send_credentials, FALSE, op->cancellable, &error);
+
+  if (n < 0 && g_error_matches (error, G_IO_ERROR, G_IO_ERROR_WOULD_BLOCK))
+    {
+      g_error_free (error);
+      return G_SOURCE_CONTINUE;
+    }
+
+  if (n >= 0 && (gsize) n < op->len)
+    {
+      /* the fds and credentials went with the first byte */
+      memmove (op->data, op->data + n, op->len - n);
+      op->len -= n;
+      op->n_fds = 0;
+      op->send_credentials = FALSE;
+      return G_SOURCE_CONTINUE;
+    }
+
+  op->callback (op->connection, error, op->user_data);
+
+  g_clear_error (&error);
+  send_message_op_free (op);
+  return G_SOURCE_REMOVE;
+}
+
+/* Copy what is left of @vectors after the first @skip bytes into a single
+ * buffer */
+static guchar *
+flatten_vectors (GOutputVector *vectors,
+    gint n_vectors,
+    gsize skip,
+    gsize *len)
+{
+  guchar *data;
+  gsize total = 0;
+  gint i;
+
+  for (i = 0; i < n_vectors; i++)
+    total += vectors[i].size;
+
+  g_assert (skip <= total);
+  data = g_malloc (total - skip);
+  *len = 0;
+
+  for (i = 0; i < n_vectors; i++)
+    {
+      if (skip >= vectors[i].size)
+        {
+          skip -= vectors[i].size;
+          continue;
+        }
+
+      memcpy (data + *len, (const guchar *) vectors[i].buffer + skip,
+          vectors[i].size - skip);
+      *len += vectors[i].size - skip;
+      skip = 0;
+    }
+
+  return data;
+}
+
+/*
+ * Send @vectors with @fds and our credentials attached in one sendmsg(),
+ * without a GTask or a thread: the send is attempted straight away, and
+ * only if the socket is full is a SendMessageOp allocated to wait for it
+ * in the thread-default main context. The unsent part of @vectors is
+ * copied, so they need not outlive this call, but the fds must remain open
+ * until @callback is called.
+ */
+void
+_tp_unix_connection_send_message_async (GSocketConnection *connection,
+    GOutputVector *vectors,
+    gint n_vectors,
+    const gint *fds,
+    gint n_fds,
+    gboolean send_credentials,
+    GCancellable *cancellable,
+    TpUnixMessageSentCallback callback,
+    gpointer user_data)
+{
+  GSocket *socket;
+  SendMessageOp *op;
+  GSource *source;
+  GError *error = NULL;
+  gsize len = 0;
+  gssize n;
+  gint i;
+
+  g_return_if_fail (G_IS_UNIX_CONNECTION (connection));
+  g_return_if_fail (n_fds == 0 || fds != NULL);
+
+  for (i = 0; i < n_vectors; i++)
+    len += vectors[i].size;
+
+  g_return_if_fail (len > 0);
+
+  socket = g_socket_connection_get_socket (connection);
+
+  n = send_message (socket, vectors, n_vectors, fds, n_fds, send_credentials,
+      FALSE, cancellable, &error);
+
+  if (n >= 0 && (gsize) n == len)
+    {
+      callback (connection, NULL, user_data);
+      return;
+    }
+
+  if (n < 0 && !g_error_matches (error, G_IO_ERROR, G_IO_ERROR_WOULD_BLOCK))
+    {
+      callback (connection, error, user_data);
+      g_error_free (error);
+      return;
+    }
+
+  g_clear_error (&error);
+
+  op = g_slice_new0 (SendMessageOp);
+  op->connection = g_object_ref (connection);
+  op->cancellable = (cancellable != NULL ? g_object_ref (cancellable) : NULL);
+  op->callback = callback;
+  op->user_data = user_data;
+
+  if (n < 0)
+    {
+      op->data = flatten_vectors (vectors, n_vectors, 0, &op->len);
+      op->fds = g_memdup (fds, n_fds * sizeof (gint));
+      op->n_fds = n_fds;
+      op->send_credentials = send_credentials;
+    }
+  else
+    {
+      op->data = flatten_vectors (vectors, n_vectors, n, &op->len);
+    }
+
+  source = g_socket_create_source (socket, G_IO_OUT, cancellable);
+  g_source_set_callback (source, (GSourceFunc) send_message_op_ready_cb, op,
+      NULL);
+  g_source_attach (source, g_main_context_get_thread_default ());
+  g_source_unref (source);
+}
+
+typedef struct
+{
+  GSocketConnection *connection;
+  GCancellable *cancellable;
+  /* points to @vector if there is only one */
+  GInputVector *vectors;
+  gint n_vectors;
+  GInputVector vector;
+  gboolean receive_credentials;
+#ifdef __linux__
+  gboolean turn_off_so_passcreds;
+#endif
+  TpUnixMessageReceivedCallback callback;
+  gpointer user_data;
+} ReceiveMessageOp;
+
+static void
+receive_message_op_free (ReceiveMessageOp *op)
+{
+  g_object_unref (op->connection);
+  tp_clear_object (&op->cancellable);
+
+  if (op->vectors != &op->vector)
+    g_free (op->vectors);
+
+  g_slice_free (ReceiveMessageOp, op);
+}
+
+/* Returns TRUE if @op has been finished and freed */
+static gboolean
+receive_message_op_try (ReceiveMessageOp *op)
+{
+  GSocket *socket = g_socket_connection_get_socket (op->connection);
+  GUnixFDList *fds = NULL;
+  GCredentials *credentials = NULL;
+  GError *error = NULL;
+  gssize n;
+
+  n = receive_message (socket, op->vectors, op->n_vectors, &fds,
+      op->receive_credentials ? &credentials : NULL, FALSE, op->cancellable,
+      &error);
+
+  if (n < 0 && g_error_matches (error, G_IO_ERROR, G_IO_ERROR_WOULD_BLOCK))
+    {
+      g_error_free (error);
+      return FALSE;
+    }
+
+#ifdef __linux__
+  if (error == NULL)
+    passcred_restore (socket, op->turn_off_so_passcreds, &error);
+  else
+    passcred_restore (socket, op->turn_off_so_passcreds, NULL);
+#endif
+
+  if (error != NULL)
+    op->callback (op->connection, 0, NULL, NULL, error, op->user_data);
+  else
+    op->callback (op->connection, n, fds, credentials, NULL, op->user_data);
+
+  g_clear_error (&error);
+  tp_clear_object (&fds);
+  tp_clear_object (&credentials);
+  receive_message_op_free (op);
+  return TRUE;
+}
+
+static gboolean
+receive_message_op_ready_cb (GSocket *socket,
+    GIOCondition condition,
+    gpointer user_data)
+{
+  if (receive_message_op_try (user_data))
+    return G_SOURCE_REMOVE;
+
+  return G_SOURCE_CONTINUE;
+}
+
+/*
+ * Receive into @vectors, with the fds and credentials attached, in one
+ * recvmsg(). As for _tp_unix_connection_send_message_async(), the socket is
+ * only polled from the thread-default main context if nothing is waiting to
+ * be read yet. The array of vectors is copied, but the buffers it points to
+ * must remain valid until @callback is called.
+ */
+void
+_tp_unix_connection_receive_message_async (GSocketConnection *connection,
+    GInputVector *vectors,
+    gint n_vectors,
+    gboolean receive_credentials,
+    GCancellable *cancellable,
+    TpUnixMessageReceivedCallback callback,
+    gpointer user_data)
+{
+  ReceiveMessageOp *op;
+  GSource *source;
+#ifdef __linux__
+  GError *error = NULL;
+#endif
+
+  g_return_if_fail (G_IS_UNIX_CONNECTION (connection));
+  g_return_if_fail (n_vectors > 0);
+
+  op = g_slice_new0 (ReceiveMessageOp);
+  op->connection = g_object_ref (connection);
+  op->cancellable = (cancellable != NULL ? g_object_ref (cancellable) : NULL);
+  op->n_vectors = n_vectors;
+  op->receive_credentials = receive_credentials;
+  op->callback = callback;
+  op->user_data = user_data;
+
+  if (n_vectors == 1)
+    {
+      op->vector = vectors[0];
+      op->vectors = &op->vector;
+    }
+  else
+    {
+      op->vectors = g_memdup (vectors, n_vectors * sizeof (GInputVector));
+    }
+
+#ifdef __linux__
+  if (receive_credentials &&
+      !passcred_enable (g_socket_connection_get_socket (connection),
+          &op->turn_off_so_passcreds, &error))
+    {
+      callback (connection, 0, NULL, NULL, error, user_data);
+      g_error_free (error);
+      receive_message_op_free (op);
+      return;
+    }
+#endif
+
+  if (receive_message_op_try (op))
+    return;
+
+  source = g_socket_create_source (g_socket_connection_get_socket (connection),
+      G_IO_IN, cancellable);
+  g_source_set_callback (source, (GSourceFunc) receive_message_op_ready_cb,
+      op, NULL);
+  g_source_attach (source, g_main_context_get_thread_default ());
+  g_source_unref (source);
+}
+#endif /* HAVE_GIO_UNIX */
@@ -86,6 +86,56 @@ GCredentials *tp_unix_connection_receive_credentials_with_byte_finish (
     guchar *byte,
     GError **error);
 
+_TP_AVAILABLE_IN_UNRELEASED
+gssize tp_unix_connection_send_message (GSocketConnection *connection,
+    GOutputVector *vectors,
+    gint n_vectors,
+    const gint *fds,
+    gint n_fds,
+    gboolean send_credentials,
+    GCancellable *cancellable,
+    GError **error);
+_TP_AVAILABLE_IN_UNRELEASED
+gssize tp_unix_connection_receive_message (GSocketConnection *connection,
+    GInputVector *vectors,
+    gint n_vectors,
+    gint **fds,
+    gint *n_fds,
+    GCredentials **credentials,
+    GCancellable *cancellable,
+    GError **error);
+
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_unix_connection_send_message_async (GSocketConnection *connection,
+    GOutputVector *vectors,
+    gint n_vectors,
+    const gint *fds,
+    gint n_fds,
+    gboolean send_credentials,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+_TP_AVAILABLE_IN_UNRELEASED
+gssize tp_unix_connection_send_message_finish (GSocketConnection *connection,
+    GAsyncResult *result,
+    GError **error);
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_unix_connection_receive_message_async (GSocketConnection *connection,
+    GInputVector *vectors,
+    gint n_vectors,
+    gboolean receive_credentials,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+_TP_AVAILABLE_IN_UNRELEASED
+gssize tp_unix_connection_receive_message_finish (
+    GSocketConnection *connection,
+    GAsyncResult *result,
+    gint **fds,
+    gint *n_fds,
+    GCredentials **credentials,
+    GError **error);
+
 G_END_DECLS
 
 #endif /* __TP_GNIO_UTIL_H__ */
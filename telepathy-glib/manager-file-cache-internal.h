@@ -0,0 +1,45 @@
+/*<private_header>*/
+/* Binary cache of parsed .manager files - internal header
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef TP_MANAGER_FILE_CACHE_INTERNAL_H
+#define TP_MANAGER_FILE_CACHE_INTERNAL_H
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+/* the type of the protocols in a cache entry: (name, immutable properties) */
+#define _TP_MANAGER_FILE_CACHE_PROTOCOLS_TYPE ((const GVariantType *) "a(sa{sv})")
+
+gboolean _tp_manager_file_cache_load (const gchar *filename,
+    gint64 *mtime,
+    guint64 *size,
+    GStrv *interfaces,
+    GVariant **protocols);
+
+void _tp_manager_file_cache_save (const gchar *filename,
+    gint64 mtime,
+    guint64 size,
+    const gchar * const *interfaces,
+    GVariant *protocols);
+
+G_END_DECLS
+
+#endif
@@ -0,0 +1,277 @@
+/*
+ * manager-file-cache.c - binary cache of parsed .manager files
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "config.h"
+
+#include "telepathy-glib/manager-file-cache-internal.h"
+
+#include <errno.h>
+
+#include <glib/gstdio.h>
+
+#define DEBUG_FLAG TP_DEBUG_MANAGER
+#include "telepathy-glib/debug-internal.h"
+
+/*
+ * Parsing a .manager file means loading a GKeyFile, then turning every
+ * param-, default-, status- and RequestableChannelClass entry into
+ * dbus-glib types for each protocol. To avoid doing that every time a
+ * TpConnectionManager is created, we keep the result of parsing each
+ * .manager file as a serialized GVariant under
+ * $XDG_CACHE_HOME/telepathy/managers, which can be mapped into memory and
+ * used directly.
+ *
+ * Each cache file holds a single GVariant of type CACHE_ENTRY_TYPE:
+ *
+ * - the version of this format, CACHE_VERSION
+ * - the absolute path of the .manager file
+ * - its modification time, in microseconds since the epoch
+ * - its size in bytes
+ * - the ConnectionManager's Interfaces
+ * - (protocol name, Protocol immutable properties) for each valid protocol
+ *
+ * If the version, path, modification time or size don't match, the cache
+ * entry is ignored, and replaced after the .manager file has been parsed.
+ */
+
+/* Increment this whenever CACHE_ENTRY_TYPE or the way .manager files are
+ * interpreted changes. */
+#define CACHE_VERSION 1
+
+#define CACHE_ENTRY_TYPE ((const GVariantType *) "(usxtasa(sa{sv}))")
+
+static gchar *
+cache_path_for (const gchar *filename)
+{
+  gchar *checksum;
+  gchar *basename;
+  gchar *path;
+
+  checksum = g_compute_checksum_for_string (G_CHECKSUM_SHA1, filename, -1);
+  basename = g_strdup_printf ("%s.cache", checksum);
+  path = g_build_filename (g_get_user_cache_dir (), "telepathy", "managers",
+      basename, NULL);
+
+  g_free (basename);
+  g_free (checksum);
+  return path;
+}
+
+static gboolean
+stat_manager_file (const gchar *filename,
+    gint64 *mtime,
+    guint64 *size)
+{
+  GFile *file = g_file_new_for_path (filename);
+  GFileInfo *info;
+  GError *error = NULL;
+
+  info = g_file_query_info (file,
+      G_FILE_ATTRIBUTE_TIME_MODIFIED ","
+      G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC ","
+      G_FILE_ATTRIBUTE_STANDARD_SIZE,
+      G_FILE_QUERY_INFO_NONE, NULL, &error);
+  g_object_unref (file);
+
+  if (info == NULL)
+    {
+      DEBUG ("can't stat %s: %s", filename, error->message);
+      g_error_free (error);
+      return FALSE;
+    }
+
+  *mtime = g_file_info_get_attribute_uint64 (info,
+      G_FILE_ATTRIBUTE_TIME_MODIFIED) * G_USEC_PER_SEC +
+    g_file_info_get_attribute_uint32 (info,
+      G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC);
+  *size = g_file_info_get_size (info);
+
+  g_object_unref (info);
+  return TRUE;
+}
+
+/*
+ * _tp_manager_file_cache_load:
+ * @filename: the absolute path of a .manager file
+ * @mtime: (out): used to return the modification time of @filename, to be
+ *  passed to _tp_manager_file_cache_save() if it needs to be parsed, or -1
+ *  if it couldn't be found
+ * @size: (out): used to return the size of @filename, likewise
+ * @interfaces: (out) (transfer full): used to return the ConnectionManager's
+ *  Interfaces, which may be %NULL
+ * @protocols: (out) (transfer full): used to return a #GVariant of type
+ *  %_TP_MANAGER_FILE_CACHE_PROTOCOLS_TYPE, which refers to the mapped cache
+ *  file rather than copying it
+ *
+ * Returns: %TRUE if there was an up-to-date cache entry for @filename
+ */
+gboolean
+_tp_manager_file_cache_load (const gchar *filename,
+    gint64 *mtime,
+    guint64 *size,
+    GStrv *interfaces,
+    GVariant **protocols)
+{
+  gchar *cache_path = NULL;
+  GMappedFile *mapped;
+  GBytes *bytes;
+  GVariant *entry = NULL;
+  GError *error = NULL;
+  guint32 version;
+  const gchar *path;
+  gint64 cached_mtime;
+  guint64 cached_size;
+  gboolean ret = FALSE;
+
+  g_return_val_if_fail (g_path_is_absolute (filename), FALSE);
+  g_return_val_if_fail (mtime != NULL, FALSE);
+  g_return_val_if_fail (size != NULL, FALSE);
+  g_return_val_if_fail (interfaces != NULL, FALSE);
+  g_return_val_if_fail (protocols != NULL, FALSE);
+
+  *mtime = -1;
+  *size = 0;
+
+  /* This happens before the .manager file is parsed, so that if it changes
+   * while we're parsing it, the cache entry we save will be out of date
+   * rather than wrong. */
+  if (!stat_manager_file (filename, mtime, size))
+    {
+      *mtime = -1;
+      goto finally;
+    }
+
+  cache_path = cache_path_for (filename);
+  mapped = g_mapped_file_new (cache_path, FALSE, &error);
+
+  if (mapped == NULL)
+    {
+      DEBUG ("no cache for %s: %s", filename, error->message);
+      g_clear_error (&error);
+      goto finally;
+    }
+
+  bytes = g_mapped_file_get_bytes (mapped);
+  g_mapped_file_unref (mapped);
+
+  /* The cache file isn't trusted: GVariant will cope with it being
+   * truncated or corrupt, by returning default values. */
+  entry = g_variant_ref_sink (g_variant_new_from_bytes (CACHE_ENTRY_TYPE,
+        bytes, FALSE));
+  g_bytes_unref (bytes);
+
+  g_variant_get_child (entry, 0, "u", &version);
+  g_variant_get_child (entry, 1, "&s", &path);
+  g_variant_get_child (entry, 2, "x", &cached_mtime);
+  g_variant_get_child (entry, 3, "t", &cached_size);
+
+  if (version != CACHE_VERSION ||
+      g_strcmp0 (path, filename) != 0 ||
+      cached_mtime != *mtime ||
+      cached_size != *size)
+    {
+      DEBUG ("cache for %s is out of date (version %u, mtime %"
+          G_GINT64_FORMAT ", size %" G_GUINT64_FORMAT ")", filename,
+          version, cached_mtime, cached_size);
+      goto finally;
+    }
+
+  g_variant_get_child (entry, 4, "^as", interfaces);
+  *protocols = g_variant_get_child_value (entry, 5);
+  DEBUG ("loaded %s from cache %s", filename, cache_path);
+  ret = TRUE;
+
+finally:
+  if (entry != NULL)
+    g_variant_unref (entry);
+
+  g_free (cache_path);
+  return ret;
+}
+
+/*
+ * _tp_manager_file_cache_save:
+ * @filename: the absolute path of a .manager file
+ * @mtime: the modification time of @filename returned by
+ *  _tp_manager_file_cache_load() before it was parsed
+ * @size: the size of @filename returned by _tp_manager_file_cache_load()
+ * @interfaces: (allow-none): the ConnectionManager's Interfaces
+ * @protocols: a #GVariant of type %_TP_MANAGER_FILE_CACHE_PROTOCOLS_TYPE
+ *
+ * Replace the cache entry for @filename with the result of parsing it.
+ *
+ * Failure to write the cache is not an error, since it only makes the next
+ * load slower.
+ */
+void
+_tp_manager_file_cache_save (const gchar *filename,
+    gint64 mtime,
+    guint64 size,
+    const gchar * const *interfaces,
+    GVariant *protocols)
+{
+  static const gchar * const no_interfaces[] = { NULL };
+  gchar *cache_path = NULL;
+  gchar *dir = NULL;
+  GVariant *entry;
+  GError *error = NULL;
+
+  g_return_if_fail (g_path_is_absolute (filename));
+  g_return_if_fail (g_variant_is_of_type (protocols,
+        _TP_MANAGER_FILE_CACHE_PROTOCOLS_TYPE));
+
+  if (mtime < 0)
+    return;
+
+  cache_path = cache_path_for (filename);
+  dir = g_path_get_dirname (cache_path);
+
+  if (g_mkdir_with_parents (dir, 0700) != 0)
+    {
+      DEBUG ("unable to create %s: %s", dir, g_strerror (errno));
+      goto finally;
+    }
+
+  if (interfaces == NULL)
+    interfaces = no_interfaces;
+
+  entry = g_variant_ref_sink (g_variant_new ("(usxt^as@a(sa{sv}))",
+        (guint32) CACHE_VERSION, filename, mtime, size, interfaces,
+        protocols));
+
+  /* this writes to a temporary file and renames it, so concurrent readers
+   * never see a partial entry */
+  if (!g_file_set_contents (cache_path, g_variant_get_data (entry),
+        g_variant_get_size (entry), &error))
+    {
+      DEBUG ("unable to write %s: %s", cache_path, error->message);
+      g_clear_error (&error);
+    }
+  else
+    {
+      DEBUG ("cached %s in %s", filename, cache_path);
+    }
+
+  g_variant_unref (entry);
+
+finally:
+  g_free (dir);
+  g_free (cache_path);
+}
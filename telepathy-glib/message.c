@@ -34,6 +34,7 @@
 
 #include "message.h"
 #include "message-internal.h"
+#include "allocation-statistics-internal.h"
 
 #include <telepathy-glib/cm-message.h>
 #include <telepathy-glib/dbus.h>
@@ -68,8 +69,23 @@ G_DEFINE_TYPE (TpMessage, tp_message, G_TYPE_OBJECT)
 struct _TpMessagePrivate
 {
   gboolean mutable;
+  /* TRUE if counted by the allocation statistics */
+  gboolean counted;
 };
 
+static void
+tp_message_constructed (GObject *object)
+{
+  TpMessage *self = TP_MESSAGE (object);
+  void (*chain_up) (GObject *) =
+    G_OBJECT_CLASS (tp_message_parent_class)->constructed;
+
+  if (chain_up != NULL)
+    chain_up (object);
+
+  self->priv->counted = _tp_allocation_statistics_object_created (self);
+}
+
 static void
 tp_message_dispose (GObject *object)
 {
@@ -93,12 +109,25 @@ tp_message_dispose (GObject *object)
     dispose (object);
 }
 
+static void
+tp_message_finalize (GObject *object)
+{
+  TpMessage *self = TP_MESSAGE (object);
+
+  if (self->priv->counted)
+    _tp_allocation_statistics_object_freed (self);
+
+  G_OBJECT_CLASS (tp_message_parent_class)->finalize (object);
+}
+
 static void
 tp_message_class_init (TpMessageClass *klass)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
 
+  gobject_class->constructed = tp_message_constructed;
   gobject_class->dispose = tp_message_dispose;
+  gobject_class->finalize = tp_message_finalize;
 
   g_type_class_add_private (gobject_class, sizeof (TpMessagePrivate));
 }
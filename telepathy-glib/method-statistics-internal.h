@@ -0,0 +1,50 @@
+/*<private_header>*/
+/* Per-method D-Bus call statistics - internal header
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef TP_METHOD_STATISTICS_INTERNAL_H
+#define TP_METHOD_STATISTICS_INTERNAL_H
+
+#include <glib.h>
+
+#include <telepathy-glib/method-statistics.h>
+
+G_BEGIN_DECLS
+
+typedef struct _TpMethodStatistics TpMethodStatistics;
+
+/* for outgoing calls, made through TpProxy */
+TpMethodStatistics *_tp_method_statistics_call_started (GQuark iface,
+    const gchar *member,
+    gint64 *started);
+void _tp_method_statistics_call_finished (TpMethodStatistics *stats,
+    gint64 started,
+    gboolean failed);
+
+/* for incoming calls, called by the generated TpSvc code */
+gint64 _tp_method_statistics_now (void);
+void _tp_method_statistics_dispatched (const gchar *iface,
+    const gchar *method,
+    gint64 started);
+
+GPtrArray *_tp_method_statistics_dup_value_arrays (void);
+
+G_END_DECLS
+
+#endif
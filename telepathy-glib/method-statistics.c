@@ -0,0 +1,572 @@
+/*
+ * method-statistics.c - per-method D-Bus call statistics
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "config.h"
+
+#include "telepathy-glib/method-statistics.h"
+#include "telepathy-glib/method-statistics-internal.h"
+#include "telepathy-glib/stall-detector-internal.h"
+
+#include <string.h>
+
+#include <dbus/dbus.h>
+#include <dbus/dbus-glib.h>
+#include <dbus/dbus-glib-lowlevel.h>
+
+#include <telepathy-glib/dbus-daemon.h>
+#include <telepathy-glib/gtypes.h>
+#include <telepathy-glib/proxy.h>
+#include <telepathy-glib/util.h>
+
+#define DEBUG_FLAG TP_DEBUG_MISC
+#include "telepathy-glib/debug-internal.h"
+
+/**
+ * SECTION:method-statistics
+ * @title: D-Bus method statistics
+ * @short_description: count and time the D-Bus calls a process makes and
+ *  receives
+ * @see_also: #TpDebugSender
+ *
+ * While enabled, telepathy-glib counts the D-Bus methods this process calls
+ * via #TpProxy, and the methods it implements via the generated TpSvc
+ * interfaces, and keeps a histogram of how long they take. The same
+ * statistics are available to other processes through the
+ * MethodStatistics interface of the #TpDebugSender object, so a slow client
+ * or service can be examined without rebuilding it.
+ *
+ * Collection is off by default; while it is off, making or receiving a call
+ * costs one extra atomic read.
+ *
+ * Since: 0.UNRELEASED
+ */
+
+/* Latencies below 16µs each get their own bucket; each power of two above
+ * that is split into 8, up to 2³² µs (about 71 minutes), which catches
+ * everything longer. See Latency_Histogram in the spec. */
+#define N_EXACT_BUCKETS 16
+#define SUB_BUCKET_BITS 3
+#define MAX_EXPONENT 31
+#define N_BUCKETS \
+  (N_EXACT_BUCKETS + (MAX_EXPONENT - 3) * (1 << SUB_BUCKET_BITS))
+
+struct _TpMethodStatistics {
+    /* interned; together, these are the key */
+    const gchar *iface;
+    const gchar *method;
+    gboolean outgoing;
+
+    guint calls;
+    guint errors;
+    guint in_flight;
+    guint64 bytes;
+    guint64 total_latency;
+    guint64 max_latency;
+    guint histogram[N_BUCKETS];
+};
+
+static volatile gint enabled = FALSE;
+
+/* protects everything below, and the contents of every
+ * TpMethodStatistics */
+G_LOCK_DEFINE_STATIC (statistics);
+/* TpMethodStatistics => itself; entries are never freed, so pending calls
+ * can keep pointers to them */
+static GHashTable *statistics = NULL;
+static TpDBusDaemon *filtered_bus = NULL;
+
+static guint
+method_statistics_hash (gconstpointer p)
+{
+  const TpMethodStatistics *s = p;
+
+  return (g_direct_hash (s->iface) * 31 + g_direct_hash (s->method)) ^
+    s->outgoing;
+}
+
+static gboolean
+method_statistics_equal (gconstpointer a,
+    gconstpointer b)
+{
+  const TpMethodStatistics *sa = a;
+  const TpMethodStatistics *sb = b;
+
+  return (sa->iface == sb->iface && sa->method == sb->method &&
+      sa->outgoing == sb->outgoing);
+}
+
+/* must be called with the lock held; @iface and @method must be interned */
+static TpMethodStatistics *
+lookup (const gchar *iface,
+    const gchar *method,
+    gboolean outgoing)
+{
+  TpMethodStatistics key;
+  TpMethodStatistics *stats;
+
+  key.iface = iface;
+  key.method = method;
+  key.outgoing = outgoing;
+
+  if (G_UNLIKELY (statistics == NULL))
+    statistics = g_hash_table_new (method_statistics_hash,
+        method_statistics_equal);
+
+  stats = g_hash_table_lookup (statistics, &key);
+
+  if (stats == NULL)
+    {
+      stats = g_slice_new0 (TpMethodStatistics);
+      stats->iface = iface;
+      stats->method = method;
+      stats->outgoing = outgoing;
+      g_hash_table_add (statistics, stats);
+    }
+
+  return stats;
+}
+
+static guint
+bucket_for_latency (guint64 latency)
+{
+  guint exponent;
+
+  if (latency < N_EXACT_BUCKETS)
+    return latency;
+
+  exponent = g_bit_storage (latency) - 1;
+
+  if (exponent > MAX_EXPONENT)
+    return N_BUCKETS - 1;
+
+  return N_EXACT_BUCKETS +
+    (exponent - 4) * (1 << SUB_BUCKET_BITS) +
+    ((latency >> (exponent - SUB_BUCKET_BITS)) &
+     ((1 << SUB_BUCKET_BITS) - 1));
+}
+
+/* must be called with the lock held */
+static void
+record_latency (TpMethodStatistics *stats,
+    gint64 started)
+{
+  gint64 now = g_get_monotonic_time ();
+  guint64 latency = (now > started ? now - started : 0);
+
+  stats->calls++;
+  stats->total_latency += latency;
+
+  if (latency > stats->max_latency)
+    stats->max_latency = latency;
+
+  stats->histogram[bucket_for_latency (latency)]++;
+}
+
+/* Returns: the number of histogram buckets that are worth reporting */
+static guint
+histogram_length (const TpMethodStatistics *stats)
+{
+  guint len = N_BUCKETS;
+
+  while (len > 0 && stats->histogram[len - 1] == 0)
+    len--;
+
+  return len;
+}
+
+static DBusHandlerResult
+incoming_call_filter (DBusConnection *connection,
+    DBusMessage *message,
+    void *user_data)
+{
+  const gchar *iface, *member;
+  char *marshalled;
+  int len;
+
+  if (!g_atomic_int_get (&enabled) ||
+      dbus_message_get_type (message) != DBUS_MESSAGE_TYPE_METHOD_CALL)
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+
+  iface = dbus_message_get_interface (message);
+  member = dbus_message_get_member (message);
+
+  if (iface == NULL || member == NULL)
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+
+  /* libdbus has no cheaper way to ask; this is only done while enabled */
+  if (!dbus_message_marshal (message, &marshalled, &len))
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+
+  dbus_free (marshalled);
+
+  G_LOCK (statistics);
+  lookup (g_intern_string (iface), g_intern_string (member), FALSE)->bytes +=
+    len;
+  G_UNLOCK (statistics);
+
+  return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+}
+
+static DBusConnection *
+bus_get_libdbus (TpDBusDaemon *bus)
+{
+  return dbus_g_connection_get_connection (tp_proxy_get_dbus_connection (
+        bus));
+}
+
+/**
+ * tp_method_statistics_set_enabled:
+ * @enable: whether to collect statistics
+ *
+ * Start or stop collecting statistics about the D-Bus methods that this
+ * process calls and implements. Statistics that were already collected are
+ * kept when this is set to %FALSE; use tp_method_statistics_reset() to
+ * discard them.
+ *
+ * The sizes of incoming method calls are only counted on the connection to
+ * the starter or session bus, as returned by tp_dbus_daemon_dup().
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_method_statistics_set_enabled (gboolean enable)
+{
+  TpDBusDaemon *old_bus = NULL;
+  TpDBusDaemon *new_bus = NULL;
+
+  enable = !!enable;
+
+  if (enable)
+    {
+      GError *error = NULL;
+
+      new_bus = tp_dbus_daemon_dup (&error);
+
+      if (new_bus == NULL)
+        {
+          DEBUG ("not counting message sizes: %s", error->message);
+          g_clear_error (&error);
+        }
+    }
+
+  G_LOCK (statistics);
+
+  if (g_atomic_int_get (&enabled) == enable)
+    {
+      G_UNLOCK (statistics);
+      tp_clear_object (&new_bus);
+      return;
+    }
+
+  g_atomic_int_set (&enabled, enable);
+  old_bus = filtered_bus;
+  filtered_bus = new_bus;
+
+  G_UNLOCK (statistics);
+
+  if (old_bus != NULL)
+    {
+      dbus_connection_remove_filter (bus_get_libdbus (old_bus),
+          incoming_call_filter, NULL);
+      g_object_unref (old_bus);
+    }
+
+  if (new_bus != NULL)
+    dbus_connection_add_filter (bus_get_libdbus (new_bus),
+        incoming_call_filter, NULL, NULL);
+
+  DEBUG ("%s method statistics", enable ? "collecting" : "stopped collecting");
+}
+
+/**
+ * tp_method_statistics_get_enabled:
+ *
+ * <!-- -->
+ *
+ * Returns: %TRUE if statistics are being collected, as set by
+ *  tp_method_statistics_set_enabled()
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_method_statistics_get_enabled (void)
+{
+  return g_atomic_int_get (&enabled);
+}
+
+/**
+ * tp_method_statistics_dup_snapshot:
+ *
+ * Return the statistics collected so far, as an array of one tuple per
+ * interface, method and direction, of type
+ * <code>a(ssbuuutttau)</code>. The members of each tuple are the
+ * interface, the method name, %TRUE if the calls were made by this process
+ * or %FALSE if they were made to it, the number of calls that finished, the
+ * number of those that failed, the number still in flight, the total size
+ * of the incoming messages in bytes, the total and maximum latency in
+ * microseconds, and a latency histogram. These are described in more detail
+ * by the Method_Statistics type in the Telepathy D-Bus Interface
+ * Specification.
+ *
+ * Returns: (transfer full): a new non-floating #GVariant
+ *
+ * Since: 0.UNRELEASED
+ */
+GVariant *
+tp_method_statistics_dup_snapshot (void)
+{
+  GVariantBuilder builder;
+  GHashTableIter iter;
+  gpointer k;
+
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a(ssbuuutttau)"));
+
+  G_LOCK (statistics);
+
+  if (statistics != NULL)
+    {
+      g_hash_table_iter_init (&iter, statistics);
+
+      while (g_hash_table_iter_next (&iter, &k, NULL))
+        {
+          TpMethodStatistics *stats = k;
+          guint len = histogram_length (stats);
+          guint i;
+
+          g_variant_builder_open (&builder, G_VARIANT_TYPE ("(ssbuuutttau)"));
+          g_variant_builder_add (&builder, "s", stats->iface);
+          g_variant_builder_add (&builder, "s", stats->method);
+          g_variant_builder_add (&builder, "b", stats->outgoing);
+          g_variant_builder_add (&builder, "u", stats->calls);
+          g_variant_builder_add (&builder, "u", stats->errors);
+          g_variant_builder_add (&builder, "u", stats->in_flight);
+          g_variant_builder_add (&builder, "t", stats->bytes);
+          g_variant_builder_add (&builder, "t", stats->total_latency);
+          g_variant_builder_add (&builder, "t", stats->max_latency);
+          g_variant_builder_open (&builder, G_VARIANT_TYPE ("au"));
+
+          for (i = 0; i < len; i++)
+            g_variant_builder_add (&builder, "u", stats->histogram[i]);
+
+          g_variant_builder_close (&builder);
+          g_variant_builder_close (&builder);
+        }
+    }
+
+  G_UNLOCK (statistics);
+
+  return g_variant_ref_sink (g_variant_builder_end (&builder));
+}
+
+/**
+ * tp_method_statistics_reset:
+ *
+ * Set all the statistics collected so far to zero, except for the numbers
+ * of calls in flight.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_method_statistics_reset (void)
+{
+  GHashTableIter iter;
+  gpointer k;
+
+  G_LOCK (statistics);
+
+  if (statistics != NULL)
+    {
+      g_hash_table_iter_init (&iter, statistics);
+
+      while (g_hash_table_iter_next (&iter, &k, NULL))
+        {
+          TpMethodStatistics *stats = k;
+
+          stats->calls = 0;
+          stats->errors = 0;
+          stats->bytes = 0;
+          stats->total_latency = 0;
+          stats->max_latency = 0;
+          memset (stats->histogram, 0, sizeof (stats->histogram));
+        }
+    }
+
+  G_UNLOCK (statistics);
+}
+
+/*
+ * _tp_method_statistics_call_started:
+ * @iface: the interface of the method being called
+ * @member: the method being called
+ * @started: used to return the time the call started
+ *
+ * Count an outgoing call as being in flight, if statistics are enabled.
+ *
+ * Returns: the statistics to pass to _tp_method_statistics_call_finished()
+ *  with @started when the call finishes, or %NULL if statistics are
+ *  disabled
+ */
+TpMethodStatistics *
+_tp_method_statistics_call_started (GQuark iface,
+    const gchar *member,
+    gint64 *started)
+{
+  TpMethodStatistics *stats;
+
+  if (!g_atomic_int_get (&enabled))
+    return NULL;
+
+  G_LOCK (statistics);
+  stats = lookup (g_quark_to_string (iface), g_intern_string (member), TRUE);
+  stats->in_flight++;
+  G_UNLOCK (statistics);
+
+  *started = g_get_monotonic_time ();
+  return stats;
+}
+
+/*
+ * _tp_method_statistics_call_finished:
+ *
+ * Record that a call for which _tp_method_statistics_call_started()
+ * returned @stats has finished, even if statistics have been disabled
+ * since.
+ */
+void
+_tp_method_statistics_call_finished (TpMethodStatistics *stats,
+    gint64 started,
+    gboolean failed)
+{
+  G_LOCK (statistics);
+
+  record_latency (stats, started);
+
+  if (failed)
+    stats->errors++;
+
+  g_assert (stats->in_flight > 0);
+  stats->in_flight--;
+
+  G_UNLOCK (statistics);
+}
+
+/*
+ * _tp_method_statistics_now:
+ *
+ * Called by the generated service-side code before a method implementation
+ * is called.
+ *
+ * Returns: the current monotonic time to pass to
+ *  _tp_method_statistics_dispatched() after the implementation has
+ *  returned, or 0 if neither method statistics nor the stall detector are
+ *  enabled, in which case there is no need to call it
+ */
+gint64
+_tp_method_statistics_now (void)
+{
+  if (g_atomic_int_get (&enabled))
+    return g_get_monotonic_time ();
+
+  return _tp_stall_detector_now ();
+}
+
+/*
+ * _tp_method_statistics_dispatched:
+ * @iface: the interface of the method that was called
+ * @method: the method that was called
+ * @started: the time at which the implementation was called
+ *
+ * Called by the generated service-side code when a method implementation
+ * returns (which might be before it has replied). This also tells the stall
+ * detector about it.
+ */
+void
+_tp_method_statistics_dispatched (const gchar *iface,
+    const gchar *method,
+    gint64 started)
+{
+  _tp_stall_detector_handler_finished (TP_STALL_HANDLER_METHOD, iface,
+      method, started);
+
+  if (!g_atomic_int_get (&enabled))
+    return;
+
+  G_LOCK (statistics);
+  record_latency (lookup (g_intern_static_string (iface),
+        g_intern_static_string (method), FALSE), started);
+  G_UNLOCK (statistics);
+}
+
+static void
+value_array_free (gpointer p)
+{
+  tp_value_array_free (p);
+}
+
+/*
+ * _tp_method_statistics_dup_value_arrays:
+ *
+ * Returns: the same as tp_method_statistics_dup_snapshot(), as a
+ *  #TP_ARRAY_TYPE_METHOD_STATISTICS_LIST, which frees its elements when
+ *  it is unreffed
+ */
+GPtrArray *
+_tp_method_statistics_dup_value_arrays (void)
+{
+  GPtrArray *ret = g_ptr_array_new_with_free_func (value_array_free);
+  GHashTableIter iter;
+  gpointer k;
+
+  G_LOCK (statistics);
+
+  if (statistics != NULL)
+    {
+      g_hash_table_iter_init (&iter, statistics);
+
+      while (g_hash_table_iter_next (&iter, &k, NULL))
+        {
+          TpMethodStatistics *stats = k;
+          guint len = histogram_length (stats);
+          GArray *histogram = g_array_sized_new (FALSE, FALSE,
+              sizeof (guint), len);
+
+          g_array_append_vals (histogram, stats->histogram, len);
+
+          g_ptr_array_add (ret, tp_value_array_build (10,
+                G_TYPE_STRING, stats->iface,
+                G_TYPE_STRING, stats->method,
+                G_TYPE_BOOLEAN, stats->outgoing,
+                G_TYPE_UINT, stats->calls,
+                G_TYPE_UINT, stats->errors,
+                G_TYPE_UINT, stats->in_flight,
+                G_TYPE_UINT64, stats->bytes,
+                G_TYPE_UINT64, stats->total_latency,
+                G_TYPE_UINT64, stats->max_latency,
+                DBUS_TYPE_G_UINT_ARRAY, histogram,
+                G_TYPE_INVALID));
+
+          g_array_unref (histogram);
+        }
+    }
+
+  G_UNLOCK (statistics);
+
+  return ret;
+}
@@ -0,0 +1,48 @@
+/*
+ * method-statistics.h - per-method D-Bus call statistics
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#if defined (TP_DISABLE_SINGLE_INCLUDE) && !defined (_TP_IN_META_HEADER) && !defined (_TP_COMPILATION)
+#error "Only <telepathy-glib/telepathy-glib.h> and <telepathy-glib/telepathy-glib-dbus.h> can be included directly."
+#endif
+
+#ifndef __TP_METHOD_STATISTICS_H__
+#define __TP_METHOD_STATISTICS_H__
+
+#include <glib.h>
+
+#include <telepathy-glib/defs.h>
+
+G_BEGIN_DECLS
+
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_method_statistics_set_enabled (gboolean enable);
+
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_method_statistics_get_enabled (void);
+
+_TP_AVAILABLE_IN_UNRELEASED
+GVariant *tp_method_statistics_dup_snapshot (void) G_GNUC_WARN_UNUSED_RESULT;
+
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_method_statistics_reset (void);
+
+G_END_DECLS
+
+#endif /* __TP_METHOD_STATISTICS_H__ */
@@ -21,9 +21,12 @@
 
 #include "telepathy-glib/proxy-subclass.h"
 #include "telepathy-glib/proxy-internal.h"
+#include "telepathy-glib/method-statistics-internal.h"
+#include "telepathy-glib/stall-detector-internal.h"
 
 #define DEBUG_FLAG TP_DEBUG_PROXY
 #include "telepathy-glib/debug-internal.h"
+#include "telepathy-glib/util-internal.h"
 #include <telepathy-glib/util.h>
 
 #if 0
@@ -47,11 +50,11 @@ struct _TpProxyPendingCall {
      *   (idle_source is nonzero)
      *
      * In normal use, its life cycle should go like this:
-     * - Created by tp_proxy_pending_call_v0_new
+     * - Created by tp_proxy_pending_call_v0_new (or _v1_new)
      * - Given to dbus-glib by generated code (actual call starts here)
      * - tp_proxy_pending_call_v0_take_pending_call
      * - (Phase 1)
-     * - tp_proxy_pending_call_v0_take_results
+     * - tp_proxy_pending_call_v0_take_results (or _v1_take_results)
      * - Idle handler queued
      * - (Phase 2)
      * - tp_proxy_pending_call_v0_completed
@@ -77,14 +80,19 @@ struct _TpProxyPendingCall {
     /* Always non-NULL */
     TpProxy *proxy;
 
-    /* Set to NULL after it's been invoked once, or if cancellation means
-     * it should never be called. Supplied by the generated code */
+    /* At most one of these is non-NULL. Set to NULL after it's been invoked
+     * once, or if cancellation means it should never be called. Supplied by
+     * the generated code: invoke_callback for calls made with _v0_new,
+     * invoke_results for _v1_new */
     TpProxyInvokeFunc invoke_callback;
+    TpProxyInvokeResultsFunc invoke_results;
 
-    /* arguments for invoke_callback supplied by _take_results, by
-     * cancellation or by the destroy signal */
+    /* arguments for invoke_callback or invoke_results supplied by
+     * _take_results, by cancellation or by the destroy signal */
     GError *error /* implicitly initialized */;
     GValueArray *args;
+    gpointer results;
+    GDestroyNotify free_results;
 
     /* user-supplied arguments for invoke_callback */
     GCallback callback;
@@ -101,6 +109,16 @@ struct _TpProxyPendingCall {
      * was destroyed */
     guint idle_source;
 
+    /* Non-NULL if method statistics were enabled when the call was made,
+     * until the call is recorded as finished */
+    TpMethodStatistics *stats;
+    gint64 started;
+
+    /* The method, for the stall detector; member is interned, or NULL if
+     * the stall detector wasn't running when the call was made */
+    GQuark iface;
+    const gchar *member;
+
     /* If TRUE, invoke the callback even on cancellation */
     unsigned cancel_must_raise:1;
 
@@ -132,15 +150,44 @@ tp_proxy_pending_call_lost_weak_ref (gpointer data,
     tp_proxy_pending_call_cancel (pc);
 }
 
+/* Record the call's latency, the first time we know it has finished */
+static void
+tp_proxy_pending_call_record_finished (TpProxyPendingCall *pc,
+    gboolean failed)
+{
+  if (pc->stats != NULL)
+    {
+      _tp_method_statistics_call_finished (pc->stats, pc->started, failed);
+      pc->stats = NULL;
+    }
+}
+
+static void
+tp_proxy_pending_call_clear_results (TpProxyPendingCall *pc)
+{
+  if (pc->args != NULL)
+    tp_value_array_free (pc->args);
+
+  pc->args = NULL;
+
+  if (pc->results != NULL && pc->free_results != NULL)
+    pc->free_results (pc->results);
+
+  pc->results = NULL;
+  pc->free_results = NULL;
+}
+
 static gboolean
 tp_proxy_pending_call_idle_invoke (gpointer p)
 {
   TpProxyPendingCall *pc = p;
   TpProxyInvokeFunc invoke = pc->invoke_callback;
+  TpProxyInvokeResultsFunc invoke_results = pc->invoke_results;
+  gint64 started;
 
   MORE_DEBUG ("%p", pc);
 
-  if (invoke == NULL)
+  if (invoke == NULL && invoke_results == NULL)
     {
       /* either already invoked (bug?), or cancelled */
       return FALSE;
@@ -150,13 +197,33 @@ tp_proxy_pending_call_idle_invoke (gpointer p)
 
   g_assert (pc->proxy != NULL);
   g_assert (pc->error == NULL || pc->args == NULL);
+  g_assert (pc->error == NULL || pc->results == NULL);
   g_assert (!pc->idle_completed);
 
   pc->invoke_callback = NULL;
-  invoke (pc->proxy, pc->error, pc->args, pc->callback,
-      pc->user_data, pc->weak_object);
-  pc->error = NULL;
-  pc->args = NULL;
+  pc->invoke_results = NULL;
+
+  started = (pc->member != NULL ? _tp_stall_detector_now () : 0);
+
+  if (invoke_results != NULL)
+    {
+      /* the error and results still belong to us */
+      invoke_results (pc->proxy, pc->error, pc->results, pc->callback,
+          pc->user_data, pc->weak_object);
+      g_clear_error (&pc->error);
+      tp_proxy_pending_call_clear_results (pc);
+    }
+  else
+    {
+      invoke (pc->proxy, pc->error, pc->args, pc->callback,
+          pc->user_data, pc->weak_object);
+      pc->error = NULL;
+      pc->args = NULL;
+    }
+
+  if (started != 0)
+    _tp_stall_detector_handler_finished (TP_STALL_HANDLER_REPLY,
+        g_quark_to_string (pc->iface), pc->member, started);
 
   /* don't clear pc->idle_source here! tp_proxy_pending_call_v0_completed
    * compares it to 0 to determine whether to free the object */
@@ -182,14 +249,16 @@ _tp_proxy_pending_call_dgproxy_destroy (DBusGProxy *iface_proxy,
       /* we haven't already received and queued a reply, so synthesize
        * one */
       g_assert (pc->args == NULL);
+      g_assert (pc->results == NULL);
       g_assert (pc->error == NULL);
 
       pc->error = g_error_new_literal (TP_DBUS_ERRORS,
           TP_DBUS_ERROR_NAME_OWNER_LOST, "Name owner lost (service crashed?)");
+      tp_proxy_pending_call_record_finished (pc, TRUE);
 
-      pc->idle_source = g_idle_add_full (G_PRIORITY_HIGH,
-          tp_proxy_pending_call_idle_invoke, pc,
-          _tp_proxy_pending_call_idle_completed);
+      pc->idle_source = g_source_get_id (_tp_idle_add_thread_default (
+          G_PRIORITY_HIGH, tp_proxy_pending_call_idle_invoke, pc,
+          _tp_proxy_pending_call_idle_completed));
     }
 
   g_signal_handlers_disconnect_by_func (pc->iface_proxy,
@@ -198,6 +267,55 @@ _tp_proxy_pending_call_dgproxy_destroy (DBusGProxy *iface_proxy,
   pc->iface_proxy = NULL;
 }
 
+static TpProxyPendingCall *
+tp_proxy_pending_call_new (TpProxy *self,
+    GQuark iface,
+    const gchar *member,
+    DBusGProxy *iface_proxy,
+    TpProxyInvokeFunc invoke_callback,
+    TpProxyInvokeResultsFunc invoke_results,
+    GCallback callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    gboolean cancel_must_raise)
+{
+  TpProxyPendingCall *pc;
+
+  pc = g_slice_new0 (TpProxyPendingCall);
+
+  MORE_DEBUG ("(proxy=%p, if=%s, meth=%s, ic=%p, ir=%p; cb=%p, ud=%p, "
+      "dn=%p, wo=%p) -> %p", self, g_quark_to_string (iface), member,
+      invoke_callback, invoke_results, callback, user_data, destroy,
+      weak_object, pc);
+
+  pc->proxy = g_object_ref (self);
+  pc->invoke_callback = invoke_callback;
+  pc->invoke_results = invoke_results;
+  pc->callback = callback;
+  pc->user_data = user_data;
+  pc->destroy = destroy;
+  pc->weak_object = weak_object;
+  pc->iface_proxy = g_object_ref (iface_proxy);
+  pc->pending_call = NULL;
+  pc->priv = pending_call_magic;
+  pc->cancel_must_raise = cancel_must_raise;
+  pc->stats = _tp_method_statistics_call_started (iface, member,
+      &pc->started);
+  pc->iface = iface;
+
+  if (_tp_stall_detector_now () != 0)
+    pc->member = g_intern_string (member);
+
+  if (weak_object != NULL)
+    g_object_weak_ref (weak_object, tp_proxy_pending_call_lost_weak_ref, pc);
+
+  g_signal_connect (iface_proxy, "destroy",
+      G_CALLBACK (_tp_proxy_pending_call_dgproxy_destroy), pc);
+
+  return pc;
+}
+
 /**
  * tp_proxy_pending_call_v0_new:
  * @self: a proxy
@@ -254,35 +372,63 @@ tp_proxy_pending_call_v0_new (TpProxy *self,
                               GObject *weak_object,
                               gboolean cancel_must_raise)
 {
-  TpProxyPendingCall *pc;
-
   g_return_val_if_fail (invoke_callback != NULL, NULL);
   g_return_val_if_fail ((gpointer) iface_proxy != (gpointer) self, NULL);
 
-  pc = g_slice_new0 (TpProxyPendingCall);
-
-  MORE_DEBUG ("(proxy=%p, if=%s, meth=%s, ic=%p; cb=%p, ud=%p, dn=%p, wo=%p)"
-      " -> %p", self, g_quark_to_string (iface), member, invoke_callback,
-      callback, user_data, destroy, weak_object, pc);
-
-  pc->proxy = g_object_ref (self);
-  pc->invoke_callback = invoke_callback;
-  pc->callback = callback;
-  pc->user_data = user_data;
-  pc->destroy = destroy;
-  pc->weak_object = weak_object;
-  pc->iface_proxy = g_object_ref (iface_proxy);
-  pc->pending_call = NULL;
-  pc->priv = pending_call_magic;
-  pc->cancel_must_raise = cancel_must_raise;
-
-  if (weak_object != NULL)
-    g_object_weak_ref (weak_object, tp_proxy_pending_call_lost_weak_ref, pc);
+  return tp_proxy_pending_call_new (self, iface, member, iface_proxy,
+      invoke_callback, NULL, callback, user_data, destroy, weak_object,
+      cancel_must_raise);
+}
 
-  g_signal_connect (iface_proxy, "destroy",
-      G_CALLBACK (_tp_proxy_pending_call_dgproxy_destroy), pc);
+/**
+ * tp_proxy_pending_call_v1_new:
+ * @self: a proxy
+ * @iface: a quark whose string value is the D-Bus interface
+ * @member: the name of the method being called
+ * @iface_proxy: the interface-specific #DBusGProxy for @iface
+ * @invoke_callback: an implementation of #TpProxyInvokeResultsFunc which
+ *  will invoke @callback with appropriate arguments
+ * @callback: a callback to be called when the call completes
+ * @user_data: user-supplied data for the callback
+ * @destroy: user-supplied destructor for the data
+ * @weak_object: if not %NULL, a #GObject which will be weakly referenced by
+ *   the signal connection - if it is destroyed, the pending call will
+ *   automatically be cancelled
+ * @cancel_must_raise: if %TRUE, the @invoke_callback will be run with
+ *  error %TP_DBUS_ERROR_CANCELLED if the call is cancelled by a call to
+ *  tp_proxy_pending_call_cancel() or by destruction of the @weak_object;
+ *  if %FALSE, the @invoke_callback will not be run at all in these cases
+ *
+ * The same as tp_proxy_pending_call_v0_new(), except that the results
+ * must be passed to tp_proxy_pending_call_v1_take_results() in whatever
+ * form @invoke_callback expects, rather than as a #GValueArray.
+ *
+ * This function is for use by #TpProxy subclass implementations only, and
+ * should usually only be called from code generated by
+ * tools/glib-client-gen.py.
+ *
+ * Returns: a new pending call structure
+ *
+ * Since: 0.UNRELEASED
+ */
+TpProxyPendingCall *
+tp_proxy_pending_call_v1_new (TpProxy *self,
+    GQuark iface,
+    const gchar *member,
+    DBusGProxy *iface_proxy,
+    TpProxyInvokeResultsFunc invoke_callback,
+    GCallback callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    gboolean cancel_must_raise)
+{
+  g_return_val_if_fail (invoke_callback != NULL, NULL);
+  g_return_val_if_fail ((gpointer) iface_proxy != (gpointer) self, NULL);
 
-  return pc;
+  return tp_proxy_pending_call_new (self, iface, member, iface_proxy,
+      NULL, invoke_callback, callback, user_data, destroy, weak_object,
+      cancel_must_raise);
 }
 
 /**
@@ -305,6 +451,8 @@ tp_proxy_pending_call_cancel (TpProxyPendingCall *pc)
   /* If the callback has already run, it's too late to cancel */
   g_return_if_fail (!pc->idle_completed);
 
+  tp_proxy_pending_call_record_finished (pc, TRUE);
+
   if (pc->cancel_must_raise)
     {
       if (pc->error != NULL)
@@ -313,15 +461,12 @@ tp_proxy_pending_call_cancel (TpProxyPendingCall *pc)
       pc->error = g_error_new_literal (TP_DBUS_ERRORS,
           TP_DBUS_ERROR_CANCELLED, "Re-entrant D-Bus call cancelled");
 
-      if (pc->args != NULL)
-        {
-          tp_value_array_free (pc->args);
-          pc->args = NULL;
-        }
+      tp_proxy_pending_call_clear_results (pc);
     }
   else
     {
       pc->invoke_callback = NULL;
+      pc->invoke_results = NULL;
     }
 
   /* If we're calling the callback due to cancellation, we must free the
@@ -330,9 +475,9 @@ tp_proxy_pending_call_cancel (TpProxyPendingCall *pc)
    * weak refs (like fd.o #14750). */
   if (pc->idle_source == 0)
     {
-      pc->idle_source = g_idle_add_full (G_PRIORITY_HIGH,
-          tp_proxy_pending_call_idle_invoke, pc,
-          _tp_proxy_pending_call_idle_completed);
+      pc->idle_source = g_source_get_id (_tp_idle_add_thread_default (
+          G_PRIORITY_HIGH, tp_proxy_pending_call_idle_invoke, pc,
+          _tp_proxy_pending_call_idle_completed));
     }
 
   if (!pc->dbus_completed && pc->pending_call != NULL)
@@ -352,6 +497,8 @@ tp_proxy_pending_call_free (TpProxyPendingCall *pc)
 
   g_assert (pc->priv == pending_call_magic);
 
+  tp_proxy_pending_call_record_finished (pc, TRUE);
+
   if (pc->destroy != NULL)
     pc->destroy (pc->user_data);
 
@@ -363,10 +510,7 @@ tp_proxy_pending_call_free (TpProxyPendingCall *pc)
 
   pc->error = NULL;
 
-  if (pc->args != NULL)
-    tp_value_array_free (pc->args);
-
-  pc->args = NULL;
+  tp_proxy_pending_call_clear_results (pc);
 
   if (pc->weak_object != NULL)
     g_object_weak_unref (pc->weak_object,
@@ -507,9 +651,60 @@ tp_proxy_pending_call_v0_take_results (TpProxyPendingCall *pc,
 
   pc->args = args;
   pc->error = _tp_proxy_take_and_remap_error (pc->proxy, error);
+  tp_proxy_pending_call_record_finished (pc, pc->error != NULL);
+
+  /* queue up the actual callback to run after we go back to the event loop */
+  pc->idle_source = g_source_get_id (_tp_idle_add_thread_default (
+      G_PRIORITY_HIGH, tp_proxy_pending_call_idle_invoke, pc,
+      _tp_proxy_pending_call_idle_completed));
+}
+
+/**
+ * tp_proxy_pending_call_v1_take_results:
+ * @pc: A pending call allocated with tp_proxy_pending_call_v1_new(), on
+ *  which this function has not yet been called
+ * @error: %NULL if the call was successful, or an error (whose ownership
+ *  is taken over by the pending call object). Because of dbus-glib
+ *  idiosyncrasies, this must be the error produced by dbus-glib, not a copy.
+ * @results: %NULL if the call failed or had no "out" arguments, or the
+ *  "out" arguments in whatever form the #TpProxyInvokeResultsFunc expects
+ *  (whose ownership is taken over by the pending call object)
+ * @free_results: used to free @results after the #TpProxyInvokeResultsFunc
+ *  has been called, or if it never will be
+ *
+ * Set the "out" arguments (return values) from this pending call, like
+ * tp_proxy_pending_call_v0_take_results().
+ *
+ * This function is for use by #TpProxy subclass implementations only, and
+ * should usually only be called from code generated by
+ * tools/glib-client-gen.py.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_proxy_pending_call_v1_take_results (TpProxyPendingCall *pc,
+    GError *error,
+    gpointer results,
+    GDestroyNotify free_results)
+{
+  g_return_if_fail (pc->proxy != NULL);
+  g_return_if_fail (pc->priv == pending_call_magic);
+  g_return_if_fail (pc->invoke_callback == NULL);
+  g_return_if_fail (pc->results == NULL);
+  g_return_if_fail (pc->error == NULL);
+  g_return_if_fail (pc->idle_source == 0);
+  g_return_if_fail (error == NULL || results == NULL);
+
+  MORE_DEBUG ("%p (error: %s)", pc,
+      error == NULL ? "(none)" : error->message);
+
+  pc->results = results;
+  pc->free_results = free_results;
+  pc->error = _tp_proxy_take_and_remap_error (pc->proxy, error);
+  tp_proxy_pending_call_record_finished (pc, pc->error != NULL);
 
   /* queue up the actual callback to run after we go back to the event loop */
-  pc->idle_source = g_idle_add_full (G_PRIORITY_HIGH,
-      tp_proxy_pending_call_idle_invoke, pc,
-      _tp_proxy_pending_call_idle_completed);
+  pc->idle_source = g_source_get_id (_tp_idle_add_thread_default (
+      G_PRIORITY_HIGH, tp_proxy_pending_call_idle_invoke, pc,
+      _tp_proxy_pending_call_idle_completed));
 }
@@ -20,9 +20,12 @@
 #include "config.h"
 
 #include "telepathy-glib/proxy-subclass.h"
+#include "telepathy-glib/allocation-statistics-internal.h"
+#include "telepathy-glib/stall-detector-internal.h"
 
 #define DEBUG_FLAG TP_DEBUG_PROXY
 #include "telepathy-glib/debug-internal.h"
+#include "telepathy-glib/util-internal.h"
 #include <telepathy-glib/util.h>
 
 #if 0
@@ -40,16 +43,34 @@
  */
 
 typedef struct _TpProxySignalInvocation TpProxySignalInvocation;
+typedef struct _TpProxySignalDispatcher TpProxySignalDispatcher;
+typedef struct _TpProxySignalResults TpProxySignalResults;
+
+/* The arguments of one signal, as passed to
+ * tp_proxy_signal_connection_v1_take_results(). Unlike a GValueArray, these
+ * are shared between the invocations for all the signal connections
+ * subscribed to a dispatcher, rather than being copied for each one. */
+struct _TpProxySignalResults {
+    /* 1 per invocation */
+    gsize refcount;
+    gpointer data;
+    GDestroyNotify free_data;
+};
 
 struct _TpProxySignalInvocation {
     TpProxySignalConnection *sc;
     TpProxy *proxy;
+    /* at most one of these is non-NULL, depending on whether the
+     * connection was made with _v0_new or _v1_new */
     GValueArray *args;
-    guint idle_source;
+    TpProxySignalResults *results;
+    /* borrowed; attached to the thread-default main context of the thread
+     * which received the signal, until it runs or is destroyed */
+    GSource *idle_source;
 };
 
 struct _TpProxySignalConnection {
-    /* 1 if D-Bus has us
+    /* 1 if subscribed to a dispatcher (i.e. if D-Bus has us)
      * 1 per member of @invocations
      * 1 per callback being invoked right now */
     gsize refcount;
@@ -62,7 +83,9 @@ struct _TpProxySignalConnection {
     DBusGProxy *iface_proxy;
     gchar *member;
     GCallback collect_args;
+    /* exactly one of these is non-NULL */
     TpProxyInvokeFunc invoke_callback;
+    TpProxyInvokeResultsFunc invoke_results;
     GCallback callback;
     gpointer user_data;
     GDestroyNotify destroy;
@@ -70,10 +93,178 @@ struct _TpProxySignalConnection {
     /* queue of _TpProxySignalInvocation, not including any that are
      * being invoked right now */
     GQueue invocations;
+    /* borrowed; the dispatcher for (@iface_proxy, @member) has a borrowed
+     * pointer to us in its subscribers, or NULL if not subscribed */
+    TpProxySignalDispatcher *dispatcher;
+    /* TRUE if counted by the allocation statistics */
+    gboolean counted;
+};
+
+/* There is one of these per (bus name, object path, interface, member),
+ * i.e. per (DBusGProxy, member): it's what dbus-glib has connected to the
+ * signal. dbus-glib calls the collector once per signal and we fan the
+ * resulting GValueArray out to every subscribed TpProxySignalConnection,
+ * rather than making dbus-glib marshal each signal once per connection.
+ * Signal connections made with tp_proxy_signal_connection_v1_new() have
+ * their own dispatchers, since their collectors produce something else.
+ *
+ * It is owned by dbus-glib: it is freed when the closure is dropped, which
+ * happens when the last subscriber goes away or the DBusGProxy is disposed. */
+struct _TpProxySignalDispatcher {
+    /* borrowed; we're in the dispatchers hash table, which is qdata on it */
+    DBusGProxy *iface_proxy;
+    gchar *member;
+    GCallback collect_args;
+    /* TRUE if the subscribers were made with _v1_new */
+    gboolean typed;
+    /* borrowed TpProxySignalConnection, each of which has a ref held by
+     * us and released in tp_proxy_signal_dispatcher_unsubscribe */
+    GPtrArray *subscribers;
 };
 
+/* signals demarshalled by a dispatcher */
+static guint64 signals_received = 0;
+/* (signal, subscriber) pairs for which an invocation was queued */
+static guint64 signals_matched = 0;
+/* invocations that actually reached invoke_callback */
+static guint64 signals_delivered = 0;
+
 static void _tp_proxy_signal_connection_dgproxy_destroy (DBusGProxy *,
     TpProxySignalConnection *);
+static gboolean tp_proxy_signal_connection_unref (TpProxySignalConnection *);
+
+static GQuark
+tp_proxy_signal_dispatchers_quark (gboolean typed)
+{
+  static GQuark q = 0;
+  static GQuark typed_q = 0;
+
+  if (G_UNLIKELY (q == 0))
+    {
+      q = g_quark_from_static_string ("tp-proxy-signal-dispatchers");
+      typed_q = g_quark_from_static_string (
+          "tp-proxy-signal-typed-dispatchers");
+    }
+
+  return typed ? typed_q : q;
+}
+
+static void
+tp_proxy_signal_dispatcher_dropped (gpointer p,
+    GClosure *unused)
+{
+  TpProxySignalDispatcher *dispatcher = p;
+  GHashTable *dispatchers = g_object_get_qdata (
+      (GObject *) dispatcher->iface_proxy,
+      tp_proxy_signal_dispatchers_quark (dispatcher->typed));
+  GPtrArray *subscribers = dispatcher->subscribers;
+  guint i;
+
+  MORE_DEBUG ("%p: %s (%u subscribers)", dispatcher, dispatcher->member,
+      subscribers->len);
+
+  if (dispatchers != NULL &&
+      g_hash_table_lookup (dispatchers, dispatcher->member) == dispatcher)
+    g_hash_table_remove (dispatchers, dispatcher->member);
+
+  /* Normally we've already lost all our subscribers, but if the
+   * DBusGProxy is being disposed, there might be some left */
+  dispatcher->subscribers = NULL;
+
+  for (i = 0; i < subscribers->len; i++)
+    {
+      TpProxySignalConnection *sc = g_ptr_array_index (subscribers, i);
+
+      g_assert (sc->dispatcher == dispatcher);
+      sc->dispatcher = NULL;
+      tp_proxy_signal_connection_unref (sc);
+    }
+
+  g_ptr_array_unref (subscribers);
+  g_free (dispatcher->member);
+  g_slice_free (TpProxySignalDispatcher, dispatcher);
+}
+
+static void
+tp_proxy_signal_dispatcher_subscribe (TpProxySignalConnection *sc,
+    DBusGProxy *iface_proxy)
+{
+  gboolean typed = (sc->invoke_results != NULL);
+  GHashTable *dispatchers = g_object_get_qdata ((GObject *) iface_proxy,
+      tp_proxy_signal_dispatchers_quark (typed));
+  TpProxySignalDispatcher *dispatcher = NULL;
+
+  g_assert (sc->dispatcher == NULL);
+
+  if (dispatchers == NULL)
+    {
+      dispatchers = g_hash_table_new (g_str_hash, g_str_equal);
+      g_object_set_qdata_full ((GObject *) iface_proxy,
+          tp_proxy_signal_dispatchers_quark (typed), dispatchers,
+          (GDestroyNotify) g_hash_table_unref);
+    }
+  else
+    {
+      dispatcher = g_hash_table_lookup (dispatchers, sc->member);
+    }
+
+  if (dispatcher == NULL)
+    {
+      dispatcher = g_slice_new0 (TpProxySignalDispatcher);
+      dispatcher->iface_proxy = iface_proxy;
+      dispatcher->member = g_strdup (sc->member);
+      /* every collector for the same member of the same interface produces
+       * the same GValueArray (or, for typed dispatchers, the same
+       * results), so it doesn't matter whose we use */
+      dispatcher->collect_args = sc->collect_args;
+      dispatcher->typed = typed;
+      dispatcher->subscribers = g_ptr_array_new ();
+
+      /* the key is owned by the dispatcher, which removes itself from the
+       * hash table before it's freed */
+      g_hash_table_insert (dispatchers, dispatcher->member, dispatcher);
+
+      MORE_DEBUG ("%p: new dispatcher for %p, %s", dispatcher, iface_proxy,
+          dispatcher->member);
+
+      dbus_g_proxy_connect_signal (iface_proxy, dispatcher->member,
+          dispatcher->collect_args, dispatcher,
+          tp_proxy_signal_dispatcher_dropped);
+    }
+
+  /* our initial ref now belongs to the dispatcher, until we unsubscribe or
+   * it's dropped by dbus-glib */
+  sc->dispatcher = dispatcher;
+  g_ptr_array_add (dispatcher->subscribers, sc);
+}
+
+static void
+tp_proxy_signal_dispatcher_unsubscribe (TpProxySignalConnection *sc)
+{
+  TpProxySignalDispatcher *dispatcher = sc->dispatcher;
+
+  if (dispatcher == NULL)
+    return;
+
+  sc->dispatcher = NULL;
+  g_ptr_array_remove (dispatcher->subscribers, sc);
+
+  /* if we were the last subscriber, this drops the closure, which frees
+   * the dispatcher; make sure nobody subscribes to it in the meantime,
+   * in case the closure is still being invoked */
+  if (dispatcher->subscribers->len == 0)
+    {
+      GHashTable *dispatchers = g_object_get_qdata (
+          (GObject *) dispatcher->iface_proxy,
+          tp_proxy_signal_dispatchers_quark (dispatcher->typed));
+
+      g_hash_table_remove (dispatchers, dispatcher->member);
+      dbus_g_proxy_disconnect_signal (dispatcher->iface_proxy,
+          dispatcher->member, dispatcher->collect_args, dispatcher);
+    }
+
+  tp_proxy_signal_connection_unref (sc);
+}
 
 static void
 tp_proxy_signal_connection_disconnect_dbus_glib (TpProxySignalConnection *sc)
@@ -87,8 +278,7 @@ tp_proxy_signal_connection_disconnect_dbus_glib (TpProxySignalConnection *sc)
   sc->iface_proxy = NULL;
   g_signal_handlers_disconnect_by_func (iface_proxy,
       _tp_proxy_signal_connection_dgproxy_destroy, sc);
-  dbus_g_proxy_disconnect_signal (iface_proxy, sc->member,
-      sc->collect_args, (gpointer) sc);
+  tp_proxy_signal_dispatcher_unsubscribe (sc);
 
   g_object_unref (iface_proxy);
 }
@@ -142,6 +332,9 @@ _tp_proxy_signal_connection_finish_free (gpointer p)
       sc->weak_object = NULL;
     }
 
+  if (sc->counted)
+    _tp_allocation_statistics_freed ("TpProxySignalConnection");
+
   g_slice_free (TpProxySignalConnection, sc);
 
   return FALSE;
@@ -167,6 +360,7 @@ tp_proxy_signal_connection_unref (TpProxySignalConnection *sc)
     }
 
   g_assert (sc->invocations.length == 0);
+  g_assert (sc->dispatcher == NULL);
 
   if (sc->destroy != NULL)
     sc->destroy (sc->user_data);
@@ -183,8 +377,8 @@ tp_proxy_signal_connection_unref (TpProxySignalConnection *sc)
    * invalidation when the weak object goes away) then we need to avoid dying
    * til *our* weak-reference callback has run. So, don't actually free the
    * signal connection until we've re-entered the main loop. */
-  g_idle_add_full (G_PRIORITY_HIGH, _tp_proxy_signal_connection_finish_free,
-      sc, NULL);
+  _tp_idle_add_thread_default (G_PRIORITY_HIGH,
+      _tp_proxy_signal_connection_finish_free, sc, NULL);
 
   return TRUE;
 }
@@ -221,7 +415,7 @@ tp_proxy_signal_connection_disconnect (TpProxySignalConnection *sc)
       g_object_unref (invocation->proxy);
       invocation->proxy = NULL;
       invocation->sc = NULL;
-      g_source_remove (invocation->idle_source);
+      g_source_destroy (invocation->idle_source);
 
       if (tp_proxy_signal_connection_unref (sc))
         return;
@@ -230,6 +424,18 @@ tp_proxy_signal_connection_disconnect (TpProxySignalConnection *sc)
   tp_proxy_signal_connection_disconnect_dbus_glib (sc);
 }
 
+static void
+tp_proxy_signal_results_unref (TpProxySignalResults *results)
+{
+  if (--(results->refcount) > 0)
+    return;
+
+  if (results->data != NULL && results->free_data != NULL)
+    results->free_data (results->data);
+
+  g_slice_free (TpProxySignalResults, results);
+}
+
 static void
 tp_proxy_signal_invocation_free (gpointer p)
 {
@@ -252,6 +458,9 @@ tp_proxy_signal_invocation_free (gpointer p)
   if (invocation->args != NULL)
     tp_value_array_free (invocation->args);
 
+  if (invocation->results != NULL)
+    tp_proxy_signal_results_unref (invocation->results);
+
   g_slice_free (TpProxySignalInvocation, invocation);
 }
 
@@ -261,17 +470,42 @@ tp_proxy_signal_invocation_run (gpointer p)
   TpProxySignalInvocation *invocation = p;
   TpProxySignalInvocation *popped = g_queue_pop_head
       (&invocation->sc->invocations);
+  TpProxySignalConnection *sc = invocation->sc;
+  gint64 started = _tp_stall_detector_now ();
+  const gchar *iface = NULL;
 
   /* if GLib is running idle handlers in the wrong order, then we've lost */
   MORE_DEBUG ("%p: popped %p", invocation->sc, popped);
   g_assert (popped == invocation);
 
-  invocation->sc->invoke_callback (invocation->proxy, NULL,
-      invocation->args, invocation->sc->callback, invocation->sc->user_data,
-      invocation->sc->weak_object);
+  signals_delivered++;
+
+  /* the callback might disconnect, which forgets iface_proxy */
+  if (started != 0 && sc->iface_proxy != NULL)
+    iface = g_intern_string (dbus_g_proxy_get_interface (sc->iface_proxy));
 
-  /* the invoke callback steals args */
-  invocation->args = NULL;
+  if (invocation->sc->invoke_results != NULL)
+    {
+      /* the results are only borrowed by the invoke callback, and are
+       * released when the invocation is freed */
+      invocation->sc->invoke_results (invocation->proxy, NULL,
+          invocation->results == NULL ? NULL : invocation->results->data,
+          invocation->sc->callback, invocation->sc->user_data,
+          invocation->sc->weak_object);
+    }
+  else
+    {
+      invocation->sc->invoke_callback (invocation->proxy, NULL,
+          invocation->args, invocation->sc->callback,
+          invocation->sc->user_data, invocation->sc->weak_object);
+
+      /* the invoke callback steals args */
+      invocation->args = NULL;
+    }
+
+  if (started != 0)
+    _tp_stall_detector_handler_finished (TP_STALL_HANDLER_SIGNAL, iface,
+        sc->member, started);
 
   /* there's one ref to the proxy per queued invocation, to keep it
    * alive */
@@ -285,17 +519,6 @@ tp_proxy_signal_invocation_run (gpointer p)
   return FALSE;
 }
 
-static void
-tp_proxy_signal_connection_dropped (gpointer p,
-                                    GClosure *unused)
-{
-  TpProxySignalConnection *sc = p;
-
-  MORE_DEBUG ("%p (%u invocations queued)", sc, sc->invocations.length);
-
-  tp_proxy_signal_connection_unref (sc);
-}
-
 static void
 _tp_proxy_signal_connection_dgproxy_destroy (DBusGProxy *iface_proxy,
                                              TpProxySignalConnection *sc)
@@ -312,12 +535,133 @@ _tp_proxy_signal_connection_dgproxy_destroy (DBusGProxy *iface_proxy,
   g_object_unref (iface_proxy);
 }
 
+/* Steals @args, if not %NULL; takes a new ref to @results, if not %NULL */
+static void
+tp_proxy_signal_connection_queue_invocation (TpProxySignalConnection *sc,
+    GValueArray *args,
+    TpProxySignalResults *results)
+{
+  TpProxySignalInvocation *invocation;
+
+  /* the proxy has already been invalidated, but we haven't been told
+   * about the DBusGProxy going away yet */
+  if (sc->proxy == NULL)
+    {
+      if (args != NULL)
+        tp_value_array_free (args);
+
+      return;
+    }
+
+  /* FIXME: assert that the GValueArray is the right length, or
+   * even that it contains the right types? */
+  invocation = g_slice_new0 (TpProxySignalInvocation);
+
+  signals_matched++;
+
+  /* as long as there are queued invocations, we keep one ref to the TpProxy
+   * and one ref to the TpProxySignalConnection per invocation */
+  MORE_DEBUG ("%p refcount++ due to %p, sc=%p", sc->proxy, invocation, sc);
+  invocation->proxy = g_object_ref (sc->proxy);
+  sc->refcount++;
+
+  invocation->sc = sc;
+  invocation->args = args;
+
+  if (results != NULL)
+    {
+      results->refcount++;
+      invocation->results = results;
+    }
+
+  g_queue_push_tail (&sc->invocations, invocation);
+
+  MORE_DEBUG ("invocations: head=%p tail=%p count=%u",
+      sc->invocations.head, sc->invocations.tail,
+      sc->invocations.length);
+
+  invocation->idle_source = _tp_idle_add_thread_default (G_PRIORITY_HIGH,
+      tp_proxy_signal_invocation_run, invocation,
+      tp_proxy_signal_invocation_free);
+}
+
 static void
 collect_none (DBusGProxy *dgproxy, TpProxySignalConnection *sc)
 {
   tp_proxy_signal_connection_v0_take_results (sc, NULL);
 }
 
+static TpProxySignalConnection *
+tp_proxy_signal_connection_new (TpProxy *self,
+    GQuark iface,
+    const gchar *member,
+    const GType *expected_types,
+    GCallback collect_args,
+    TpProxyInvokeFunc invoke_callback,
+    TpProxyInvokeResultsFunc invoke_results,
+    GCallback callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  TpProxySignalConnection *sc;
+  DBusGProxy *iface_proxy = tp_proxy_get_interface_by_id (self,
+      iface, error);
+
+  if (iface_proxy == NULL)
+    {
+      if (destroy != NULL)
+        destroy (user_data);
+
+      return NULL;
+    }
+
+  if (expected_types[0] == G_TYPE_INVALID)
+    {
+      collect_args = G_CALLBACK (collect_none);
+    }
+  else
+    {
+      g_return_val_if_fail (collect_args != NULL, NULL);
+    }
+
+  sc = g_slice_new0 (TpProxySignalConnection);
+
+  MORE_DEBUG ("(proxy=%p, if=%s, sig=%s, collect=%p, invoke=%p, "
+      "ir=%p, cb=%p, ud=%p, dn=%p, wo=%p) -> %p",
+      self, g_quark_to_string (iface), member, collect_args,
+      invoke_callback, invoke_results, callback, user_data, destroy,
+      weak_object, sc);
+
+  sc->refcount = 1;
+  sc->proxy = self;
+  sc->iface_proxy = g_object_ref (iface_proxy);
+  sc->member = g_strdup (member);
+  sc->collect_args = collect_args;
+  sc->invoke_callback = invoke_callback;
+  sc->invoke_results = invoke_results;
+  sc->callback = callback;
+  sc->user_data = user_data;
+  sc->destroy = destroy;
+  sc->weak_object = weak_object;
+  sc->counted = _tp_allocation_statistics_created ("TpProxySignalConnection");
+
+  if (weak_object != NULL)
+    g_object_weak_ref (weak_object, tp_proxy_signal_connection_lost_weak_ref,
+        sc);
+
+  g_signal_connect (self, "invalidated",
+      G_CALLBACK (tp_proxy_signal_connection_proxy_invalidated), sc);
+
+  g_signal_connect (iface_proxy, "destroy",
+      G_CALLBACK (_tp_proxy_signal_connection_dgproxy_destroy), sc);
+
+  tp_proxy_signal_dispatcher_subscribe (sc, iface_proxy);
+
+  return sc;
+}
+
 /**
  * tp_proxy_signal_connection_v0_new:
  * @self: a proxy
@@ -370,59 +714,68 @@ tp_proxy_signal_connection_v0_new (TpProxy *self,
                                    GObject *weak_object,
                                    GError **error)
 {
-  TpProxySignalConnection *sc;
-  DBusGProxy *iface_proxy = tp_proxy_get_interface_by_id (self,
-      iface, error);
-
-  if (iface_proxy == NULL)
-    {
-      if (destroy != NULL)
-        destroy (user_data);
-
-      return NULL;
-    }
-
-  if (expected_types[0] == G_TYPE_INVALID)
-    {
-      collect_args = G_CALLBACK (collect_none);
-    }
-  else
-    {
-      g_return_val_if_fail (collect_args != NULL, NULL);
-    }
-
-  sc = g_slice_new0 (TpProxySignalConnection);
-
-  MORE_DEBUG ("(proxy=%p, if=%s, sig=%s, collect=%p, invoke=%p, "
-      "cb=%p, ud=%p, dn=%p, wo=%p) -> %p",
-      self, g_quark_to_string (iface), member, collect_args,
-      invoke_callback, callback, user_data, destroy, weak_object, sc);
-
-  sc->refcount = 1;
-  sc->proxy = self;
-  sc->iface_proxy = g_object_ref (iface_proxy);
-  sc->member = g_strdup (member);
-  sc->collect_args = collect_args;
-  sc->invoke_callback = invoke_callback;
-  sc->callback = callback;
-  sc->user_data = user_data;
-  sc->destroy = destroy;
-  sc->weak_object = weak_object;
-
-  if (weak_object != NULL)
-    g_object_weak_ref (weak_object, tp_proxy_signal_connection_lost_weak_ref,
-        sc);
-
-  g_signal_connect (self, "invalidated",
-      G_CALLBACK (tp_proxy_signal_connection_proxy_invalidated), sc);
-
-  g_signal_connect (iface_proxy, "destroy",
-      G_CALLBACK (_tp_proxy_signal_connection_dgproxy_destroy), sc);
+  return tp_proxy_signal_connection_new (self, iface, member,
+      expected_types, collect_args, invoke_callback, NULL, callback,
+      user_data, destroy, weak_object, error);
+}
 
-  dbus_g_proxy_connect_signal (iface_proxy, member, collect_args, sc,
-      tp_proxy_signal_connection_dropped);
+/**
+ * tp_proxy_signal_connection_v1_new:
+ * @self: a proxy
+ * @iface: a quark whose string value is the D-Bus interface
+ * @member: the name of the signal to which we're connecting
+ * @expected_types: an array of expected GTypes for the arguments, terminated
+ *  by %G_TYPE_INVALID
+ * @collect_args: a callback to be given to dbus_g_proxy_connect_signal(),
+ *  which must copy the arguments into whatever form @invoke_callback
+ *  expects and use them to call tp_proxy_signal_connection_v1_take_results();
+ *  or %NULL if no arguments are expected at all
+ * @invoke_callback: a function which will be called with @error = %NULL,
+ *  which should invoke @callback with @user_data, @weak_object and other
+ *  appropriate arguments taken from its @results
+ * @callback: user callback to be invoked by @invoke_callback
+ * @user_data: user-supplied data for the callback
+ * @destroy: user-supplied destructor for the data, which will be called
+ *   when the signal connection is disconnected for any reason,
+ *   or will be called before this function returns if an error occurs
+ * @weak_object: if not %NULL, a #GObject which will be weakly referenced by
+ *   the signal connection - if it is destroyed, the signal connection will
+ *   automatically be disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is returned
+ *
+ * The same as tp_proxy_signal_connection_v0_new(), except that the
+ * arguments of each signal are collected into whatever form
+ * @invoke_callback expects, rather than a #GValueArray, and are shared
+ * between all the signal connections for the same signal rather than
+ * copied for each of them.
+ *
+ * This function is for use by #TpProxy subclass implementations only, and
+ * should usually only be called from code generated by
+ * tools/glib-client-gen.py.
+ *
+ * Returns: a signal connection structure, or %NULL if the proxy does not
+ *  have the desired interface or has become invalid
+ *
+ * Since: 0.UNRELEASED
+ */
+TpProxySignalConnection *
+tp_proxy_signal_connection_v1_new (TpProxy *self,
+    GQuark iface,
+    const gchar *member,
+    const GType *expected_types,
+    GCallback collect_args,
+    TpProxyInvokeResultsFunc invoke_callback,
+    GCallback callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  g_return_val_if_fail (invoke_callback != NULL, NULL);
 
-  return sc;
+  return tp_proxy_signal_connection_new (self, iface, member,
+      expected_types, collect_args, NULL, invoke_callback, callback,
+      user_data, destroy, weak_object, error);
 }
 
 /**
@@ -436,32 +789,149 @@ tp_proxy_signal_connection_v0_new (TpProxy *self,
  * This method should only be called from #TpProxy subclass implementations,
  * in the callback that implements @collect_args.
  *
+ * Since 0.UNRELEASED, the @sc passed to @collect_args (and hence to this
+ * function) might be shared between all the signal connections for the same
+ * signal on the same object, so that each signal is only collected once;
+ * it must be treated as opaque.
+ *
  * Since: 0.7.1
  */
 void
 tp_proxy_signal_connection_v0_take_results (TpProxySignalConnection *sc,
                                             GValueArray *args)
 {
-  TpProxySignalInvocation *invocation = g_slice_new0 (TpProxySignalInvocation);
-  /* FIXME: assert that the GValueArray is the right length, or
-   * even that it contains the right types? */
+  /* It's actually one of ours: see tp_proxy_signal_dispatcher_subscribe */
+  TpProxySignalDispatcher *dispatcher = (TpProxySignalDispatcher *) sc;
+  GPtrArray *subscribers = dispatcher->subscribers;
+  guint i;
 
-  /* as long as there are queued invocations, we keep one ref to the TpProxy
-   * and one ref to the TpProxySignalConnection per invocation */
-  MORE_DEBUG ("%p refcount++ due to %p, sc=%p", sc->proxy, invocation, sc);
-  invocation->proxy = g_object_ref (sc->proxy);
-  sc->refcount++;
+  signals_received++;
 
-  invocation->sc = sc;
-  invocation->args = args;
+  if (subscribers == NULL || subscribers->len == 0)
+    {
+      MORE_DEBUG ("%p: %s has no subscribers", dispatcher,
+          dispatcher->member);
 
-  g_queue_push_tail (&sc->invocations, invocation);
+      if (args != NULL)
+        tp_value_array_free (args);
 
-  MORE_DEBUG ("invocations: head=%p tail=%p count=%u",
-      sc->invocations.head, sc->invocations.tail,
-      sc->invocations.length);
+      return;
+    }
 
-  invocation->idle_source = g_idle_add_full (G_PRIORITY_HIGH,
-      tp_proxy_signal_invocation_run, invocation,
-      tp_proxy_signal_invocation_free);
+  /* Queuing an invocation can't call back into user code, so the set of
+   * subscribers can't change while we do this. The last subscriber gets
+   * @args itself, the rest get copies, since the invoke callback
+   * steals them. */
+  for (i = 0; i < subscribers->len; i++)
+    {
+      TpProxySignalConnection *subscriber = g_ptr_array_index (subscribers,
+          i);
+
+      if (i + 1 == subscribers->len || args == NULL)
+        {
+          tp_proxy_signal_connection_queue_invocation (subscriber, args,
+              NULL);
+        }
+      else
+        {
+          G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+          tp_proxy_signal_connection_queue_invocation (subscriber,
+              g_value_array_copy (args), NULL);
+          G_GNUC_END_IGNORE_DEPRECATIONS
+        }
+    }
+}
+
+/**
+ * tp_proxy_signal_connection_v1_take_results:
+ * @sc: The signal connection
+ * @results: The arguments of the signal, in whatever form the
+ *  #TpProxyInvokeResultsFunc expects, or %NULL if there are none
+ * @free_results: used to free @results after the last
+ *  #TpProxyInvokeResultsFunc to which they are passed has returned
+ *
+ * Feed the results of a signal invocation back into the signal connection
+ * machinery, like tp_proxy_signal_connection_v0_take_results(). @results
+ * are passed to the #TpProxyInvokeResultsFunc of every signal connection
+ * for this signal, without being copied.
+ *
+ * This method should only be called from #TpProxy subclass implementations,
+ * in the callback that implements @collect_args, for signal connections
+ * made with tp_proxy_signal_connection_v1_new().
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_proxy_signal_connection_v1_take_results (TpProxySignalConnection *sc,
+    gpointer results,
+    GDestroyNotify free_results)
+{
+  /* It's actually one of ours: see tp_proxy_signal_dispatcher_subscribe */
+  TpProxySignalDispatcher *dispatcher = (TpProxySignalDispatcher *) sc;
+  GPtrArray *subscribers = dispatcher->subscribers;
+  TpProxySignalResults *shared;
+  guint i;
+
+  g_assert (dispatcher->typed);
+
+  signals_received++;
+
+  shared = g_slice_new0 (TpProxySignalResults);
+  shared->data = results;
+  shared->free_data = free_results;
+
+  /* this ref is released below, after each invocation has taken its own */
+  shared->refcount = 1;
+
+  if (subscribers == NULL || subscribers->len == 0)
+    {
+      MORE_DEBUG ("%p: %s has no subscribers", dispatcher,
+          dispatcher->member);
+    }
+  else
+    {
+      /* Queuing an invocation can't call back into user code, so the set
+       * of subscribers can't change while we do this */
+      for (i = 0; i < subscribers->len; i++)
+        tp_proxy_signal_connection_queue_invocation (
+            g_ptr_array_index (subscribers, i), NULL, shared);
+    }
+
+  tp_proxy_signal_results_unref (shared);
+}
+
+/**
+ * tp_proxy_signal_connection_get_dispatch_stats:
+ * @received: (out) (allow-none): used to return the number of D-Bus signals
+ *  that were collected, once per signal, for any #TpProxySignalConnection
+ * @matched: (out) (allow-none): used to return the number of times one of
+ *  those signals matched a #TpProxySignalConnection and was queued for it
+ * @delivered: (out) (allow-none): used to return the number of times a
+ *  queued signal was actually passed to a callback, which is less than
+ *  @matched if signal connections were disconnected before their signals
+ *  could be delivered
+ *
+ * Return statistics about the signals received by all the signal connections
+ * in this process, since it started. Each signal is demarshalled once, no
+ * matter how many #TpProxySignalConnection<!-- -->s are connected to it, so
+ * comparing @received with @matched shows how much work that saves.
+ *
+ * This function is not thread-safe, in the same way as the rest of
+ * #TpProxy.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_proxy_signal_connection_get_dispatch_stats (guint64 *received,
+    guint64 *matched,
+    guint64 *delivered)
+{
+  if (received != NULL)
+    *received = signals_received;
+
+  if (matched != NULL)
+    *matched = signals_matched;
+
+  if (delivered != NULL)
+    *delivered = signals_delivered;
 }
@@ -33,6 +33,10 @@ typedef void (*TpProxyInvokeFunc) (TpProxy *self,
     GError *error, GValueArray *args, GCallback callback, gpointer user_data,
     GObject *weak_object);
 
+typedef void (*TpProxyInvokeResultsFunc) (TpProxy *self,
+    const GError *error, gconstpointer results, GCallback callback,
+    gpointer user_data, GObject *weak_object);
+
 TpProxyPendingCall *tp_proxy_pending_call_v0_new (TpProxy *self,
     GQuark iface, const gchar *member, DBusGProxy *iface_proxy,
     TpProxyInvokeFunc invoke_callback,
@@ -47,6 +51,17 @@ void tp_proxy_pending_call_v0_take_results (TpProxyPendingCall *pc,
 
 void tp_proxy_pending_call_v0_completed (gpointer p);
 
+_TP_AVAILABLE_IN_UNRELEASED
+TpProxyPendingCall *tp_proxy_pending_call_v1_new (TpProxy *self,
+    GQuark iface, const gchar *member, DBusGProxy *iface_proxy,
+    TpProxyInvokeResultsFunc invoke_callback,
+    GCallback callback, gpointer user_data, GDestroyNotify destroy,
+    GObject *weak_object, gboolean cancel_must_raise);
+
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_proxy_pending_call_v1_take_results (TpProxyPendingCall *pc,
+    GError *error, gpointer results, GDestroyNotify free_results);
+
 TpProxySignalConnection *tp_proxy_signal_connection_v0_new (TpProxy *self,
     GQuark iface, const gchar *member,
     const GType *expected_types,
@@ -57,6 +72,19 @@ TpProxySignalConnection *tp_proxy_signal_connection_v0_new (TpProxy *self,
 void tp_proxy_signal_connection_v0_take_results
     (TpProxySignalConnection *sc, GValueArray *args);
 
+_TP_AVAILABLE_IN_UNRELEASED
+TpProxySignalConnection *tp_proxy_signal_connection_v1_new (TpProxy *self,
+    GQuark iface, const gchar *member,
+    const GType *expected_types,
+    GCallback collect_args, TpProxyInvokeResultsFunc invoke_callback,
+    GCallback callback, gpointer user_data, GDestroyNotify destroy,
+    GObject *weak_object, GError **error);
+
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_proxy_signal_connection_v1_take_results
+    (TpProxySignalConnection *sc, gpointer results,
+    GDestroyNotify free_results);
+
 typedef void (*TpProxyInterfaceAddedCb) (TpProxy *self,
     guint quark, DBusGProxy *proxy, gpointer unused);
 
@@ -23,6 +23,7 @@
 
 #include "telepathy-glib/proxy-subclass.h"
 #include "telepathy-glib/proxy-internal.h"
+#include "telepathy-glib/allocation-statistics-internal.h"
 
 #include <string.h>
 
@@ -322,6 +323,35 @@ struct _TpProxyFeaturePrivate
  * Since: 0.7.1
  */
 
+/**
+ * TpProxyInvokeResultsFunc:
+ * @self: the #TpProxy on which the D-Bus method was invoked, or which
+ *  emitted the D-Bus signal
+ * @error: %NULL if the method call succeeded, or a non-%NULL error if the
+ *  method call failed; always %NULL for signals
+ * @results: the "out" arguments of the D-Bus method or the arguments of the
+ *  D-Bus signal, in whatever form was passed to
+ *  tp_proxy_pending_call_v1_take_results() or
+ *  tp_proxy_signal_connection_v1_take_results(), or %NULL if an error
+ *  occurred or there were no arguments
+ * @callback: the callback that should be invoked, as passed to
+ *  tp_proxy_pending_call_v1_new() or tp_proxy_signal_connection_v1_new()
+ * @user_data: user-supplied data to pass to the callback
+ * @weak_object: user-supplied object to pass to the callback
+ *
+ * Signature of a callback invoked by the #TpProxy machinery after a D-Bus
+ * method call has succeeded or failed, or a D-Bus signal has been received,
+ * like #TpProxyInvokeFunc. Unlike #TpProxyInvokeFunc, the results don't
+ * need to be boxed into a #GValueArray: the generated code can use a
+ * structure with a member of the appropriate C type for each argument.
+ *
+ * @error and @results are borrowed, and are freed after this callback
+ * returns; the same @results might be passed to the callbacks for several
+ * signal connections.
+ *
+ * Since: 0.UNRELEASED
+ */
+
 typedef enum {
     /* Not a feature */
     FEATURE_STATE_INVALID = GPOINTER_TO_INT (NULL),
@@ -403,6 +433,8 @@ struct _TpProxyPrivate {
     guint pending_will_announce_calls;
 
     gboolean dispose_has_run;
+    /* TRUE if counted by the allocation statistics */
+    gboolean counted;
 
     TpSimpleClientFactory *factory;
 };
@@ -677,7 +709,7 @@ tp_proxy_iface_destroyed_cb (DBusGProxy *dgproxy,
       self->invalidated = g_error_new_literal (TP_DBUS_ERRORS,
           TP_DBUS_ERROR_NAME_OWNER_LOST, "Name owner lost (service crashed?)");
 
-      g_idle_add_full (G_PRIORITY_HIGH, tp_proxy_emit_invalidated,
+      _tp_idle_add_thread_default (G_PRIORITY_HIGH, tp_proxy_emit_invalidated,
           g_object_ref (self), g_object_unref);
     }
 }
@@ -1069,6 +1101,8 @@ tp_proxy_constructor (GType type,
   GType proxy_parent_type = G_TYPE_FROM_CLASS (tp_proxy_parent_class);
   GType ancestor_type;
 
+  self->priv->counted = _tp_allocation_statistics_object_created (self);
+
   _tp_register_dbus_glib_marshallers ();
 
   for (ancestor_type = type;
@@ -1198,6 +1232,9 @@ tp_proxy_finalize (GObject *object)
   g_free (self->bus_name);
   g_free (self->object_path);
 
+  if (self->priv->counted)
+    _tp_allocation_statistics_object_freed (self);
+
   G_OBJECT_CLASS (tp_proxy_parent_class)->finalize (object);
 }
 
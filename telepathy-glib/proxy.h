@@ -139,6 +139,11 @@ typedef struct _TpProxySignalConnection TpProxySignalConnection;
 
 void tp_proxy_signal_connection_disconnect (TpProxySignalConnection *sc);
 
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_proxy_signal_connection_get_dispatch_stats (guint64 *received,
+    guint64 *matched,
+    guint64 *delivered);
+
 GType tp_proxy_get_type (void);
 
 /* TYPE MACROS */
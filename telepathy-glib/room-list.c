@@ -24,6 +24,20 @@
  * @short_description: proxy object for a room list channel
  *
  * #TpRoomList provides convenient API to list rooms.
+ *
+ * By default, each room found is announced with the #TpRoomList::got-room
+ * signal. Servers can have a great many public rooms, so a #TpRoomList can
+ * instead be used as a bounded stream by setting
+ * #TpRoomList:max-pending-rooms: rooms are then queued until they are
+ * retrieved with tp_room_list_pop_room(), and #TpRoomList::rooms-available
+ * is emitted when some have arrived. This is not lossless: a consumer that
+ * pops rooms from its #TpRoomList::rooms-available handler keeps up with any
+ * number of them, but if one falls too far behind, listing is stopped, and
+ * #TpRoomList:n-dropped-rooms says how many rooms were lost as a result.
+ * The Telepathy API has no way to resume a listing from where it stopped,
+ * so the rooms which were not delivered can only be found by listing them
+ * all again with tp_room_list_start(). Whichever mode is used, #TpRoomList
+ * does not keep any reference to the rooms it has delivered.
  */
 
 /**
@@ -55,6 +69,7 @@
 #include "telepathy-glib/debug-internal.h"
 
 #include <stdio.h>
+#include <string.h>
 #include <glib/gstdio.h>
 
 static void async_initable_iface_init (GAsyncInitableIface *iface);
@@ -72,6 +87,21 @@ struct _TpRoomListPrivate
 
   GSimpleAsyncResult *async_res;
   gulong invalidated_id;
+
+  /* if not NULL, only rooms whose name or handle name contain it are
+   * reported */
+  gchar *name_filter;
+
+  /* if nonzero, rooms are queued in @pending rather than emitted with
+   * got-room, and no more than this many are kept */
+  guint max_pending;
+  /* owned TpRoomInfo, oldest first */
+  GQueue pending;
+  /* rooms discarded since listing was last started because @pending was
+   * full */
+  guint n_dropped;
+  /* TRUE if we've asked the CM to stop listing because @pending was full */
+  gboolean stopping;
 };
 
 enum
@@ -79,11 +109,14 @@ enum
   PROP_ACCOUNT = 1,
   PROP_SERVER,
   PROP_LISTING,
+  PROP_MAX_PENDING_ROOMS,
+  PROP_N_DROPPED_ROOMS,
 };
 
 enum {
   SIG_GOT_ROOM,
   SIG_FAILED,
+  SIG_ROOMS_AVAILABLE,
   LAST_SIGNAL
 };
 
@@ -111,6 +144,14 @@ tp_room_list_get_property (GObject *object,
         g_value_set_boolean (value, self->priv->listing);
         break;
 
+      case PROP_MAX_PENDING_ROOMS:
+        g_value_set_uint (value, self->priv->max_pending);
+        break;
+
+      case PROP_N_DROPPED_ROOMS:
+        g_value_set_uint (value, self->priv->n_dropped);
+        break;
+
       default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
         break;
@@ -137,12 +178,55 @@ tp_room_list_set_property (GObject *object,
         self->priv->server = g_value_dup_string (value);
         break;
 
+      case PROP_MAX_PENDING_ROOMS:
+        tp_room_list_set_max_pending_rooms (self, g_value_get_uint (value));
+        break;
+
       default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
         break;
     }
 }
 
+static gboolean
+asv_string_contains (GHashTable *asv,
+    const gchar *key,
+    const gchar *needle)
+{
+  const gchar *s = tp_asv_get_string (asv, key);
+
+  return (s != NULL && strstr (s, needle) != NULL);
+}
+
+static gboolean
+room_matches_filter (TpRoomList *self,
+    GValueArray *dbus_struct)
+{
+  TpHandle handle;
+  const gchar *channel_type;
+  GHashTable *info;
+
+  if (self->priv->name_filter == NULL)
+    return TRUE;
+
+  /* This is checked on the D-Bus struct, so that rooms which are filtered
+   * out never get a TpRoomInfo */
+  tp_value_array_unpack (dbus_struct, 3, &handle, &channel_type, &info);
+
+  return (asv_string_contains (info, "name", self->priv->name_filter) ||
+      asv_string_contains (info, "handle-name", self->priv->name_filter));
+}
+
+static void
+stop_listing_cb (TpChannel *channel,
+    const GError *error,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  if (error != NULL)
+    DEBUG ("Failed to stop listing: %s", error->message);
+}
+
 static void
 got_rooms_cb (TpChannel *channel,
     const GPtrArray *rooms,
@@ -150,16 +234,78 @@ got_rooms_cb (TpChannel *channel,
     GObject *weak_object)
 {
   TpRoomList *self = TP_ROOM_LIST (weak_object);
+  guint queued = 0;
+  guint dropped = 0;
   guint i;
 
+  /* signal handlers might drop the last reference */
+  g_object_ref (self);
+
   for (i = 0; i < rooms->len; i++)
     {
+      GValueArray *dbus_struct = g_ptr_array_index (rooms, i);
       TpRoomInfo *room;
 
-      room = _tp_room_info_new (g_ptr_array_index (rooms, i));
-      g_signal_emit (self, signals[SIG_GOT_ROOM], 0, room);
-      g_object_unref (room);
+      if (!room_matches_filter (self, dbus_struct))
+        continue;
+
+      if (self->priv->max_pending == 0)
+        {
+          room = _tp_room_info_new (dbus_struct);
+          g_signal_emit (self, signals[SIG_GOT_ROOM], 0, room);
+          g_object_unref (room);
+          continue;
+        }
+
+      /* if the queue fills up in the middle of a batch, give a consumer
+       * that pops rooms from its handler a chance to make room before
+       * dropping any */
+      if (self->priv->pending.length >= self->priv->max_pending &&
+          queued > 0)
+        {
+          queued = 0;
+          g_signal_emit (self, signals[SIG_ROOMS_AVAILABLE], 0);
+        }
+
+      if (self->priv->pending.length >= self->priv->max_pending)
+        {
+          dropped++;
+          continue;
+        }
+
+      g_queue_push_tail (&self->priv->pending, _tp_room_info_new (dbus_struct));
+      queued++;
+    }
+
+  if (queued > 0)
+    g_signal_emit (self, signals[SIG_ROOMS_AVAILABLE], 0);
+
+  /* D-Bus signals can't be throttled, so the only way to stop the CM from
+   * sending rooms faster than they are consumed is to stop it altogether.
+   * Do that as soon as the queue is still full after the consumer has been
+   * told about it, rather than when the first room doesn't fit in it, so
+   * that only rooms already on their way are lost. The Telepathy API can't
+   * resume a listing where it stopped, so this is where the listing ends. */
+  if (self->priv->max_pending != 0 &&
+      self->priv->pending.length >= self->priv->max_pending &&
+      !self->priv->stopping)
+    {
+      DEBUG ("%u rooms are waiting to be popped; stop listing",
+          self->priv->pending.length);
+
+      self->priv->stopping = TRUE;
+      tp_cli_channel_type_room_list_call_stop_listing (channel, -1,
+          stop_listing_cb, NULL, NULL, G_OBJECT (self));
+    }
+
+  if (dropped > 0)
+    {
+      DEBUG ("dropped %u rooms", dropped);
+      self->priv->n_dropped += dropped;
+      g_object_notify (G_OBJECT (self), "n-dropped-rooms");
     }
+
+  g_object_unref (self);
 }
 
 static void
@@ -203,6 +349,9 @@ tp_room_list_dispose (GObject *object)
   destroy_channel (self);
   g_clear_object (&self->priv->account);
 
+  while (!g_queue_is_empty (&self->priv->pending))
+    g_object_unref (g_queue_pop_head (&self->priv->pending));
+
   if (chain_up != NULL)
     chain_up (object);
 }
@@ -215,6 +364,7 @@ tp_room_list_finalize (GObject *object)
       ((GObjectClass *) tp_room_list_parent_class)->finalize;
 
   g_free (self->priv->server);
+  g_free (self->priv->name_filter);
 
   if (chain_up != NULL)
     chain_up (object);
@@ -274,6 +424,53 @@ tp_room_list_class_init (TpRoomListClass *klass)
       G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
   g_object_class_install_property (gobject_class, PROP_LISTING, param_spec);
 
+  /**
+   * TpRoomList:max-pending-rooms:
+   *
+   * If zero (the default), each room found is announced with the
+   * #TpRoomList::got-room signal.
+   *
+   * Otherwise, rooms are queued until they are retrieved with
+   * tp_room_list_pop_room(), and #TpRoomList::rooms-available is emitted
+   * instead of #TpRoomList::got-room. If this many rooms are waiting to be
+   * popped, #TpRoomList::rooms-available is emitted straight away; if they
+   * are still waiting once it has been emitted, the connection manager is
+   * asked to stop listing, so that the memory used by @self stays bounded
+   * however many rooms the server has. Rooms which the connection manager
+   * had already sent are then discarded, and counted by
+   * #TpRoomList:n-dropped-rooms; listing can't be resumed, so the rest of
+   * the server's rooms are not reported at all.
+   *
+   * Since: 0.UNRELEASED
+   */
+  param_spec = g_param_spec_uint ("max-pending-rooms", "Max pending rooms",
+      "Maximum number of rooms waiting to be popped, or 0 to use got-room",
+      0, G_MAXUINT, 0,
+      G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+  g_object_class_install_property (gobject_class, PROP_MAX_PENDING_ROOMS,
+      param_spec);
+
+  /**
+   * TpRoomList:n-dropped-rooms:
+   *
+   * The number of rooms which were discarded since tp_room_list_start() was
+   * last called, because #TpRoomList:max-pending-rooms rooms were already
+   * waiting to be popped. If this is nonzero, the listing is incomplete.
+   * Rooms which the connection manager never sent, because it was asked to
+   * stop listing, can't be counted, so the listing may also be incomplete
+   * if this is zero but the queue was full when #TpRoomList:listing became
+   * %FALSE.
+   * Change notification is emitted each time more rooms are discarded.
+   *
+   * Since: 0.UNRELEASED
+   */
+  param_spec = g_param_spec_uint ("n-dropped-rooms", "Number of dropped rooms",
+      "Number of rooms discarded because too many were waiting to be popped",
+      0, G_MAXUINT, 0,
+      G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+  g_object_class_install_property (gobject_class, PROP_N_DROPPED_ROOMS,
+      param_spec);
+
 
   /**
    * TpRoomList::got-room:
@@ -310,6 +507,26 @@ tp_room_list_class_init (TpRoomListClass *klass)
       G_TYPE_NONE,
       1, G_TYPE_ERROR);
 
+  /**
+   * TpRoomList::rooms-available:
+   * @self: a #TpRoomList
+   *
+   * Fired when rooms have been added to the queue of rooms waiting to be
+   * retrieved with tp_room_list_pop_room(). This is only used if
+   * #TpRoomList:max-pending-rooms is nonzero. Handlers that pop rooms
+   * straight away prevent the listing from being stopped, even if the
+   * connection manager sends more than #TpRoomList:max-pending-rooms rooms
+   * at once.
+   *
+   * Since: 0.UNRELEASED
+   */
+  signals[SIG_ROOMS_AVAILABLE] = g_signal_new ("rooms-available",
+      G_OBJECT_CLASS_TYPE (klass),
+      G_SIGNAL_RUN_LAST,
+      0, NULL, NULL, NULL,
+      G_TYPE_NONE,
+      0);
+
   g_type_class_add_private (gobject_class, sizeof (TpRoomListPrivate));
 }
 
@@ -318,6 +535,8 @@ tp_room_list_init (TpRoomList *self)
 {
   self->priv = G_TYPE_INSTANCE_GET_PRIVATE ((self), TP_TYPE_ROOM_LIST,
       TpRoomListPrivate);
+
+  g_queue_init (&self->priv->pending);
 }
 
 /**
@@ -397,10 +616,126 @@ tp_room_list_start (TpRoomList *self)
 {
   g_return_if_fail (self->priv->channel != NULL);
 
+  self->priv->stopping = FALSE;
+
+  if (self->priv->n_dropped != 0)
+    {
+      self->priv->n_dropped = 0;
+      g_object_notify (G_OBJECT (self), "n-dropped-rooms");
+    }
+
   tp_cli_channel_type_room_list_call_list_rooms (self->priv->channel, -1,
       list_rooms_cb, NULL, NULL, G_OBJECT (self));
 }
 
+/**
+ * tp_room_list_set_max_pending_rooms:
+ * @self: a #TpRoomList
+ * @max_pending: the new value of #TpRoomList:max-pending-rooms
+ *
+ * Set #TpRoomList:max-pending-rooms. This should be done before calling
+ * tp_room_list_start(). Rooms already waiting to be popped are kept, even if
+ * there are more than @max_pending of them; if @max_pending is 0, they can
+ * still be retrieved with tp_room_list_pop_room().
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_room_list_set_max_pending_rooms (TpRoomList *self,
+    guint max_pending)
+{
+  g_return_if_fail (TP_IS_ROOM_LIST (self));
+
+  if (self->priv->max_pending == max_pending)
+    return;
+
+  self->priv->max_pending = max_pending;
+  g_object_notify (G_OBJECT (self), "max-pending-rooms");
+}
+
+/**
+ * tp_room_list_pop_room:
+ * @self: a #TpRoomList
+ *
+ * Retrieve the oldest room that is waiting in @self's queue, if
+ * #TpRoomList:max-pending-rooms is nonzero. @self doesn't keep any reference
+ * to the rooms it returns.
+ *
+ * Returns: (transfer full): the next #TpRoomInfo, or %NULL if no rooms are
+ *  waiting
+ *
+ * Since: 0.UNRELEASED
+ */
+TpRoomInfo *
+tp_room_list_pop_room (TpRoomList *self)
+{
+  g_return_val_if_fail (TP_IS_ROOM_LIST (self), NULL);
+
+  return g_queue_pop_head (&self->priv->pending);
+}
+
+/**
+ * tp_room_list_get_n_pending_rooms:
+ * @self: a #TpRoomList
+ *
+ * <!-- -->
+ *
+ * Returns: the number of rooms waiting to be retrieved with
+ *  tp_room_list_pop_room()
+ *
+ * Since: 0.UNRELEASED
+ */
+guint
+tp_room_list_get_n_pending_rooms (TpRoomList *self)
+{
+  g_return_val_if_fail (TP_IS_ROOM_LIST (self), 0);
+
+  return self->priv->pending.length;
+}
+
+/**
+ * tp_room_list_get_n_dropped_rooms:
+ * @self: a #TpRoomList
+ *
+ * Return the #TpRoomList:n-dropped-rooms property.
+ *
+ * Returns: the value of #TpRoomList:n-dropped-rooms
+ *
+ * Since: 0.UNRELEASED
+ */
+guint
+tp_room_list_get_n_dropped_rooms (TpRoomList *self)
+{
+  g_return_val_if_fail (TP_IS_ROOM_LIST (self), 0);
+
+  return self->priv->n_dropped;
+}
+
+/**
+ * tp_room_list_set_name_filter:
+ * @self: a #TpRoomList
+ * @filter: (allow-none): a string, or %NULL
+ *
+ * Only report rooms whose name or handle name contain @filter (which is
+ * case-sensitive), or every room if @filter is %NULL.
+ *
+ * The Telepathy D-Bus API has no way to pass a filter to the server, so
+ * every room is still received, but rooms which don't match are discarded
+ * as soon as they arrive, before any #TpRoomInfo is created for them or they
+ * are counted against #TpRoomList:max-pending-rooms.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_room_list_set_name_filter (TpRoomList *self,
+    const gchar *filter)
+{
+  g_return_if_fail (TP_IS_ROOM_LIST (self));
+
+  g_free (self->priv->name_filter);
+  self->priv->name_filter = g_strdup (filter);
+}
+
 static void
 chan_invalidated_cb (TpChannel *channel,
     guint domain,
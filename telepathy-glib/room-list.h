@@ -73,6 +73,21 @@ gboolean tp_room_list_is_listing (TpRoomList *self);
 
 void tp_room_list_start (TpRoomList *self);
 
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_room_list_set_max_pending_rooms (TpRoomList *self,
+    guint max_pending);
+_TP_AVAILABLE_IN_UNRELEASED
+TpRoomInfo *tp_room_list_pop_room (TpRoomList *self)
+    G_GNUC_WARN_UNUSED_RESULT;
+_TP_AVAILABLE_IN_UNRELEASED
+guint tp_room_list_get_n_pending_rooms (TpRoomList *self);
+_TP_AVAILABLE_IN_UNRELEASED
+guint tp_room_list_get_n_dropped_rooms (TpRoomList *self);
+
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_room_list_set_name_filter (TpRoomList *self,
+    const gchar *filter);
+
 G_END_DECLS
 
 #endif
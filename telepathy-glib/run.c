@@ -29,7 +29,11 @@
  * and lets it run.
  *
  * This function also manages the connection manager's lifetime - if there
- * are no new connections for a while, it times out and exits.
+ * are no new connections for a while, it times out and exits. By default
+ * "a while" is a few seconds; tp_run_connection_manager_set_idle_exit() can
+ * make it adapt to how soon connections have been coming back, so that a CM
+ * whose accounts keep reconnecting stays running between reconnections
+ * instead of starting from scratch each time.
  */
 
 #include "config.h"
@@ -61,11 +65,30 @@
 #include <signal.h>
 #endif /* HAVE_SIGNAL_H */
 
+#define DIE_TIME 5000
+
 static GMainLoop *mainloop = NULL;
 static TpBaseConnectionManager *manager = NULL;
 static gboolean connections_exist = FALSE;
 static guint timeout_id = 0;
 
+/* bounds for the idle timeout, in milliseconds */
+static guint min_idle_time = DIE_TIME;
+static guint max_idle_time = DIE_TIME;
+/* monotonic time at which the last connection went away, or 0 if there
+ * are connections or there have never been any */
+static gint64 idle_since = 0;
+/* moving average of how long, in microseconds, it took for a connection to
+ * arrive after the last one went away, or 0 if that hasn't happened yet */
+static gint64 mean_idle_gap = 0;
+
+/* how long, in microseconds, each phase of the last startup took; only
+ * meaningful if startup_timed is TRUE */
+static gboolean startup_timed = FALSE;
+static gint64 startup_connect_time = 0;
+static gint64 startup_construct_time = 0;
+static gint64 startup_register_time = 0;
+
 static void
 quit_loop (void)
 {
@@ -93,6 +116,22 @@ new_connection (TpBaseConnectionManager *conn,
                 gchar *object_path,
                 gchar *proto)
 {
+  if (idle_since != 0)
+    {
+      gint64 gap = g_get_monotonic_time () - idle_since;
+
+      /* weight the latest gap by 1/4 */
+      if (mean_idle_gap == 0)
+        mean_idle_gap = gap;
+      else
+        mean_idle_gap += (gap - mean_idle_gap) / 4;
+
+      DEBUG ("%s connection arrived after %" G_GINT64_FORMAT " ms idle; "
+          "average now %" G_GINT64_FORMAT " ms", proto, gap / 1000,
+          mean_idle_gap / 1000);
+      idle_since = 0;
+    }
+
   connections_exist = TRUE;
 
   if (0 != timeout_id)
@@ -102,19 +141,37 @@ new_connection (TpBaseConnectionManager *conn,
     }
 }
 
-#define DIE_TIME 5000
+/* Stay up for twice as long as connections have recently taken to come
+ * back, so that the next one probably finds us still running. */
+static guint
+idle_time (void)
+{
+  gint64 t = mean_idle_gap / 1000 * 2;
+
+  if (t < min_idle_time)
+    return min_idle_time;
+
+  if (t > max_idle_time)
+    return max_idle_time;
+
+  return (guint) t;
+}
 
 static void
 no_more_connections (TpBaseConnectionManager *conn)
 {
+  guint t = idle_time ();
+
   connections_exist = FALSE;
+  idle_since = g_get_monotonic_time ();
 
   if (0 != timeout_id)
     {
       g_source_remove (timeout_id);
     }
 
-  timeout_id = g_timeout_add (DIE_TIME, kill_connection_manager, NULL);
+  DEBUG ("no more connections; exiting in %u ms unless one arrives", t);
+  timeout_id = g_timeout_add (t, kill_connection_manager, NULL);
 }
 
 #ifdef ENABLE_BACKTRACE
@@ -182,6 +239,120 @@ dbus_filter_function (DBusConnection *connection,
   return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
 }
 
+/**
+ * tp_run_connection_manager_set_idle_exit:
+ * @min_idle_ms: the shortest time to wait for a connection before exiting
+ * @max_idle_ms: the longest time to wait for a connection before exiting,
+ *  which must be at least @min_idle_ms
+ *
+ * Set how long tp_run_connection_manager() waits for a new connection,
+ * after startup or after the last connection goes away, before it exits.
+ * This must be called before tp_run_connection_manager().
+ *
+ * Starting a connection manager costs a process, the construction of its
+ * protocol objects and the registration of its bus name; while it stays
+ * running, new connections are requested from a "warm" connection manager
+ * that has already done all of that. Within these bounds, the connection
+ * manager waits for twice the recent average time that it has taken for a
+ * new connection to arrive after the last one went away, so a connection
+ * manager whose accounts keep disconnecting and reconnecting in bursts
+ * stays warm between them, while one whose connections rarely come back
+ * exits after @min_idle_ms. The first wait after startup is always
+ * @min_idle_ms.
+ *
+ * By default, both are 5 seconds. If the PERSIST debug flag is set, the
+ * connection manager never exits for lack of connections.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_run_connection_manager_set_idle_exit (guint min_idle_ms,
+    guint max_idle_ms)
+{
+  g_return_if_fail (min_idle_ms <= max_idle_ms);
+  g_return_if_fail (mainloop == NULL);
+
+  min_idle_time = min_idle_ms;
+  max_idle_time = max_idle_ms;
+}
+
+/**
+ * tp_run_connection_manager_get_startup_time:
+ * @connect_us: (out) (allow-none): used to return how long it took to
+ *  connect to D-Bus, in microseconds
+ * @construct_us: (out) (allow-none): used to return how long the
+ *  @construct_cm function passed to tp_run_connection_manager() took, in
+ *  microseconds
+ * @register_us: (out) (allow-none): used to return how long it took to
+ *  register the connection manager on D-Bus, in microseconds
+ *
+ * Return how long each phase of the most recent startup in
+ * tp_run_connection_manager() took, so that a connection manager can
+ * report or record its own startup cost, for instance via its Debug
+ * interface, without having to turn on the "manager" debug flag.
+ *
+ * Returns: %TRUE if the out parameters were set, or %FALSE if
+ *  tp_run_connection_manager() has not yet got as far as registering
+ *  the connection manager on D-Bus
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_run_connection_manager_get_startup_time (gint64 *connect_us,
+    gint64 *construct_us,
+    gint64 *register_us)
+{
+  if (!startup_timed)
+    return FALSE;
+
+  if (connect_us != NULL)
+    *connect_us = startup_connect_time;
+
+  if (construct_us != NULL)
+    *construct_us = startup_construct_time;
+
+  if (register_us != NULL)
+    *register_us = startup_register_time;
+
+  return TRUE;
+}
+
+static void
+set_n_shards_from_env (TpBaseConnectionManager *cm)
+{
+  const gchar *var = g_getenv ("TP_CM_SHARDS");
+  guint64 n_shards;
+  gchar *end;
+  GError *error = NULL;
+
+  if (var == NULL)
+    return;
+
+  n_shards = g_ascii_strtoull (var, &end, 10);
+
+  if (*var == '\0' || *end != '\0' || n_shards > G_MAXUINT)
+    {
+      WARNING ("ignoring TP_CM_SHARDS='%s': not a number of threads", var);
+      return;
+    }
+
+  if (tp_base_connection_manager_get_n_shards (cm) == 0)
+    {
+      WARNING ("ignoring TP_CM_SHARDS: this connection manager does not "
+          "use worker threads, so might not be thread-safe");
+      return;
+    }
+
+  if (!tp_base_connection_manager_set_n_shards (cm, n_shards, &error))
+    {
+      WARNING ("ignoring TP_CM_SHARDS: %s", error->message);
+      g_error_free (error);
+      return;
+    }
+
+  DEBUG ("using %u worker thread(s), from TP_CM_SHARDS", (guint) n_shards);
+}
+
 /**
  * tp_run_connection_manager:
  * @prog_name: The program name to be used in debug messages etc.
@@ -196,10 +367,28 @@ dbus_filter_function (DBusConnection *connection,
  * loop. When this function returns, the program should exit.
  *
  * If the connection manager does not create a connection within a
- * short arbitrary time (currently 5 seconds), either on startup or after
+ * short arbitrary time (5 seconds, unless changed with
+ * tp_run_connection_manager_set_idle_exit()), either on startup or after
  * the last open connection is disconnected, and the PERSIST debug
  * flag is not set, return 0.
  *
+ * With the "manager" debug flag, the time taken by each phase of startup
+ * is logged, along with how long the connection manager waited for each
+ * connection after it became idle; the "params" debug flag logs how long
+ * each RequestConnection call took, and whether it was the first. The
+ * startup timings are also available from
+ * tp_run_connection_manager_get_startup_time().
+ *
+ * If the connection manager object returned by @construct_cm uses worker
+ * threads for its connections (see
+ * tp_base_connection_manager_set_n_shards()), the environment variable
+ * <envar>TP_CM_SHARDS</envar> can be set to a number of threads to use
+ * instead, or to 0 to create every connection in the main thread. This
+ * lets the number of threads be tuned to a particular machine without
+ * rebuilding the connection manager. It is ignored, with a warning, if
+ * the connection manager does not use worker threads itself, since its
+ * protocols might not be thread-safe.
+ *
  * If registering the connection manager on D-Bus fails, return 1.
  *
  * Returns: the status code with which the process should exit
@@ -216,9 +405,17 @@ tp_run_connection_manager (const char *prog_name,
   TpDBusDaemon *bus_daemon = NULL;
   GError *error = NULL;
   int ret = 1;
+  gint64 started = g_get_monotonic_time ();
+  gint64 phase = started;
+  gint64 now;
 
   add_signal_handlers ();
 
+  startup_timed = FALSE;
+  connections_exist = FALSE;
+  idle_since = 0;
+  mean_idle_gap = 0;
+
   g_set_prgname (prog_name);
 
 #ifdef ENABLE_BACKTRACE
@@ -252,8 +449,22 @@ tp_run_connection_manager (const char *prog_name,
       goto out;
     }
 
+  now = g_get_monotonic_time ();
+  startup_connect_time = now - phase;
+  DEBUG ("startup: connected to D-Bus in %" G_GINT64_FORMAT " us",
+      startup_connect_time);
+  phase = now;
+
   manager = construct_cm ();
 
+  now = g_get_monotonic_time ();
+  startup_construct_time = now - phase;
+  DEBUG ("startup: constructed connection manager in %" G_GINT64_FORMAT
+      " us", startup_construct_time);
+  phase = now;
+
+  set_n_shards_from_env (manager);
+
   g_signal_connect (manager, "new-connection",
       (GCallback) new_connection, NULL);
 
@@ -276,10 +487,17 @@ tp_run_connection_manager (const char *prog_name,
       goto out;
     }
 
+  now = g_get_monotonic_time ();
+  startup_register_time = now - phase;
+  startup_timed = TRUE;
+  DEBUG ("startup: registered on D-Bus in %" G_GINT64_FORMAT " us; "
+      "%" G_GINT64_FORMAT " us in total", startup_register_time,
+      now - started);
+
   g_debug ("started version %s (telepathy-glib version %s)", version,
       VERSION);
 
-  timeout_id = g_timeout_add (DIE_TIME, kill_connection_manager, NULL);
+  timeout_id = g_timeout_add (min_idle_time, kill_connection_manager, NULL);
 
   g_main_loop_run (mainloop);
 
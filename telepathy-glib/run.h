@@ -32,6 +32,14 @@ G_BEGIN_DECLS
 int tp_run_connection_manager (const char *prog_name, const char *version,
     TpBaseConnectionManager *(*construct_cm) (void), int argc, char **argv);
 
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_run_connection_manager_set_idle_exit (guint min_idle_ms,
+    guint max_idle_ms);
+
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_run_connection_manager_get_startup_time (gint64 *connect_us,
+    gint64 *construct_us, gint64 *register_us);
+
 G_END_DECLS
 
 #endif
@@ -0,0 +1,53 @@
+/*<private_header>*/
+/* Main-loop stall detector - internal header
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef TP_STALL_DETECTOR_INTERNAL_H
+#define TP_STALL_DETECTOR_INTERNAL_H
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+typedef enum {
+    /* a method implemented by this process, via TpSvc */
+    TP_STALL_HANDLER_METHOD,
+    /* the callback for a method called by this process, via TpProxy */
+    TP_STALL_HANDLER_REPLY,
+    /* a signal callback, via TpProxy */
+    TP_STALL_HANDLER_SIGNAL
+} TpStallHandlerKind;
+
+typedef void (*TpStallReportFunc) (const gchar *report,
+    gpointer user_data);
+
+void _tp_stall_detector_start (guint threshold_ms,
+    TpStallReportFunc report,
+    gpointer user_data);
+void _tp_stall_detector_stop (void);
+
+gint64 _tp_stall_detector_now (void);
+void _tp_stall_detector_handler_finished (TpStallHandlerKind kind,
+    const gchar *iface,
+    const gchar *member,
+    gint64 started);
+
+G_END_DECLS
+
+#endif
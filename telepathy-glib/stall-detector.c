@@ -0,0 +1,267 @@
+/*
+ * stall-detector.c - find main loop iterations that take too long
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "config.h"
+
+#include "telepathy-glib/stall-detector-internal.h"
+
+#include <telepathy-glib/util.h>
+
+#define DEBUG_FLAG TP_DEBUG_MISC
+#include "telepathy-glib/debug-internal.h"
+
+/*
+ * The default main context's poll function is replaced by one that times
+ * how long it was since the previous poll returned: that is, how long the
+ * last iteration spent preparing, checking and dispatching sources. While
+ * an iteration runs, the D-Bus handlers that telepathy-glib calls report
+ * how long they took, and the longest is blamed if the iteration turns out
+ * to have been too long.
+ *
+ * Apart from @running, which handlers check from any thread, all of this
+ * is only used by the thread that iterates the default main context.
+ */
+
+static volatile gint running = FALSE;
+
+static GPollFunc chained_poll = NULL;
+static gint64 threshold = 0;
+static TpStallReportFunc report_func = NULL;
+static gpointer report_data = NULL;
+
+/* the thread that last polled the default main context */
+static GThread *loop_thread = NULL;
+/* when the current iteration started, or 0 if we haven't polled yet */
+static gint64 iteration_started = 0;
+
+/* the handlers that have run during the current iteration */
+static guint n_handlers = 0;
+static gint64 handlers_total = 0;
+static gint64 longest_handler = 0;
+static gchar *longest_handler_desc = NULL;
+
+static void
+iteration_reset (void)
+{
+  n_handlers = 0;
+  handlers_total = 0;
+  longest_handler = 0;
+  tp_clear_pointer (&longest_handler_desc, g_free);
+}
+
+static void
+report_stall (gint64 elapsed)
+{
+  gchar *report;
+
+  if (n_handlers == 0)
+    {
+      report = g_strdup_printf ("Main loop iteration took %" G_GINT64_FORMAT
+          " ms (threshold %" G_GINT64_FORMAT " ms); no D-Bus method or "
+          "signal handler ran during it", elapsed / 1000, threshold / 1000);
+    }
+  else
+    {
+      report = g_strdup_printf ("Main loop iteration took %" G_GINT64_FORMAT
+          " ms (threshold %" G_GINT64_FORMAT " ms); the longest handler was "
+          "%s, taking %" G_GINT64_FORMAT " ms; %u handler(s) took %"
+          G_GINT64_FORMAT " ms in total", elapsed / 1000, threshold / 1000,
+          longest_handler_desc, longest_handler / 1000, n_handlers,
+          handlers_total / 1000);
+    }
+
+  DEBUG ("%s", report);
+  report_func (report, report_data);
+  g_free (report);
+}
+
+static gint
+stall_detector_poll (GPollFD *fds,
+    guint nfds,
+    gint timeout)
+{
+  gint ret;
+
+  loop_thread = g_thread_self ();
+
+  if (iteration_started != 0 && g_atomic_int_get (&running))
+    {
+      gint64 elapsed = g_get_monotonic_time () - iteration_started;
+
+      if (elapsed >= threshold)
+        {
+          report_stall (elapsed);
+          /* reporting might have added sources that this iteration didn't
+           * prepare, so don't sleep until they have been */
+          timeout = 0;
+        }
+    }
+
+  iteration_reset ();
+  ret = chained_poll (fds, nfds, timeout);
+  iteration_started = g_get_monotonic_time ();
+
+  return ret;
+}
+
+/*
+ * _tp_stall_detector_start:
+ * @threshold_ms: report iterations that take at least this long
+ * @report: called with a description of each such iteration, from the
+ *  main loop but not from a #GSource
+ * @user_data: passed to @report
+ *
+ * Start timing iterations of the default main context, or change the
+ * threshold and report function if it is already being timed. This must be
+ * called by the thread that iterates it.
+ */
+void
+_tp_stall_detector_start (guint threshold_ms,
+    TpStallReportFunc report,
+    gpointer user_data)
+{
+  GMainContext *context = g_main_context_default ();
+
+  threshold = (gint64) threshold_ms * 1000;
+  report_func = report;
+  report_data = user_data;
+
+  if (!g_atomic_int_get (&running))
+    {
+      chained_poll = g_main_context_get_poll_func (context);
+      g_main_context_set_poll_func (context, stall_detector_poll);
+      iteration_started = 0;
+      iteration_reset ();
+      g_atomic_int_set (&running, TRUE);
+    }
+
+  DEBUG ("reporting main loop iterations longer than %u ms", threshold_ms);
+}
+
+/*
+ * _tp_stall_detector_stop:
+ *
+ * Stop timing the default main context. This must be called by the thread
+ * that iterates it.
+ */
+void
+_tp_stall_detector_stop (void)
+{
+  GMainContext *context = g_main_context_default ();
+
+  if (!g_atomic_int_get (&running))
+    return;
+
+  g_atomic_int_set (&running, FALSE);
+
+  /* if someone else has replaced our poll function in the meantime, they
+   * are presumably calling it, so it has to keep working */
+  if (g_main_context_get_poll_func (context) == stall_detector_poll)
+    g_main_context_set_poll_func (context, chained_poll);
+
+  report_func = NULL;
+  report_data = NULL;
+  iteration_reset ();
+
+  DEBUG ("stopped timing main loop iterations");
+}
+
+/*
+ * _tp_stall_detector_now:
+ *
+ * Returns: the current monotonic time to pass to
+ *  _tp_stall_detector_handler_finished() after a handler has run, or 0 if
+ *  there is no need to call it
+ */
+gint64
+_tp_stall_detector_now (void)
+{
+  if (!g_atomic_int_get (&running))
+    return 0;
+
+  return g_get_monotonic_time ();
+}
+
+/*
+ * _tp_stall_detector_handler_finished:
+ * @kind: what sort of handler it was
+ * @iface: (allow-none): the D-Bus interface it handled
+ * @member: the D-Bus method or signal it handled
+ * @started: when it started
+ *
+ * Note that a D-Bus handler has run, in case it was responsible for a
+ * stall. This may be called from any thread, but only handlers run by the
+ * thread that iterates the default main context are counted.
+ */
+void
+_tp_stall_detector_handler_finished (TpStallHandlerKind kind,
+    const gchar *iface,
+    const gchar *member,
+    gint64 started)
+{
+  gint64 elapsed;
+  GSource *source;
+  gchar *source_desc;
+  const gchar *what;
+
+  if (!g_atomic_int_get (&running) || started == 0 ||
+      g_thread_self () != loop_thread)
+    return;
+
+  elapsed = g_get_monotonic_time () - started;
+  n_handlers++;
+  handlers_total += elapsed;
+
+  if (elapsed <= longest_handler && longest_handler_desc != NULL)
+    return;
+
+  switch (kind)
+    {
+      case TP_STALL_HANDLER_METHOD:
+        what = "method";
+        break;
+      case TP_STALL_HANDLER_REPLY:
+        what = "reply callback for";
+        break;
+      case TP_STALL_HANDLER_SIGNAL:
+        what = "signal callback for";
+        break;
+      default:
+        g_return_if_reached ();
+    }
+
+  source = g_main_current_source ();
+
+  if (source == NULL)
+    source_desc = g_strdup ("outside any GSource");
+  else if (g_source_get_name (source) != NULL)
+    source_desc = g_strdup_printf ("in GSource '%s'",
+        g_source_get_name (source));
+  else
+    source_desc = g_strdup_printf ("in an unnamed GSource of priority %d",
+        g_source_get_priority (source));
+
+  g_free (longest_handler_desc);
+  longest_handler = elapsed;
+  longest_handler_desc = g_strdup_printf ("%s %s%s%s %s", what,
+      iface == NULL ? "" : iface, iface == NULL ? "" : ".", member,
+      source_desc);
+  g_free (source_desc);
+}
@@ -0,0 +1,58 @@
+/*<private_header>*/
+/* Relaying data between two streams - internal header
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef TP_STREAM_RELAY_INTERNAL_H
+#define TP_STREAM_RELAY_INTERNAL_H
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+typedef enum {
+    TP_STREAM_RELAY_FROM_REMOTE = 0,
+    TP_STREAM_RELAY_TO_REMOTE = 1,
+    TP_STREAM_RELAY_N_DIRECTIONS
+} TpStreamRelayDirection;
+
+typedef struct {
+    /* bytes written to the destination */
+    guint64 bytes[TP_STREAM_RELAY_N_DIRECTIONS];
+    /* how many times the relay's buffer was emptied, and how long the
+     * oldest byte in it had been waiting each time, in microseconds */
+    guint64 drains[TP_STREAM_RELAY_N_DIRECTIONS];
+    gint64 total_latency[TP_STREAM_RELAY_N_DIRECTIONS];
+    gint64 max_latency[TP_STREAM_RELAY_N_DIRECTIONS];
+} TpStreamRelayStats;
+
+void _tp_stream_relay_async (gpointer source_object,
+    GIOStream *remote,
+    GIOStream *local,
+    gsize buffer_size,
+    TpStreamRelayStats *stats,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean _tp_stream_relay_finish (GAsyncResult *result,
+    GError **error);
+
+G_END_DECLS
+
+#endif
@@ -0,0 +1,636 @@
+/*
+ * stream-relay.c - relaying data between two streams
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "config.h"
+
+/* for splice(), pipe2() and F_SETPIPE_SZ */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "telepathy-glib/stream-relay-internal.h"
+
+#include <telepathy-glib/util.h>
+
+#if defined (HAVE_GIO_UNIX) && defined (HAVE_SPLICE)
+#define USE_SPLICE
+#endif
+
+#ifdef USE_SPLICE
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define DEBUG_FLAG TP_DEBUG_CHANNEL
+#include "telepathy-glib/debug-internal.h"
+
+/*
+ * A relay copies everything read from one stream to the other, in both
+ * directions, until both have reached the end of the stream. Each
+ * direction is handled by a RelayHalf, which holds at most buffer_size
+ * bytes which have been read from its source but not yet written to its
+ * destination. While that buffer is full nothing more is read, so a slow
+ * reader at one end makes the writer at the other end wait rather than
+ * making the relay's memory use grow.
+ *
+ * If both streams are stream sockets on Linux, the buffer is a pipe: data
+ * is moved from one socket into the pipe and from the pipe to the other
+ * socket with splice(), without being copied into userspace. Otherwise it
+ * is an ordinary buffer filled and emptied with asynchronous GIO calls.
+ * Either way, everything happens in the main context which was the
+ * thread-default when the relay was started.
+ */
+
+#define DEFAULT_BUFFER_SIZE (64 * 1024)
+
+/* how many times a splice()ing half moves data before letting the main
+ * loop run again, so that one busy connection can't starve the others */
+#define MAX_SPLICE_ROUNDS 16
+
+typedef struct _Relay Relay;
+
+typedef struct {
+    Relay *relay;
+    TpStreamRelayDirection direction;
+    GIOStream *from;
+    GIOStream *to;
+
+    /* bytes read from @from but not yet written to @to */
+    gsize pending;
+    /* when the oldest of those was read */
+    gint64 filled_at;
+
+    gboolean use_splice;
+    /* for splice(): the buffer is a pipe */
+    GSocket *in_socket;
+    GSocket *out_socket;
+    gint pipe_fds[2];
+    gsize capacity;
+    gboolean eof;
+    GSource *source;
+
+    /* for GIO: bytes of @buffer already written to @to */
+    guchar *buffer;
+    gsize written;
+
+    gboolean done;
+} RelayHalf;
+
+struct _Relay {
+    GTask *task;
+    GIOStream *remote;
+    GIOStream *local;
+    TpStreamRelayStats *stats;
+    gsize buffer_size;
+    RelayHalf halves[TP_STREAM_RELAY_N_DIRECTIONS];
+
+    /* cancelled if either half fails, or the caller cancels */
+    GCancellable *cancellable;
+    GCancellable *caller_cancellable;
+    gulong cancelled_id;
+
+    guint n_done;
+    GError *error;
+};
+
+static void
+relay_free (gpointer p)
+{
+  Relay *relay = p;
+  guint i;
+
+  for (i = 0; i < TP_STREAM_RELAY_N_DIRECTIONS; i++)
+    {
+      RelayHalf *half = &relay->halves[i];
+
+      g_assert (half->source == NULL);
+
+#ifdef USE_SPLICE
+      if (half->use_splice)
+        {
+          close (half->pipe_fds[0]);
+          close (half->pipe_fds[1]);
+        }
+#endif
+
+      g_free (half->buffer);
+    }
+
+  g_object_unref (relay->remote);
+  g_object_unref (relay->local);
+
+  if (relay->cancelled_id != 0)
+    g_cancellable_disconnect (relay->caller_cancellable, relay->cancelled_id);
+
+  tp_clear_object (&relay->caller_cancellable);
+  g_object_unref (relay->cancellable);
+  g_clear_error (&relay->error);
+  g_slice_free (Relay, relay);
+}
+
+static void
+relay_cancelled_cb (GCancellable *caller_cancellable,
+    gpointer user_data)
+{
+  g_cancellable_cancel (user_data);
+}
+
+static void
+relay_return (Relay *relay)
+{
+  GTask *task = relay->task;
+
+  relay->task = NULL;
+
+  DEBUG ("relayed %" G_GUINT64_FORMAT " bytes from the remote end and %"
+      G_GUINT64_FORMAT " to it",
+      relay->stats->bytes[TP_STREAM_RELAY_FROM_REMOTE],
+      relay->stats->bytes[TP_STREAM_RELAY_TO_REMOTE]);
+
+  /* both directions have finished with the streams */
+  g_io_stream_close (relay->remote, NULL, NULL);
+  g_io_stream_close (relay->local, NULL, NULL);
+
+  if (relay->error != NULL)
+    {
+      GError *error = relay->error;
+
+      relay->error = NULL;
+      g_task_return_error (task, error);
+    }
+  else
+    {
+      g_task_return_boolean (task, TRUE);
+    }
+
+  g_object_unref (task);
+}
+
+static void
+shut_down_output (GIOStream *stream)
+{
+  GError *error = NULL;
+  gboolean ok;
+
+  /* Closing a socket connection's output stream doesn't tell the other end
+   * anything, so shut down the socket for writing instead */
+  if (G_IS_SOCKET_CONNECTION (stream))
+    ok = g_socket_shutdown (
+        g_socket_connection_get_socket (G_SOCKET_CONNECTION (stream)),
+        FALSE, TRUE, &error);
+  else
+    ok = g_output_stream_close (g_io_stream_get_output_stream (stream), NULL,
+        &error);
+
+  if (!ok)
+    {
+      DEBUG ("failed to shut down output: %s", error->message);
+      g_clear_error (&error);
+    }
+}
+
+/* Takes ownership of @error, if not %NULL. */
+static void
+relay_half_finished (RelayHalf *half,
+    GError *error)
+{
+  Relay *relay = half->relay;
+
+  g_assert (!half->done);
+  half->done = TRUE;
+
+  if (half->source != NULL)
+    {
+      g_source_destroy (half->source);
+      tp_clear_pointer (&half->source, g_source_unref);
+    }
+
+  if (error != NULL)
+    {
+      DEBUG ("relaying %s the remote end failed: %s",
+          half->direction == TP_STREAM_RELAY_FROM_REMOTE ? "from" : "to",
+          error->message);
+
+      if (relay->error == NULL)
+        relay->error = error;
+      else
+        g_error_free (error);
+
+      /* stop the other direction too */
+      g_cancellable_cancel (relay->cancellable);
+    }
+  else
+    {
+      /* pass on the end of the stream */
+      shut_down_output (half->to);
+    }
+
+  relay->n_done++;
+
+  if (relay->n_done == TP_STREAM_RELAY_N_DIRECTIONS)
+    relay_return (relay);
+}
+
+static void
+relay_half_drained (RelayHalf *half)
+{
+  TpStreamRelayStats *stats = half->relay->stats;
+  gint64 latency = g_get_monotonic_time () - half->filled_at;
+
+  stats->drains[half->direction]++;
+  stats->total_latency[half->direction] += latency;
+
+  if (latency > stats->max_latency[half->direction])
+    stats->max_latency[half->direction] = latency;
+}
+
+#ifdef USE_SPLICE
+
+static void relay_half_splice (RelayHalf *half);
+
+static gboolean
+relay_half_ready_cb (GSocket *socket,
+    GIOCondition condition,
+    gpointer user_data)
+{
+  RelayHalf *half = user_data;
+
+  tp_clear_pointer (&half->source, g_source_unref);
+  relay_half_splice (half);
+  return FALSE;
+}
+
+static void
+relay_half_wait (RelayHalf *half,
+    GSocket *socket,
+    GIOCondition condition)
+{
+  g_assert (half->source == NULL);
+
+  half->source = g_socket_create_source (socket, condition,
+      half->relay->cancellable);
+  g_source_set_callback (half->source, (GSourceFunc) relay_half_ready_cb,
+      half, NULL);
+  g_source_attach (half->source, g_task_get_context (half->relay->task));
+}
+
+static GError *
+splice_error (gint saved_errno)
+{
+  return g_error_new (G_IO_ERROR, g_io_error_from_errno (saved_errno),
+      "splice() failed: %s", g_strerror (saved_errno));
+}
+
+static void
+relay_half_splice (RelayHalf *half)
+{
+  gint in_fd = g_socket_get_fd (half->in_socket);
+  gint out_fd = g_socket_get_fd (half->out_socket);
+  GError *error = NULL;
+  guint rounds;
+
+  if (g_cancellable_set_error_if_cancelled (half->relay->cancellable,
+        &error))
+    {
+      relay_half_finished (half, error);
+      return;
+    }
+
+  for (rounds = 0; rounds < MAX_SPLICE_ROUNDS; rounds++)
+    {
+      gboolean progress = FALSE;
+      gssize n;
+
+      /* once the pipe is full, leave the data in the source's socket
+       * buffer, so that the sender has to wait */
+      if (!half->eof && half->pending < half->capacity)
+        {
+          n = splice (in_fd, NULL, half->pipe_fds[1], NULL,
+              half->capacity - half->pending,
+              SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+
+          if (n > 0)
+            {
+              if (half->pending == 0)
+                half->filled_at = g_get_monotonic_time ();
+
+              half->pending += n;
+              progress = TRUE;
+            }
+          else if (n == 0)
+            {
+              half->eof = TRUE;
+              progress = TRUE;
+            }
+          else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+              relay_half_finished (half, splice_error (errno));
+              return;
+            }
+        }
+
+      if (half->pending > 0)
+        {
+          n = splice (half->pipe_fds[0], NULL, out_fd, NULL, half->pending,
+              SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+
+          if (n > 0)
+            {
+              half->pending -= n;
+              half->relay->stats->bytes[half->direction] += n;
+
+              if (half->pending == 0)
+                relay_half_drained (half);
+
+              progress = TRUE;
+            }
+          else if (n < 0 &&
+              errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+              relay_half_finished (half, splice_error (errno));
+              return;
+            }
+        }
+
+      if (half->eof && half->pending == 0)
+        {
+          relay_half_finished (half, NULL);
+          return;
+        }
+
+      if (!progress)
+        break;
+    }
+
+  /* If there's anything in the pipe we couldn't write, wait until we can;
+   * otherwise wait for something to read. If we ran out of rounds, one of
+   * these is ready already, and we'll carry on in the next main loop
+   * iteration. */
+  if (half->pending > 0)
+    relay_half_wait (half, half->out_socket, G_IO_OUT);
+  else
+    relay_half_wait (half, half->in_socket, G_IO_IN);
+}
+
+static gboolean
+relay_half_setup_splice (RelayHalf *half)
+{
+  GSocket *in_socket, *out_socket;
+
+  if (!G_IS_SOCKET_CONNECTION (half->from) ||
+      !G_IS_SOCKET_CONNECTION (half->to))
+    return FALSE;
+
+  in_socket = g_socket_connection_get_socket (
+      G_SOCKET_CONNECTION (half->from));
+  out_socket = g_socket_connection_get_socket (
+      G_SOCKET_CONNECTION (half->to));
+
+  if (g_socket_get_socket_type (in_socket) != G_SOCKET_TYPE_STREAM ||
+      g_socket_get_socket_type (out_socket) != G_SOCKET_TYPE_STREAM)
+    return FALSE;
+
+  if (pipe2 (half->pipe_fds, O_CLOEXEC | O_NONBLOCK) != 0)
+    {
+      DEBUG ("pipe2() failed, copying instead: %s", g_strerror (errno));
+      return FALSE;
+    }
+
+  half->capacity = DEFAULT_BUFFER_SIZE;
+
+#ifdef F_SETPIPE_SZ
+    {
+      gint size;
+
+      /* this may fail for sizes above /proc/sys/fs/pipe-max-size, in which
+       * case we make do with whatever the pipe has */
+      fcntl (half->pipe_fds[1], F_SETPIPE_SZ,
+          (gint) MIN (half->relay->buffer_size, G_MAXINT));
+      size = fcntl (half->pipe_fds[1], F_GETPIPE_SZ);
+
+      if (size > 0)
+        half->capacity = size;
+    }
+#endif
+
+  half->in_socket = in_socket;
+  half->out_socket = out_socket;
+  return TRUE;
+}
+
+#endif /* USE_SPLICE */
+
+static void relay_half_read (RelayHalf *half);
+
+static void
+relay_half_write_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data);
+
+static void
+relay_half_write (RelayHalf *half)
+{
+  g_output_stream_write_async (g_io_stream_get_output_stream (half->to),
+      half->buffer + half->written, half->pending - half->written,
+      G_PRIORITY_DEFAULT, half->relay->cancellable, relay_half_write_cb,
+      half);
+}
+
+static void
+relay_half_write_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  RelayHalf *half = user_data;
+  GError *error = NULL;
+  gssize n;
+
+  n = g_output_stream_write_finish (G_OUTPUT_STREAM (source), result,
+      &error);
+
+  if (n < 0)
+    {
+      relay_half_finished (half, error);
+      return;
+    }
+
+  half->written += n;
+  half->relay->stats->bytes[half->direction] += n;
+
+  if (half->written < half->pending)
+    {
+      relay_half_write (half);
+      return;
+    }
+
+  relay_half_drained (half);
+  half->pending = 0;
+  half->written = 0;
+  relay_half_read (half);
+}
+
+static void
+relay_half_read_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  RelayHalf *half = user_data;
+  GError *error = NULL;
+  gssize n;
+
+  n = g_input_stream_read_finish (G_INPUT_STREAM (source), result, &error);
+
+  if (n < 0)
+    {
+      relay_half_finished (half, error);
+    }
+  else if (n == 0)
+    {
+      relay_half_finished (half, NULL);
+    }
+  else
+    {
+      half->filled_at = g_get_monotonic_time ();
+      half->pending = n;
+      relay_half_write (half);
+    }
+}
+
+static void
+relay_half_read (RelayHalf *half)
+{
+  /* the next read isn't started until everything from this one has been
+   * written */
+  g_input_stream_read_async (g_io_stream_get_input_stream (half->from),
+      half->buffer, half->relay->buffer_size, G_PRIORITY_DEFAULT,
+      half->relay->cancellable, relay_half_read_cb, half);
+}
+
+static void
+relay_half_start (Relay *relay,
+    TpStreamRelayDirection direction)
+{
+  RelayHalf *half = &relay->halves[direction];
+
+  half->relay = relay;
+  half->direction = direction;
+
+  if (direction == TP_STREAM_RELAY_FROM_REMOTE)
+    {
+      half->from = relay->remote;
+      half->to = relay->local;
+    }
+  else
+    {
+      half->from = relay->local;
+      half->to = relay->remote;
+    }
+
+#ifdef USE_SPLICE
+  half->use_splice = relay_half_setup_splice (half);
+
+  if (half->use_splice)
+    {
+      DEBUG ("splicing %s the remote end through a %" G_GSIZE_FORMAT
+          "-byte pipe",
+          direction == TP_STREAM_RELAY_FROM_REMOTE ? "from" : "to",
+          half->capacity);
+      relay_half_splice (half);
+      return;
+    }
+#endif
+
+  half->buffer = g_malloc (relay->buffer_size);
+  relay_half_read (half);
+}
+
+/*
+ * _tp_stream_relay_async:
+ * @source_object: the object on whose behalf this is done
+ * @remote: a stream connected to the remote end, such as a tube's
+ *  #GSocketConnection
+ * @local: a stream connected to a local endpoint
+ * @buffer_size: the maximum number of bytes which have been read but not yet
+ *  written in each direction, or 0 for a default
+ * @stats: statistics to be updated as data is relayed, which must remain
+ *  valid until @callback has been called; typically part of @source_object
+ * @cancellable: (allow-none): optional #GCancellable object
+ * @callback: called when both directions have reached the end of the
+ *  stream, or either has failed
+ * @user_data: data to pass to @callback
+ *
+ * Copy everything read from @remote to @local, and vice versa. When either
+ * reaches the end of the stream, the other is shut down for writing; when
+ * both have, or on error, both streams are closed.
+ */
+void
+_tp_stream_relay_async (gpointer source_object,
+    GIOStream *remote,
+    GIOStream *local,
+    gsize buffer_size,
+    TpStreamRelayStats *stats,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  Relay *relay;
+
+  g_return_if_fail (G_IS_IO_STREAM (remote));
+  g_return_if_fail (G_IS_IO_STREAM (local));
+  g_return_if_fail (stats != NULL);
+
+  relay = g_slice_new0 (Relay);
+  relay->task = g_task_new (source_object, cancellable, callback, user_data);
+  g_task_set_task_data (relay->task, relay, relay_free);
+
+  relay->remote = g_object_ref (remote);
+  relay->local = g_object_ref (local);
+  relay->stats = stats;
+  relay->buffer_size = (buffer_size > 0 ? buffer_size : DEFAULT_BUFFER_SIZE);
+  relay->cancellable = g_cancellable_new ();
+
+  if (cancellable != NULL)
+    {
+      relay->caller_cancellable = g_object_ref (cancellable);
+      relay->cancelled_id = g_cancellable_connect (cancellable,
+          G_CALLBACK (relay_cancelled_cb), g_object_ref (relay->cancellable),
+          g_object_unref);
+    }
+
+  relay_half_start (relay, TP_STREAM_RELAY_FROM_REMOTE);
+  relay_half_start (relay, TP_STREAM_RELAY_TO_REMOTE);
+}
+
+/*
+ * _tp_stream_relay_finish:
+ * @result: the result passed to the callback
+ * @error: used to return an error
+ *
+ * Returns: %TRUE if both directions reached the end of the stream
+ */
+gboolean
+_tp_stream_relay_finish (GAsyncResult *result,
+    GError **error)
+{
+  g_return_val_if_fail (G_IS_TASK (result), FALSE);
+
+  return g_task_propagate_boolean (G_TASK (result), error);
+}
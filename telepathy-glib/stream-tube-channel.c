@@ -53,6 +53,7 @@
 #include <telepathy-glib/dbus.h>
 #include <telepathy-glib/enums.h>
 #include <telepathy-glib/gnio-util.h>
+#include <telepathy-glib/gnio-util-internal.h>
 #include <telepathy-glib/gtypes.h>
 #include <telepathy-glib/interfaces.h>
 #include <telepathy-glib/proxy-subclass.h>
@@ -657,20 +658,18 @@ new_local_connection_identified (TpStreamTubeChannel *self,
 
 #ifdef HAVE_GIO_UNIX
 static void
-send_credentials_cb (GObject *source,
-    GAsyncResult *result,
+send_credentials_cb (GSocketConnection *conn,
+    const GError *error,
     gpointer user_data)
 {
   TpStreamTubeChannel *self = user_data;
-  GError *error = NULL;
 
-  if (!tp_unix_connection_send_credentials_with_byte_finish (
-          (GSocketConnection *) source, result, &error))
+  if (error != NULL)
     {
       DEBUG ("Failed to send credentials: %s", error->message);
 
-      operation_failed (self, error);
-      g_clear_error (&error);
+      if (self->priv->result != NULL)
+        operation_failed (self, error);
     }
 }
 #endif
@@ -690,10 +689,23 @@ client_socket_connected (TpStreamTubeChannel *self)
   if (self->priv->access_control == TP_SOCKET_ACCESS_CONTROL_CREDENTIALS)
     {
       guchar byte;
+      GOutputVector vector;
 
       byte = g_value_get_uchar (self->priv->access_control_param);
-      tp_unix_connection_send_credentials_with_byte_async (conn, byte, NULL,
-          send_credentials_cb, self);
+      vector.buffer = &byte;
+      vector.size = 1;
+
+      /* The byte and our credentials usually fit in the socket's buffer,
+       * in which case they are sent straight away, with one sendmsg() */
+      _tp_unix_connection_send_message_async (conn, &vector, 1, NULL, 0, TRUE,
+          NULL, send_credentials_cb, self);
+
+      if (self->priv->result == NULL)
+        {
+          /* sending failed and the operation was completed */
+          g_object_unref (conn);
+          return;
+        }
     }
 #endif
 
@@ -1351,29 +1363,47 @@ credentials_received (TpStreamTubeChannel *self,
 }
 
 #ifdef HAVE_GIO_UNIX
+typedef struct
+{
+  TpStreamTubeChannel *self;
+  /* the byte is received straight into this */
+  guchar byte;
+} ReceiveCredentialsData;
+
 static void
-receive_credentials_cb (GObject *source,
-    GAsyncResult *result,
+receive_credentials_cb (GSocketConnection *conn,
+    gsize len,
+    GUnixFDList *fds,
+    GCredentials *creds,
+    const GError *error,
     gpointer user_data)
 {
-  TpStreamTubeChannel *self = user_data;
-  GSocketConnection *conn = (GSocketConnection *) source;
-  GCredentials *creds;
-  guchar byte;
+  ReceiveCredentialsData *data = user_data;
+  TpStreamTubeChannel *self = data->self;
+  guchar byte = data->byte;
   uid_t uid;
-  GError *error = NULL;
 
-  creds = tp_unix_connection_receive_credentials_with_byte_finish (conn, result,
-      &byte, &error);
+  g_slice_free (ReceiveCredentialsData, data);
 
-  if (creds == NULL)
+  if (error != NULL)
     {
       DEBUG ("Failed to receive credentials: %s", error->message);
-      g_error_free (error);
       return;
     }
 
-  uid = g_credentials_get_unix_user (creds, &error);
+  if (len != 1)
+    {
+      DEBUG ("Connection closed before receiving the byte");
+      return;
+    }
+
+  if (creds == NULL)
+    {
+      DEBUG ("No credentials received with the byte");
+      return;
+    }
+
+  uid = g_credentials_get_unix_user (creds, NULL);
   if (uid != geteuid ())
     {
       DEBUG ("Wrong credentials received (user: %u)", uid);
@@ -1381,8 +1411,6 @@ receive_credentials_cb (GObject *source,
     }
 
   credentials_received (self, conn, byte);
-
-  g_object_unref (creds);
 }
 #endif
 
@@ -1400,8 +1428,17 @@ service_incoming_cb (GSocketService *service,
   /* Check the credentials if needed */
   if (self->priv->access_control == TP_SOCKET_ACCESS_CONTROL_CREDENTIALS)
     {
-      tp_unix_connection_receive_credentials_with_byte_async (conn, NULL,
-          receive_credentials_cb, self);
+      ReceiveCredentialsData *data = g_slice_new (ReceiveCredentialsData);
+      GInputVector vector;
+
+      data->self = self;
+      vector.buffer = &data->byte;
+      vector.size = 1;
+
+      /* If the peer has already sent its byte, this is a single recvmsg()
+       * and receive_credentials_cb is called straight away */
+      _tp_unix_connection_receive_message_async (conn, &vector, 1, TRUE, NULL,
+          receive_credentials_cb, data);
       return;
     }
 #endif
@@ -49,10 +49,13 @@
 #include "telepathy-glib/stream-tube-connection-internal.h"
 #include "telepathy-glib/stream-tube-connection.h"
 
+#include <telepathy-glib/errors.h>
 #include <telepathy-glib/util.h>
 
 #define DEBUG_FLAG TP_DEBUG_CHANNEL
 #include "telepathy-glib/debug-internal.h"
+#include "telepathy-glib/stream-relay-internal.h"
+#include "telepathy-glib/util-internal.h"
 
 struct _TpStreamTubeConnectionClass {
     /*<private>*/
@@ -84,6 +87,9 @@ struct _TpStreamTubeConnectionPrivate
    * on us */
   TpStreamTubeChannel *channel;
   TpContact *contact;
+
+  gboolean relaying;
+  TpStreamRelayStats relay_stats;
 };
 
 static void
@@ -333,3 +339,152 @@ _tp_stream_tube_connection_fire_closed (TpStreamTubeConnection *self,
 {
   g_signal_emit (self, _signals[CLOSED], 0, error);
 }
+
+static void
+relay_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  GSimpleAsyncResult *simple = user_data;
+  GError *error = NULL;
+
+  if (!_tp_stream_relay_finish (result, &error))
+    g_simple_async_result_take_error (simple, error);
+
+  g_simple_async_result_complete (simple);
+  g_object_unref (simple);
+}
+
+/**
+ * tp_stream_tube_connection_relay_async:
+ * @self: a #TpStreamTubeConnection
+ * @local: a #GIOStream connected to a local endpoint, such as a
+ *  #GSocketConnection returned by g_socket_client_connect()
+ * @buffer_size: the largest number of bytes which may have been read but
+ *  not yet written in each direction, or 0 for a default
+ * @cancellable: (allow-none): optional #GCancellable object
+ * @callback: a callback to call when the relay has finished
+ * @user_data: data to pass to @callback
+ *
+ * Relay everything received through the tube connection to @local, and
+ * everything received from @local through the tube, instead of reading
+ * and writing #TpStreamTubeConnection:socket-connection yourself. For
+ * example, a handler for an incoming tube can connect to the local service
+ * it provides access to, and relay between that and each
+ * #TpStreamTubeConnection returned by tp_stream_tube_channel_accept_async().
+ *
+ * When one side reaches the end of the stream, the other is shut down for
+ * writing. Once both have, or if either fails, both
+ * #TpStreamTubeConnection:socket-connection and @local are closed and
+ * @callback is called; call tp_stream_tube_connection_relay_finish() to get
+ * the result.
+ *
+ * Each direction holds at most @buffer_size bytes; while one side isn't
+ * reading, the relay stops reading from the other. If both sides are
+ * stream sockets, on Linux the data is moved with splice() without being
+ * copied through userspace.
+ *
+ * tp_stream_tube_connection_get_relay_stats() reports how much has been
+ * relayed so far.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_stream_tube_connection_relay_async (TpStreamTubeConnection *self,
+    GIOStream *local,
+    gsize buffer_size,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  GSimpleAsyncResult *simple;
+
+  g_return_if_fail (TP_IS_STREAM_TUBE_CONNECTION (self));
+  g_return_if_fail (G_IS_IO_STREAM (local));
+
+  if (self->priv->relaying)
+    {
+      g_simple_async_report_error_in_idle (G_OBJECT (self), callback,
+          user_data, TP_ERROR, TP_ERROR_NOT_AVAILABLE,
+          "This connection is already being relayed");
+      return;
+    }
+
+  self->priv->relaying = TRUE;
+
+  simple = g_simple_async_result_new (G_OBJECT (self), callback, user_data,
+      tp_stream_tube_connection_relay_async);
+
+  _tp_stream_relay_async (self, G_IO_STREAM (self->priv->socket_connection),
+      local, buffer_size, &self->priv->relay_stats, cancellable, relay_cb,
+      simple);
+}
+
+/**
+ * tp_stream_tube_connection_relay_finish:
+ * @self: a #TpStreamTubeConnection
+ * @result: a #GAsyncResult
+ * @error: a #GError to fill
+ *
+ * Finishes a call to tp_stream_tube_connection_relay_async().
+ *
+ * Returns: %TRUE if both sides reached the end of the stream, or %FALSE
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_stream_tube_connection_relay_finish (TpStreamTubeConnection *self,
+    GAsyncResult *result,
+    GError **error)
+{
+  _tp_implement_finish_void (self, tp_stream_tube_connection_relay_async)
+}
+
+/**
+ * tp_stream_tube_connection_get_relay_stats:
+ * @self: a #TpStreamTubeConnection
+ * @bytes_received: (out) (allow-none): used to return the number of bytes
+ *  relayed from the tube to the local endpoint
+ * @bytes_sent: (out) (allow-none): used to return the number of bytes
+ *  relayed from the local endpoint to the tube
+ * @mean_latency: (out) (allow-none): used to return the mean time, in
+ *  microseconds, between the relay reading data and finishing writing it,
+ *  in both directions, or 0 if nothing has been relayed
+ * @max_latency: (out) (allow-none): used to return the longest such time
+ *
+ * Report statistics about tp_stream_tube_connection_relay_async(). These
+ * remain available after the relay has finished.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_stream_tube_connection_get_relay_stats (TpStreamTubeConnection *self,
+    guint64 *bytes_received,
+    guint64 *bytes_sent,
+    gint64 *mean_latency,
+    gint64 *max_latency)
+{
+  TpStreamRelayStats *stats;
+  guint64 drains;
+
+  g_return_if_fail (TP_IS_STREAM_TUBE_CONNECTION (self));
+
+  stats = &self->priv->relay_stats;
+  drains = stats->drains[TP_STREAM_RELAY_FROM_REMOTE] +
+      stats->drains[TP_STREAM_RELAY_TO_REMOTE];
+
+  if (bytes_received != NULL)
+    *bytes_received = stats->bytes[TP_STREAM_RELAY_FROM_REMOTE];
+
+  if (bytes_sent != NULL)
+    *bytes_sent = stats->bytes[TP_STREAM_RELAY_TO_REMOTE];
+
+  if (mean_latency != NULL)
+    *mean_latency = (drains == 0 ? 0 :
+        (stats->total_latency[TP_STREAM_RELAY_FROM_REMOTE] +
+         stats->total_latency[TP_STREAM_RELAY_TO_REMOTE]) / (gint64) drains);
+
+  if (max_latency != NULL)
+    *max_latency = MAX (stats->max_latency[TP_STREAM_RELAY_FROM_REMOTE],
+        stats->max_latency[TP_STREAM_RELAY_TO_REMOTE]);
+}
@@ -29,6 +29,7 @@
 #include <gio/gio.h>
 
 #include <telepathy-glib/contact.h>
+#include <telepathy-glib/defs.h>
 #include <telepathy-glib/stream-tube-channel.h>
 
 G_BEGIN_DECLS
@@ -65,6 +66,27 @@ TpStreamTubeChannel * tp_stream_tube_connection_get_channel (
 TpContact * tp_stream_tube_connection_get_contact (
     TpStreamTubeConnection *self);
 
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_stream_tube_connection_relay_async (TpStreamTubeConnection *self,
+    GIOStream *local,
+    gsize buffer_size,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_stream_tube_connection_relay_finish (
+    TpStreamTubeConnection *self,
+    GAsyncResult *result,
+    GError **error);
+
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_stream_tube_connection_get_relay_stats (TpStreamTubeConnection *self,
+    guint64 *bytes_received,
+    guint64 *bytes_sent,
+    gint64 *mean_latency,
+    gint64 *max_latency);
+
 G_END_DECLS
 
 #endif
@@ -36,6 +36,7 @@
 #include <telepathy-glib/account-request.h>
 #include <telepathy-glib/account.h>
 #include <telepathy-glib/add-dispatch-operation-context.h>
+#include <telepathy-glib/allocation-statistics.h>
 #include <telepathy-glib/automatic-client-factory.h>
 #include <telepathy-glib/base-call-channel.h>
 #include <telepathy-glib/base-call-content.h>
@@ -60,6 +61,7 @@
 #include <telepathy-glib/capabilities.h>
 #include <telepathy-glib/channel-dispatch-operation.h>
 #include <telepathy-glib/channel-dispatcher.h>
+#include <telepathy-glib/channel-filter-set.h>
 #include <telepathy-glib/channel-iface.h>
 #include <telepathy-glib/channel-manager.h>
 #include <telepathy-glib/channel-request.h>
@@ -94,6 +96,7 @@
 #include <telepathy-glib/media-interfaces.h>
 #include <telepathy-glib/message.h>
 #include <telepathy-glib/message-mixin.h>
+#include <telepathy-glib/method-statistics.h>
 #include <telepathy-glib/observe-channels-context.h>
 #include <telepathy-glib/presence-mixin.h>
 #include <telepathy-glib/protocol.h>
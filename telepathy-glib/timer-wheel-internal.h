@@ -0,0 +1,64 @@
+/*<private_header>*/
+/* Shared timer wheel - internal header
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef TP_TIMER_WHEEL_INTERNAL_H
+#define TP_TIMER_WHEEL_INTERNAL_H
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+typedef void (*TpTimerFunc) (gpointer user_data);
+
+typedef struct _TpTimer TpTimer;
+
+/* Embed one of these in the object that needs a timer: scheduling and
+ * cancelling it don't allocate anything. */
+struct _TpTimer {
+    /* the other timers in the same slot of the wheel, or NULL if this timer
+     * is not scheduled */
+    TpTimer *prev;
+    TpTimer *next;
+    /* in ticks (milliseconds) of the wheel's clock */
+    guint64 expires;
+    /* the wheel of the thread that scheduled this timer */
+    gpointer wheel;
+    TpTimerFunc callback;
+    gpointer user_data;
+};
+
+void _tp_timer_init (TpTimer *timer,
+    TpTimerFunc callback,
+    gpointer user_data);
+
+void _tp_timer_schedule (TpTimer *timer,
+    guint interval_ms);
+
+void _tp_timer_cancel (TpTimer *timer);
+
+#define _tp_timer_is_scheduled(timer) ((timer)->next != NULL)
+
+void _tp_timer_wheel_bind (GMainContext *context);
+
+void _tp_timer_wheel_release (void);
+
+G_END_DECLS
+
+#endif
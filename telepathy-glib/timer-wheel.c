@@ -0,0 +1,472 @@
+/*
+ * timer-wheel.c - per-thread hierarchical timer wheels
+ *
+ * Copyright © 2026 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "config.h"
+
+#include "telepathy-glib/timer-wheel-internal.h"
+
+/*
+ * Objects that would otherwise each have a g_timeout_add() running, such as
+ * TpDTMFPlayer (of which a gateway CM might have thousands), share a single
+ * GSource instead. Each thread has its own wheel. The worker threads of a
+ * sharded TpBaseConnectionManager bind theirs to their own main context
+ * when they start, with _tp_timer_wheel_bind(), so connections there get
+ * their timers in their own thread; in any other thread the wheel is
+ * attached to the global default main context, like g_timeout_add(), even
+ * if another context has been pushed as thread-default in the meantime.
+ *
+ * The wheel counts time in ticks of one millisecond, the same resolution as
+ * g_timeout_add(). It has N_LEVELS levels of LEVEL_SIZE slots: level 0 has
+ * one slot per tick, level 1 one per LEVEL_SIZE ticks and so on. A timer
+ * goes into the lowest level whose range covers it, which takes constant
+ * time; each time a level's slot comes round, the timers in it are placed
+ * again in the levels below ("cascaded"). Each slot is a circular list with
+ * a sentinel, so cancelling a timer is just unlinking it.
+ *
+ * A timer must be scheduled and cancelled in the same thread.
+ */
+
+#define LEVEL_BITS 6
+#define LEVEL_SIZE (1 << LEVEL_BITS)
+#define LEVEL_MASK (LEVEL_SIZE - 1)
+#define N_LEVELS 4
+
+/* Timers further than this in the future (about 4.6 hours) are parked in
+ * the top level, and moved on each time it turns round. */
+#define MAX_DELTA ((G_GUINT64_CONSTANT (1) << (LEVEL_BITS * N_LEVELS)) - 1)
+
+typedef struct {
+    GSource source;
+    /* monotonic time of tick 0, in microseconds */
+    gint64 epoch;
+    /* every timer that expires at or before this tick has been fired */
+    guint64 now;
+    /* the tick at which the source is due to be dispatched, or G_MAXUINT64 */
+    guint64 wakeup;
+    guint n_timers;
+    gboolean dispatching;
+    TpTimer slots[N_LEVELS][LEVEL_SIZE];
+} TimerWheel;
+
+static guint64
+current_tick (TimerWheel *wheel,
+    gboolean round_up)
+{
+  gint64 elapsed = g_get_monotonic_time () - wheel->epoch;
+
+  if (round_up)
+    elapsed += 999;
+
+  return elapsed / 1000;
+}
+
+static void
+set_wakeup (TimerWheel *wheel,
+    guint64 tick)
+{
+  wheel->wakeup = tick;
+
+  if (tick == G_MAXUINT64)
+    g_source_set_ready_time ((GSource *) wheel, -1);
+  else
+    g_source_set_ready_time ((GSource *) wheel,
+        wheel->epoch + (gint64) tick * 1000);
+}
+
+static void
+timer_link (TpTimer *head,
+    TpTimer *timer)
+{
+  timer->next = head;
+  timer->prev = head->prev;
+  head->prev->next = timer;
+  head->prev = timer;
+}
+
+static void
+timer_unlink (TpTimer *timer)
+{
+  timer->prev->next = timer->next;
+  timer->next->prev = timer->prev;
+  timer->prev = NULL;
+  timer->next = NULL;
+}
+
+static void
+place (TimerWheel *wheel,
+    TpTimer *timer)
+{
+  guint64 at = timer->expires;
+  guint64 delta;
+  guint level;
+
+  g_assert (at >= wheel->now);
+
+  if (at - wheel->now > MAX_DELTA)
+    at = wheel->now + MAX_DELTA;
+
+  delta = at - wheel->now;
+
+  for (level = 0; level < N_LEVELS - 1; level++)
+    {
+      if (delta < (G_GUINT64_CONSTANT (1) << (LEVEL_BITS * (level + 1))))
+        break;
+    }
+
+  timer_link (
+      &wheel->slots[level][(at >> (LEVEL_BITS * level)) & LEVEL_MASK],
+      timer);
+}
+
+static gboolean
+slot_is_empty (TpTimer *head)
+{
+  return head->next == head;
+}
+
+/* Returns the first tick after wheel->now at which a timer might fire or an
+ * occupied slot needs cascading, or G_MAXUINT64 if there are no timers. A
+ * long timer therefore only wakes the wheel once per level it passes
+ * through, rather than every time level 0 turns round. */
+static guint64
+next_event (TimerWheel *wheel)
+{
+  guint64 next = G_MAXUINT64;
+  guint level, i;
+  guint64 t;
+
+  if (wheel->n_timers == 0)
+    return G_MAXUINT64;
+
+  /* every timer in level 0 expires in the next LEVEL_SIZE - 1 ticks */
+  for (t = wheel->now + 1; t < wheel->now + LEVEL_SIZE; t++)
+    {
+      if (!slot_is_empty (&wheel->slots[0][t & LEVEL_MASK]))
+        {
+          next = t;
+          break;
+        }
+    }
+
+  /* slot i of a higher level is cascaded at the next tick whose bits for
+   * that level are i and whose lower bits are all 0 */
+  for (level = 1; level < N_LEVELS; level++)
+    {
+      guint shift = LEVEL_BITS * level;
+      guint64 base = wheel->now >> shift;
+
+      for (i = 0; i < LEVEL_SIZE; i++)
+        {
+          guint64 round;
+
+          if (slot_is_empty (&wheel->slots[level][i]))
+            continue;
+
+          round = (base & ~(guint64) LEVEL_MASK) | i;
+
+          if (round <= base)
+            round += LEVEL_SIZE;
+
+          next = MIN (next, round << shift);
+        }
+    }
+
+  return next;
+}
+
+static void
+cascade (TimerWheel *wheel,
+    guint level)
+{
+  TpTimer *head = &wheel->slots[level][
+      (wheel->now >> (LEVEL_BITS * level)) & LEVEL_MASK];
+  TpTimer *timer = head->next;
+
+  head->next = head;
+  head->prev = head;
+
+  while (timer != head)
+    {
+      TpTimer *next = timer->next;
+
+      place (wheel, timer);
+      timer = next;
+    }
+}
+
+static void
+run_tick (TimerWheel *wheel)
+{
+  TpTimer *head;
+  guint level;
+
+  /* find the highest level whose slot has just come round, and move its
+   * timers down, level by level */
+  for (level = 1; level < N_LEVELS; level++)
+    {
+      if ((wheel->now & ((G_GUINT64_CONSTANT (1) << (LEVEL_BITS * level)) - 1))
+          != 0)
+        break;
+    }
+
+  while (--level > 0)
+    cascade (wheel, level);
+
+  /* Everything in this slot expires now. Callbacks can schedule or cancel
+   * any timer, but a timer scheduled now can't expire in this tick. */
+  head = &wheel->slots[0][wheel->now & LEVEL_MASK];
+
+  while (!slot_is_empty (head))
+    {
+      TpTimer *timer = head->next;
+
+      timer_unlink (timer);
+      wheel->n_timers--;
+      timer->callback (timer->user_data);
+    }
+}
+
+static gboolean
+timer_wheel_dispatch (GSource *source,
+    GSourceFunc callback,
+    gpointer user_data)
+{
+  TimerWheel *wheel = (TimerWheel *) source;
+  guint64 target = current_tick (wheel, FALSE);
+
+  wheel->dispatching = TRUE;
+
+  /* nothing happens between events, so skip straight to the next one */
+  while (wheel->now < target)
+    {
+      guint64 next = next_event (wheel);
+
+      if (next > target)
+        {
+          wheel->now = target;
+          break;
+        }
+
+      wheel->now = next;
+      run_tick (wheel);
+    }
+
+  wheel->dispatching = FALSE;
+  set_wakeup (wheel, next_event (wheel));
+
+  return G_SOURCE_CONTINUE;
+}
+
+static GSourceFuncs timer_wheel_funcs = {
+    NULL,
+    NULL,
+    timer_wheel_dispatch,
+    NULL
+};
+
+static void
+timer_wheel_destroy (gpointer data)
+{
+  TimerWheel *wheel = data;
+  guint level, i;
+
+  /* Whoever owns these timers can no longer cancel them safely, and they
+   * would never fire; unlink them, so that they merely look unscheduled. */
+  if (wheel->n_timers > 0)
+    {
+      g_critical ("%u timer(s) still scheduled when their thread's timer "
+          "wheel was destroyed", wheel->n_timers);
+
+      for (level = 0; level < N_LEVELS; level++)
+        {
+          for (i = 0; i < LEVEL_SIZE; i++)
+            {
+              TpTimer *head = &wheel->slots[level][i];
+
+              while (!slot_is_empty (head))
+                {
+                  TpTimer *timer = head->next;
+
+                  timer_unlink (timer);
+                  timer->wheel = NULL;
+                }
+            }
+        }
+
+      wheel->n_timers = 0;
+    }
+
+  g_source_destroy (data);
+  g_source_unref (data);
+}
+
+static GPrivate thread_wheel = G_PRIVATE_INIT (timer_wheel_destroy);
+
+static TimerWheel *
+timer_wheel_new (GMainContext *context)
+{
+  GSource *source = g_source_new (&timer_wheel_funcs, sizeof (TimerWheel));
+  TimerWheel *w = (TimerWheel *) source;
+  guint level, i;
+
+  for (level = 0; level < N_LEVELS; level++)
+    {
+      for (i = 0; i < LEVEL_SIZE; i++)
+        {
+          w->slots[level][i].next = &w->slots[level][i];
+          w->slots[level][i].prev = &w->slots[level][i];
+        }
+    }
+
+  w->epoch = g_get_monotonic_time ();
+  w->wakeup = G_MAXUINT64;
+
+  g_source_set_name (source, "TpTimerWheel");
+  g_source_set_ready_time (source, -1);
+  /* the wheel lasts until its thread exits or releases it, so keep our
+   * reference */
+  g_source_attach (source, context);
+
+  return w;
+}
+
+static TimerWheel *
+get_wheel (void)
+{
+  TimerWheel *w = g_private_get (&thread_wheel);
+
+  if (w == NULL)
+    {
+      w = timer_wheel_new (g_main_context_default ());
+      g_private_set (&thread_wheel, w);
+    }
+
+  return w;
+}
+
+/*
+ * _tp_timer_wheel_bind:
+ * @context: the main context that this thread will run
+ *
+ * Give this thread a timer wheel attached to @context, instead of the
+ * global default main context. This must be called before the thread
+ * schedules any timers, and undone with _tp_timer_wheel_release() before
+ * @context stops being iterated.
+ */
+void
+_tp_timer_wheel_bind (GMainContext *context)
+{
+  g_return_if_fail (context != NULL);
+  g_return_if_fail (g_private_get (&thread_wheel) == NULL);
+
+  g_private_set (&thread_wheel, timer_wheel_new (context));
+}
+
+/*
+ * _tp_timer_wheel_release:
+ *
+ * Destroy this thread's timer wheel, if it has one. No timers may be
+ * scheduled in this thread at the time.
+ */
+void
+_tp_timer_wheel_release (void)
+{
+  g_private_replace (&thread_wheel, NULL);
+}
+
+/*
+ * _tp_timer_init:
+ * @timer: a timer, usually embedded in another structure
+ * @callback: called when @timer expires
+ * @user_data: passed to @callback
+ *
+ * Initialize @timer, which is not scheduled.
+ */
+void
+_tp_timer_init (TpTimer *timer,
+    TpTimerFunc callback,
+    gpointer user_data)
+{
+  timer->prev = NULL;
+  timer->next = NULL;
+  timer->expires = 0;
+  timer->wheel = NULL;
+  timer->callback = callback;
+  timer->user_data = user_data;
+}
+
+/*
+ * _tp_timer_schedule:
+ * @timer: a timer that is not already scheduled
+ * @interval_ms: the time to wait
+ *
+ * Arrange for @timer's callback to be called once from this thread's
+ * default main context, no sooner than @interval_ms milliseconds from now;
+ * this is the same guarantee as g_timeout_add(). Timers that expire in the
+ * same millisecond are called in the order they were scheduled.
+ */
+void
+_tp_timer_schedule (TpTimer *timer,
+    guint interval_ms)
+{
+  TimerWheel *wheel = get_wheel ();
+
+  g_return_if_fail (timer->callback != NULL);
+  g_return_if_fail (!_tp_timer_is_scheduled (timer));
+
+  /* If the wheel has been idle, its clock may be well behind; since there
+   * is nothing to fire, it can be brought up to date for free. */
+  if (wheel->n_timers == 0 && !wheel->dispatching)
+    wheel->now = current_tick (wheel, FALSE);
+
+  timer->expires = current_tick (wheel, TRUE) + interval_ms;
+
+  /* a timer can't be put into the slot that's being fired or has just been
+   * fired */
+  if (timer->expires <= wheel->now)
+    timer->expires = wheel->now + 1;
+
+  timer->wheel = wheel;
+  place (wheel, timer);
+  wheel->n_timers++;
+
+  /* Waking up when this timer expires is always early enough, even if it
+   * has to be cascaded first: the dispatch catches up with every event up
+   * to then. While dispatching, the next wakeup is worked out afterwards. */
+  if (!wheel->dispatching && timer->expires < wheel->wakeup)
+    set_wakeup (wheel, timer->expires);
+}
+
+/*
+ * _tp_timer_cancel:
+ * @timer: a timer
+ *
+ * If @timer is scheduled, stop it from expiring. Otherwise do nothing.
+ */
+void
+_tp_timer_cancel (TpTimer *timer)
+{
+  if (!_tp_timer_is_scheduled (timer))
+    return;
+
+  timer_unlink (timer);
+  /* the wheel might wake up for nothing, which is harmless */
+  ((TimerWheel *) timer->wheel)->n_timers--;
+}
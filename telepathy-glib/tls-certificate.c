@@ -23,6 +23,8 @@
 #include <config.h>
 #include "telepathy-glib/tls-certificate.h"
 
+#include <string.h>
+
 #include <glib/gstdio.h>
 
 #include <telepathy-glib/_gen/tp-cli-tls-cert.h>
@@ -90,6 +92,8 @@ struct _TpTLSCertificatePrivate {
   GPtrArray *rejections;
   /* GPtrArray of TP_STRUCT_TYPE_TLS_CERTIFICATE_REJECTION to send to CM */
   GPtrArray *pending_rejections;
+  /* SHA-256 of the type and chain, as hex, for the verification cache */
+  gchar *fingerprint;
 };
 
 G_DEFINE_TYPE (TpTLSCertificate, tp_tls_certificate,
@@ -198,6 +202,36 @@ tp_tls_certificate_rejected_cb (TpTLSCertificate *self,
   g_object_notify ((GObject *) self, "state");
 }
 
+static gchar *
+chain_fingerprint (TpTLSCertificate *self)
+{
+  GChecksum *checksum = g_checksum_new (G_CHECKSUM_SHA256);
+  const gchar *type = tp_str_empty (self->priv->cert_type) ? "" :
+      self->priv->cert_type;
+  gchar *ret;
+  guint i;
+
+  /* include the terminating NUL, and each certificate's length, so that
+   * different chains can't hash the same bytes */
+  g_checksum_update (checksum, (const guchar *) type, strlen (type) + 1);
+
+  for (i = 0; i < self->priv->cert_data->len; i++)
+    {
+      GBytes *bytes = g_ptr_array_index (self->priv->cert_data, i);
+      gsize size;
+      gconstpointer data = g_bytes_get_data (bytes, &size);
+      guint32 be_size = GUINT32_TO_BE (size);
+
+      g_checksum_update (checksum, (const guchar *) &be_size,
+          sizeof (be_size));
+      g_checksum_update (checksum, data, size);
+    }
+
+  ret = g_strdup (g_checksum_get_string (checksum));
+  g_checksum_free (checksum);
+  return ret;
+}
+
 static void
 tls_certificate_got_all_cb (TpProxy *proxy,
     GHashTable *properties,
@@ -275,6 +309,8 @@ tls_certificate_got_all_cb (TpProxy *proxy,
       g_ptr_array_add (self->priv->cert_data, bytes);
     }
 
+  self->priv->fingerprint = chain_fingerprint (self);
+
   DEBUG ("Got a certificate chain long %u, of type %s",
       self->priv->cert_data->len, self->priv->cert_type);
 
@@ -347,6 +383,7 @@ tp_tls_certificate_finalize (GObject *object)
 
   tp_clear_pointer (&self->priv->rejections, g_ptr_array_unref);
   g_free (priv->cert_type);
+  g_free (priv->fingerprint);
   if (priv->cert_data != NULL)
     g_ptr_array_unref (priv->cert_data);
   tp_clear_boxed (TP_ARRAY_TYPE_TLS_CERTIFICATE_REJECTION_LIST,
@@ -807,6 +844,290 @@ tp_tls_certificate_reject_finish (TpTLSCertificate *self,
   _tp_implement_finish_void (self, tp_tls_certificate_reject_async)
 }
 
+/*
+ * Verification results, shared by every TpTLSCertificate in the process, so
+ * that a handler that sees the same chain again (typically because an
+ * account is reconnecting) doesn't have to parse and verify it again.
+ */
+typedef struct {
+    /* monotonic time after which this result is not used, in microseconds */
+    gint64 expires;
+    /* owned TP_ARRAY_TYPE_TLS_CERTIFICATE_REJECTION_LIST, or NULL if the
+     * chain was accepted */
+    GPtrArray *rejections;
+} CachedVerification;
+
+#define DEFAULT_VERIFICATION_TTL 300
+#define MAX_CACHED_VERIFICATIONS 256
+
+G_LOCK_DEFINE_STATIC (verification_cache);
+/* owned "fingerprint hostname" => owned CachedVerification */
+static GHashTable *verification_cache = NULL;
+static guint verification_ttl = DEFAULT_VERIFICATION_TTL;
+
+static void
+cached_verification_free (gpointer p)
+{
+  CachedVerification *cached = p;
+
+  tp_clear_boxed (TP_ARRAY_TYPE_TLS_CERTIFICATE_REJECTION_LIST,
+      &cached->rejections);
+  g_slice_free (CachedVerification, cached);
+}
+
+static gchar *
+verification_key (TpTLSCertificate *self,
+    const gchar *hostname)
+{
+  gchar *lower = g_ascii_strdown (hostname, -1);
+  gchar *key = g_strdup_printf ("%s %s", self->priv->fingerprint, lower);
+
+  g_free (lower);
+  return key;
+}
+
+/* called with the lock held; makes room for one more entry */
+static void
+verification_cache_make_room (gint64 now)
+{
+  GHashTableIter iter;
+  gpointer key, value;
+  gpointer soonest = NULL;
+  gint64 soonest_expiry = G_MAXINT64;
+
+  if (g_hash_table_size (verification_cache) < MAX_CACHED_VERIFICATIONS)
+    return;
+
+  g_hash_table_iter_init (&iter, verification_cache);
+
+  while (g_hash_table_iter_next (&iter, &key, &value))
+    {
+      CachedVerification *cached = value;
+
+      if (cached->expires <= now)
+        {
+          g_hash_table_iter_remove (&iter);
+        }
+      else if (cached->expires < soonest_expiry)
+        {
+          soonest = key;
+          soonest_expiry = cached->expires;
+        }
+    }
+
+  if (g_hash_table_size (verification_cache) >= MAX_CACHED_VERIFICATIONS)
+    g_hash_table_remove (verification_cache, soonest);
+}
+
+/**
+ * tp_tls_certificate_cache_verification:
+ * @self: a TLS certificate with %TP_TLS_CERTIFICATE_FEATURE_CORE prepared
+ * @hostname: the name that the chain was verified for, usually the
+ *  Hostname property of the ServerTLSConnection channel
+ * @accepted: %TRUE if the chain was found to be acceptable, %FALSE if it
+ *  was rejected
+ *
+ * Remember the outcome of verifying @self for @hostname, so that
+ * tp_tls_certificate_lookup_verification() can return it for the same
+ * certificate chain, presented again for the same host, until the
+ * verification cache's time limit (see
+ * tp_tls_certificate_set_verification_ttl()) runs out or the trust store
+ * changes (see tp_tls_certificate_invalidate_verifications()).
+ *
+ * Call this after deciding whether to accept @self. If @accepted is %FALSE,
+ * the rejections added by tp_tls_certificate_add_rejection() are remembered,
+ * so this must be called before tp_tls_certificate_reject_async(), which uses
+ * them up. If @accepted is %TRUE, no rejections may have been added, and
+ * @self must not already have been rejected; otherwise, nothing is
+ * remembered, and a critical warning is logged.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_tls_certificate_cache_verification (TpTLSCertificate *self,
+    const gchar *hostname,
+    gboolean accepted)
+{
+  CachedVerification *cached;
+  gboolean has_rejections;
+  gint64 now;
+
+  g_return_if_fail (TP_IS_TLS_CERTIFICATE (self));
+  g_return_if_fail (hostname != NULL);
+  g_return_if_fail (self->priv->fingerprint != NULL);
+
+  has_rejections = (self->priv->pending_rejections != NULL &&
+      self->priv->pending_rejections->len > 0);
+
+  /* never remember a chain as acceptable by mistake */
+  if (accepted)
+    {
+      g_return_if_fail (!has_rejections);
+      g_return_if_fail (self->priv->state !=
+          TP_TLS_CERTIFICATE_STATE_REJECTED);
+    }
+  else
+    {
+      g_return_if_fail (has_rejections);
+    }
+
+  G_LOCK (verification_cache);
+
+  if (verification_ttl == 0)
+    goto finally;
+
+  if (verification_cache == NULL)
+    verification_cache = g_hash_table_new_full (g_str_hash, g_str_equal,
+        g_free, cached_verification_free);
+
+  now = g_get_monotonic_time ();
+  verification_cache_make_room (now);
+
+  cached = g_slice_new0 (CachedVerification);
+  cached->expires = now + (gint64) verification_ttl * G_USEC_PER_SEC;
+
+  if (!accepted)
+    cached->rejections = g_boxed_copy (
+        TP_ARRAY_TYPE_TLS_CERTIFICATE_REJECTION_LIST,
+        self->priv->pending_rejections);
+
+  DEBUG ("Remembering that %s was %s for %s", self->priv->fingerprint,
+      cached->rejections == NULL ? "accepted" : "rejected", hostname);
+
+  g_hash_table_replace (verification_cache,
+      verification_key (self, hostname), cached);
+
+finally:
+  G_UNLOCK (verification_cache);
+}
+
+/**
+ * tp_tls_certificate_lookup_verification:
+ * @self: a TLS certificate with %TP_TLS_CERTIFICATE_FEATURE_CORE prepared
+ * @hostname: the name that the chain is being verified for
+ * @accepted: (out): set to %TRUE if the chain was accepted, or %FALSE if it
+ *  was rejected
+ *
+ * Look for a result for @self's certificate chain and @hostname, recorded
+ * with tp_tls_certificate_cache_verification(), so that verifying the same
+ * chain again can be skipped.
+ *
+ * If the chain was rejected, the rejections that were recorded are added
+ * to @self, as if by tp_tls_certificate_add_rejection(), so the caller
+ * only needs to call tp_tls_certificate_reject_async(). If it was accepted,
+ * the caller should call tp_tls_certificate_accept_async().
+ *
+ * Returns: %TRUE if a result was found and @accepted was set, or %FALSE if
+ *  the chain needs to be verified
+ *
+ * Since: 0.UNRELEASED
+ */
+gboolean
+tp_tls_certificate_lookup_verification (TpTLSCertificate *self,
+    const gchar *hostname,
+    gboolean *accepted)
+{
+  CachedVerification *cached = NULL;
+  gchar *key;
+  gboolean found = FALSE;
+  gboolean was_accepted = FALSE;
+
+  g_return_val_if_fail (TP_IS_TLS_CERTIFICATE (self), FALSE);
+  g_return_val_if_fail (hostname != NULL, FALSE);
+  g_return_val_if_fail (self->priv->fingerprint != NULL, FALSE);
+
+  key = verification_key (self, hostname);
+
+  G_LOCK (verification_cache);
+
+  if (verification_cache != NULL)
+    cached = g_hash_table_lookup (verification_cache, key);
+
+  if (cached != NULL && cached->expires <= g_get_monotonic_time ())
+    {
+      g_hash_table_remove (verification_cache, key);
+      cached = NULL;
+    }
+
+  if (cached != NULL)
+    {
+      found = TRUE;
+      was_accepted = (cached->rejections == NULL);
+
+      if (cached->rejections != NULL)
+        {
+          guint i;
+
+          if (self->priv->pending_rejections == NULL)
+            self->priv->pending_rejections = g_ptr_array_new ();
+
+          for (i = 0; i < cached->rejections->len; i++)
+            g_ptr_array_add (self->priv->pending_rejections,
+                g_boxed_copy (TP_STRUCT_TYPE_TLS_CERTIFICATE_REJECTION,
+                  g_ptr_array_index (cached->rejections, i)));
+        }
+    }
+
+  G_UNLOCK (verification_cache);
+
+  DEBUG ("%s for %s: %s", self->priv->fingerprint, hostname,
+      !found ? "not cached" : was_accepted ? "accepted" : "rejected");
+
+  if (found && accepted != NULL)
+    *accepted = was_accepted;
+
+  g_free (key);
+  return found;
+}
+
+/**
+ * tp_tls_certificate_set_verification_ttl:
+ * @seconds: how long results recorded by
+ *  tp_tls_certificate_cache_verification() should be used for, or 0 to
+ *  stop recording them and forget those already recorded
+ *
+ * Set how long verification results are cached for. The default is
+ * 5 minutes, which is long enough to cover all the accounts reconnecting
+ * after a network outage, but short enough that a revoked certificate
+ * won't be accepted for long. Results that were already recorded keep
+ * their original time limit.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_tls_certificate_set_verification_ttl (guint seconds)
+{
+  G_LOCK (verification_cache);
+
+  verification_ttl = seconds;
+
+  if (seconds == 0 && verification_cache != NULL)
+    g_hash_table_remove_all (verification_cache);
+
+  G_UNLOCK (verification_cache);
+}
+
+/**
+ * tp_tls_certificate_invalidate_verifications:
+ *
+ * Forget every result recorded by tp_tls_certificate_cache_verification().
+ * Call this whenever the set of trusted certificate authorities, or any
+ * other input to verification such as a list of pinned certificates,
+ * changes.
+ *
+ * Since: 0.UNRELEASED
+ */
+void
+tp_tls_certificate_invalidate_verifications (void)
+{
+  G_LOCK (verification_cache);
+
+  if (verification_cache != NULL)
+    g_hash_table_remove_all (verification_cache);
+
+  G_UNLOCK (verification_cache);
+}
+
 #include <telepathy-glib/_gen/tp-cli-tls-cert-body.h>
 
 /**
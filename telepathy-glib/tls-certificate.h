@@ -116,6 +116,19 @@ gboolean tp_tls_certificate_reject_finish (TpTLSCertificate *self,
     GAsyncResult *result,
     GError **error);
 
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_tls_certificate_cache_verification (TpTLSCertificate *self,
+    const gchar *hostname,
+    gboolean accepted);
+_TP_AVAILABLE_IN_UNRELEASED
+gboolean tp_tls_certificate_lookup_verification (TpTLSCertificate *self,
+    const gchar *hostname,
+    gboolean *accepted);
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_tls_certificate_set_verification_ttl (guint seconds);
+_TP_AVAILABLE_IN_UNRELEASED
+void tp_tls_certificate_invalidate_verifications (void);
+
 _TP_AVAILABLE_IN_0_20
 void tp_tls_certificate_init_known_interfaces (void);
 
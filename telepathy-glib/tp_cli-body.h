@@ -0,0 +1,11810 @@
+/* We don't want gtkdoc scanning this file, it'll get
+ * confused by seeing function definitions, so mark it as: */
+/*<private_header>*/
+
+static inline void
+/tmp/rv/old_add_signals_for_connection (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "SelfHandleChanged",
+      G_TYPE_UINT,
+      G_TYPE_INVALID);
+  dbus_g_proxy_add_signal (proxy, "SelfContactChanged",
+      G_TYPE_UINT,
+      G_TYPE_STRING,
+      G_TYPE_INVALID);
+  dbus_g_proxy_add_signal (proxy, "NewChannel",
+      DBUS_TYPE_G_OBJECT_PATH,
+      G_TYPE_STRING,
+      G_TYPE_UINT,
+      G_TYPE_UINT,
+      G_TYPE_BOOLEAN,
+      G_TYPE_INVALID);
+  dbus_g_proxy_add_signal (proxy, "ConnectionError",
+      G_TYPE_STRING,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)),
+      G_TYPE_INVALID);
+  dbus_g_proxy_add_signal (proxy, "StatusChanged",
+      G_TYPE_UINT,
+      G_TYPE_UINT,
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_args_of_self_handle_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    guint arg_Self_Handle,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, arg_Self_Handle);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_for_self_handle_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_signal_callback_self_handle_changed callback =
+      (/tmp/rv/old_connection_signal_callback_self_handle_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_uint (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_connect_to_self_handle_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_signal_callback_self_handle_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      G_TYPE_UINT,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION, "SelfHandleChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_collect_args_of_self_handle_changed),
+      _/tmp/rv/old_connection_invoke_callback_for_self_handle_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_collect_args_of_self_contact_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    guint arg_Self_Handle,
+    const gchar *arg_Self_ID,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (2);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, arg_Self_Handle);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, G_TYPE_STRING);
+  g_value_set_string (args->values + 1, arg_Self_ID);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_for_self_contact_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_signal_callback_self_contact_changed callback =
+      (/tmp/rv/old_connection_signal_callback_self_contact_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_uint (args->values + 0),
+      g_value_get_string (args->values + 1),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_connect_to_self_contact_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_signal_callback_self_contact_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[3] = {
+      G_TYPE_UINT,
+      G_TYPE_STRING,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION, "SelfContactChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_collect_args_of_self_contact_changed),
+      _/tmp/rv/old_connection_invoke_callback_for_self_contact_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_collect_args_of_new_channel (DBusGProxy *proxy G_GNUC_UNUSED,
+    const gchar *arg_Object_Path,
+    const gchar *arg_Channel_Type,
+    guint arg_Handle_Type,
+    guint arg_Handle,
+    gboolean arg_Suppress_Handler,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (5);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 5; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, DBUS_TYPE_G_OBJECT_PATH);
+  g_value_set_boxed (args->values + 0, arg_Object_Path);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, G_TYPE_STRING);
+  g_value_set_string (args->values + 1, arg_Channel_Type);
+
+  g_value_unset (args->values + 2);
+  g_value_init (args->values + 2, G_TYPE_UINT);
+  g_value_set_uint (args->values + 2, arg_Handle_Type);
+
+  g_value_unset (args->values + 3);
+  g_value_init (args->values + 3, G_TYPE_UINT);
+  g_value_set_uint (args->values + 3, arg_Handle);
+
+  g_value_unset (args->values + 4);
+  g_value_init (args->values + 4, G_TYPE_BOOLEAN);
+  g_value_set_boolean (args->values + 4, arg_Suppress_Handler);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_for_new_channel (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_signal_callback_new_channel callback =
+      (/tmp/rv/old_connection_signal_callback_new_channel) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      g_value_get_string (args->values + 1),
+      g_value_get_uint (args->values + 2),
+      g_value_get_uint (args->values + 3),
+      g_value_get_boolean (args->values + 4),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_connect_to_new_channel (TpConnection *proxy,
+    /tmp/rv/old_connection_signal_callback_new_channel callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[6] = {
+      DBUS_TYPE_G_OBJECT_PATH,
+      G_TYPE_STRING,
+      G_TYPE_UINT,
+      G_TYPE_UINT,
+      G_TYPE_BOOLEAN,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION, "NewChannel",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_collect_args_of_new_channel),
+      _/tmp/rv/old_connection_invoke_callback_for_new_channel,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_collect_args_of_connection_error (DBusGProxy *proxy G_GNUC_UNUSED,
+    const gchar *arg_Error,
+    GHashTable *arg_Details,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (2);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_STRING);
+  g_value_set_string (args->values + 0, arg_Error);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)));
+  g_value_set_boxed (args->values + 1, arg_Details);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_for_connection_error (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_signal_callback_connection_error callback =
+      (/tmp/rv/old_connection_signal_callback_connection_error) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_string (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_connect_to_connection_error (TpConnection *proxy,
+    /tmp/rv/old_connection_signal_callback_connection_error callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[3] = {
+      G_TYPE_STRING,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION, "ConnectionError",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_collect_args_of_connection_error),
+      _/tmp/rv/old_connection_invoke_callback_for_connection_error,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_collect_args_of_status_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    guint arg_Status,
+    guint arg_Reason,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (2);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, arg_Status);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, G_TYPE_UINT);
+  g_value_set_uint (args->values + 1, arg_Reason);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_for_status_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_signal_callback_status_changed callback =
+      (/tmp/rv/old_connection_signal_callback_status_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_uint (args->values + 0),
+      g_value_get_uint (args->values + 1),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_connect_to_status_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_signal_callback_status_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[3] = {
+      G_TYPE_UINT,
+      G_TYPE_UINT,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION, "StatusChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_collect_args_of_status_changed),
+      _/tmp/rv/old_connection_invoke_callback_for_status_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_collect_callback_connect (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_connect (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_connect callback = (/tmp/rv/old_connection_callback_for_connect) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_connect (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_callback_for_connect callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "Connect",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "Connect", iface,
+          _/tmp/rv/old_connection_invoke_callback_connect,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "Connect",
+              _/tmp/rv/old_connection_collect_callback_connect,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_callback_disconnect (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_disconnect (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_disconnect callback = (/tmp/rv/old_connection_callback_for_disconnect) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_disconnect (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_callback_for_disconnect callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "Disconnect",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "Disconnect", iface,
+          _/tmp/rv/old_connection_invoke_callback_disconnect,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "Disconnect",
+              _/tmp/rv/old_connection_collect_callback_disconnect,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_callback_get_interfaces (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  gchar **out_Interfaces;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_STRV, &out_Interfaces,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_STRV);
+  g_value_take_boxed (args->values + 0, out_Interfaces);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_get_interfaces (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_get_interfaces callback = (/tmp/rv/old_connection_callback_for_get_interfaces) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_get_interfaces (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_callback_for_get_interfaces callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetInterfaces",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetInterfaces", iface,
+          _/tmp/rv/old_connection_invoke_callback_get_interfaces,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetInterfaces",
+              _/tmp/rv/old_connection_collect_callback_get_interfaces,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_callback_get_protocol (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  gchar *out_Protocol;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_STRING, &out_Protocol,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_STRING);
+  g_value_take_string (args->values + 0, out_Protocol);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_get_protocol (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_get_protocol callback = (/tmp/rv/old_connection_callback_for_get_protocol) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_string (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_get_protocol (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_callback_for_get_protocol callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetProtocol",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetProtocol", iface,
+          _/tmp/rv/old_connection_invoke_callback_get_protocol,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetProtocol",
+              _/tmp/rv/old_connection_collect_callback_get_protocol,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_callback_get_self_handle (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  guint out_Self_Handle;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_UINT, &out_Self_Handle,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, out_Self_Handle);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_get_self_handle (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_get_self_handle callback = (/tmp/rv/old_connection_callback_for_get_self_handle) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          0,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_uint (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_get_self_handle (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_callback_for_get_self_handle callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetSelfHandle",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetSelfHandle", iface,
+          _/tmp/rv/old_connection_invoke_callback_get_self_handle,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetSelfHandle",
+              _/tmp/rv/old_connection_collect_callback_get_self_handle,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_callback_get_status (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  guint out_Status;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_UINT, &out_Status,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, out_Status);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_get_status (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_get_status callback = (/tmp/rv/old_connection_callback_for_get_status) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          0,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_uint (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_get_status (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_callback_for_get_status callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetStatus",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetStatus", iface,
+          _/tmp/rv/old_connection_invoke_callback_get_status,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetStatus",
+              _/tmp/rv/old_connection_collect_callback_get_status,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_callback_hold_handles (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_hold_handles (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_hold_handles callback = (/tmp/rv/old_connection_callback_for_hold_handles) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_hold_handles (TpConnection *proxy,
+    gint timeout_ms,
+    guint in_Handle_Type,
+    const GArray *in_Handles,
+    /tmp/rv/old_connection_callback_for_hold_handles callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "HoldHandles",
+          G_TYPE_UINT, in_Handle_Type,
+          DBUS_TYPE_G_UINT_ARRAY, in_Handles,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "HoldHandles", iface,
+          _/tmp/rv/old_connection_invoke_callback_hold_handles,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "HoldHandles",
+              _/tmp/rv/old_connection_collect_callback_hold_handles,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_UINT, in_Handle_Type,
+              DBUS_TYPE_G_UINT_ARRAY, in_Handles,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_callback_inspect_handles (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  gchar **out_Identifiers;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_STRV, &out_Identifiers,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_STRV);
+  g_value_take_boxed (args->values + 0, out_Identifiers);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_inspect_handles (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_inspect_handles callback = (/tmp/rv/old_connection_callback_for_inspect_handles) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_inspect_handles (TpConnection *proxy,
+    gint timeout_ms,
+    guint in_Handle_Type,
+    const GArray *in_Handles,
+    /tmp/rv/old_connection_callback_for_inspect_handles callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "InspectHandles",
+          G_TYPE_UINT, in_Handle_Type,
+          DBUS_TYPE_G_UINT_ARRAY, in_Handles,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "InspectHandles", iface,
+          _/tmp/rv/old_connection_invoke_callback_inspect_handles,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "InspectHandles",
+              _/tmp/rv/old_connection_collect_callback_inspect_handles,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_UINT, in_Handle_Type,
+              DBUS_TYPE_G_UINT_ARRAY, in_Handles,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_callback_list_channels (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GPtrArray *out_Channel_Info;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", DBUS_TYPE_G_OBJECT_PATH, G_TYPE_STRING, G_TYPE_UINT, G_TYPE_UINT, G_TYPE_INVALID)))), &out_Channel_Info,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", DBUS_TYPE_G_OBJECT_PATH, G_TYPE_STRING, G_TYPE_UINT, G_TYPE_UINT, G_TYPE_INVALID)))));
+  g_value_take_boxed (args->values + 0, out_Channel_Info);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_list_channels (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_list_channels callback = (/tmp/rv/old_connection_callback_for_list_channels) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_list_channels (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_callback_for_list_channels callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "ListChannels",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "ListChannels", iface,
+          _/tmp/rv/old_connection_invoke_callback_list_channels,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "ListChannels",
+              _/tmp/rv/old_connection_collect_callback_list_channels,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_callback_release_handles (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_release_handles (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_release_handles callback = (/tmp/rv/old_connection_callback_for_release_handles) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_release_handles (TpConnection *proxy,
+    gint timeout_ms,
+    guint in_Handle_Type,
+    const GArray *in_Handles,
+    /tmp/rv/old_connection_callback_for_release_handles callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "ReleaseHandles",
+          G_TYPE_UINT, in_Handle_Type,
+          DBUS_TYPE_G_UINT_ARRAY, in_Handles,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "ReleaseHandles", iface,
+          _/tmp/rv/old_connection_invoke_callback_release_handles,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "ReleaseHandles",
+              _/tmp/rv/old_connection_collect_callback_release_handles,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_UINT, in_Handle_Type,
+              DBUS_TYPE_G_UINT_ARRAY, in_Handles,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_callback_request_channel (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  gchar *out_Object_Path;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      DBUS_TYPE_G_OBJECT_PATH, &out_Object_Path,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, DBUS_TYPE_G_OBJECT_PATH);
+  g_value_take_boxed (args->values + 0, out_Object_Path);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_request_channel (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_request_channel callback = (/tmp/rv/old_connection_callback_for_request_channel) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_request_channel (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_Type,
+    guint in_Handle_Type,
+    guint in_Handle,
+    gboolean in_Suppress_Handler,
+    /tmp/rv/old_connection_callback_for_request_channel callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestChannel",
+          G_TYPE_STRING, in_Type,
+          G_TYPE_UINT, in_Handle_Type,
+          G_TYPE_UINT, in_Handle,
+          G_TYPE_BOOLEAN, in_Suppress_Handler,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestChannel", iface,
+          _/tmp/rv/old_connection_invoke_callback_request_channel,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestChannel",
+              _/tmp/rv/old_connection_collect_callback_request_channel,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_Type,
+              G_TYPE_UINT, in_Handle_Type,
+              G_TYPE_UINT, in_Handle,
+              G_TYPE_BOOLEAN, in_Suppress_Handler,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_callback_request_handles (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GArray *out_Handles;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      DBUS_TYPE_G_UINT_ARRAY, &out_Handles,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, DBUS_TYPE_G_UINT_ARRAY);
+  g_value_take_boxed (args->values + 0, out_Handles);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_request_handles (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_request_handles callback = (/tmp/rv/old_connection_callback_for_request_handles) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_request_handles (TpConnection *proxy,
+    gint timeout_ms,
+    guint in_Handle_Type,
+    const gchar **in_Identifiers,
+    /tmp/rv/old_connection_callback_for_request_handles callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestHandles",
+          G_TYPE_UINT, in_Handle_Type,
+          G_TYPE_STRV, in_Identifiers,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestHandles", iface,
+          _/tmp/rv/old_connection_invoke_callback_request_handles,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestHandles",
+              _/tmp/rv/old_connection_collect_callback_request_handles,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_UINT, in_Handle_Type,
+              G_TYPE_STRV, in_Identifiers,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_callback_add_client_interest (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_add_client_interest (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_add_client_interest callback = (/tmp/rv/old_connection_callback_for_add_client_interest) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_add_client_interest (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar **in_Tokens,
+    /tmp/rv/old_connection_callback_for_add_client_interest callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "AddClientInterest",
+          G_TYPE_STRV, in_Tokens,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "AddClientInterest", iface,
+          _/tmp/rv/old_connection_invoke_callback_add_client_interest,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "AddClientInterest",
+              _/tmp/rv/old_connection_collect_callback_add_client_interest,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRV, in_Tokens,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_collect_callback_remove_client_interest (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_invoke_callback_remove_client_interest (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_callback_for_remove_client_interest callback = (/tmp/rv/old_connection_callback_for_remove_client_interest) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_call_remove_client_interest (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar **in_Tokens,
+    /tmp/rv/old_connection_callback_for_remove_client_interest callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RemoveClientInterest",
+          G_TYPE_STRV, in_Tokens,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RemoveClientInterest", iface,
+          _/tmp/rv/old_connection_invoke_callback_remove_client_interest,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RemoveClientInterest",
+              _/tmp/rv/old_connection_collect_callback_remove_client_interest,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRV, in_Tokens,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_addressing_collect_callback_get_contacts_by_vcard_field (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Requested;
+  GHashTable *out_Attributes;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_UINT)), &out_Requested,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), &out_Attributes,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (2);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_UINT)));
+  g_value_take_boxed (args->values + 0, out_Requested);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))));
+  g_value_take_boxed (args->values + 1, out_Attributes);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_addressing_invoke_callback_get_contacts_by_vcard_field (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_addressing_callback_for_get_contacts_by_vcard_field callback = (/tmp/rv/old_connection_interface_addressing_callback_for_get_contacts_by_vcard_field) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_addressing_call_get_contacts_by_vcard_field (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_Field,
+    const gchar **in_Addresses,
+    const gchar **in_Interfaces,
+    /tmp/rv/old_connection_interface_addressing_callback_for_get_contacts_by_vcard_field callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_ADDRESSING;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetContactsByVCardField",
+          G_TYPE_STRING, in_Field,
+          G_TYPE_STRV, in_Addresses,
+          G_TYPE_STRV, in_Interfaces,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetContactsByVCardField", iface,
+          _/tmp/rv/old_connection_interface_addressing_invoke_callback_get_contacts_by_vcard_field,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetContactsByVCardField",
+              _/tmp/rv/old_connection_interface_addressing_collect_callback_get_contacts_by_vcard_field,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_Field,
+              G_TYPE_STRV, in_Addresses,
+              G_TYPE_STRV, in_Interfaces,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_addressing_collect_callback_get_contacts_by_uri (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Requested;
+  GHashTable *out_Attributes;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_UINT)), &out_Requested,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), &out_Attributes,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (2);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_UINT)));
+  g_value_take_boxed (args->values + 0, out_Requested);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))));
+  g_value_take_boxed (args->values + 1, out_Attributes);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_addressing_invoke_callback_get_contacts_by_uri (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_addressing_callback_for_get_contacts_by_uri callback = (/tmp/rv/old_connection_interface_addressing_callback_for_get_contacts_by_uri) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_addressing_call_get_contacts_by_uri (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar **in_URIs,
+    const gchar **in_Interfaces,
+    /tmp/rv/old_connection_interface_addressing_callback_for_get_contacts_by_uri callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_ADDRESSING;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetContactsByURI",
+          G_TYPE_STRV, in_URIs,
+          G_TYPE_STRV, in_Interfaces,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetContactsByURI", iface,
+          _/tmp/rv/old_connection_interface_addressing_invoke_callback_get_contacts_by_uri,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetContactsByURI",
+              _/tmp/rv/old_connection_interface_addressing_collect_callback_get_contacts_by_uri,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRV, in_URIs,
+              G_TYPE_STRV, in_Interfaces,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_aliasing (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "AliasesChanged",
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)))),
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_aliasing_collect_args_of_aliases_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    const GPtrArray *arg_Aliases,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)))));
+  g_value_set_boxed (args->values + 0, arg_Aliases);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_aliasing_invoke_callback_for_aliases_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_aliasing_signal_callback_aliases_changed callback =
+      (/tmp/rv/old_connection_interface_aliasing_signal_callback_aliases_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_aliasing_connect_to_aliases_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_aliasing_signal_callback_aliases_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)))),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_ALIASING, "AliasesChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_aliasing_collect_args_of_aliases_changed),
+      _/tmp/rv/old_connection_interface_aliasing_invoke_callback_for_aliases_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_aliasing_collect_callback_get_alias_flags (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  guint out_Alias_Flags;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_UINT, &out_Alias_Flags,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, out_Alias_Flags);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_aliasing_invoke_callback_get_alias_flags (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_aliasing_callback_for_get_alias_flags callback = (/tmp/rv/old_connection_interface_aliasing_callback_for_get_alias_flags) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          0,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_uint (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_aliasing_call_get_alias_flags (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_interface_aliasing_callback_for_get_alias_flags callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_ALIASING;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetAliasFlags",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetAliasFlags", iface,
+          _/tmp/rv/old_connection_interface_aliasing_invoke_callback_get_alias_flags,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetAliasFlags",
+              _/tmp/rv/old_connection_interface_aliasing_collect_callback_get_alias_flags,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_aliasing_collect_callback_request_aliases (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  gchar **out_Aliases;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_STRV, &out_Aliases,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_STRV);
+  g_value_take_boxed (args->values + 0, out_Aliases);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_aliasing_invoke_callback_request_aliases (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_aliasing_callback_for_request_aliases callback = (/tmp/rv/old_connection_interface_aliasing_callback_for_request_aliases) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_aliasing_call_request_aliases (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_aliasing_callback_for_request_aliases callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_ALIASING;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestAliases",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestAliases", iface,
+          _/tmp/rv/old_connection_interface_aliasing_invoke_callback_request_aliases,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestAliases",
+              _/tmp/rv/old_connection_interface_aliasing_collect_callback_request_aliases,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_aliasing_collect_callback_get_aliases (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Aliases;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)), &out_Aliases,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)));
+  g_value_take_boxed (args->values + 0, out_Aliases);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_aliasing_invoke_callback_get_aliases (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_aliasing_callback_for_get_aliases callback = (/tmp/rv/old_connection_interface_aliasing_callback_for_get_aliases) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_aliasing_call_get_aliases (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_aliasing_callback_for_get_aliases callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_ALIASING;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetAliases",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetAliases", iface,
+          _/tmp/rv/old_connection_interface_aliasing_invoke_callback_get_aliases,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetAliases",
+              _/tmp/rv/old_connection_interface_aliasing_collect_callback_get_aliases,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_aliasing_collect_callback_set_aliases (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_aliasing_invoke_callback_set_aliases (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_aliasing_callback_for_set_aliases callback = (/tmp/rv/old_connection_interface_aliasing_callback_for_set_aliases) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_aliasing_call_set_aliases (TpConnection *proxy,
+    gint timeout_ms,
+    GHashTable *in_Aliases,
+    /tmp/rv/old_connection_interface_aliasing_callback_for_set_aliases callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_ALIASING;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "SetAliases",
+          (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)), in_Aliases,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "SetAliases", iface,
+          _/tmp/rv/old_connection_interface_aliasing_invoke_callback_set_aliases,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "SetAliases",
+              _/tmp/rv/old_connection_interface_aliasing_collect_callback_set_aliases,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)), in_Aliases,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_anonymity (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "AnonymityModesChanged",
+      G_TYPE_UINT,
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_anonymity_collect_args_of_anonymity_modes_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    guint arg_Modes,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, arg_Modes);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_anonymity_invoke_callback_for_anonymity_modes_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_anonymity_signal_callback_anonymity_modes_changed callback =
+      (/tmp/rv/old_connection_interface_anonymity_signal_callback_anonymity_modes_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_uint (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_anonymity_connect_to_anonymity_modes_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_anonymity_signal_callback_anonymity_modes_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      G_TYPE_UINT,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_ANONYMITY, "AnonymityModesChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_anonymity_collect_args_of_anonymity_modes_changed),
+      _/tmp/rv/old_connection_interface_anonymity_invoke_callback_for_anonymity_modes_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_avatars (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "AvatarUpdated",
+      G_TYPE_UINT,
+      G_TYPE_STRING,
+      G_TYPE_INVALID);
+  dbus_g_proxy_add_signal (proxy, "AvatarRetrieved",
+      G_TYPE_UINT,
+      G_TYPE_STRING,
+      dbus_g_type_get_collection ("GArray", G_TYPE_UCHAR),
+      G_TYPE_STRING,
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_avatars_collect_args_of_avatar_updated (DBusGProxy *proxy G_GNUC_UNUSED,
+    guint arg_Contact,
+    const gchar *arg_New_Avatar_Token,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (2);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, arg_Contact);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, G_TYPE_STRING);
+  g_value_set_string (args->values + 1, arg_New_Avatar_Token);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_avatars_invoke_callback_for_avatar_updated (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_avatars_signal_callback_avatar_updated callback =
+      (/tmp/rv/old_connection_interface_avatars_signal_callback_avatar_updated) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_uint (args->values + 0),
+      g_value_get_string (args->values + 1),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_avatars_connect_to_avatar_updated (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_avatars_signal_callback_avatar_updated callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[3] = {
+      G_TYPE_UINT,
+      G_TYPE_STRING,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_AVATARS, "AvatarUpdated",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_avatars_collect_args_of_avatar_updated),
+      _/tmp/rv/old_connection_interface_avatars_invoke_callback_for_avatar_updated,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_avatars_collect_args_of_avatar_retrieved (DBusGProxy *proxy G_GNUC_UNUSED,
+    guint arg_Contact,
+    const gchar *arg_Token,
+    const GArray *arg_Avatar,
+    const gchar *arg_Type,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (4);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 4; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, arg_Contact);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, G_TYPE_STRING);
+  g_value_set_string (args->values + 1, arg_Token);
+
+  g_value_unset (args->values + 2);
+  g_value_init (args->values + 2, dbus_g_type_get_collection ("GArray", G_TYPE_UCHAR));
+  g_value_set_boxed (args->values + 2, arg_Avatar);
+
+  g_value_unset (args->values + 3);
+  g_value_init (args->values + 3, G_TYPE_STRING);
+  g_value_set_string (args->values + 3, arg_Type);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_avatars_invoke_callback_for_avatar_retrieved (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_avatars_signal_callback_avatar_retrieved callback =
+      (/tmp/rv/old_connection_interface_avatars_signal_callback_avatar_retrieved) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_uint (args->values + 0),
+      g_value_get_string (args->values + 1),
+      g_value_get_boxed (args->values + 2),
+      g_value_get_string (args->values + 3),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_avatars_connect_to_avatar_retrieved (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_avatars_signal_callback_avatar_retrieved callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[5] = {
+      G_TYPE_UINT,
+      G_TYPE_STRING,
+      dbus_g_type_get_collection ("GArray", G_TYPE_UCHAR),
+      G_TYPE_STRING,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_AVATARS, "AvatarRetrieved",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_avatars_collect_args_of_avatar_retrieved),
+      _/tmp/rv/old_connection_interface_avatars_invoke_callback_for_avatar_retrieved,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_avatars_collect_callback_get_avatar_requirements (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  gchar **out_MIME_Types;
+  guint out_Min_Width;
+  guint out_Min_Height;
+  guint out_Max_Width;
+  guint out_Max_Height;
+  guint out_Max_Bytes;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_STRV, &out_MIME_Types,
+      G_TYPE_UINT, &out_Min_Width,
+      G_TYPE_UINT, &out_Min_Height,
+      G_TYPE_UINT, &out_Max_Width,
+      G_TYPE_UINT, &out_Max_Height,
+      G_TYPE_UINT, &out_Max_Bytes,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (6);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 6; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_STRV);
+  g_value_take_boxed (args->values + 0, out_MIME_Types);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, G_TYPE_UINT);
+  g_value_set_uint (args->values + 1, out_Min_Width);
+
+  g_value_unset (args->values + 2);
+  g_value_init (args->values + 2, G_TYPE_UINT);
+  g_value_set_uint (args->values + 2, out_Min_Height);
+
+  g_value_unset (args->values + 3);
+  g_value_init (args->values + 3, G_TYPE_UINT);
+  g_value_set_uint (args->values + 3, out_Max_Width);
+
+  g_value_unset (args->values + 4);
+  g_value_init (args->values + 4, G_TYPE_UINT);
+  g_value_set_uint (args->values + 4, out_Max_Height);
+
+  g_value_unset (args->values + 5);
+  g_value_init (args->values + 5, G_TYPE_UINT);
+  g_value_set_uint (args->values + 5, out_Max_Bytes);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_avatars_invoke_callback_get_avatar_requirements (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_avatars_callback_for_get_avatar_requirements callback = (/tmp/rv/old_connection_interface_avatars_callback_for_get_avatar_requirements) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          0,
+          0,
+          0,
+          0,
+          0,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      g_value_get_uint (args->values + 1),
+      g_value_get_uint (args->values + 2),
+      g_value_get_uint (args->values + 3),
+      g_value_get_uint (args->values + 4),
+      g_value_get_uint (args->values + 5),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_avatars_call_get_avatar_requirements (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_interface_avatars_callback_for_get_avatar_requirements callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_AVATARS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            0,
+            0,
+            0,
+            0,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetAvatarRequirements",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetAvatarRequirements", iface,
+          _/tmp/rv/old_connection_interface_avatars_invoke_callback_get_avatar_requirements,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetAvatarRequirements",
+              _/tmp/rv/old_connection_interface_avatars_collect_callback_get_avatar_requirements,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_avatars_collect_callback_get_avatar_tokens (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  gchar **out_Tokens;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_STRV, &out_Tokens,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_STRV);
+  g_value_take_boxed (args->values + 0, out_Tokens);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_avatars_invoke_callback_get_avatar_tokens (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_avatars_callback_for_get_avatar_tokens callback = (/tmp/rv/old_connection_interface_avatars_callback_for_get_avatar_tokens) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_avatars_call_get_avatar_tokens (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_avatars_callback_for_get_avatar_tokens callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_AVATARS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetAvatarTokens",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetAvatarTokens", iface,
+          _/tmp/rv/old_connection_interface_avatars_invoke_callback_get_avatar_tokens,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetAvatarTokens",
+              _/tmp/rv/old_connection_interface_avatars_collect_callback_get_avatar_tokens,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_avatars_collect_callback_get_known_avatar_tokens (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Tokens;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)), &out_Tokens,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)));
+  g_value_take_boxed (args->values + 0, out_Tokens);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_avatars_invoke_callback_get_known_avatar_tokens (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_avatars_callback_for_get_known_avatar_tokens callback = (/tmp/rv/old_connection_interface_avatars_callback_for_get_known_avatar_tokens) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_avatars_call_get_known_avatar_tokens (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_avatars_callback_for_get_known_avatar_tokens callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_AVATARS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetKnownAvatarTokens",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetKnownAvatarTokens", iface,
+          _/tmp/rv/old_connection_interface_avatars_invoke_callback_get_known_avatar_tokens,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetKnownAvatarTokens",
+              _/tmp/rv/old_connection_interface_avatars_collect_callback_get_known_avatar_tokens,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_avatars_collect_callback_request_avatar (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GArray *out_Data;
+  gchar *out_MIME_Type;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      dbus_g_type_get_collection ("GArray", G_TYPE_UCHAR), &out_Data,
+      G_TYPE_STRING, &out_MIME_Type,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (2);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, dbus_g_type_get_collection ("GArray", G_TYPE_UCHAR));
+  g_value_take_boxed (args->values + 0, out_Data);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, G_TYPE_STRING);
+  g_value_take_string (args->values + 1, out_MIME_Type);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_avatars_invoke_callback_request_avatar (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_avatars_callback_for_request_avatar callback = (/tmp/rv/old_connection_interface_avatars_callback_for_request_avatar) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      g_value_get_string (args->values + 1),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_avatars_call_request_avatar (TpConnection *proxy,
+    gint timeout_ms,
+    guint in_Contact,
+    /tmp/rv/old_connection_interface_avatars_callback_for_request_avatar callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_AVATARS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestAvatar",
+          G_TYPE_UINT, in_Contact,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestAvatar", iface,
+          _/tmp/rv/old_connection_interface_avatars_invoke_callback_request_avatar,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestAvatar",
+              _/tmp/rv/old_connection_interface_avatars_collect_callback_request_avatar,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_UINT, in_Contact,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_avatars_collect_callback_request_avatars (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_avatars_invoke_callback_request_avatars (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_avatars_callback_for_request_avatars callback = (/tmp/rv/old_connection_interface_avatars_callback_for_request_avatars) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_avatars_call_request_avatars (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_avatars_callback_for_request_avatars callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_AVATARS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestAvatars",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestAvatars", iface,
+          _/tmp/rv/old_connection_interface_avatars_invoke_callback_request_avatars,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestAvatars",
+              _/tmp/rv/old_connection_interface_avatars_collect_callback_request_avatars,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_avatars_collect_callback_set_avatar (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  gchar *out_Token;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_STRING, &out_Token,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_STRING);
+  g_value_take_string (args->values + 0, out_Token);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_avatars_invoke_callback_set_avatar (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_avatars_callback_for_set_avatar callback = (/tmp/rv/old_connection_interface_avatars_callback_for_set_avatar) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_string (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_avatars_call_set_avatar (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Avatar,
+    const gchar *in_MIME_Type,
+    /tmp/rv/old_connection_interface_avatars_callback_for_set_avatar callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_AVATARS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "SetAvatar",
+          dbus_g_type_get_collection ("GArray", G_TYPE_UCHAR), in_Avatar,
+          G_TYPE_STRING, in_MIME_Type,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "SetAvatar", iface,
+          _/tmp/rv/old_connection_interface_avatars_invoke_callback_set_avatar,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "SetAvatar",
+              _/tmp/rv/old_connection_interface_avatars_collect_callback_set_avatar,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              dbus_g_type_get_collection ("GArray", G_TYPE_UCHAR), in_Avatar,
+              G_TYPE_STRING, in_MIME_Type,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_avatars_collect_callback_clear_avatar (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_avatars_invoke_callback_clear_avatar (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_avatars_callback_for_clear_avatar callback = (/tmp/rv/old_connection_interface_avatars_callback_for_clear_avatar) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_avatars_call_clear_avatar (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_interface_avatars_callback_for_clear_avatar callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_AVATARS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "ClearAvatar",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "ClearAvatar", iface,
+          _/tmp/rv/old_connection_interface_avatars_invoke_callback_clear_avatar,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "ClearAvatar",
+              _/tmp/rv/old_connection_interface_avatars_collect_callback_clear_avatar,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_balance (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "BalanceChanged",
+      (dbus_g_type_get_struct ("GValueArray", G_TYPE_INT, G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)),
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_balance_collect_args_of_balance_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    const GValueArray *arg_Balance,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_struct ("GValueArray", G_TYPE_INT, G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)));
+  g_value_set_boxed (args->values + 0, arg_Balance);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_balance_invoke_callback_for_balance_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_balance_signal_callback_balance_changed callback =
+      (/tmp/rv/old_connection_interface_balance_signal_callback_balance_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_balance_connect_to_balance_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_balance_signal_callback_balance_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      (dbus_g_type_get_struct ("GValueArray", G_TYPE_INT, G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_BALANCE, "BalanceChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_balance_collect_args_of_balance_changed),
+      _/tmp/rv/old_connection_interface_balance_invoke_callback_for_balance_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_capabilities (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "CapabilitiesChanged",
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_UINT, G_TYPE_UINT, G_TYPE_UINT, G_TYPE_UINT, G_TYPE_INVALID)))),
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_capabilities_collect_args_of_capabilities_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    const GPtrArray *arg_Caps,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_UINT, G_TYPE_UINT, G_TYPE_UINT, G_TYPE_UINT, G_TYPE_INVALID)))));
+  g_value_set_boxed (args->values + 0, arg_Caps);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_capabilities_invoke_callback_for_capabilities_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_capabilities_signal_callback_capabilities_changed callback =
+      (/tmp/rv/old_connection_interface_capabilities_signal_callback_capabilities_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_capabilities_connect_to_capabilities_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_capabilities_signal_callback_capabilities_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_UINT, G_TYPE_UINT, G_TYPE_UINT, G_TYPE_UINT, G_TYPE_INVALID)))),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_CAPABILITIES, "CapabilitiesChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_capabilities_collect_args_of_capabilities_changed),
+      _/tmp/rv/old_connection_interface_capabilities_invoke_callback_for_capabilities_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_capabilities_collect_callback_advertise_capabilities (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GPtrArray *out_Self_Capabilities;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_UINT, G_TYPE_INVALID)))), &out_Self_Capabilities,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_UINT, G_TYPE_INVALID)))));
+  g_value_take_boxed (args->values + 0, out_Self_Capabilities);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_capabilities_invoke_callback_advertise_capabilities (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_capabilities_callback_for_advertise_capabilities callback = (/tmp/rv/old_connection_interface_capabilities_callback_for_advertise_capabilities) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_capabilities_call_advertise_capabilities (TpConnection *proxy,
+    gint timeout_ms,
+    const GPtrArray *in_Add,
+    const gchar **in_Remove,
+    /tmp/rv/old_connection_interface_capabilities_callback_for_advertise_capabilities callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CAPABILITIES;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "AdvertiseCapabilities",
+          (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_UINT, G_TYPE_INVALID)))), in_Add,
+          G_TYPE_STRV, in_Remove,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "AdvertiseCapabilities", iface,
+          _/tmp/rv/old_connection_interface_capabilities_invoke_callback_advertise_capabilities,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "AdvertiseCapabilities",
+              _/tmp/rv/old_connection_interface_capabilities_collect_callback_advertise_capabilities,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_UINT, G_TYPE_INVALID)))), in_Add,
+              G_TYPE_STRV, in_Remove,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_capabilities_collect_callback_get_capabilities (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GPtrArray *out_Contact_Capabilities;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_UINT, G_TYPE_UINT, G_TYPE_INVALID)))), &out_Contact_Capabilities,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_UINT, G_TYPE_UINT, G_TYPE_INVALID)))));
+  g_value_take_boxed (args->values + 0, out_Contact_Capabilities);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_capabilities_invoke_callback_get_capabilities (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_capabilities_callback_for_get_capabilities callback = (/tmp/rv/old_connection_interface_capabilities_callback_for_get_capabilities) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_capabilities_call_get_capabilities (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Handles,
+    /tmp/rv/old_connection_interface_capabilities_callback_for_get_capabilities callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CAPABILITIES;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetCapabilities",
+          DBUS_TYPE_G_UINT_ARRAY, in_Handles,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetCapabilities", iface,
+          _/tmp/rv/old_connection_interface_capabilities_invoke_callback_get_capabilities,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetCapabilities",
+              _/tmp/rv/old_connection_interface_capabilities_collect_callback_get_capabilities,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Handles,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_cellular (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "IMSIChanged",
+      G_TYPE_STRING,
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_cellular_collect_args_of_imsi_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    const gchar *arg_IMSI,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_STRING);
+  g_value_set_string (args->values + 0, arg_IMSI);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_cellular_invoke_callback_for_imsi_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_cellular_signal_callback_imsi_changed callback =
+      (/tmp/rv/old_connection_interface_cellular_signal_callback_imsi_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_string (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_cellular_connect_to_imsi_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_cellular_signal_callback_imsi_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      G_TYPE_STRING,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_CELLULAR, "IMSIChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_cellular_collect_args_of_imsi_changed),
+      _/tmp/rv/old_connection_interface_cellular_invoke_callback_for_imsi_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_client_types (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "ClientTypesUpdated",
+      G_TYPE_UINT,
+      G_TYPE_STRV,
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_client_types_collect_args_of_client_types_updated (DBusGProxy *proxy G_GNUC_UNUSED,
+    guint arg_Contact,
+    const gchar **arg_Client_Types,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (2);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, arg_Contact);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, G_TYPE_STRV);
+  g_value_set_boxed (args->values + 1, arg_Client_Types);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_client_types_invoke_callback_for_client_types_updated (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_client_types_signal_callback_client_types_updated callback =
+      (/tmp/rv/old_connection_interface_client_types_signal_callback_client_types_updated) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_uint (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_client_types_connect_to_client_types_updated (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_client_types_signal_callback_client_types_updated callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[3] = {
+      G_TYPE_UINT,
+      G_TYPE_STRV,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_CLIENT_TYPES, "ClientTypesUpdated",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_client_types_collect_args_of_client_types_updated),
+      _/tmp/rv/old_connection_interface_client_types_invoke_callback_for_client_types_updated,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_client_types_collect_callback_get_client_types (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Client_Types;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRV)), &out_Client_Types,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRV)));
+  g_value_take_boxed (args->values + 0, out_Client_Types);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_client_types_invoke_callback_get_client_types (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_client_types_callback_for_get_client_types callback = (/tmp/rv/old_connection_interface_client_types_callback_for_get_client_types) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_client_types_call_get_client_types (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_client_types_callback_for_get_client_types callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CLIENT_TYPES;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetClientTypes",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetClientTypes", iface,
+          _/tmp/rv/old_connection_interface_client_types_invoke_callback_get_client_types,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetClientTypes",
+              _/tmp/rv/old_connection_interface_client_types_collect_callback_get_client_types,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_client_types_collect_callback_request_client_types (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  gchar **out_Client_Types;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_STRV, &out_Client_Types,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_STRV);
+  g_value_take_boxed (args->values + 0, out_Client_Types);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_client_types_invoke_callback_request_client_types (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_client_types_callback_for_request_client_types callback = (/tmp/rv/old_connection_interface_client_types_callback_for_request_client_types) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_client_types_call_request_client_types (TpConnection *proxy,
+    gint timeout_ms,
+    guint in_Contact,
+    /tmp/rv/old_connection_interface_client_types_callback_for_request_client_types callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CLIENT_TYPES;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestClientTypes",
+          G_TYPE_UINT, in_Contact,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestClientTypes", iface,
+          _/tmp/rv/old_connection_interface_client_types_invoke_callback_request_client_types,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestClientTypes",
+              _/tmp/rv/old_connection_interface_client_types_collect_callback_request_client_types,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_UINT, in_Contact,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_contact_blocking (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "BlockedContactsChanged",
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)),
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)),
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_blocking_collect_args_of_blocked_contacts_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    GHashTable *arg_Blocked_Contacts,
+    GHashTable *arg_Unblocked_Contacts,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (2);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)));
+  g_value_set_boxed (args->values + 0, arg_Blocked_Contacts);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)));
+  g_value_set_boxed (args->values + 1, arg_Unblocked_Contacts);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_blocking_invoke_callback_for_blocked_contacts_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_blocking_signal_callback_blocked_contacts_changed callback =
+      (/tmp/rv/old_connection_interface_contact_blocking_signal_callback_blocked_contacts_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_contact_blocking_connect_to_blocked_contacts_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_contact_blocking_signal_callback_blocked_contacts_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[3] = {
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)),
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_BLOCKING, "BlockedContactsChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_contact_blocking_collect_args_of_blocked_contacts_changed),
+      _/tmp/rv/old_connection_interface_contact_blocking_invoke_callback_for_blocked_contacts_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_contact_blocking_collect_callback_block_contacts (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_blocking_invoke_callback_block_contacts (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_blocking_callback_for_block_contacts callback = (/tmp/rv/old_connection_interface_contact_blocking_callback_for_block_contacts) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_blocking_call_block_contacts (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    gboolean in_Report_Abusive,
+    /tmp/rv/old_connection_interface_contact_blocking_callback_for_block_contacts callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_BLOCKING;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "BlockContacts",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_BOOLEAN, in_Report_Abusive,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "BlockContacts", iface,
+          _/tmp/rv/old_connection_interface_contact_blocking_invoke_callback_block_contacts,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "BlockContacts",
+              _/tmp/rv/old_connection_interface_contact_blocking_collect_callback_block_contacts,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_BOOLEAN, in_Report_Abusive,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_blocking_collect_callback_unblock_contacts (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_blocking_invoke_callback_unblock_contacts (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_blocking_callback_for_unblock_contacts callback = (/tmp/rv/old_connection_interface_contact_blocking_callback_for_unblock_contacts) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_blocking_call_unblock_contacts (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_contact_blocking_callback_for_unblock_contacts callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_BLOCKING;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "UnblockContacts",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "UnblockContacts", iface,
+          _/tmp/rv/old_connection_interface_contact_blocking_invoke_callback_unblock_contacts,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "UnblockContacts",
+              _/tmp/rv/old_connection_interface_contact_blocking_collect_callback_unblock_contacts,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_blocking_collect_callback_request_blocked_contacts (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Contacts;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)), &out_Contacts,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)));
+  g_value_take_boxed (args->values + 0, out_Contacts);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_blocking_invoke_callback_request_blocked_contacts (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_blocking_callback_for_request_blocked_contacts callback = (/tmp/rv/old_connection_interface_contact_blocking_callback_for_request_blocked_contacts) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_blocking_call_request_blocked_contacts (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_interface_contact_blocking_callback_for_request_blocked_contacts callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_BLOCKING;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestBlockedContacts",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestBlockedContacts", iface,
+          _/tmp/rv/old_connection_interface_contact_blocking_invoke_callback_request_blocked_contacts,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestBlockedContacts",
+              _/tmp/rv/old_connection_interface_contact_blocking_collect_callback_request_blocked_contacts,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_contact_capabilities (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "ContactCapabilitiesChanged",
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), G_TYPE_STRV, G_TYPE_INVALID)))))),
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_capabilities_collect_args_of_contact_capabilities_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    GHashTable *arg_caps,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), G_TYPE_STRV, G_TYPE_INVALID)))))));
+  g_value_set_boxed (args->values + 0, arg_caps);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_capabilities_invoke_callback_for_contact_capabilities_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_capabilities_signal_callback_contact_capabilities_changed callback =
+      (/tmp/rv/old_connection_interface_contact_capabilities_signal_callback_contact_capabilities_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_contact_capabilities_connect_to_contact_capabilities_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_contact_capabilities_signal_callback_contact_capabilities_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), G_TYPE_STRV, G_TYPE_INVALID)))))),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_CAPABILITIES, "ContactCapabilitiesChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_contact_capabilities_collect_args_of_contact_capabilities_changed),
+      _/tmp/rv/old_connection_interface_contact_capabilities_invoke_callback_for_contact_capabilities_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_contact_capabilities_collect_callback_update_capabilities (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_capabilities_invoke_callback_update_capabilities (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_capabilities_callback_for_update_capabilities callback = (/tmp/rv/old_connection_interface_contact_capabilities_callback_for_update_capabilities) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_capabilities_call_update_capabilities (TpConnection *proxy,
+    gint timeout_ms,
+    const GPtrArray *in_Handler_Capabilities,
+    /tmp/rv/old_connection_interface_contact_capabilities_callback_for_update_capabilities callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_CAPABILITIES;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "UpdateCapabilities",
+          (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), G_TYPE_STRV, G_TYPE_INVALID)))), in_Handler_Capabilities,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "UpdateCapabilities", iface,
+          _/tmp/rv/old_connection_interface_contact_capabilities_invoke_callback_update_capabilities,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "UpdateCapabilities",
+              _/tmp/rv/old_connection_interface_contact_capabilities_collect_callback_update_capabilities,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), G_TYPE_STRV, G_TYPE_INVALID)))), in_Handler_Capabilities,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_capabilities_collect_callback_get_contact_capabilities (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Contact_Capabilities;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), G_TYPE_STRV, G_TYPE_INVALID)))))), &out_Contact_Capabilities,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), G_TYPE_STRV, G_TYPE_INVALID)))))));
+  g_value_take_boxed (args->values + 0, out_Contact_Capabilities);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_capabilities_invoke_callback_get_contact_capabilities (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_capabilities_callback_for_get_contact_capabilities callback = (/tmp/rv/old_connection_interface_contact_capabilities_callback_for_get_contact_capabilities) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_capabilities_call_get_contact_capabilities (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Handles,
+    /tmp/rv/old_connection_interface_contact_capabilities_callback_for_get_contact_capabilities callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_CAPABILITIES;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetContactCapabilities",
+          DBUS_TYPE_G_UINT_ARRAY, in_Handles,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetContactCapabilities", iface,
+          _/tmp/rv/old_connection_interface_contact_capabilities_invoke_callback_get_contact_capabilities,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetContactCapabilities",
+              _/tmp/rv/old_connection_interface_contact_capabilities_collect_callback_get_contact_capabilities,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Handles,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_contact_groups (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "GroupsChanged",
+      DBUS_TYPE_G_UINT_ARRAY,
+      G_TYPE_STRV,
+      G_TYPE_STRV,
+      G_TYPE_INVALID);
+  dbus_g_proxy_add_signal (proxy, "GroupsCreated",
+      G_TYPE_STRV,
+      G_TYPE_INVALID);
+  dbus_g_proxy_add_signal (proxy, "GroupRenamed",
+      G_TYPE_STRING,
+      G_TYPE_STRING,
+      G_TYPE_INVALID);
+  dbus_g_proxy_add_signal (proxy, "GroupsRemoved",
+      G_TYPE_STRV,
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_groups_collect_args_of_groups_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    const GArray *arg_Contact,
+    const gchar **arg_Added,
+    const gchar **arg_Removed,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (3);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 3; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, DBUS_TYPE_G_UINT_ARRAY);
+  g_value_set_boxed (args->values + 0, arg_Contact);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, G_TYPE_STRV);
+  g_value_set_boxed (args->values + 1, arg_Added);
+
+  g_value_unset (args->values + 2);
+  g_value_init (args->values + 2, G_TYPE_STRV);
+  g_value_set_boxed (args->values + 2, arg_Removed);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_groups_invoke_callback_for_groups_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_groups_signal_callback_groups_changed callback =
+      (/tmp/rv/old_connection_interface_contact_groups_signal_callback_groups_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      g_value_get_boxed (args->values + 2),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_contact_groups_connect_to_groups_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_contact_groups_signal_callback_groups_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[4] = {
+      DBUS_TYPE_G_UINT_ARRAY,
+      G_TYPE_STRV,
+      G_TYPE_STRV,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_GROUPS, "GroupsChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_contact_groups_collect_args_of_groups_changed),
+      _/tmp/rv/old_connection_interface_contact_groups_invoke_callback_for_groups_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_contact_groups_collect_args_of_groups_created (DBusGProxy *proxy G_GNUC_UNUSED,
+    const gchar **arg_Names,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_STRV);
+  g_value_set_boxed (args->values + 0, arg_Names);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_groups_invoke_callback_for_groups_created (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_groups_signal_callback_groups_created callback =
+      (/tmp/rv/old_connection_interface_contact_groups_signal_callback_groups_created) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_contact_groups_connect_to_groups_created (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_contact_groups_signal_callback_groups_created callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      G_TYPE_STRV,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_GROUPS, "GroupsCreated",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_contact_groups_collect_args_of_groups_created),
+      _/tmp/rv/old_connection_interface_contact_groups_invoke_callback_for_groups_created,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_contact_groups_collect_args_of_group_renamed (DBusGProxy *proxy G_GNUC_UNUSED,
+    const gchar *arg_Old_Name,
+    const gchar *arg_New_Name,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (2);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_STRING);
+  g_value_set_string (args->values + 0, arg_Old_Name);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, G_TYPE_STRING);
+  g_value_set_string (args->values + 1, arg_New_Name);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_groups_invoke_callback_for_group_renamed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_groups_signal_callback_group_renamed callback =
+      (/tmp/rv/old_connection_interface_contact_groups_signal_callback_group_renamed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_string (args->values + 0),
+      g_value_get_string (args->values + 1),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_contact_groups_connect_to_group_renamed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_contact_groups_signal_callback_group_renamed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[3] = {
+      G_TYPE_STRING,
+      G_TYPE_STRING,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_GROUPS, "GroupRenamed",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_contact_groups_collect_args_of_group_renamed),
+      _/tmp/rv/old_connection_interface_contact_groups_invoke_callback_for_group_renamed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_contact_groups_collect_args_of_groups_removed (DBusGProxy *proxy G_GNUC_UNUSED,
+    const gchar **arg_Names,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_STRV);
+  g_value_set_boxed (args->values + 0, arg_Names);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_groups_invoke_callback_for_groups_removed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_groups_signal_callback_groups_removed callback =
+      (/tmp/rv/old_connection_interface_contact_groups_signal_callback_groups_removed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_contact_groups_connect_to_groups_removed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_contact_groups_signal_callback_groups_removed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      G_TYPE_STRV,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_GROUPS, "GroupsRemoved",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_contact_groups_collect_args_of_groups_removed),
+      _/tmp/rv/old_connection_interface_contact_groups_invoke_callback_for_groups_removed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_contact_groups_collect_callback_set_contact_groups (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_groups_invoke_callback_set_contact_groups (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_groups_callback_for_set_contact_groups callback = (/tmp/rv/old_connection_interface_contact_groups_callback_for_set_contact_groups) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_groups_call_set_contact_groups (TpConnection *proxy,
+    gint timeout_ms,
+    guint in_Contact,
+    const gchar **in_Groups,
+    /tmp/rv/old_connection_interface_contact_groups_callback_for_set_contact_groups callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_GROUPS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "SetContactGroups",
+          G_TYPE_UINT, in_Contact,
+          G_TYPE_STRV, in_Groups,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "SetContactGroups", iface,
+          _/tmp/rv/old_connection_interface_contact_groups_invoke_callback_set_contact_groups,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "SetContactGroups",
+              _/tmp/rv/old_connection_interface_contact_groups_collect_callback_set_contact_groups,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_UINT, in_Contact,
+              G_TYPE_STRV, in_Groups,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_groups_collect_callback_set_group_members (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_groups_invoke_callback_set_group_members (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_groups_callback_for_set_group_members callback = (/tmp/rv/old_connection_interface_contact_groups_callback_for_set_group_members) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_groups_call_set_group_members (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_Group,
+    const GArray *in_Members,
+    /tmp/rv/old_connection_interface_contact_groups_callback_for_set_group_members callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_GROUPS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "SetGroupMembers",
+          G_TYPE_STRING, in_Group,
+          DBUS_TYPE_G_UINT_ARRAY, in_Members,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "SetGroupMembers", iface,
+          _/tmp/rv/old_connection_interface_contact_groups_invoke_callback_set_group_members,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "SetGroupMembers",
+              _/tmp/rv/old_connection_interface_contact_groups_collect_callback_set_group_members,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_Group,
+              DBUS_TYPE_G_UINT_ARRAY, in_Members,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_groups_collect_callback_add_to_group (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_groups_invoke_callback_add_to_group (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_groups_callback_for_add_to_group callback = (/tmp/rv/old_connection_interface_contact_groups_callback_for_add_to_group) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_groups_call_add_to_group (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_Group,
+    const GArray *in_Members,
+    /tmp/rv/old_connection_interface_contact_groups_callback_for_add_to_group callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_GROUPS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "AddToGroup",
+          G_TYPE_STRING, in_Group,
+          DBUS_TYPE_G_UINT_ARRAY, in_Members,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "AddToGroup", iface,
+          _/tmp/rv/old_connection_interface_contact_groups_invoke_callback_add_to_group,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "AddToGroup",
+              _/tmp/rv/old_connection_interface_contact_groups_collect_callback_add_to_group,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_Group,
+              DBUS_TYPE_G_UINT_ARRAY, in_Members,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_groups_collect_callback_remove_from_group (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_groups_invoke_callback_remove_from_group (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_groups_callback_for_remove_from_group callback = (/tmp/rv/old_connection_interface_contact_groups_callback_for_remove_from_group) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_groups_call_remove_from_group (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_Group,
+    const GArray *in_Members,
+    /tmp/rv/old_connection_interface_contact_groups_callback_for_remove_from_group callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_GROUPS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RemoveFromGroup",
+          G_TYPE_STRING, in_Group,
+          DBUS_TYPE_G_UINT_ARRAY, in_Members,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RemoveFromGroup", iface,
+          _/tmp/rv/old_connection_interface_contact_groups_invoke_callback_remove_from_group,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RemoveFromGroup",
+              _/tmp/rv/old_connection_interface_contact_groups_collect_callback_remove_from_group,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_Group,
+              DBUS_TYPE_G_UINT_ARRAY, in_Members,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_groups_collect_callback_remove_group (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_groups_invoke_callback_remove_group (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_groups_callback_for_remove_group callback = (/tmp/rv/old_connection_interface_contact_groups_callback_for_remove_group) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_groups_call_remove_group (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_Group,
+    /tmp/rv/old_connection_interface_contact_groups_callback_for_remove_group callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_GROUPS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RemoveGroup",
+          G_TYPE_STRING, in_Group,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RemoveGroup", iface,
+          _/tmp/rv/old_connection_interface_contact_groups_invoke_callback_remove_group,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RemoveGroup",
+              _/tmp/rv/old_connection_interface_contact_groups_collect_callback_remove_group,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_Group,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_groups_collect_callback_rename_group (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_groups_invoke_callback_rename_group (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_groups_callback_for_rename_group callback = (/tmp/rv/old_connection_interface_contact_groups_callback_for_rename_group) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_groups_call_rename_group (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_Old_Name,
+    const gchar *in_New_Name,
+    /tmp/rv/old_connection_interface_contact_groups_callback_for_rename_group callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_GROUPS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RenameGroup",
+          G_TYPE_STRING, in_Old_Name,
+          G_TYPE_STRING, in_New_Name,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RenameGroup", iface,
+          _/tmp/rv/old_connection_interface_contact_groups_invoke_callback_rename_group,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RenameGroup",
+              _/tmp/rv/old_connection_interface_contact_groups_collect_callback_rename_group,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_Old_Name,
+              G_TYPE_STRING, in_New_Name,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_contact_info (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "ContactInfoChanged",
+      G_TYPE_UINT,
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_STRV, G_TYPE_STRV, G_TYPE_INVALID)))),
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_info_collect_args_of_contact_info_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    guint arg_Contact,
+    const GPtrArray *arg_ContactInfo,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (2);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, arg_Contact);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_STRV, G_TYPE_STRV, G_TYPE_INVALID)))));
+  g_value_set_boxed (args->values + 1, arg_ContactInfo);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_info_invoke_callback_for_contact_info_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_info_signal_callback_contact_info_changed callback =
+      (/tmp/rv/old_connection_interface_contact_info_signal_callback_contact_info_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_uint (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_contact_info_connect_to_contact_info_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_contact_info_signal_callback_contact_info_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[3] = {
+      G_TYPE_UINT,
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_STRV, G_TYPE_STRV, G_TYPE_INVALID)))),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_INFO, "ContactInfoChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_contact_info_collect_args_of_contact_info_changed),
+      _/tmp/rv/old_connection_interface_contact_info_invoke_callback_for_contact_info_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_contact_info_collect_callback_get_contact_info (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_ContactInfo;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_STRV, G_TYPE_STRV, G_TYPE_INVALID)))))), &out_ContactInfo,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_STRV, G_TYPE_STRV, G_TYPE_INVALID)))))));
+  g_value_take_boxed (args->values + 0, out_ContactInfo);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_info_invoke_callback_get_contact_info (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_info_callback_for_get_contact_info callback = (/tmp/rv/old_connection_interface_contact_info_callback_for_get_contact_info) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_info_call_get_contact_info (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_contact_info_callback_for_get_contact_info callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_INFO;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetContactInfo",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetContactInfo", iface,
+          _/tmp/rv/old_connection_interface_contact_info_invoke_callback_get_contact_info,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetContactInfo",
+              _/tmp/rv/old_connection_interface_contact_info_collect_callback_get_contact_info,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_info_collect_callback_refresh_contact_info (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_info_invoke_callback_refresh_contact_info (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_info_callback_for_refresh_contact_info callback = (/tmp/rv/old_connection_interface_contact_info_callback_for_refresh_contact_info) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_info_call_refresh_contact_info (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_contact_info_callback_for_refresh_contact_info callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_INFO;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RefreshContactInfo",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RefreshContactInfo", iface,
+          _/tmp/rv/old_connection_interface_contact_info_invoke_callback_refresh_contact_info,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RefreshContactInfo",
+              _/tmp/rv/old_connection_interface_contact_info_collect_callback_refresh_contact_info,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_info_collect_callback_request_contact_info (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GPtrArray *out_Contact_Info;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_STRV, G_TYPE_STRV, G_TYPE_INVALID)))), &out_Contact_Info,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_STRV, G_TYPE_STRV, G_TYPE_INVALID)))));
+  g_value_take_boxed (args->values + 0, out_Contact_Info);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_info_invoke_callback_request_contact_info (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_info_callback_for_request_contact_info callback = (/tmp/rv/old_connection_interface_contact_info_callback_for_request_contact_info) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_info_call_request_contact_info (TpConnection *proxy,
+    gint timeout_ms,
+    guint in_Contact,
+    /tmp/rv/old_connection_interface_contact_info_callback_for_request_contact_info callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_INFO;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestContactInfo",
+          G_TYPE_UINT, in_Contact,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestContactInfo", iface,
+          _/tmp/rv/old_connection_interface_contact_info_invoke_callback_request_contact_info,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestContactInfo",
+              _/tmp/rv/old_connection_interface_contact_info_collect_callback_request_contact_info,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_UINT, in_Contact,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_info_collect_callback_set_contact_info (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_info_invoke_callback_set_contact_info (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_info_callback_for_set_contact_info callback = (/tmp/rv/old_connection_interface_contact_info_callback_for_set_contact_info) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_info_call_set_contact_info (TpConnection *proxy,
+    gint timeout_ms,
+    const GPtrArray *in_ContactInfo,
+    /tmp/rv/old_connection_interface_contact_info_callback_for_set_contact_info callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_INFO;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "SetContactInfo",
+          (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_STRV, G_TYPE_STRV, G_TYPE_INVALID)))), in_ContactInfo,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "SetContactInfo", iface,
+          _/tmp/rv/old_connection_interface_contact_info_invoke_callback_set_contact_info,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "SetContactInfo",
+              _/tmp/rv/old_connection_interface_contact_info_collect_callback_set_contact_info,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_STRV, G_TYPE_STRV, G_TYPE_INVALID)))), in_ContactInfo,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_contact_list (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "ContactListStateChanged",
+      G_TYPE_UINT,
+      G_TYPE_INVALID);
+  dbus_g_proxy_add_signal (proxy, "ContactsChangedWithID",
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)))),
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)),
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)),
+      G_TYPE_INVALID);
+  dbus_g_proxy_add_signal (proxy, "ContactsChanged",
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)))),
+      DBUS_TYPE_G_UINT_ARRAY,
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_list_collect_args_of_contact_list_state_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    guint arg_Contact_List_State,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, arg_Contact_List_State);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_list_invoke_callback_for_contact_list_state_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_list_signal_callback_contact_list_state_changed callback =
+      (/tmp/rv/old_connection_interface_contact_list_signal_callback_contact_list_state_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_uint (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_contact_list_connect_to_contact_list_state_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_contact_list_signal_callback_contact_list_state_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      G_TYPE_UINT,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_LIST, "ContactListStateChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_contact_list_collect_args_of_contact_list_state_changed),
+      _/tmp/rv/old_connection_interface_contact_list_invoke_callback_for_contact_list_state_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_contact_list_collect_args_of_contacts_changed_with_id (DBusGProxy *proxy G_GNUC_UNUSED,
+    GHashTable *arg_Changes,
+    GHashTable *arg_Identifiers,
+    GHashTable *arg_Removals,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (3);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 3; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)))));
+  g_value_set_boxed (args->values + 0, arg_Changes);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)));
+  g_value_set_boxed (args->values + 1, arg_Identifiers);
+
+  g_value_unset (args->values + 2);
+  g_value_init (args->values + 2, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)));
+  g_value_set_boxed (args->values + 2, arg_Removals);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_list_invoke_callback_for_contacts_changed_with_id (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_list_signal_callback_contacts_changed_with_id callback =
+      (/tmp/rv/old_connection_interface_contact_list_signal_callback_contacts_changed_with_id) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      g_value_get_boxed (args->values + 2),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_contact_list_connect_to_contacts_changed_with_id (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_contact_list_signal_callback_contacts_changed_with_id callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[4] = {
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)))),
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)),
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, G_TYPE_STRING)),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_LIST, "ContactsChangedWithID",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_contact_list_collect_args_of_contacts_changed_with_id),
+      _/tmp/rv/old_connection_interface_contact_list_invoke_callback_for_contacts_changed_with_id,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_contact_list_collect_args_of_contacts_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    GHashTable *arg_Changes,
+    const GArray *arg_Removals,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (2);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)))));
+  g_value_set_boxed (args->values + 0, arg_Changes);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, DBUS_TYPE_G_UINT_ARRAY);
+  g_value_set_boxed (args->values + 1, arg_Removals);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_list_invoke_callback_for_contacts_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_list_signal_callback_contacts_changed callback =
+      (/tmp/rv/old_connection_interface_contact_list_signal_callback_contacts_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_contact_list_connect_to_contacts_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_contact_list_signal_callback_contacts_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[3] = {
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)))),
+      DBUS_TYPE_G_UINT_ARRAY,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_LIST, "ContactsChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_contact_list_collect_args_of_contacts_changed),
+      _/tmp/rv/old_connection_interface_contact_list_invoke_callback_for_contacts_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_contact_list_collect_callback_get_contact_list_attributes (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Attributes;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), &out_Attributes,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))));
+  g_value_take_boxed (args->values + 0, out_Attributes);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_list_invoke_callback_get_contact_list_attributes (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_list_callback_for_get_contact_list_attributes callback = (/tmp/rv/old_connection_interface_contact_list_callback_for_get_contact_list_attributes) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_list_call_get_contact_list_attributes (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar **in_Interfaces,
+    gboolean in_Hold,
+    /tmp/rv/old_connection_interface_contact_list_callback_for_get_contact_list_attributes callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_LIST;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetContactListAttributes",
+          G_TYPE_STRV, in_Interfaces,
+          G_TYPE_BOOLEAN, in_Hold,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetContactListAttributes", iface,
+          _/tmp/rv/old_connection_interface_contact_list_invoke_callback_get_contact_list_attributes,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetContactListAttributes",
+              _/tmp/rv/old_connection_interface_contact_list_collect_callback_get_contact_list_attributes,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRV, in_Interfaces,
+              G_TYPE_BOOLEAN, in_Hold,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_list_collect_callback_request_subscription (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_list_invoke_callback_request_subscription (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_list_callback_for_request_subscription callback = (/tmp/rv/old_connection_interface_contact_list_callback_for_request_subscription) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_list_call_request_subscription (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    const gchar *in_Message,
+    /tmp/rv/old_connection_interface_contact_list_callback_for_request_subscription callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_LIST;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestSubscription",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_STRING, in_Message,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestSubscription", iface,
+          _/tmp/rv/old_connection_interface_contact_list_invoke_callback_request_subscription,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestSubscription",
+              _/tmp/rv/old_connection_interface_contact_list_collect_callback_request_subscription,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_STRING, in_Message,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_list_collect_callback_authorize_publication (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_list_invoke_callback_authorize_publication (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_list_callback_for_authorize_publication callback = (/tmp/rv/old_connection_interface_contact_list_callback_for_authorize_publication) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_list_call_authorize_publication (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_contact_list_callback_for_authorize_publication callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_LIST;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "AuthorizePublication",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "AuthorizePublication", iface,
+          _/tmp/rv/old_connection_interface_contact_list_invoke_callback_authorize_publication,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "AuthorizePublication",
+              _/tmp/rv/old_connection_interface_contact_list_collect_callback_authorize_publication,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_list_collect_callback_remove_contacts (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_list_invoke_callback_remove_contacts (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_list_callback_for_remove_contacts callback = (/tmp/rv/old_connection_interface_contact_list_callback_for_remove_contacts) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_list_call_remove_contacts (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_contact_list_callback_for_remove_contacts callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_LIST;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RemoveContacts",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RemoveContacts", iface,
+          _/tmp/rv/old_connection_interface_contact_list_invoke_callback_remove_contacts,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RemoveContacts",
+              _/tmp/rv/old_connection_interface_contact_list_collect_callback_remove_contacts,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_list_collect_callback_unsubscribe (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_list_invoke_callback_unsubscribe (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_list_callback_for_unsubscribe callback = (/tmp/rv/old_connection_interface_contact_list_callback_for_unsubscribe) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_list_call_unsubscribe (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_contact_list_callback_for_unsubscribe callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_LIST;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "Unsubscribe",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "Unsubscribe", iface,
+          _/tmp/rv/old_connection_interface_contact_list_invoke_callback_unsubscribe,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "Unsubscribe",
+              _/tmp/rv/old_connection_interface_contact_list_collect_callback_unsubscribe,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_list_collect_callback_unpublish (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_list_invoke_callback_unpublish (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_list_callback_for_unpublish callback = (/tmp/rv/old_connection_interface_contact_list_callback_for_unpublish) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_list_call_unpublish (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_contact_list_callback_for_unpublish callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_LIST;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "Unpublish",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "Unpublish", iface,
+          _/tmp/rv/old_connection_interface_contact_list_invoke_callback_unpublish,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "Unpublish",
+              _/tmp/rv/old_connection_interface_contact_list_collect_callback_unpublish,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contact_list_collect_callback_download (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_contact_list_invoke_callback_download (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contact_list_callback_for_download callback = (/tmp/rv/old_connection_interface_contact_list_callback_for_download) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contact_list_call_download (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_interface_contact_list_callback_for_download callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_LIST;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "Download",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "Download", iface,
+          _/tmp/rv/old_connection_interface_contact_list_invoke_callback_download,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "Download",
+              _/tmp/rv/old_connection_interface_contact_list_collect_callback_download,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contacts_collect_callback_get_contact_attributes (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Attributes;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), &out_Attributes,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))));
+  g_value_take_boxed (args->values + 0, out_Attributes);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contacts_invoke_callback_get_contact_attributes (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contacts_callback_for_get_contact_attributes callback = (/tmp/rv/old_connection_interface_contacts_callback_for_get_contact_attributes) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contacts_call_get_contact_attributes (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Handles,
+    const gchar **in_Interfaces,
+    gboolean in_Hold,
+    /tmp/rv/old_connection_interface_contacts_callback_for_get_contact_attributes callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACTS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetContactAttributes",
+          DBUS_TYPE_G_UINT_ARRAY, in_Handles,
+          G_TYPE_STRV, in_Interfaces,
+          G_TYPE_BOOLEAN, in_Hold,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetContactAttributes", iface,
+          _/tmp/rv/old_connection_interface_contacts_invoke_callback_get_contact_attributes,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetContactAttributes",
+              _/tmp/rv/old_connection_interface_contacts_collect_callback_get_contact_attributes,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Handles,
+              G_TYPE_STRV, in_Interfaces,
+              G_TYPE_BOOLEAN, in_Hold,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_contacts_collect_callback_get_contact_by_id (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  guint out_Handle;
+  GHashTable *out_Attributes;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_UINT, &out_Handle,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), &out_Attributes,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (2);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, out_Handle);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)));
+  g_value_take_boxed (args->values + 1, out_Attributes);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_contacts_invoke_callback_get_contact_by_id (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_contacts_callback_for_get_contact_by_id callback = (/tmp/rv/old_connection_interface_contacts_callback_for_get_contact_by_id) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          0,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_uint (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_contacts_call_get_contact_by_id (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_Identifier,
+    const gchar **in_Interfaces,
+    /tmp/rv/old_connection_interface_contacts_callback_for_get_contact_by_id callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACTS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetContactByID",
+          G_TYPE_STRING, in_Identifier,
+          G_TYPE_STRV, in_Interfaces,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetContactByID", iface,
+          _/tmp/rv/old_connection_interface_contacts_invoke_callback_get_contact_by_id,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetContactByID",
+              _/tmp/rv/old_connection_interface_contacts_collect_callback_get_contact_by_id,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_Identifier,
+              G_TYPE_STRV, in_Interfaces,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_location (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "LocationUpdated",
+      G_TYPE_UINT,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)),
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_location_collect_args_of_location_updated (DBusGProxy *proxy G_GNUC_UNUSED,
+    guint arg_Contact,
+    GHashTable *arg_Location,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (2);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, arg_Contact);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)));
+  g_value_set_boxed (args->values + 1, arg_Location);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_location_invoke_callback_for_location_updated (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_location_signal_callback_location_updated callback =
+      (/tmp/rv/old_connection_interface_location_signal_callback_location_updated) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_uint (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_location_connect_to_location_updated (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_location_signal_callback_location_updated callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[3] = {
+      G_TYPE_UINT,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_LOCATION, "LocationUpdated",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_location_collect_args_of_location_updated),
+      _/tmp/rv/old_connection_interface_location_invoke_callback_for_location_updated,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_location_collect_callback_get_locations (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Locations;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), &out_Locations,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))));
+  g_value_take_boxed (args->values + 0, out_Locations);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_location_invoke_callback_get_locations (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_location_callback_for_get_locations callback = (/tmp/rv/old_connection_interface_location_callback_for_get_locations) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_location_call_get_locations (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_location_callback_for_get_locations callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_LOCATION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetLocations",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetLocations", iface,
+          _/tmp/rv/old_connection_interface_location_invoke_callback_get_locations,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetLocations",
+              _/tmp/rv/old_connection_interface_location_collect_callback_get_locations,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_location_collect_callback_request_location (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Location;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), &out_Location,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)));
+  g_value_take_boxed (args->values + 0, out_Location);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_location_invoke_callback_request_location (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_location_callback_for_request_location callback = (/tmp/rv/old_connection_interface_location_callback_for_request_location) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_location_call_request_location (TpConnection *proxy,
+    gint timeout_ms,
+    guint in_Contact,
+    /tmp/rv/old_connection_interface_location_callback_for_request_location callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_LOCATION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestLocation",
+          G_TYPE_UINT, in_Contact,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestLocation", iface,
+          _/tmp/rv/old_connection_interface_location_invoke_callback_request_location,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestLocation",
+              _/tmp/rv/old_connection_interface_location_collect_callback_request_location,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_UINT, in_Contact,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_location_collect_callback_set_location (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_location_invoke_callback_set_location (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_location_callback_for_set_location callback = (/tmp/rv/old_connection_interface_location_callback_for_set_location) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_location_call_set_location (TpConnection *proxy,
+    gint timeout_ms,
+    GHashTable *in_Location,
+    /tmp/rv/old_connection_interface_location_callback_for_set_location callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_LOCATION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "SetLocation",
+          (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), in_Location,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "SetLocation", iface,
+          _/tmp/rv/old_connection_interface_location_invoke_callback_set_location,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "SetLocation",
+              _/tmp/rv/old_connection_interface_location_collect_callback_set_location,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), in_Location,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_mail_notification (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "MailsReceived",
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))),
+      G_TYPE_INVALID);
+  dbus_g_proxy_add_signal (proxy, "UnreadMailsChanged",
+      G_TYPE_UINT,
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))),
+      G_TYPE_STRV,
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_mail_notification_collect_args_of_mails_received (DBusGProxy *proxy G_GNUC_UNUSED,
+    const GPtrArray *arg_Mails,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))));
+  g_value_set_boxed (args->values + 0, arg_Mails);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_mail_notification_invoke_callback_for_mails_received (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_mail_notification_signal_callback_mails_received callback =
+      (/tmp/rv/old_connection_interface_mail_notification_signal_callback_mails_received) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_mail_notification_connect_to_mails_received (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_mail_notification_signal_callback_mails_received callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_MAIL_NOTIFICATION, "MailsReceived",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_mail_notification_collect_args_of_mails_received),
+      _/tmp/rv/old_connection_interface_mail_notification_invoke_callback_for_mails_received,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_mail_notification_collect_args_of_unread_mails_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    guint arg_Count,
+    const GPtrArray *arg_Mails_Added,
+    const gchar **arg_Mails_Removed,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (3);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 3; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, arg_Count);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))));
+  g_value_set_boxed (args->values + 1, arg_Mails_Added);
+
+  g_value_unset (args->values + 2);
+  g_value_init (args->values + 2, G_TYPE_STRV);
+  g_value_set_boxed (args->values + 2, arg_Mails_Removed);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_mail_notification_invoke_callback_for_unread_mails_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_mail_notification_signal_callback_unread_mails_changed callback =
+      (/tmp/rv/old_connection_interface_mail_notification_signal_callback_unread_mails_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_uint (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      g_value_get_boxed (args->values + 2),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_mail_notification_connect_to_unread_mails_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_mail_notification_signal_callback_unread_mails_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[4] = {
+      G_TYPE_UINT,
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))),
+      G_TYPE_STRV,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_MAIL_NOTIFICATION, "UnreadMailsChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_mail_notification_collect_args_of_unread_mails_changed),
+      _/tmp/rv/old_connection_interface_mail_notification_invoke_callback_for_unread_mails_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_mail_notification_collect_callback_request_inbox_url (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GValueArray *out_URL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_UINT, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_STRING, G_TYPE_INVALID)))), G_TYPE_INVALID)), &out_URL,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_UINT, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_STRING, G_TYPE_INVALID)))), G_TYPE_INVALID)));
+  g_value_take_boxed (args->values + 0, out_URL);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_mail_notification_invoke_callback_request_inbox_url (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_mail_notification_callback_for_request_inbox_url callback = (/tmp/rv/old_connection_interface_mail_notification_callback_for_request_inbox_url) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_mail_notification_call_request_inbox_url (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_interface_mail_notification_callback_for_request_inbox_url callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_MAIL_NOTIFICATION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestInboxURL",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestInboxURL", iface,
+          _/tmp/rv/old_connection_interface_mail_notification_invoke_callback_request_inbox_url,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestInboxURL",
+              _/tmp/rv/old_connection_interface_mail_notification_collect_callback_request_inbox_url,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_mail_notification_collect_callback_request_mail_url (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GValueArray *out_URL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_UINT, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_STRING, G_TYPE_INVALID)))), G_TYPE_INVALID)), &out_URL,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_UINT, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_STRING, G_TYPE_STRING, G_TYPE_INVALID)))), G_TYPE_INVALID)));
+  g_value_take_boxed (args->values + 0, out_URL);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_mail_notification_invoke_callback_request_mail_url (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_mail_notification_callback_for_request_mail_url callback = (/tmp/rv/old_connection_interface_mail_notification_callback_for_request_mail_url) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_mail_notification_call_request_mail_url (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_ID,
+    const GValue *in_URL_Data,
+    /tmp/rv/old_connection_interface_mail_notification_callback_for_request_mail_url callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_MAIL_NOTIFICATION;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestMailURL",
+          G_TYPE_STRING, in_ID,
+          G_TYPE_VALUE, in_URL_Data,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestMailURL", iface,
+          _/tmp/rv/old_connection_interface_mail_notification_invoke_callback_request_mail_url,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestMailURL",
+              _/tmp/rv/old_connection_interface_mail_notification_collect_callback_request_mail_url,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_ID,
+              G_TYPE_VALUE, in_URL_Data,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_power_saving (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "PowerSavingChanged",
+      G_TYPE_BOOLEAN,
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_power_saving_collect_args_of_power_saving_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    gboolean arg_Active,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_BOOLEAN);
+  g_value_set_boolean (args->values + 0, arg_Active);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_power_saving_invoke_callback_for_power_saving_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_power_saving_signal_callback_power_saving_changed callback =
+      (/tmp/rv/old_connection_interface_power_saving_signal_callback_power_saving_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boolean (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_power_saving_connect_to_power_saving_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_power_saving_signal_callback_power_saving_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      G_TYPE_BOOLEAN,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_POWER_SAVING, "PowerSavingChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_power_saving_collect_args_of_power_saving_changed),
+      _/tmp/rv/old_connection_interface_power_saving_invoke_callback_for_power_saving_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_power_saving_collect_callback_set_power_saving (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_power_saving_invoke_callback_set_power_saving (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_power_saving_callback_for_set_power_saving callback = (/tmp/rv/old_connection_interface_power_saving_callback_for_set_power_saving) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_power_saving_call_set_power_saving (TpConnection *proxy,
+    gint timeout_ms,
+    gboolean in_Activate,
+    /tmp/rv/old_connection_interface_power_saving_callback_for_set_power_saving callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_POWER_SAVING;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "SetPowerSaving",
+          G_TYPE_BOOLEAN, in_Activate,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "SetPowerSaving", iface,
+          _/tmp/rv/old_connection_interface_power_saving_invoke_callback_set_power_saving,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "SetPowerSaving",
+              _/tmp/rv/old_connection_interface_power_saving_collect_callback_set_power_saving,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_BOOLEAN, in_Activate,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_presence (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "PresenceUpdate",
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), G_TYPE_INVALID)))),
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_presence_collect_args_of_presence_update (DBusGProxy *proxy G_GNUC_UNUSED,
+    GHashTable *arg_Presence,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), G_TYPE_INVALID)))));
+  g_value_set_boxed (args->values + 0, arg_Presence);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_presence_invoke_callback_for_presence_update (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_presence_signal_callback_presence_update callback =
+      (/tmp/rv/old_connection_interface_presence_signal_callback_presence_update) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_presence_connect_to_presence_update (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_presence_signal_callback_presence_update callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), G_TYPE_INVALID)))),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_PRESENCE, "PresenceUpdate",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_presence_collect_args_of_presence_update),
+      _/tmp/rv/old_connection_interface_presence_invoke_callback_for_presence_update,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_presence_collect_callback_add_status (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_presence_invoke_callback_add_status (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_presence_callback_for_add_status callback = (/tmp/rv/old_connection_interface_presence_callback_for_add_status) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_presence_call_add_status (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_Status,
+    GHashTable *in_Parameters,
+    /tmp/rv/old_connection_interface_presence_callback_for_add_status callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_PRESENCE;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "AddStatus",
+          G_TYPE_STRING, in_Status,
+          (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), in_Parameters,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "AddStatus", iface,
+          _/tmp/rv/old_connection_interface_presence_invoke_callback_add_status,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "AddStatus",
+              _/tmp/rv/old_connection_interface_presence_collect_callback_add_status,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_Status,
+              (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), in_Parameters,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_presence_collect_callback_clear_status (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_presence_invoke_callback_clear_status (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_presence_callback_for_clear_status callback = (/tmp/rv/old_connection_interface_presence_callback_for_clear_status) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_presence_call_clear_status (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_interface_presence_callback_for_clear_status callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_PRESENCE;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "ClearStatus",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "ClearStatus", iface,
+          _/tmp/rv/old_connection_interface_presence_invoke_callback_clear_status,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "ClearStatus",
+              _/tmp/rv/old_connection_interface_presence_collect_callback_clear_status,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_presence_collect_callback_get_presence (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Presence;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), G_TYPE_INVALID)))), &out_Presence,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), G_TYPE_INVALID)))));
+  g_value_take_boxed (args->values + 0, out_Presence);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_presence_invoke_callback_get_presence (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_presence_callback_for_get_presence callback = (/tmp/rv/old_connection_interface_presence_callback_for_get_presence) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_presence_call_get_presence (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_presence_callback_for_get_presence callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_PRESENCE;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetPresence",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetPresence", iface,
+          _/tmp/rv/old_connection_interface_presence_invoke_callback_get_presence,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetPresence",
+              _/tmp/rv/old_connection_interface_presence_collect_callback_get_presence,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_presence_collect_callback_get_statuses (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Available_Statuses;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_BOOLEAN, G_TYPE_BOOLEAN, DBUS_TYPE_G_STRING_STRING_HASHTABLE, G_TYPE_INVALID)))), &out_Available_Statuses,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_BOOLEAN, G_TYPE_BOOLEAN, DBUS_TYPE_G_STRING_STRING_HASHTABLE, G_TYPE_INVALID)))));
+  g_value_take_boxed (args->values + 0, out_Available_Statuses);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_presence_invoke_callback_get_statuses (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_presence_callback_for_get_statuses callback = (/tmp/rv/old_connection_interface_presence_callback_for_get_statuses) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_presence_call_get_statuses (TpConnection *proxy,
+    gint timeout_ms,
+    /tmp/rv/old_connection_interface_presence_callback_for_get_statuses callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_PRESENCE;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetStatuses",
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetStatuses", iface,
+          _/tmp/rv/old_connection_interface_presence_invoke_callback_get_statuses,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetStatuses",
+              _/tmp/rv/old_connection_interface_presence_collect_callback_get_statuses,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_presence_collect_callback_remove_status (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_presence_invoke_callback_remove_status (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_presence_callback_for_remove_status callback = (/tmp/rv/old_connection_interface_presence_callback_for_remove_status) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_presence_call_remove_status (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_Status,
+    /tmp/rv/old_connection_interface_presence_callback_for_remove_status callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_PRESENCE;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RemoveStatus",
+          G_TYPE_STRING, in_Status,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RemoveStatus", iface,
+          _/tmp/rv/old_connection_interface_presence_invoke_callback_remove_status,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RemoveStatus",
+              _/tmp/rv/old_connection_interface_presence_collect_callback_remove_status,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_Status,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_presence_collect_callback_request_presence (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_presence_invoke_callback_request_presence (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_presence_callback_for_request_presence callback = (/tmp/rv/old_connection_interface_presence_callback_for_request_presence) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_presence_call_request_presence (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_presence_callback_for_request_presence callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_PRESENCE;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestPresence",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestPresence", iface,
+          _/tmp/rv/old_connection_interface_presence_invoke_callback_request_presence,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestPresence",
+              _/tmp/rv/old_connection_interface_presence_collect_callback_request_presence,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_presence_collect_callback_set_last_activity_time (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_presence_invoke_callback_set_last_activity_time (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_presence_callback_for_set_last_activity_time callback = (/tmp/rv/old_connection_interface_presence_callback_for_set_last_activity_time) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_presence_call_set_last_activity_time (TpConnection *proxy,
+    gint timeout_ms,
+    guint in_Time,
+    /tmp/rv/old_connection_interface_presence_callback_for_set_last_activity_time callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_PRESENCE;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "SetLastActivityTime",
+          G_TYPE_UINT, in_Time,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "SetLastActivityTime", iface,
+          _/tmp/rv/old_connection_interface_presence_invoke_callback_set_last_activity_time,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "SetLastActivityTime",
+              _/tmp/rv/old_connection_interface_presence_collect_callback_set_last_activity_time,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_UINT, in_Time,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_presence_collect_callback_set_status (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_presence_invoke_callback_set_status (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_presence_callback_for_set_status callback = (/tmp/rv/old_connection_interface_presence_callback_for_set_status) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_presence_call_set_status (TpConnection *proxy,
+    gint timeout_ms,
+    GHashTable *in_Statuses,
+    /tmp/rv/old_connection_interface_presence_callback_for_set_status callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_PRESENCE;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "SetStatus",
+          (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), in_Statuses,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "SetStatus", iface,
+          _/tmp/rv/old_connection_interface_presence_invoke_callback_set_status,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "SetStatus",
+              _/tmp/rv/old_connection_interface_presence_collect_callback_set_status,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)))), in_Statuses,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_renaming (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "Renamed",
+      G_TYPE_UINT,
+      G_TYPE_UINT,
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_renaming_collect_args_of_renamed (DBusGProxy *proxy G_GNUC_UNUSED,
+    guint arg_Original,
+    guint arg_New,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (2);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_UINT);
+  g_value_set_uint (args->values + 0, arg_Original);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, G_TYPE_UINT);
+  g_value_set_uint (args->values + 1, arg_New);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_renaming_invoke_callback_for_renamed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_renaming_signal_callback_renamed callback =
+      (/tmp/rv/old_connection_interface_renaming_signal_callback_renamed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_uint (args->values + 0),
+      g_value_get_uint (args->values + 1),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_renaming_connect_to_renamed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_renaming_signal_callback_renamed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[3] = {
+      G_TYPE_UINT,
+      G_TYPE_UINT,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_RENAMING, "Renamed",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_renaming_collect_args_of_renamed),
+      _/tmp/rv/old_connection_interface_renaming_invoke_callback_for_renamed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_renaming_collect_callback_request_rename (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_renaming_invoke_callback_request_rename (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_renaming_callback_for_request_rename callback = (/tmp/rv/old_connection_interface_renaming_callback_for_request_rename) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_renaming_call_request_rename (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_Identifier,
+    /tmp/rv/old_connection_interface_renaming_callback_for_request_rename callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_RENAMING;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "RequestRename",
+          G_TYPE_STRING, in_Identifier,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "RequestRename", iface,
+          _/tmp/rv/old_connection_interface_renaming_invoke_callback_request_rename,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "RequestRename",
+              _/tmp/rv/old_connection_interface_renaming_collect_callback_request_rename,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_Identifier,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_requests (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "NewChannels",
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", DBUS_TYPE_G_OBJECT_PATH, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), G_TYPE_INVALID)))),
+      G_TYPE_INVALID);
+  dbus_g_proxy_add_signal (proxy, "ChannelClosed",
+      DBUS_TYPE_G_OBJECT_PATH,
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_requests_collect_args_of_new_channels (DBusGProxy *proxy G_GNUC_UNUSED,
+    const GPtrArray *arg_Channels,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", DBUS_TYPE_G_OBJECT_PATH, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), G_TYPE_INVALID)))));
+  g_value_set_boxed (args->values + 0, arg_Channels);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_requests_invoke_callback_for_new_channels (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_requests_signal_callback_new_channels callback =
+      (/tmp/rv/old_connection_interface_requests_signal_callback_new_channels) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_requests_connect_to_new_channels (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_requests_signal_callback_new_channels callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", DBUS_TYPE_G_OBJECT_PATH, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), G_TYPE_INVALID)))),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_REQUESTS, "NewChannels",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_requests_collect_args_of_new_channels),
+      _/tmp/rv/old_connection_interface_requests_invoke_callback_for_new_channels,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_requests_collect_args_of_channel_closed (DBusGProxy *proxy G_GNUC_UNUSED,
+    const gchar *arg_Removed,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, DBUS_TYPE_G_OBJECT_PATH);
+  g_value_set_boxed (args->values + 0, arg_Removed);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_requests_invoke_callback_for_channel_closed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_requests_signal_callback_channel_closed callback =
+      (/tmp/rv/old_connection_interface_requests_signal_callback_channel_closed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_requests_connect_to_channel_closed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_requests_signal_callback_channel_closed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      DBUS_TYPE_G_OBJECT_PATH,
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_REQUESTS, "ChannelClosed",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_requests_collect_args_of_channel_closed),
+      _/tmp/rv/old_connection_interface_requests_invoke_callback_for_channel_closed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_requests_collect_callback_create_channel (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  gchar *out_Channel;
+  GHashTable *out_Properties;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      DBUS_TYPE_G_OBJECT_PATH, &out_Channel,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), &out_Properties,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (2);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, DBUS_TYPE_G_OBJECT_PATH);
+  g_value_take_boxed (args->values + 0, out_Channel);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)));
+  g_value_take_boxed (args->values + 1, out_Properties);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_requests_invoke_callback_create_channel (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_requests_callback_for_create_channel callback = (/tmp/rv/old_connection_interface_requests_callback_for_create_channel) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_requests_call_create_channel (TpConnection *proxy,
+    gint timeout_ms,
+    GHashTable *in_Request,
+    /tmp/rv/old_connection_interface_requests_callback_for_create_channel callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_REQUESTS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "CreateChannel",
+          (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), in_Request,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "CreateChannel", iface,
+          _/tmp/rv/old_connection_interface_requests_invoke_callback_create_channel,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "CreateChannel",
+              _/tmp/rv/old_connection_interface_requests_collect_callback_create_channel,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), in_Request,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_requests_collect_callback_ensure_channel (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  gboolean out_Yours;
+  gchar *out_Channel;
+  GHashTable *out_Properties;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_BOOLEAN, &out_Yours,
+      DBUS_TYPE_G_OBJECT_PATH, &out_Channel,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), &out_Properties,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (3);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 3; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, G_TYPE_BOOLEAN);
+  g_value_set_boolean (args->values + 0, out_Yours);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, DBUS_TYPE_G_OBJECT_PATH);
+  g_value_take_boxed (args->values + 1, out_Channel);
+
+  g_value_unset (args->values + 2);
+  g_value_init (args->values + 2, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)));
+  g_value_take_boxed (args->values + 2, out_Properties);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_requests_invoke_callback_ensure_channel (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_requests_callback_for_ensure_channel callback = (/tmp/rv/old_connection_interface_requests_callback_for_ensure_channel) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          0,
+          NULL,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boolean (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      g_value_get_boxed (args->values + 2),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_requests_call_ensure_channel (TpConnection *proxy,
+    gint timeout_ms,
+    GHashTable *in_Request,
+    /tmp/rv/old_connection_interface_requests_callback_for_ensure_channel callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_REQUESTS;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            NULL,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "EnsureChannel",
+          (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), in_Request,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "EnsureChannel", iface,
+          _/tmp/rv/old_connection_interface_requests_invoke_callback_ensure_channel,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "EnsureChannel",
+              _/tmp/rv/old_connection_interface_requests_collect_callback_ensure_channel,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), in_Request,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_service_point (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "ServicePointsChanged",
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)), G_TYPE_STRV, G_TYPE_INVALID)))),
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_service_point_collect_args_of_service_points_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    const GPtrArray *arg_Service_Points,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)), G_TYPE_STRV, G_TYPE_INVALID)))));
+  g_value_set_boxed (args->values + 0, arg_Service_Points);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_service_point_invoke_callback_for_service_points_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_service_point_signal_callback_service_points_changed callback =
+      (/tmp/rv/old_connection_interface_service_point_signal_callback_service_points_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_service_point_connect_to_service_points_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_service_point_signal_callback_service_points_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      (dbus_g_type_get_collection ("GPtrArray", (dbus_g_type_get_struct ("GValueArray", (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_INVALID)), G_TYPE_STRV, G_TYPE_INVALID)))),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_SERVICE_POINT, "ServicePointsChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_service_point_collect_args_of_service_points_changed),
+      _/tmp/rv/old_connection_interface_service_point_invoke_callback_for_service_points_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_sidecars1_collect_callback_ensure_sidecar (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  gchar *out_Path;
+  GHashTable *out_Properties;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      DBUS_TYPE_G_OBJECT_PATH, &out_Path,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), &out_Properties,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (2);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 2; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, DBUS_TYPE_G_OBJECT_PATH);
+  g_value_take_boxed (args->values + 0, out_Path);
+
+  g_value_unset (args->values + 1);
+  g_value_init (args->values + 1, (dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)));
+  g_value_take_boxed (args->values + 1, out_Properties);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_sidecars1_invoke_callback_ensure_sidecar (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_sidecars1_callback_for_ensure_sidecar callback = (/tmp/rv/old_connection_interface_sidecars1_callback_for_ensure_sidecar) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      g_value_get_boxed (args->values + 1),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_sidecars1_call_ensure_sidecar (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_Main_Interface,
+    /tmp/rv/old_connection_interface_sidecars1_callback_for_ensure_sidecar callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_SIDECARS1;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            NULL,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "EnsureSidecar",
+          G_TYPE_STRING, in_Main_Interface,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "EnsureSidecar", iface,
+          _/tmp/rv/old_connection_interface_sidecars1_invoke_callback_ensure_sidecar,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "EnsureSidecar",
+              _/tmp/rv/old_connection_interface_sidecars1_collect_callback_ensure_sidecar,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_Main_Interface,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static inline void
+/tmp/rv/old_add_signals_for_connection_interface_simple_presence (DBusGProxy *proxy)
+{
+  if (!tp_proxy_dbus_g_proxy_claim_for_signal_adding (proxy))
+    return;
+  dbus_g_proxy_add_signal (proxy, "PresencesChanged",
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_INVALID)))),
+      G_TYPE_INVALID);
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_simple_presence_collect_args_of_presences_changed (DBusGProxy *proxy G_GNUC_UNUSED,
+    GHashTable *arg_Presence,
+    TpProxySignalConnection *sc)
+{
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  GValueArray *args = g_value_array_new (1);
+  GValue blank = { 0 };
+  guint i;
+
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_INVALID)))));
+  g_value_set_boxed (args->values + 0, arg_Presence);
+
+  tp_proxy_signal_connection_v0_take_results (sc, args);
+}
+static void
+_/tmp/rv/old_connection_interface_simple_presence_invoke_callback_for_presences_changed (TpProxy *tpproxy,
+    GError *error G_GNUC_UNUSED,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_simple_presence_signal_callback_presences_changed callback =
+      (/tmp/rv/old_connection_interface_simple_presence_signal_callback_presences_changed) generic_callback;
+
+  if (callback != NULL)
+    callback (g_object_ref (tpproxy),
+      g_value_get_boxed (args->values + 0),
+      user_data,
+      weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+  g_object_unref (tpproxy);
+}
+TpProxySignalConnection *
+/tmp/rv/old_connection_interface_simple_presence_connect_to_presences_changed (TpConnection *proxy,
+    /tmp/rv/old_connection_interface_simple_presence_signal_callback_presences_changed callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object,
+    GError **error)
+{
+  GType expected_types[2] = {
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_INVALID)))),
+      G_TYPE_INVALID };
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL, NULL);
+
+  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_SIMPLE_PRESENCE, "PresencesChanged",
+      expected_types,
+      G_CALLBACK (_/tmp/rv/old_connection_interface_simple_presence_collect_args_of_presences_changed),
+      _/tmp/rv/old_connection_interface_simple_presence_invoke_callback_for_presences_changed,
+      G_CALLBACK (callback), user_data, destroy,
+      weak_object, error);
+}
+
+static void
+_/tmp/rv/old_connection_interface_simple_presence_collect_callback_set_presence (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      G_TYPE_INVALID);
+  tp_proxy_pending_call_v0_take_results (user_data, error,NULL);
+}
+static void
+_/tmp/rv/old_connection_interface_simple_presence_invoke_callback_set_presence (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_simple_presence_callback_for_set_presence callback = (/tmp/rv/old_connection_interface_simple_presence_callback_for_set_presence) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  if (args != NULL)
+    g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_simple_presence_call_set_presence (TpConnection *proxy,
+    gint timeout_ms,
+    const gchar *in_Status,
+    const gchar *in_Status_Message,
+    /tmp/rv/old_connection_interface_simple_presence_callback_for_set_presence callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_SIMPLE_PRESENCE;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "SetPresence",
+          G_TYPE_STRING, in_Status,
+          G_TYPE_STRING, in_Status_Message,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "SetPresence", iface,
+          _/tmp/rv/old_connection_interface_simple_presence_invoke_callback_set_presence,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "SetPresence",
+              _/tmp/rv/old_connection_interface_simple_presence_collect_callback_set_presence,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              G_TYPE_STRING, in_Status,
+              G_TYPE_STRING, in_Status_Message,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+static void
+_/tmp/rv/old_connection_interface_simple_presence_collect_callback_get_presences (DBusGProxy *proxy,
+    DBusGProxyCall *call,
+    gpointer user_data)
+{
+  GError *error = NULL;
+  GValueArray *args;
+  GValue blank = { 0 };
+  guint i;
+  GHashTable *out_Presence;
+
+  dbus_g_proxy_end_call (proxy, call, &error,
+      (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_INVALID)))), &out_Presence,
+      G_TYPE_INVALID);
+
+  if (error != NULL)
+    {
+      tp_proxy_pending_call_v0_take_results (user_data, error,
+          NULL);
+      return;
+    }
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  args = g_value_array_new (1);
+  g_value_init (&blank, G_TYPE_INT);
+
+  for (i = 0; i < 1; i++)
+    g_value_array_append (args, &blank);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  g_value_unset (args->values + 0);
+  g_value_init (args->values + 0, (dbus_g_type_get_map ("GHashTable", G_TYPE_UINT, (dbus_g_type_get_struct ("GValueArray", G_TYPE_UINT, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_INVALID)))));
+  g_value_take_boxed (args->values + 0, out_Presence);
+  tp_proxy_pending_call_v0_take_results (user_data, NULL, args);
+}
+static void
+_/tmp/rv/old_connection_interface_simple_presence_invoke_callback_get_presences (TpProxy *self,
+    GError *error,
+    GValueArray *args,
+    GCallback generic_callback,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  /tmp/rv/old_connection_interface_simple_presence_callback_for_get_presences callback = (/tmp/rv/old_connection_interface_simple_presence_callback_for_get_presences) generic_callback;
+
+  if (error != NULL)
+    {
+      callback ((TpConnection *) self,
+          NULL,
+          error, user_data, weak_object);
+      g_error_free (error);
+      return;
+    }
+  callback ((TpConnection *) self,
+      g_value_get_boxed (args->values + 0),
+      error, user_data, weak_object);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  g_value_array_free (args);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+TpProxyPendingCall *
+/tmp/rv/old_connection_interface_simple_presence_call_get_presences (TpConnection *proxy,
+    gint timeout_ms,
+    const GArray *in_Contacts,
+    /tmp/rv/old_connection_interface_simple_presence_callback_for_get_presences callback,
+    gpointer user_data,
+    GDestroyNotify destroy,
+    GObject *weak_object)
+{
+  GError *error = NULL;
+  GQuark interface = TP_IFACE_QUARK_CONNECTION_INTERFACE_SIMPLE_PRESENCE;
+  DBusGProxy *iface;
+
+  g_return_val_if_fail (TP_IS_CONNECTION (proxy), NULL);
+  g_return_val_if_fail (callback != NULL || user_data == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || destroy == NULL, NULL);
+  g_return_val_if_fail (callback != NULL || weak_object == NULL, NULL);
+
+  G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  iface = tp_proxy_borrow_interface_by_id (
+      (TpProxy *) proxy,
+      interface, &error);
+  G_GNUC_END_IGNORE_DEPRECATIONS
+
+  if (iface == NULL)
+    {
+      if (callback != NULL)
+        callback (proxy,
+            0,
+            error, user_data, weak_object);
+
+      if (destroy != NULL)
+        destroy (user_data);
+
+      g_error_free (error);
+      return NULL;
+    }
+
+  if (callback == NULL)
+    {
+      dbus_g_proxy_call_no_reply (iface, "GetPresences",
+          DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+          G_TYPE_INVALID);
+      return NULL;
+    }
+  else
+    {
+      TpProxyPendingCall *data;
+
+      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,
+          interface, "GetPresences", iface,
+          _/tmp/rv/old_connection_interface_simple_presence_invoke_callback_get_presences,
+          G_CALLBACK (callback), user_data, destroy,
+          weak_object, FALSE);
+      tp_proxy_pending_call_v0_take_pending_call (data,
+          dbus_g_proxy_begin_call_with_timeout (iface,
+              "GetPresences",
+              _/tmp/rv/old_connection_interface_simple_presence_collect_callback_get_presences,
+              data,
+              tp_proxy_pending_call_v0_completed,
+              timeout_ms,
+              DBUS_TYPE_G_UINT_ARRAY, in_Contacts,
+              G_TYPE_INVALID));
+
+      return data;
+    }
+}
+
+
+/*
+ * /tmp/rv/old_connection_add_signals:
+ * @self: the #TpProxy
+ * @quark: a quark whose string value is the interface
+ *   name whose signals should be added
+ * @proxy: the D-Bus proxy to which to add the signals
+ * @unused: not used for anything
+ *
+ * Tell dbus-glib that @proxy has the signatures of all
+ * signals on the given interface, if it's one we
+ * support.
+ *
+ * This function should be used as a signal handler for
+ * #TpProxy::interface-added.
+ */
+static void
+/tmp/rv/old_connection_add_signals (TpProxy *self G_GNUC_UNUSED,
+    guint quark,
+    DBusGProxy *proxy,
+    gpointer unused G_GNUC_UNUSED)
+{
+  if (quark == TP_IFACE_QUARK_CONNECTION)
+    /tmp/rv/old_add_signals_for_connection (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_ALIASING)
+    /tmp/rv/old_add_signals_for_connection_interface_aliasing (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_ANONYMITY)
+    /tmp/rv/old_add_signals_for_connection_interface_anonymity (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_AVATARS)
+    /tmp/rv/old_add_signals_for_connection_interface_avatars (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_BALANCE)
+    /tmp/rv/old_add_signals_for_connection_interface_balance (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_CAPABILITIES)
+    /tmp/rv/old_add_signals_for_connection_interface_capabilities (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_CELLULAR)
+    /tmp/rv/old_add_signals_for_connection_interface_cellular (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_CLIENT_TYPES)
+    /tmp/rv/old_add_signals_for_connection_interface_client_types (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_BLOCKING)
+    /tmp/rv/old_add_signals_for_connection_interface_contact_blocking (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_CAPABILITIES)
+    /tmp/rv/old_add_signals_for_connection_interface_contact_capabilities (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_GROUPS)
+    /tmp/rv/old_add_signals_for_connection_interface_contact_groups (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_INFO)
+    /tmp/rv/old_add_signals_for_connection_interface_contact_info (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_CONTACT_LIST)
+    /tmp/rv/old_add_signals_for_connection_interface_contact_list (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_LOCATION)
+    /tmp/rv/old_add_signals_for_connection_interface_location (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_MAIL_NOTIFICATION)
+    /tmp/rv/old_add_signals_for_connection_interface_mail_notification (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_POWER_SAVING)
+    /tmp/rv/old_add_signals_for_connection_interface_power_saving (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_PRESENCE)
+    /tmp/rv/old_add_signals_for_connection_interface_presence (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_RENAMING)
+    /tmp/rv/old_add_signals_for_connection_interface_renaming (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_REQUESTS)
+    /tmp/rv/old_add_signals_for_connection_interface_requests (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_SERVICE_POINT)
+    /tmp/rv/old_add_signals_for_connection_interface_service_point (proxy);
+  if (quark == TP_IFACE_QUARK_CONNECTION_INTERFACE_SIMPLE_PRESENCE)
+    /tmp/rv/old_add_signals_for_connection_interface_simple_presence (proxy);
+}
@@ -0,0 +1,4373 @@
+/**
+ * /tmp/rv/old_connection_signal_callback_self_handle_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_connect_to_self_handle_changed ()
+ *  was called
+ * @arg_Self_Handle: The new value of the SelfHandle property. (#TpContactHandle)
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal SelfHandleChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_connect_to_self_handle_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal SelfHandleChanged.
+ *
+ * Emitted whenever the &lt;tp:member-ref&gt;SelfHandle&lt;/tp:member-ref&gt; property         changes. If the connection         is not yet in the CONNECTED state, this signal is not guaranteed         to be emitted.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_signal_callback_self_contact_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_connect_to_self_contact_changed ()
+ *  was called
+ * @arg_Self_Handle: The new value of the SelfHandle property. (#TpContactHandle)
+ * @arg_Self_ID: The new value of the SelfID property.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal SelfContactChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_connect_to_self_contact_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal SelfContactChanged.
+ *
+ * Emitted whenever the &lt;tp:member-ref&gt;SelfHandle&lt;/tp:member-ref&gt; and         &lt;tp:member-ref&gt;SelfID&lt;/tp:member-ref&gt; property         changes. If the connection         is not yet in the CONNECTED state, this signal is not guaranteed         to be emitted.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_signal_callback_new_channel:
+ * @proxy: The proxy on which /tmp/rv/old_connection_connect_to_new_channel ()
+ *  was called
+ * @arg_Object_Path: A D-Bus object path for the channel object on this service
+ * @arg_Channel_Type: A D-Bus interface name representing the channel type
+ * @arg_Handle_Type: An integer representing the type of handle this channel           communicates with, or Handle_Type_None if no handle is specified (#TpHandleType)
+ * @arg_Handle: A handle indicating the specific contact, room or list this           channel communicates with, or zero if no handle is specified (#TpHandle)
+ * @arg_Suppress_Handler: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;If true, the channel was requested by a client that intends to             present it to the user itself (i.e. it passed suppress_handler=TRUE             to the &lt;tp:member-ref&gt;RequestChannel&lt;/tp:member-ref&gt; method), so no             other handler should be             launched. Clients MAY assume that channels where this is true             were created by a user request.&lt;/p&gt;            &lt;p&gt;If false, either the channel was created due to incoming             information from the service, or the channel was requested by             a local client that does not intend to handle the channel itself             (this usage is deprecated).&lt;/p&gt;            &lt;p&gt;Clients MUST NOT assume that only incoming channels will have             this flag set to false.&lt;/p&gt;
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal NewChannel.
+ */
+
+/**
+ * /tmp/rv/old_connection_connect_to_new_channel:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal NewChannel.
+ *
+ * Emitted when a new Channel object is created, either through user         request or incoming information from the service.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_signal_callback_connection_error:
+ * @proxy: The proxy on which /tmp/rv/old_connection_connect_to_connection_error ()
+ *  was called
+ * @arg_Error: The name of a D-Bus error describing the error that occurred,           which may correspond to a           &lt;tp:type&gt;Connection_Status_Reason&lt;/tp:type&gt;, or may be a more           specific Telepathy error           (such as           &lt;code&gt;org.freedesktop.Telepathy.Error.ConnectionRefused&lt;/code&gt;           for Connection_Status_Reason_Network_Error)           or a protocol-specific or connection-manager-specific error in a           suitable namespace.            &lt;tp:rationale&gt;             For instance, a SIP connection manager could signal             &amp;quot;402 Payment Required&amp;quot; as an error in a             connection-manager-specific namespace, or a link-local             XMPP implementation that used Avahi could provide the error             given to it by the avahi-daemon.           &lt;/tp:rationale&gt;
+ * @arg_Details: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;Additional information about the error, which may include             the following well-known keys:&lt;/p&gt;            &lt;dl&gt;             &lt;dt&gt;debug-message (s)&lt;/dt&gt;             &lt;dd&gt;Debugging information on the change, corresponding to the               message part of a D-Bus error message, which SHOULD NOT be               displayed to users under normal circumstances&lt;/dd&gt;              &lt;dt&gt;server-message (s)&lt;/dt&gt;             &lt;dd&gt;A human-readable message from the server explaining what               happened. This may be in the user&apos;s native language, or in the               server operator&apos;s native language, or even in Lojban.&lt;/dd&gt;  	    &lt;dt&gt;user-requested (b), expected-hostname (s), certificate-hostname (s)&lt;/dt&gt; 	    &lt;dd&gt;The same details defined in &lt;tp:type&gt;TLS_Certificate_Rejection&lt;/tp:type&gt;.&lt;/dd&gt;           &lt;/dl&gt;
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal ConnectionError.
+ */
+
+/**
+ * /tmp/rv/old_connection_connect_to_connection_error:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal ConnectionError.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Emitted when an error occurs that renders this connection unusable.         &lt;/p&gt;          &lt;p&gt;Whenever this signal is emitted, it MUST immediately be followed by           a &lt;tp:member-ref&gt;StatusChanged&lt;/tp:member-ref&gt; signal with status           Connection_Status_Disconnected and an appropriate reason           code.&lt;/p&gt;          &lt;p&gt;Connection managers SHOULD emit this signal on disconnection, but           need not do so. Clients MUST support connection managers that emit           StatusChanged(Disconnected, ...) without first emitting           ConnectionError.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;This signal provides additional information about the reason             for disconnection. The reason for connection is always             straightforward - it was requested - so it does not need further             explanation. However, on errors, it can be useful to provide             additional information.&lt;/p&gt;            &lt;p&gt;The &lt;tp:type&gt;Connection_Status_Reason&lt;/tp:type&gt; is not given             here, since it will be signalled in             &lt;tp:member-ref&gt;StatusChanged&lt;/tp:member-ref&gt;. A reasonable client             implementation would be to store the information given by this             signal until StatusChanged is received, at which point the             information given by this signal can be used to supplement the             StatusChanged signal.&lt;/p&gt;         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_signal_callback_status_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_connect_to_status_changed ()
+ *  was called
+ * @arg_Status: An integer indicating the new status, as defined by ConnectionStatus (#TpConnectionStatus)
+ * @arg_Reason: An integer indicating the reason for the status change, as defined           by ConnectionStatusReason (#TpConnectionStatusReason)
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal StatusChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_connect_to_status_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal StatusChanged.
+ *
+ * Emitted when the status of the connection changes.  All states and         reasons have numerical values, as defined in ConnectionStatus         and ConnectionStatusReason.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_callback_for_connect:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a Connect method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_connect:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a Connect method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Request that the connection be established. This will be done           asynchronously and errors will be returned by emitting           &lt;tp:member-ref&gt;StatusChanged&lt;/tp:member-ref&gt; signals.&lt;/p&gt;          &lt;p&gt;Calling this method on a Connection that is already connecting           or connected is allowed, and has no effect.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_callback_for_disconnect:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a Disconnect method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_disconnect:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a Disconnect method call.
+ *
+ * Request that the connection be closed. This closes the connection if         it&apos;s not already in DISCONNECTED state, and destroys the connection         object.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_callback_for_get_interfaces:
+ * @proxy: the proxy on which the call was made
+ * @out_Interfaces: Used to return an 'out' argument if @error is %NULL: The value of the &lt;tp:member-ref&gt;Interfaces&lt;/tp:member-ref&gt; property
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetInterfaces method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_get_interfaces:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetInterfaces method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Returns the set of optional interfaces supported by this           connection. See &lt;tp:member-ref&gt;Interfaces&lt;/tp:member-ref&gt; for more           details.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_callback_for_get_protocol:
+ * @proxy: the proxy on which the call was made
+ * @out_Protocol: Used to return an 'out' argument if @error is %NULL: A string identifier for the protocol
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetProtocol method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_get_protocol:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetProtocol method call.
+ *
+ * Get the protocol this connection is using.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_callback_for_get_self_handle:
+ * @proxy: the proxy on which the call was made
+ * @out_Self_Handle: Used to return an 'out' argument if @error is %NULL: The value of the &lt;tp:member-ref&gt;SelfHandle&lt;/tp:member-ref&gt; property (#TpContactHandle)
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetSelfHandle method call
+ * succeeds or fails.
+ *
+ * Deprecated: Use GetAll to get the         SelfHandle property (and all other Connection properties)         instead.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_get_self_handle:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetSelfHandle method call.
+ *
+ * Returns the value of the SelfHandle property. Change notification         is via the SelfHandleChanged signal.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ *
+ * Deprecated: Use GetAll to get the         SelfHandle property (and all other Connection properties)         instead.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_callback_for_get_status:
+ * @proxy: the proxy on which the call was made
+ * @out_Status: Used to return an 'out' argument if @error is %NULL: The value of the &lt;tp:member-ref&gt;Status&lt;/tp:member-ref&gt; property (#TpConnectionStatus)
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetStatus method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_get_status:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetStatus method call.
+ *
+ * Get the current status as defined in the         &lt;tp:member-ref&gt;StatusChanged&lt;/tp:member-ref&gt; signal.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_callback_for_hold_handles:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a HoldHandles method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_hold_handles:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Handle_Type: Used to pass an 'in' argument: The type of handle to be held (#TpHandleType)
+ * @in_Handles: Used to pass an 'in' argument: A array of integer handles to hold
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a HoldHandles method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;If &lt;tp:member-ref&gt;HasImmortalHandles&lt;/tp:member-ref&gt; is true,           which SHOULD always be the case in this version of telepathy-spec,           this method does nothing and returns successfully, unless           the given handle type or any of the given handles is invalid.&lt;/p&gt;          &lt;p&gt;In older connection managers, this method         notifies the connection manger that your client is holding a copy         of handles which may not be in use in any existing channel or         list, and were not obtained by using the         &lt;tp:member-ref&gt;RequestHandles&lt;/tp:member-ref&gt; method. For         example, a handle observed in an emitted signal, or displayed         somewhere in the UI that is not associated with a channel. The         connection manager must not deallocate a handle where any clients         have used this method to indicate it is in use until the         &lt;tp:member-ref&gt;ReleaseHandles&lt;/tp:member-ref&gt;         method is called, or the clients disappear from the bus.&lt;/p&gt;          &lt;p&gt;Note that HoldHandles is idempotent - calling it multiple times           is equivalent to calling it once. If a handle is &amp;quot;referenced&amp;quot; by           several components which share a D-Bus unique name, the client           should perform reference counting internally, and only call           ReleaseHandles when none of the cooperating components need the           handle any longer.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_callback_for_inspect_handles:
+ * @proxy: the proxy on which the call was made
+ * @out_Identifiers: Used to return an 'out' argument if @error is %NULL: An array of identifiers corresponding to the given handles, in the same order.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a InspectHandles method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_inspect_handles:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Handle_Type: Used to pass an 'in' argument: The type of handle to be inspected (#TpHandleType)
+ * @in_Handles: Used to pass an 'in' argument: An array of integer handles of this type
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a InspectHandles method call.
+ *
+ * Return a string representation for a number of handles of a given         type.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_callback_for_list_channels:
+ * @proxy: the proxy on which the call was made
+ * @out_Channel_Info: Used to return an 'out' argument if @error is %NULL: An array of structs representing channels.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a ListChannels method call
+ * succeeds or fails.
+ *
+ * Deprecated: Use the Requests.Channels property instead.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_list_channels:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a ListChannels method call.
+ *
+ * List all the channels which currently exist on this connection.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ *
+ * Deprecated: Use the Requests.Channels property instead.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_callback_for_release_handles:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a ReleaseHandles method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_release_handles:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Handle_Type: Used to pass an 'in' argument: An integer handle type (as defined in RequestHandle) (#TpHandleType)
+ * @in_Handles: Used to pass an 'in' argument: An array of integer handles being held by the client
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a ReleaseHandles method call.
+ *
+ * &lt;p&gt;If &lt;tp:member-ref&gt;HasImmortalHandles&lt;/tp:member-ref&gt; is true,           which SHOULD always be the case in this version of telepathy-spec,           this method does nothing and returns successfully, unless           the given handle type or any of the given handles is invalid.&lt;/p&gt;          &lt;p&gt;In older connection managers, this method         explicitly notifies the connection manager that your client is no         longer holding any references to the given handles, and that they         may be deallocated if they are not held by any other clients or         referenced by any existing channels. See         &lt;tp:member-ref&gt;HoldHandles&lt;/tp:member-ref&gt; for notes.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_callback_for_request_channel:
+ * @proxy: the proxy on which the call was made
+ * @out_Object_Path: Used to return an 'out' argument if @error is %NULL: The D-Bus object path for the channel created or retrieved
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestChannel method call
+ * succeeds or fails.
+ *
+ * Deprecated: Use Requests.CreateChannel or Requests.EnsureChannel instead. Connection managers MAY implement RequestChannel by         raising NotImplemented, or implement fewer types of channel via         this API.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_request_channel:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Type: Used to pass an 'in' argument: A D-Bus interface name representing base channel type
+ * @in_Handle_Type: Used to pass an 'in' argument: An integer representing the handle type, or Handle_Type_None if           no handle is specified (#TpHandleType)
+ * @in_Handle: Used to pass an 'in' argument: A nonzero integer handle representing a contact, room, list etc.           according to handle_type, or zero if the handle_type is           Handle_Type_None (#TpHandle)
+ * @in_Suppress_Handler: Used to pass an 'in' argument: &lt;p&gt;Clients SHOULD always set this to true.&lt;/p&gt;            &lt;tp:rationale&gt;             &lt;p&gt;The historical meaning was that clients that did not               intend to take responsibility for displaying the channel to               the user could set this to FALSE, in which case the channel               dispatcher would launch an appropriate channel handler.&lt;/p&gt;              &lt;p&gt;However, clients whose functionality relies on having a               working channel dispatcher should obtain that functionality by               calling methods on the channel dispatcher, so that they will               get an appropriate error if the channel dispatcher is missing               or not working.&lt;/p&gt;              &lt;p&gt;The channel dispatcher itself should set this to true too,               so that it will ignore the               &lt;tp:member-ref&gt;NewChannel&lt;/tp:member-ref&gt; signal that results               from the creation of the channel. It can then dispatch the               channel returned from this method to an               appropriate handler.&lt;/p&gt;              &lt;p&gt;So, there is no sensible use-case for setting this to false,               and setting it to false can result in unhandled channels (in               the case where clients assume that a channel dispatcher is               present, but it isn&apos;t).&lt;/p&gt;           &lt;/tp:rationale&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestChannel method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Request a channel satisfying the specified type and communicating           with the contact, room, list etc. indicated by the given           handle_type and handle. The handle_type and handle may both be           zero to request the creation of a new, empty channel, which may           or may not be possible, depending on the protocol and channel           type.&lt;/p&gt;          &lt;p&gt;On success, the returned channel will always be of the requested           type (i.e. implement the requested channel-type interface).&lt;/p&gt;          &lt;p&gt;If a new, empty channel is requested, on success the returned           channel will always be an &amp;quot;anonymous&amp;quot; channel for which the type           and handle are both zero.&lt;/p&gt;          &lt;p&gt;If a channel to a contact, room etc. is requested, on success, the           returned channel may either be a new or existing channel to           the requested entity (i.e. its           &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Channel&quot;&gt;TargetHandleType&lt;/tp:dbus-ref&gt;           and &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Channel&quot;&gt;TargetHandle&lt;/tp:dbus-ref&gt;           properties are the           requested handle type and handle), or a newly created &amp;quot;anonymous&amp;quot;           channel associated with the requested handle in some           implementation-specific way.&lt;/p&gt;          &lt;p&gt;For example, for a contact handle, the returned channel           might be &amp;quot;anonymous&amp;quot;, but implement the groups interface and have           the requested contact already present among the members.&lt;/p&gt;          &lt;p&gt;If the request cannot be satisfied, an error is raised and no           channel is created.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ *
+ * Deprecated: Use Requests.CreateChannel or Requests.EnsureChannel instead. Connection managers MAY implement RequestChannel by         raising NotImplemented, or implement fewer types of channel via         this API.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_callback_for_request_handles:
+ * @proxy: the proxy on which the call was made
+ * @out_Handles: Used to return an 'out' argument if @error is %NULL: An array of integer handle numbers in the same order as the given identifiers.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestHandles method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_request_handles:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Handle_Type: Used to pass an 'in' argument: The type of handle required (#TpHandleType)
+ * @in_Identifiers: Used to pass an 'in' argument: An array of identifiers of entities to request handles for
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestHandles method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Request several handles from the connection manager which represent a           number of contacts, rooms or server-stored lists on the service.&lt;/p&gt;          &lt;p&gt;If &lt;tp:member-ref&gt;HasImmortalHandles&lt;/tp:member-ref&gt; is true,           which SHOULD always be the case in this version of telepathy-spec,           the handles remain valid until the connection disconnects.&lt;/p&gt;          &lt;p&gt;The implementation of this method in older connection managers         must record that these handles are in use by the         client who invokes this method, and must not deallocate the handles         until the client disconnects from the bus or calls the         &lt;tp:member-ref&gt;ReleaseHandles&lt;/tp:member-ref&gt;         method. Where the identifier refers to an entity that already has a         handle in this connection manager, this handle should be returned         instead. The handle number 0 must not be returned by the connection         manager.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_callback_for_add_client_interest:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a AddClientInterest method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_add_client_interest:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Tokens: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;Interfaces or parts of interfaces in which to register an             interest, represented by either a             &lt;tp:type&gt;DBus_Interface&lt;/tp:type&gt;, or a string prefixed with a             &lt;tp:type&gt;DBus_Interface&lt;/tp:type&gt;.&lt;/p&gt;            &lt;p&gt;If the Connection does not support one of these tokens, this             is not considered to be an error; the unsupported token is             simply ignored.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a AddClientInterest method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Register a client&apos;s interest in notifications related to one or           more interfaces.&lt;/p&gt;          &lt;p&gt;Groups of notifications are identified by a token which is either           a D-Bus interface name, or a string that starts with a D-Bus           interface name. The meaning of each token is given by that D-Bus           interface, which MUST define it in its documentation.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;Initially, all interests are in entire interface, but allowing             other strings allows subscription to part of an interface; for             instance, an interest in ...MailNotification/count could track             the number of messages without caring about their detailed             content.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;For each token with which this method interacts, the           Connection tracks an &amp;quot;interest count&amp;quot; (like a reference count) for           each unique bus name that has called this method. When a client           calls this method, for each token, the interest count for its           unique bus name is incremented; when           &lt;tp:member-ref&gt;RemoveClientInterest&lt;/tp:member-ref&gt; is called,           all interest counts for that unique bus name are decremented.           If the unique bus name leaves the bus (for instance, if the           client crashes or exits), all interest counts for that unique bus           name are set to zero.&lt;/p&gt;          &lt;p&gt;The Connection can then use these reference counts to           avoid subscribing to protocol-level notifications unless at least           one client has a non-zero interest count for the relevant           token.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;This method exists to reduce memory and network overhead when             there is no active subscription.&lt;/p&gt;            &lt;p&gt;One situation where this is useful is &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection.Interface&quot;&gt;Location&lt;/tp:dbus-ref&gt;: on XMPP, location updates are received             over PEP. If the Connection advertises the             &lt;code&gt;geoloc+notify&lt;/code&gt; capability, it will be sent location             updates for all contacts. To avoid consuming resources for this,             the connection should avoid advertising that capability until             a client has expressed an interest in contacts&apos; locations.&lt;/p&gt;            &lt;p&gt;Another example of a protocol that benefits from this method is             the Google XMPP Mail Notification extension, which can be used             to implement &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection.Interface&quot;&gt;MailNotification&lt;/tp:dbus-ref&gt;. In this protocol, the CM             receives a notification that something has changed, but to get             more information, the CM must request this information. Knowing             that nobody is currently interested in this information, the CM             can avoid generating useless network traffic. Similarly, the CM             may free the list of unread messages to reduce memory overhead.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;If this method is called for an interface that might require           protocol-level subscription, but the connection cannot set up           that subscription yet (for instance because the           &lt;tp:member-ref&gt;Status&lt;/tp:member-ref&gt; is not Connected yet), the           Connection MUST remember the client&apos;s interest, and attempt to           subscribe to the appropriate protocol feature when this becomes           possible.&lt;/p&gt;          &lt;p&gt;Clients MAY ignore any errors raised by this method; it is intended           to be called with the reply ignored.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;The only reason it could fail is if it&apos;s unimplemented, in which             case the only thing the client can usefully do is to proceed as if             it had succeeded.&lt;/p&gt;         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_callback_for_remove_client_interest:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RemoveClientInterest method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_call_remove_client_interest:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Tokens: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;Interfaces or parts of interfaces that were previously passed to             &lt;tp:member-ref&gt;AddClientInterest&lt;/tp:member-ref&gt;.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RemoveClientInterest method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Release an interest registered using           &lt;tp:member-ref&gt;AddClientInterest&lt;/tp:member-ref&gt;. See that           method&apos;s documentation for details.&lt;/p&gt;          &lt;p&gt;Clients MAY ignore any errors raised by this method; it is intended           to be called with the reply ignored.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;The only reasons it could fail are if it&apos;s unimplemented, or if             the client&apos;s reference-counting is wrong and it has tried to             remove a client interest that it did not add. In both cases,             there&apos;s nothing the client could do about it.&lt;/p&gt;         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_addressing_callback_for_get_contacts_by_vcard_field:
+ * @proxy: the proxy on which the call was made
+ * @out_Requested: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A mapping from requested vCard addresses to the corresponding             contact handles.&lt;/p&gt;            &lt;p&gt;Requested addresses that are not valid or understood for this protocol             MUST be omitted from the mapping.&lt;/p&gt;
+ * @out_Attributes: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A dictionary mapping the contact handles to contact attributes.             If any of the requested addresses are in fact invalid, they are             simply omitted from this mapping. If contact attributes are not             immediately known, the behaviour is defined by the interface;             the attribute should either be omitted from the result or             replaced with a default value.&lt;/p&gt;            &lt;p&gt;Requested addresses that are not valid or understood for this protocol             MUST be omitted from the mapping.&lt;/p&gt;            &lt;p&gt;Each contact&apos;s attributes will always include at least the             identifier that would be obtained by inspecting the handle             (&lt;code&gt;org.freedesktop.Telepathy.Connection/contact-id&lt;/code&gt;).           &lt;/p&gt;
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetContactsByVCardField method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_addressing_call_get_contacts_by_vcard_field:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Field: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;The vCard field of the addresses we are requesting. The             field name SHOULD be in lower case. Supported             fields can be found in             &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Protocol.Interface.Addressing&quot;&gt;AddressableVCardFields&lt;/tp:dbus-ref&gt;.&lt;/p&gt;            &lt;p&gt;The &lt;code&gt;url&lt;/code&gt; vCard field MUST NOT appear here; see             &lt;tp:member-ref&gt;GetContactsByURI&lt;/tp:member-ref&gt; instead.&lt;/p&gt;            &lt;tp:rationale&gt;             &lt;p&gt;In practice, protocols have a limited set of URI               schemes that make sense to resolve as a contact.&lt;/p&gt;           &lt;/tp:rationale&gt;
+ * @in_Addresses: Used to pass an 'in' argument: The addresses to get contact handles for. The address types           should match the given vCard field.
+ * @in_Interfaces: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A list of strings indicating which D-Bus interfaces the calling             process is interested in. All supported attributes from these             interfaces, whose values can be obtained without additional network             activity, will be in the reply.&lt;/p&gt;            &lt;p&gt;Attributes from this interface and from             &lt;tp:dbus-ref&gt;org.freedesktop.Telepathy.Connection&lt;/tp:dbus-ref&gt;             are always returned, and need not be requested             explicitly.&lt;/p&gt;            &lt;p&gt;The behavior of this parameter is similar to the same             parameter in             &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection.Interface&quot;&gt;Contacts.GetContactAttributes&lt;/tp:dbus-ref&gt;.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetContactsByVCardField method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Request contacts and retrieve their attributes using a given field           in their vCards.&lt;/p&gt;          &lt;p&gt;The connection manager should record that these handles are in           use by the client who invokes this method, and must not           deallocate the handles until the client disconnects from the           bus or calls the           &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy&quot;&gt;Connection.ReleaseHandles&lt;/tp:dbus-ref&gt;           method.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_addressing_callback_for_get_contacts_by_uri:
+ * @proxy: the proxy on which the call was made
+ * @out_Requested: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A mapping of requested URIs to the corresponding contact handles.&lt;/p&gt;            &lt;p&gt;Requested URIs that are not valid or understood for this protocol             MUST be omitted from the mapping.&lt;/p&gt;
+ * @out_Attributes: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A dictionary mapping the contact handles to contact attributes.             If any of the requested addresses are in fact invalid, they are             simply omitted from this mapping. If contact attributes are not             immediately known, the behaviour is defined by the interface;             the attribute should either be omitted from the result or             replaced with a default value.&lt;/p&gt;            &lt;p&gt;Requested URIs that are not valid or understood for this protocol             MUST be omitted from the mapping.&lt;/p&gt;            &lt;p&gt;Each contact&apos;s attributes will always include at least the             identifier that would be obtained by inspecting the handle             (&lt;code&gt;org.freedesktop.Telepathy.Connection/contact-id&lt;/code&gt;).           &lt;/p&gt;
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetContactsByURI method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_addressing_call_get_contacts_by_uri:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_URIs: Used to pass an 'in' argument: The URI addresses to get contact handles for. Supported           schemes can be found in           &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Protocol.Interface.Addressing&quot;&gt;AddressableURISchemes&lt;/tp:dbus-ref&gt;.
+ * @in_Interfaces: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A list of strings indicating which D-Bus interfaces the calling             process is interested in. All supported attributes from these             interfaces, whose values can be obtained without additional network             activity, will be in the reply.&lt;/p&gt;            &lt;p&gt;Attributes from this interface and from             &lt;tp:dbus-ref&gt;org.freedesktop.Telepathy.Connection&lt;/tp:dbus-ref&gt;             are always returned, and need not be requested             explicitly.&lt;/p&gt;            &lt;p&gt;The behavior of this parameter is similar to the same             parameter in             &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection.Interface&quot;&gt;Contacts.GetContactAttributes&lt;/tp:dbus-ref&gt;.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetContactsByURI method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Request contacts and retrieve their attributes using URI addresses.&lt;/p&gt;          &lt;p&gt;The connection manager should record that these handles are in           use by the client who invokes this method, and must not           deallocate the handles until the client disconnects from the           bus or calls the           &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy&quot;&gt;Connection.ReleaseHandles&lt;/tp:dbus-ref&gt;           method.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_aliasing_signal_callback_aliases_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_aliasing_connect_to_aliases_changed ()
+ *  was called
+ * @arg_Aliases: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           An array containing structs of:           &lt;ul&gt;             &lt;li&gt;the handle representing the contact&lt;/li&gt;             &lt;li&gt;the new alias&lt;/li&gt;           &lt;/ul&gt;
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal AliasesChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_aliasing_connect_to_aliases_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal AliasesChanged.
+ *
+ * Signal emitted when a contact&apos;s alias (or that of the user) is changed.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_aliasing_callback_for_get_alias_flags:
+ * @proxy: the proxy on which the call was made
+ * @out_Alias_Flags: Used to return an 'out' argument if @error is %NULL: An integer with a bitwise OR of flags from ConnectionAliasFlags (#TpConnectionAliasFlags)
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetAliasFlags method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_aliasing_call_get_alias_flags:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetAliasFlags method call.
+ *
+ * Return a bitwise OR of flags detailing the behaviour of aliases on this         connection.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_aliasing_callback_for_request_aliases:
+ * @proxy: the proxy on which the call was made
+ * @out_Aliases: Used to return an 'out' argument if @error is %NULL: A list of aliases in the same order as the contact handles
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestAliases method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_aliasing_call_request_aliases:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: An array of handles representing contacts
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestAliases method call.
+ *
+ * Request the value of several contacts&apos; aliases at once.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_aliasing_callback_for_get_aliases:
+ * @proxy: the proxy on which the call was made
+ * @out_Aliases: Used to return an 'out' argument if @error is %NULL: A dictionary mapping contact handles to aliases
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetAliases method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_aliasing_call_get_aliases:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: An array of handles representing contacts
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetAliases method call.
+ *
+ * Request the value of several contacts&apos; aliases at once. This SHOULD         only return cached aliases, falling back on the contact identifier         (i.e. the string corresponding to the handle) if none is present. Also         if there was no cached alias, a request SHOULD be started of which the         result is later signalled by         &lt;tp:member-ref&gt;AliasesChanged&lt;/tp:member-ref&gt;.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_aliasing_callback_for_set_aliases:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a SetAliases method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_aliasing_call_set_aliases:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Aliases: Used to pass an 'in' argument: A dictionary mapping integer handles of contacts           to strings of the new alias to set.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a SetAliases method call.
+ *
+ * Request that the alias of the given contact be changed. Success will be         indicated by emitting an &lt;tp:member-ref&gt;AliasesChanged&lt;/tp:member-ref&gt;         signal. On connections where the CONNECTION_ALIAS_FLAG_USER_SET flag is         not set, this method will only ever succeed if the contact is the         user&apos;s own handle (as returned by &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy&quot;&gt;Connection.GetSelfHandle&lt;/tp:dbus-ref&gt;).
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_anonymity_signal_callback_anonymity_modes_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_anonymity_connect_to_anonymity_modes_changed ()
+ *  was called
+ * @arg_Modes: The new anonymity modes for this connection. (#TpAnonymityModeFlags)
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal AnonymityModesChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_anonymity_connect_to_anonymity_modes_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal AnonymityModesChanged.
+ *
+ * Emitted when the anonymity mode has changed.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_signal_callback_avatar_updated:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_avatars_connect_to_avatar_updated ()
+ *  was called
+ * @arg_Contact: An integer handle for the contact whose avatar has changed (#TpContactHandle)
+ * @arg_New_Avatar_Token: Unique token for their new avatar
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal AvatarUpdated.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_connect_to_avatar_updated:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal AvatarUpdated.
+ *
+ * Emitted when the avatar for a contact has been updated, or first         discovered on this connection. If the token differs from the token         associated with the client&apos;s cached avatar for this contact, the new         avatar should be requested with         &lt;tp:member-ref&gt;RequestAvatars&lt;/tp:member-ref&gt;.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_signal_callback_avatar_retrieved:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_avatars_connect_to_avatar_retrieved ()
+ *  was called
+ * @arg_Contact: The contact whose avatar has been retrieved (#TpContactHandle)
+ * @arg_Token: The token corresponding to the avatar
+ * @arg_Avatar: An array of bytes containing the image data
+ * @arg_Type: A string containing the image MIME type (eg image/jpeg), or empty if           unknown
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal AvatarRetrieved.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_connect_to_avatar_retrieved:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal AvatarRetrieved.
+ *
+ * Emitted when the avatar for a contact has been retrieved.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_callback_for_get_avatar_requirements:
+ * @proxy: the proxy on which the call was made
+ * @out_MIME_Types: Used to return an 'out' argument if @error is %NULL: An array of supported MIME types (eg image/jpeg)
+ * @out_Min_Width: Used to return an 'out' argument if @error is %NULL: The minimum image width in pixels
+ * @out_Min_Height: Used to return an 'out' argument if @error is %NULL: The minimum image height in pixels
+ * @out_Max_Width: Used to return an 'out' argument if @error is %NULL: The maximum image width in pixels, or 0 if there is no limit
+ * @out_Max_Height: Used to return an 'out' argument if @error is %NULL: The maximum image height in pixels, or 0 if there is no limit
+ * @out_Max_Bytes: Used to return an 'out' argument if @error is %NULL: The maximum image size in bytes, or 0 if there is no limit
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetAvatarRequirements method call
+ * succeeds or fails.
+ *
+ * Deprecated: Use GetAll to retrieve the         D-Bus properties on this interface, falling back to this method         on failure.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_call_get_avatar_requirements:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetAvatarRequirements method call.
+ *
+ * Get the required format of avatars on this connection.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ *
+ * Deprecated: Use GetAll to retrieve the         D-Bus properties on this interface, falling back to this method         on failure.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_callback_for_get_avatar_tokens:
+ * @proxy: the proxy on which the call was made
+ * @out_Tokens: Used to return an 'out' argument if @error is %NULL: An array of avatar tokens or empty strings (if no avatar is set) in the           same order as the given array of contact handles
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetAvatarTokens method call
+ * succeeds or fails.
+ *
+ * Deprecated: Use GetKnownAvatarTokens         instead.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_call_get_avatar_tokens:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: An array of handles representing contacts
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetAvatarTokens method call.
+ *
+ * Get the unique tokens for all of the given contacts&apos; avatars.          Using this method in new Telepathy clients is deprecated; use         &lt;tp:member-ref&gt;GetKnownAvatarTokens&lt;/tp:member-ref&gt; instead.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ *
+ * Deprecated: Use GetKnownAvatarTokens         instead.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_callback_for_get_known_avatar_tokens:
+ * @proxy: the proxy on which the call was made
+ * @out_Tokens: Used to return an 'out' argument if @error is %NULL: A dictionary of handles mapped to avatar tokens, containing only           the known avatar tokens.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetKnownAvatarTokens method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_call_get_known_avatar_tokens:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: An array of handles representing contacts
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetKnownAvatarTokens method call.
+ *
+ * Get the unique tokens for the given contacts&apos; avatars. These tokens         can be persisted across connections, and should be used by the client         to check whether the avatars have been updated.  For handles other than         the self handle, only tokens that are already known are returned; an         empty token means the given contact has no avatar.  However, a CM must         always have the tokens for the self handle if one is set (even if it is         set to no avatar).  On protocols where the avatar does not persist         between connections, a CM should omit the self handle from the returned         map until an avatar is explicitly set or cleared.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_callback_for_request_avatar:
+ * @proxy: the proxy on which the call was made
+ * @out_Data: Used to return an 'out' argument if @error is %NULL: An array of bytes containing the image data
+ * @out_MIME_Type: Used to return an 'out' argument if @error is %NULL: A string containing the image MIME type (eg image/jpeg), or empty if         unknown
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestAvatar method call
+ * succeeds or fails.
+ *
+ * Deprecated: Use RequestAvatars         instead.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_call_request_avatar:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contact: Used to pass an 'in' argument: An integer handle for the contact to request the avatar for (#TpContactHandle)
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestAvatar method call.
+ *
+ * Request the avatar for a given contact. Using this method in new         Telepathy clients is deprecated; use RequestAvatars instead.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ *
+ * Deprecated: Use RequestAvatars         instead.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_callback_for_request_avatars:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestAvatars method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_call_request_avatars:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: The contacts to retrieve avatars for
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestAvatars method call.
+ *
+ * Request avatars for a number of contacts. The         &lt;tp:member-ref&gt;AvatarRetrieved&lt;/tp:member-ref&gt; signal is emitted for         each avatar retrieved. If the handles are valid but retrieving an         avatar fails (for any reason, including the contact not having an         avatar) the AvatarRetrieved signal is not emitted for that contact.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_callback_for_set_avatar:
+ * @proxy: the proxy on which the call was made
+ * @out_Token: Used to return an 'out' argument if @error is %NULL: The string token of the new avatar
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a SetAvatar method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_call_set_avatar:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Avatar: Used to pass an 'in' argument: An array of bytes representing the avatar image data
+ * @in_MIME_Type: Used to pass an 'in' argument: A string representing the image MIME type
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a SetAvatar method call.
+ *
+ * Set a new avatar image for this connection. The avatar image must         respect the requirements obtained by         &lt;tp:member-ref&gt;GetAvatarRequirements&lt;/tp:member-ref&gt;.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_callback_for_clear_avatar:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a ClearAvatar method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_avatars_call_clear_avatar:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a ClearAvatar method call.
+ *
+ * Remove the avatar image for this connection.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_balance_signal_callback_balance_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_balance_connect_to_balance_changed ()
+ *  was called
+ * @arg_Balance: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;The new value of the &lt;tp:member-ref&gt;AccountBalance&lt;/tp:member-ref&gt;             property.&lt;/p&gt;
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal BalanceChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_balance_connect_to_balance_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal BalanceChanged.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Emitted when the user&apos;s balance has changed.&lt;/p&gt;
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_capabilities_signal_callback_capabilities_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_capabilities_connect_to_capabilities_changed ()
+ *  was called
+ * @arg_Caps: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           An array of structures containing:           &lt;ul&gt;             &lt;li&gt;an integer handle representing the contact&lt;/li&gt;             &lt;li&gt;a string channel type&lt;/li&gt;             &lt;li&gt;a bitwise OR of the contact&apos;s old generic capability flags&lt;/li&gt;             &lt;li&gt;a bitwise OR of the contact&apos;s new generic capability flags&lt;/li&gt;             &lt;li&gt;a bitwise OR of the contact&apos;s old type specific capability flags&lt;/li&gt;             &lt;li&gt;a bitwise OR of the contact&apos;s new type specific capability flags&lt;/li&gt;           &lt;/ul&gt;
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal CapabilitiesChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_capabilities_connect_to_capabilities_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal CapabilitiesChanged.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Announce that there has been a change of capabilities on the           given handle.&lt;/p&gt;          &lt;p&gt;If the handle is zero, the capabilities refer to the connection           itself, in some poorly defined way. This usage is deprecated and           clients should ignore it.&lt;/p&gt;
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_capabilities_callback_for_advertise_capabilities:
+ * @proxy: the proxy on which the call was made
+ * @out_Self_Capabilities: Used to return an 'out' argument if @error is %NULL: An array of structures describing the current capabilities containing:           &lt;ul&gt;             &lt;li&gt;a string channel type&lt;/li&gt;             &lt;li&gt;a bitwise OR of type specific capability flags&lt;/li&gt;           &lt;/ul&gt;
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a AdvertiseCapabilities method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_capabilities_call_advertise_capabilities:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Add: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           An array of structures containing:           &lt;ul&gt;             &lt;li&gt;a string channel type&lt;/li&gt;             &lt;li&gt;a bitwise OR of type specific capability flags&lt;/li&gt;           &lt;/ul&gt;
+ * @in_Remove: Used to pass an 'in' argument: An array of D-Bus interface names of channel types to remove
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a AdvertiseCapabilities method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Used by user interfaces to indicate which channel types they are able         to handle on this connection. Because these may be provided by         different client processes, this method accepts channel types to add         and remove from the set already advertised on this connection. The type         of advertised capabilities (create versus invite) is protocol-dependent         and hence cannot be set by the this method. In the case of a client         adding an already advertised channel type but with new channel type         specific flags, the connection manager should simply add the new flags         to the set of advertised capabilities.&lt;/p&gt;          &lt;p&gt;Upon a successful invocation of this method, the         &lt;tp:member-ref&gt;CapabilitiesChanged&lt;/tp:member-ref&gt;         signal will be emitted for the user&apos;s own handle ( &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy&quot;&gt;Connection.GetSelfHandle&lt;/tp:dbus-ref&gt;)         by the connection manager to indicate the changes         that have been made.  This signal should also be monitored to ensure         that the set is kept accurate - for example, a client may remove         capabilities or type specific capability flags when it exits         which are still provided by another client.&lt;/p&gt;          &lt;p&gt;On connections managed by the &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy&quot;&gt;ChannelDispatcher&lt;/tp:dbus-ref&gt;,           this method SHOULD NOT be used by clients other than the           ChannelDispatcher itself.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_capabilities_callback_for_get_capabilities:
+ * @proxy: the proxy on which the call was made
+ * @out_Contact_Capabilities: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           An array of structures containing:           &lt;ul&gt;             &lt;li&gt;an integer handle representing the contact&lt;/li&gt;             &lt;li&gt;a string channel type&lt;/li&gt;             &lt;li&gt;a bitwise OR of generic capability flags for the type&lt;/li&gt;             &lt;li&gt;a bitwise OR of type specific capability flags for the type&lt;/li&gt;           &lt;/ul&gt;
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetCapabilities method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_capabilities_call_get_capabilities:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Handles: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;An array of contact handles for this connection.&lt;/p&gt;            &lt;p&gt;This may include zero, which originally meant a query for             capabilities available on the connection itself. This usage             is deprecated; clients SHOULD NOT do this, and connection managers             SHOULD proceed as though zero had not been present in this             list.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetCapabilities method call.
+ *
+ * Returns an array of capabilities for the given contact handles.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_cellular_signal_callback_imsi_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_cellular_connect_to_imsi_changed ()
+ *  was called
+ * @arg_IMSI: The new IMSI value.  This may be an empty string in the case where           the IMSI is being reset or removed.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal IMSIChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_cellular_connect_to_imsi_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal IMSIChanged.
+ *
+ * Emitted when the IMSI for the connection changes.  This sort of thing         is rare, but could happen on cellular phones that allow hot-swapping         of SIM cards.  In the case of SIM swapping, this signal would be         emitted twice; the first time while the SIM is being ejected (with an         empty string), and the second time after a new SIM has been inserted         (assuming that the IMSI can be determined from the new SIM).
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_client_types_signal_callback_client_types_updated:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_client_types_connect_to_client_types_updated ()
+ *  was called
+ * @arg_Contact: The contact. (#TpContactHandle)
+ * @arg_Client_Types: The contact&apos;s client types, or an empty list to indicate that nothing           is known about the contact&apos;s client types.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal ClientTypesUpdated.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_client_types_connect_to_client_types_updated:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal ClientTypesUpdated.
+ *
+ * Emitted when a contact&apos;s client types change or become known.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_client_types_callback_for_get_client_types:
+ * @proxy: the proxy on which the call was made
+ * @out_Client_Types: Used to return an 'out' argument if @error is %NULL: The contacts&apos; client types, if already known. Contacts whose client           types are not already known are omitted from the mapping; contacts known           to have no client type information appear in the mapping with an empty           list.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetClientTypes method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_client_types_call_get_client_types:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: The contacts whose client types should be returned or signalled.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetClientTypes method call.
+ *
+ * Return the client types of the given contacts, if they are         already known. If any of the given contacts&apos; client types are         not known, request their current client types, but return         immediately without waiting for a reply; if a reply with a         non-empty client type array is later received for those         contacts, the         &lt;tp:member-ref&gt;ClientTypesUpdated&lt;/tp:member-ref&gt; signal will         be emitted for them.          &lt;tp:rationale&gt;           This method is appropriate for &amp;quot;lazy&amp;quot; client type finding, for instance           displaying the client types (if available) of everyone in your contact           list.         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_client_types_callback_for_request_client_types:
+ * @proxy: the proxy on which the call was made
+ * @out_Client_Types: Used to return an 'out' argument if @error is %NULL: The contact&apos;s client types. It MAY be empty, indicating that no client           type information was found.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestClientTypes method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_client_types_call_request_client_types:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contact: Used to pass an 'in' argument: The contact whose client types should be returned. (#TpContactHandle)
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestClientTypes method call.
+ *
+ * Return the current client types of the given contact. If necessary, make         a request to the server for up-to-date information, and wait for a         reply.          &lt;tp:rationale&gt;           This method is appropriate for use in a &amp;quot;Contact Information...&amp;quot;           dialog; it can be used to show progress information (while waiting           for the method to return), and can distinguish between various error           conditions.         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_blocking_signal_callback_blocked_contacts_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_contact_blocking_connect_to_blocked_contacts_changed ()
+ *  was called
+ * @arg_Blocked_Contacts: Contacts added to the result of           &lt;tp:member-ref&gt;RequestBlockedContacts&lt;/tp:member-ref&gt;.
+ * @arg_Unblocked_Contacts: Contacts removed from the result of           &lt;tp:member-ref&gt;RequestBlockedContacts&lt;/tp:member-ref&gt;.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal BlockedContactsChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_blocking_connect_to_blocked_contacts_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal BlockedContactsChanged.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Emitted when the list of blocked contacts is first retrieved           (before returning from any pending calls to           &lt;tp:member-ref&gt;RequestBlockedContacts&lt;/tp:member-ref&gt;), and           whenever the list of blocked contacts subsequently changes.&lt;/p&gt;
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_blocking_callback_for_block_contacts:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a BlockContacts method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_blocking_call_block_contacts:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: Some contacts to block. If some of the contacts in this           list are already blocked, the connection manager MUST act as if they           were not specified in this list.
+ * @in_Report_Abusive: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;In addition to blocking, report these contacts as abusive to the             server administrators.&lt;/p&gt;            &lt;p&gt;Clients can determine whether this capability is available by             checking the             &lt;tp:member-ref&gt;ContactBlockingCapabilities&lt;/tp:member-ref&gt;             property. If this argument is set to &lt;code&gt;True&lt;/code&gt; by a client             despite &lt;tp:member-ref&gt;ContactBlockingCapabilities&lt;/tp:member-ref&gt;             not containing the &lt;code&gt;Can_Report_Abusive&lt;/code&gt; flag, the             connection manager SHOULD act as if it were &lt;code&gt;False&lt;/code&gt; and             simply block the supplied contacts.&lt;/p&gt;            &lt;tp:rationale&gt;             &lt;p&gt;A correct user interface shouldn&apos;t get this far without knowing               that reporting abusive contacts is not supported. If it does,               then the user has expressed their intention to block these               contacts. Returning an error would leave the UI with three               options:&lt;/p&gt;              &lt;ul&gt;               &lt;li&gt;Ignore the error, leaving the contacts not actually blocked;&lt;/li&gt;               &lt;li&gt;Display an error to the user;&lt;/li&gt;               &lt;li&gt;Call this method again, passing &lt;code&gt;False&lt;/code&gt; for this               argument.&lt;/li&gt;             &lt;/ul&gt;              &lt;p&gt;None of these seem preferable to the CM just ignoring this flag               if it doesn&apos;t support it: that way, the contacts will be blocked,               as the user requested, and UIs have fewer ways to mess up               entirely.&lt;/p&gt;           &lt;/tp:rationale&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a BlockContacts method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Direct the server to block some contacts. The precise effect is           protocol-dependent, but SHOULD include ignoring all current and           subsequent communications from the given contacts, avoiding sending           presence to them in future, and if they were already receiving the           local user&apos;s presence, behaving as if the local user went           offline.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_blocking_callback_for_unblock_contacts:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a UnblockContacts method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_blocking_call_unblock_contacts:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: Some contacts to unblock. If some of the contacts in this           list are not currently blocked, the connection manager MUST act as if           they were not specified in this list.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a UnblockContacts method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Direct the server to unblock some contacts.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_blocking_callback_for_request_blocked_contacts:
+ * @proxy: the proxy on which the call was made
+ * @out_Contacts: Used to return an 'out' argument if @error is %NULL: The blocked contacts’ handles, together with their           identifiers.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestBlockedContacts method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_blocking_call_request_blocked_contacts:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestBlockedContacts method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;List the contacts that are blocked.&lt;/p&gt;          &lt;p&gt;Clients SHOULD allow a relatively long timeout for calls to this           method, since on some protocols contact blocking is part of the           contact list, which can take a significant time to retrieve.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_capabilities_signal_callback_contact_capabilities_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_contact_capabilities_connect_to_contact_capabilities_changed ()
+ *  was called
+ * @arg_caps: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           All the capabilities of the contacts
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal ContactCapabilitiesChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_capabilities_connect_to_contact_capabilities_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal ContactCapabilitiesChanged.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Announce that there has been a change of capabilities on the           given handles. A single signal can be emitted for several         contacts.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;The underlying protocol can get several contacts&apos; capabilities at             the same time.&lt;/p&gt;         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_capabilities_callback_for_update_capabilities:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a UpdateCapabilities method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_capabilities_call_update_capabilities:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Handler_Capabilities: Used to pass an 'in' argument: &lt;p&gt;The capabilities of one or more clients.&lt;/p&gt;            &lt;p&gt;For each client in the given list, any capabilities previously             advertised for the same client name are discarded, then replaced by             the capabilities indicated.&lt;/p&gt;            &lt;p&gt;As a result, if a client becomes unavailable, this method SHOULD             be called with a &lt;tp:type&gt;Handler_Capabilities&lt;/tp:type&gt; structure             containing its name, an empty list of channel classes, and an             empty list of capabilities. When this is done, the connection             manager SHOULD free all memory associated with that client name.&lt;/p&gt;            &lt;tp:rationale&gt;             &lt;p&gt;This method takes a list of clients so that               when the channel dispatcher first calls it (with a list of all               the Handlers that are initially available), the changes can be               made atomically, with only one transmission of updated               capabilities to the network. Afterwards, the channel dispatcher               will call this method with a single-element list every time               a Handler becomes available or unavailable.&lt;/p&gt;           &lt;/tp:rationale&gt;            &lt;p&gt;The connection manager MUST ignore any channel classes and client             capabilities for which there is no representation in the protocol             or no support in the connection manager.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a UpdateCapabilities method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Alter the connection&apos;s advertised capabilities to include           the intersection of the given clients&apos; capabilities with what the           connection manager is able to implement.&lt;/p&gt;          &lt;p&gt;On connections managed by the ChannelDispatcher, processes other           than the ChannelDispatcher SHOULD NOT call this method, and the           ChannelDispatcher SHOULD use this method to advertise the           capabilities of all the registered &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy&quot;&gt;Client.Handler&lt;/tp:dbus-ref&gt;           implementations.On connections not managed by the ChannelDispatcher,           clients MAY use this method directly, to indicate the channels they           will handle and the extra capabilities they have.&lt;/p&gt;          &lt;p&gt;Upon a successful invocation of this method, the connection manager           will only emit the           &lt;tp:member-ref&gt;ContactCapabilitiesChanged&lt;/tp:member-ref&gt; signal           for the user&apos;s &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection&quot;&gt;SelfHandle&lt;/tp:dbus-ref&gt;           if, in the underlying protocol, the new capabilities are distinct           from the previous state.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;The connection manager will essentially intersect the provided             capabilities and the channel classes it implements. Therefore,             certain properties which are never fixed for a channel class             (such as the target handle, or the Parameters property of a tube             channel) will almost certainly not be advertised.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;This method MAY be called on a newly-created connection while it           is still in the DISCONNECTED state, to request that when the           connection connects, it will do so with the appropriate           capabilities. Doing so MUST NOT fail.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_capabilities_callback_for_get_contact_capabilities:
+ * @proxy: the proxy on which the call was made
+ * @out_Contact_Capabilities: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A map from contact handles to lists of requestable channel             classes, representing the channel requests that are expected             to succeed for that contact.&lt;/p&gt;            &lt;p&gt;Contacts listed among Handles whose capabilities are unknown             SHOULD be omitted from this map; contacts known to have an empty             set of capabilities SHOULD be included in the keys of this map,             with an empty array as the corresponding value.&lt;/p&gt;
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetContactCapabilities method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_capabilities_call_get_contact_capabilities:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Handles: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;An array of contact handles for this connection.&lt;/p&gt;            &lt;p&gt;The handle zero MUST NOT be included in the request.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetContactCapabilities method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Returns an array of requestable channel classes for the given           contact handles, representing the channel requests that are           expected to succeed.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_signal_callback_groups_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_contact_groups_connect_to_groups_changed ()
+ *  was called
+ * @arg_Contact: The relevant contacts.
+ * @arg_Added: The names of groups to which the contacts were           added.
+ * @arg_Removed: The names of groups from which the contacts were           removed.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal GroupsChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_connect_to_groups_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal GroupsChanged.
+ *
+ * Emitted when contacts&apos; groups change.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_signal_callback_groups_created:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_contact_groups_connect_to_groups_created ()
+ *  was called
+ * @arg_Names: The names of the new groups.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal GroupsCreated.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_connect_to_groups_created:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal GroupsCreated.
+ *
+ * Emitted when new, empty groups are created. This will often be         followed by &lt;tp:member-ref&gt;GroupsChanged&lt;/tp:member-ref&gt; signals that         add some members.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_signal_callback_group_renamed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_contact_groups_connect_to_group_renamed ()
+ *  was called
+ * @arg_Old_Name: The old name of the group.
+ * @arg_New_Name: The new name of the group.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal GroupRenamed.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_connect_to_group_renamed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal GroupRenamed.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Emitted when a group is renamed, in protocols where this can           be distinguished from group creation, removal and membership           changes.&lt;/p&gt;          &lt;p&gt;Immediately after this signal is emitted,           &lt;tp:member-ref&gt;GroupsCreated&lt;/tp:member-ref&gt; MUST signal the           creation of a group with the new name, and           &lt;tp:member-ref&gt;GroupsRemoved&lt;/tp:member-ref&gt; MUST signal the           removal of a group with the old name.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;Emitting these extra signals, in this order, means that clients             that are interested in the set of groups that exist (but treat a             rename and a create/remove pair identically) can ignore the             GroupRenamed signal entirely.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;If the group was not empty, immediately after those signals are           emitted, &lt;tp:member-ref&gt;GroupsChanged&lt;/tp:member-ref&gt; MUST signal           that the members of that group were removed from the old name           and added to the new name.&lt;/p&gt;          &lt;p&gt;On connection managers where groups behave like tags, renaming a           group MAY be signalled as a set of           &lt;tp:member-ref&gt;GroupsCreated&lt;/tp:member-ref&gt;,           &lt;tp:member-ref&gt;GroupsRemoved&lt;/tp:member-ref&gt; and           &lt;tp:member-ref&gt;GroupsChanged&lt;/tp:member-ref&gt; signals, instead of           emitting this signal.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;On protocols like XMPP, another resource &amp;quot;renaming a group&amp;quot; is             indistinguishable from changing contacts&apos; groups individually.&lt;/p&gt;         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_signal_callback_groups_removed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_contact_groups_connect_to_groups_removed ()
+ *  was called
+ * @arg_Names: The names of the groups.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal GroupsRemoved.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_connect_to_groups_removed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal GroupsRemoved.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Emitted when one or more groups are removed. If they had members at           the time that they were removed, then immediately after this signal           is emitted, &lt;tp:member-ref&gt;GroupsChanged&lt;/tp:member-ref&gt; MUST signal           that their members were removed.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;Emitting the signals in this order allows for two modes of             operation. A client interested only in a contact&apos;s set of groups             can ignore &lt;tp:member-ref&gt;GroupsRemoved&lt;/tp:member-ref&gt; and rely             on the &lt;tp:member-ref&gt;GroupsChanged&lt;/tp:member-ref&gt; signal that             will follow; a more elaborate client wishing to distinguish between             all of a group&apos;s members being removed, and the group itself             being removed, can additionally watch for             &lt;tp:member-ref&gt;GroupsRemoved&lt;/tp:member-ref&gt; and use it to             disambiguate.&lt;/p&gt;         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_callback_for_set_contact_groups:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a SetContactGroups method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_call_set_contact_groups:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contact: Used to pass an 'in' argument: The contact to alter. (#TpContactHandle)
+ * @in_Groups: Used to pass an 'in' argument: The set of groups which the contact should be           in.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a SetContactGroups method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Add the given contact to the given groups (creating new groups           if necessary), and remove them from all other groups.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;This is the easiest and most correct way to implement user             interfaces that display a single contact with a list of groups,             resulting in a user expectation that when they apply the changes,             the contact&apos;s set of groups will become exactly what was             displayed.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;If the user is removed from a group of which they were the only           member, the group MAY be removed automatically.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;In protocols like XMPP where groups behave like tags, a group             with no members has no protocol representation.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;Any &lt;tp:member-ref&gt;GroupsCreated&lt;/tp:member-ref&gt;,           &lt;tp:member-ref&gt;GroupsChanged&lt;/tp:member-ref&gt; and           &lt;tp:member-ref&gt;GroupsRemoved&lt;/tp:member-ref&gt; signals that result from           this method call MUST be emitted before the method returns.&lt;/p&gt;          &lt;p&gt;This method SHOULD NOT be called until the           &lt;tp:dbus-ref namespace=&quot;ofdT.Connection.Interface.ContactList&quot;&gt;ContactListState&lt;/tp:dbus-ref&gt; changes to Success.           If the ContactListState is Failure, this method SHOULD raise the           same error as           &lt;tp:dbus-ref namespace=&quot;ofdT.Connection.Interface.ContactList&quot;&gt;GetContactListAttributes&lt;/tp:dbus-ref&gt;.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_callback_for_set_group_members:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a SetGroupMembers method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_call_set_group_members:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Group: Used to pass an 'in' argument: The group to alter.
+ * @in_Members: Used to pass an 'in' argument: The set of members for the group. If this set is           empty, this method MAY remove the group.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a SetGroupMembers method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Add the given members to the given group (creating it if necessary),           and remove all other members.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;This is the easiest and most correct way to implement user             interfaces that display a single group with a list of contacts,             resulting in a user expectation that when they apply the changes,             the groups&apos;s set of members will become exactly what was             displayed.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;If &lt;tp:member-ref&gt;DisjointGroups&lt;/tp:member-ref&gt; is true,           this will also remove each member from their previous group.&lt;/p&gt;          &lt;p&gt;If the user is removed from a group of which they were the only           member, the group MAY be removed automatically.&lt;/p&gt;          &lt;p&gt;Any &lt;tp:member-ref&gt;GroupsCreated&lt;/tp:member-ref&gt;,           &lt;tp:member-ref&gt;GroupsChanged&lt;/tp:member-ref&gt; and           &lt;tp:member-ref&gt;GroupsRemoved&lt;/tp:member-ref&gt; signals that result from           this method call MUST be emitted before the method returns.&lt;/p&gt;          &lt;p&gt;This method SHOULD NOT be called until the           &lt;tp:dbus-ref namespace=&quot;ofdT.Connection.Interface.ContactList&quot;&gt;ContactListState&lt;/tp:dbus-ref&gt; changes to Success.           If the ContactListState is Failure, this method SHOULD raise the           same error as           &lt;tp:dbus-ref namespace=&quot;ofdT.Connection.Interface.ContactList&quot;&gt;GetContactListAttributes&lt;/tp:dbus-ref&gt;.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_callback_for_add_to_group:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a AddToGroup method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_call_add_to_group:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Group: Used to pass an 'in' argument: The group to alter.
+ * @in_Members: Used to pass an 'in' argument: The set of members to include in the group.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a AddToGroup method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Add the given members to the given group, creating it if           necessary.&lt;/p&gt;          &lt;p&gt;If &lt;tp:member-ref&gt;DisjointGroups&lt;/tp:member-ref&gt; is true,           this will also remove each member from their previous group.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;This is good for user interfaces in which you can edit groups             via drag-and-drop.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;Any &lt;tp:member-ref&gt;GroupsCreated&lt;/tp:member-ref&gt;,           &lt;tp:member-ref&gt;GroupsChanged&lt;/tp:member-ref&gt; and           &lt;tp:member-ref&gt;GroupsRemoved&lt;/tp:member-ref&gt; signals that result from           this method call MUST be emitted before the method returns.&lt;/p&gt;          &lt;p&gt;This method SHOULD NOT be called until the           &lt;tp:dbus-ref namespace=&quot;ofdT.Connection.Interface.ContactList&quot;&gt;ContactListState&lt;/tp:dbus-ref&gt; changes to Success.           If the ContactListState is Failure, this method SHOULD raise the           same error as           &lt;tp:dbus-ref namespace=&quot;ofdT.Connection.Interface.ContactList&quot;&gt;GetContactListAttributes&lt;/tp:dbus-ref&gt;.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_callback_for_remove_from_group:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RemoveFromGroup method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_call_remove_from_group:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Group: Used to pass an 'in' argument: The group to alter. If it does not exist, then it has           no members by definition, so this method SHOULD return           successfully.
+ * @in_Members: Used to pass an 'in' argument: The set of members to remove from the group. It is not           an error to remove members who are already not in the group.           If there are no members left in the group afterwards, the group MAY           itself be removed.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RemoveFromGroup method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Remove the given members from the given group.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;This is good for user interfaces in which you can edit groups             via drag-and-drop.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;Any &lt;tp:member-ref&gt;GroupsChanged&lt;/tp:member-ref&gt; or           &lt;tp:member-ref&gt;GroupsRemoved&lt;/tp:member-ref&gt; signals that result from           this method call MUST be emitted before the method returns.&lt;/p&gt;          &lt;p&gt;This method SHOULD NOT be called until the           &lt;tp:dbus-ref namespace=&quot;ofdT.Connection.Interface.ContactList&quot;&gt;ContactListState&lt;/tp:dbus-ref&gt; changes to Success.           If the ContactListState is Failure, this method SHOULD raise the           same error as           &lt;tp:dbus-ref namespace=&quot;ofdT.Connection.Interface.ContactList&quot;&gt;GetContactListAttributes&lt;/tp:dbus-ref&gt;.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_callback_for_remove_group:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RemoveGroup method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_call_remove_group:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Group: Used to pass an 'in' argument: The group to remove.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RemoveGroup method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Remove all members from the given group, then remove the group           itself. If the group already does not exist, this method SHOULD           return successfully.&lt;/p&gt;          &lt;p&gt;Any &lt;tp:member-ref&gt;GroupsChanged&lt;/tp:member-ref&gt; or           &lt;tp:member-ref&gt;GroupsRemoved&lt;/tp:member-ref&gt; signals that result from           this method call MUST be emitted before the method returns.&lt;/p&gt;          &lt;p&gt;This method SHOULD NOT be called until the           &lt;tp:dbus-ref namespace=&quot;ofdT.Connection.Interface.ContactList&quot;&gt;ContactListState&lt;/tp:dbus-ref&gt; changes to Success.           If the ContactListState is Failure, this method SHOULD raise the           same error as           &lt;tp:dbus-ref namespace=&quot;ofdT.Connection.Interface.ContactList&quot;&gt;GetContactListAttributes&lt;/tp:dbus-ref&gt;.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_callback_for_rename_group:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RenameGroup method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_groups_call_rename_group:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Old_Name: Used to pass an 'in' argument: The group to rename.
+ * @in_New_Name: Used to pass an 'in' argument: The new name for the group.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RenameGroup method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Rename the given group.&lt;/p&gt;          &lt;p&gt;On protocols where groups behave like tags, this is an API           short-cut for adding all of the group&apos;s members to a group with           the new name, then removing the old group.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;Otherwise, clients can&apos;t perform this operation atomically, even             if the connection could.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;Any &lt;tp:member-ref&gt;GroupRenamed&lt;/tp:member-ref&gt; or           &lt;tp:member-ref&gt;GroupsRemoved&lt;/tp:member-ref&gt; signals that result from           this method call MUST be emitted before the method returns.&lt;/p&gt;          &lt;p&gt;This method SHOULD NOT be called until the           &lt;tp:dbus-ref namespace=&quot;ofdT.Connection.Interface.ContactList&quot;&gt;ContactListState&lt;/tp:dbus-ref&gt; changes to Success.           If the ContactListState is Failure, this method SHOULD raise the           same error as           &lt;tp:dbus-ref namespace=&quot;ofdT.Connection.Interface.ContactList&quot;&gt;GetContactListAttributes&lt;/tp:dbus-ref&gt;.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_info_signal_callback_contact_info_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_contact_info_connect_to_contact_info_changed ()
+ *  was called
+ * @arg_Contact: An integer handle for the contact whose info has changed. (#TpContactHandle)
+ * @arg_ContactInfo: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           An array of fields representing information about this contact.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal ContactInfoChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_info_connect_to_contact_info_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal ContactInfoChanged.
+ *
+ * Emitted when a contact&apos;s information has changed or been received for         the first time on this connection.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_info_callback_for_get_contact_info:
+ * @proxy: the proxy on which the call was made
+ * @out_ContactInfo: Used to return an 'out' argument if @error is %NULL: A dictionary mapping contact handles to information, whose keys are           the subset of the requested list of handles for which information was           cached.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetContactInfo method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_info_call_get_contact_info:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: An array of handles representing contacts.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetContactInfo method call.
+ *
+ * Request information on several contacts at once.  This SHOULD only         return cached information, omitting handles for which no information is         cached from the returned map.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_info_callback_for_refresh_contact_info:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RefreshContactInfo method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_info_call_refresh_contact_info:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: Integer handles for contacts.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RefreshContactInfo method call.
+ *
+ * Retrieve information for the given contact, requesting it from the         network if an up-to-date version is not cached locally. This method         SHOULD return immediately, emitting         &lt;tp:member-ref&gt;ContactInfoChanged&lt;/tp:member-ref&gt; when the contacts&apos;         updated contact information is returned.          &lt;tp:rationale&gt;           This method allows a client with cached contact information to           update its cache after a number of days.         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_info_callback_for_request_contact_info:
+ * @proxy: the proxy on which the call was made
+ * @out_Contact_Info: Used to return an 'out' argument if @error is %NULL: Information about that contact.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestContactInfo method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_info_call_request_contact_info:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contact: Used to pass an 'in' argument: An integer handle for a contact. (#TpContactHandle)
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestContactInfo method call.
+ *
+ * Retrieve information for a contact, requesting it from the network if         it is not cached locally.          &lt;tp:rationale&gt;           This method is appropriate for an explicit user request to show           a contact&apos;s information; it allows a UI to wait for the contact           info to be returned.         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_info_callback_for_set_contact_info:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a SetContactInfo method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_info_call_set_contact_info:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_ContactInfo: Used to pass an 'in' argument: The new information to be set.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a SetContactInfo method call.
+ *
+ * Set new contact information for this connection, replacing existing         information.  This method is only suppported if         &lt;tp:member-ref&gt;ContactInfoFlags&lt;/tp:member-ref&gt; contains         &lt;code&gt;Can_Set&lt;/code&gt;, and may only be passed fields conforming to         &lt;tp:member-ref&gt;SupportedFields&lt;/tp:member-ref&gt;.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_signal_callback_contact_list_state_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_contact_list_connect_to_contact_list_state_changed ()
+ *  was called
+ * @arg_Contact_List_State: The new value of &lt;tp:member-ref&gt;ContactListState&lt;/tp:member-ref&gt;. (#TpContactListState)
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal ContactListStateChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_connect_to_contact_list_state_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal ContactListStateChanged.
+ *
+ * Emitted when &lt;tp:member-ref&gt;ContactListState&lt;/tp:member-ref&gt;         changes.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_signal_callback_contacts_changed_with_id:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_contact_list_connect_to_contacts_changed_with_id ()
+ *  was called
+ * @arg_Changes: The new &lt;tp:token-ref&gt;subscribe&lt;/tp:token-ref&gt;,             &lt;tp:token-ref&gt;publish&lt;/tp:token-ref&gt; and             &lt;tp:token-ref&gt;publish-request&lt;/tp:token-ref&gt; attributes of all the           contacts that have been added, and all the contacts for which those           attributes have changed.
+ * @arg_Identifiers: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           The identifiers of the contacts in the &lt;var&gt;Changes&lt;/var&gt; map.
+ * @arg_Removals: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           The contacts that have been removed from the list that would be           returned by           &lt;tp:member-ref&gt;GetContactListAttributes&lt;/tp:member-ref&gt;.           This also implies that they have subscribe = No and publish = No;           contacts MUST NOT be listed both here and in &lt;var&gt;Changes&lt;/var&gt;.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal ContactsChangedWithID.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_connect_to_contacts_changed_with_id:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal ContactsChangedWithID.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Emitted when the contact list becomes available, when contacts&apos;           basic stored properties change, when new contacts are added to the           list that would be returned by           &lt;tp:member-ref&gt;GetContactListAttributes&lt;/tp:member-ref&gt;,           or when contacts are removed from that list.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;This provides change notification for that list, and for             contacts&apos; &lt;tp:token-ref&gt;subscribe&lt;/tp:token-ref&gt;,             &lt;tp:token-ref&gt;publish&lt;/tp:token-ref&gt; and             &lt;tp:token-ref&gt;publish-request&lt;/tp:token-ref&gt; attributes.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;Connection managers SHOULD also emit this signal when a contact           requests that the user&apos;s presence is published to them, even if           that contact&apos;s &lt;tp:token&gt;publish&lt;/tp:token&gt; attribute is already           Ask and the &lt;tp:token&gt;publish-request&lt;/tp:token&gt; has not changed.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;If the same contact sends 10 identical requests, 10 identical             signals should be emitted.&lt;/p&gt;         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_signal_callback_contacts_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_contact_list_connect_to_contacts_changed ()
+ *  was called
+ * @arg_Changes: The same as the corresponding argument to           &lt;tp:member-ref&gt;ContactsChangedWithID&lt;/tp:member-ref&gt;.
+ * @arg_Removals: The same as the corresponding argument to           &lt;tp:member-ref&gt;ContactsChangedWithID&lt;/tp:member-ref&gt;, except that it           only includes handles and not identifiers.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal ContactsChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_connect_to_contacts_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal ContactsChanged.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Emitted immediately after           &lt;tp:member-ref&gt;ContactsChangedWithID&lt;/tp:member-ref&gt;, under the same           circumstances.&lt;/p&gt;          &lt;p&gt;If clients receive this signal without first receiving a           corresponding &lt;tp:member-ref&gt;ContactsChangedWithID&lt;/tp:member-ref&gt;,           they MUST assume that only this signal will be emitted.&lt;/p&gt;
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_callback_for_get_contact_list_attributes:
+ * @proxy: the proxy on which the call was made
+ * @out_Attributes: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A dictionary mapping the contact handles to contact attributes,             equivalent to the result of &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection.Interface.Contacts&quot;&gt;GetContactAttributes&lt;/tp:dbus-ref&gt;.&lt;/p&gt;
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetContactListAttributes method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_call_get_contact_list_attributes:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Interfaces: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A list of strings indicating which D-Bus interfaces the calling             process is interested in. Equivalent to the corresponding argument             to &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection.Interface.Contacts&quot;&gt;GetContactAttributes&lt;/tp:dbus-ref&gt;,             except that if this list does not contain the ContactList             interface itself, it is treated as though that interface was also             requested.&lt;/p&gt;
+ * @in_Hold: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;If true, all handles that appear as keys in the result have been             held on behalf of the calling process, as if by a call to             &lt;tp:dbus-ref namespace=&quot;ofdT&quot;&gt;Connection.HoldHandles&lt;/tp:dbus-ref&gt;.             (If &lt;tp:dbus-ref namespace=&quot;ofdT.Connection&quot;&gt;HasImmortalHandles&lt;/tp:dbus-ref&gt; is true, which SHOULD be the             case in all new connection managers, this has no effect.)&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetContactListAttributes method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Return some contact attributes for a list of contacts           associated with the user. This list MUST include at least:&lt;/p&gt;          &lt;ul&gt;           &lt;li&gt;all contacts whose &lt;tp:token-ref&gt;subscribe&lt;/tp:token-ref&gt;             attribute is not No&lt;/li&gt;           &lt;li&gt;all contacts whose &lt;tp:token-ref&gt;publish&lt;/tp:token-ref&gt;             attribute is not No&lt;/li&gt;         &lt;/ul&gt;          &lt;p&gt;but MAY contain other contacts.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;For instance, on XMPP, all contacts on the roster would appear             here even if they have subscription=&amp;quot;none&amp;quot;, unless there&apos;s             reason to believe the user does not want to see them (such as             having been blocked).&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;This list does not need to contain every visible contact: for           instance, contacts seen in XMPP or IRC chatrooms SHOULD NOT appear           here. Blocked contacts SHOULD NOT appear here, unless they still           have a non-&lt;tt&gt;No&lt;/tt&gt; &lt;tp:token-ref&gt;subscribe&lt;/tp:token-ref&gt; or           &lt;tp:token-ref&gt;publish&lt;/tp:token-ref&gt; attribute           for some reason.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;It&apos;s reasonable to assume that blocked contacts should not be             visible to the user unless they specifically go looking for them,             at least in protocols like XMPP where blocking a contact             suppresses presence.&lt;/p&gt;         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_callback_for_request_subscription:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestSubscription method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_call_request_subscription:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;One or more contacts to whom requests are to be sent.&lt;/p&gt;
+ * @in_Message: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;An optional plain-text message from the user, to send to those             contacts with the subscription request. The             &lt;tp:member-ref&gt;RequestUsesMessage&lt;/tp:member-ref&gt; property             indicates whether this message will be used or ignored.&lt;/p&gt;            &lt;p&gt;Clients SHOULD NOT send a non-empty message without first giving             the user an opportunity to edit it.&lt;/p&gt;            &lt;tp:rationale&gt;             &lt;p&gt;These messages are typically presented to the remote contact               as if the user had typed them, so as a minimum, the user should be               allowed to see what the UI will be saying on their behalf.&lt;/p&gt;           &lt;/tp:rationale&gt;            &lt;p&gt;Connections where this message is not useful MUST still allow it to             be non-empty.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestSubscription method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Request that the given contacts allow the local user to           subscribe to their presence, i.e. that their subscribe attribute           becomes Yes.&lt;/p&gt;          &lt;p&gt;Connection managers SHOULD NOT attempt to enforce a           mutual-subscription policy (i.e. when this method is called, they           should not automatically allow the contacts to see the local user&apos;s           presence). User interfaces that require mutual subscription           MAY call &lt;tp:member-ref&gt;AuthorizePublication&lt;/tp:member-ref&gt;           at the same time as this method.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;Whether to enforce mutual subscription is a matter of policy,             so it is left to the user interface and/or the server.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;Before calling this method on a connection where &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection.Interface.Aliasing&quot;&gt;GetAliasFlags&lt;/tp:dbus-ref&gt; returns the &lt;code&gt;User_Set&lt;/code&gt; flag,           user interfaces SHOULD obtain, from the user, an alias to           identify the contact in future, and store it using &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection.Interface.Aliasing&quot;&gt;SetAliases&lt;/tp:dbus-ref&gt;.&lt;/p&gt;          &lt;p&gt;The user MAY be           prompted using the contact&apos;s current self-assigned nickname, or           something derived from the contact&apos;s (presumably self-assigned)           identifier, as a default, but these names chosen by the contact           SHOULD NOT be used without user approval.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;This is a generalization of             &lt;a href=&quot;http://xmpp.org/extensions/xep-0165.html&quot;&gt;XEP-0165 &amp;quot;Best Practices to Discourage JID Mimicking&amp;quot;&lt;/a&gt;)             to protocols other than XMPP. A reasonable user interface for             this, as used in many XMPP clients, is to have a text entry             for the alias adjacent to the text entry for the identifier             to add.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;For contacts with subscribe=Yes, this method has no effect.           It MUST return successfully if all contacts are in this state.&lt;/p&gt;          &lt;p&gt;For contacts with subscribe=Ask, this method SHOULD send a new           request, with the given message, if allowed by the underlying           protocol.&lt;/p&gt;          &lt;p&gt;For contacts with subscribe=No or subscribe=Rejected, this method           SHOULD request that the contact allows the local user to subscribe           to their presence; in general, this will change their publish           attribute to Ask (although it could change directly to Yes in some           situations).&lt;/p&gt;          &lt;p&gt;Any state changes that immediately result from this request MUST           be signalled via &lt;tp:member-ref&gt;ContactsChanged&lt;/tp:member-ref&gt;           before this method returns.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;This makes it easy for user interfaces to see what practical             effect this method had.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;If the remote contact accepts the request, their subscribe           attribute will later change from Ask to Yes.&lt;/p&gt;          &lt;p&gt;If the remote contact explicitly rejects the request (in protocols           that allow this), their subscribe attribute will later change from           Ask to Rejected.&lt;/p&gt;          &lt;p&gt;If the subscription request is cancelled by the local user, the           contact&apos;s subscribe attribute will change from Ask to No.&lt;/p&gt;          &lt;p&gt;This method SHOULD NOT be called until the           &lt;tp:member-ref&gt;ContactListState&lt;/tp:member-ref&gt; changes to Success.           If the &lt;tp:member-ref&gt;ContactListState&lt;/tp:member-ref&gt; changes to           Failure, this method SHOULD raise the same error as           &lt;tp:member-ref&gt;GetContactListAttributes&lt;/tp:member-ref&gt;.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_callback_for_authorize_publication:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a AuthorizePublication method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_call_authorize_publication:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;One or more contacts to authorize.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a AuthorizePublication method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;For each of the given contacts, request that the local user&apos;s           presence is sent to that contact, i.e. that their publish attribute           becomes Yes.&lt;/p&gt;          &lt;p&gt;Connection managers SHOULD NOT attempt to enforce a           mutual-subscription policy (i.e. when this method is called, they           should not automatically request that the contacts allow the user to           subscribe to their presence). User interfaces that require mutual           subscription MAY call           &lt;tp:member-ref&gt;RequestSubscription&lt;/tp:member-ref&gt; at the same time           as this method.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;Whether to enforce mutual subscription is a matter of policy,             so it is left to the user interface and/or the server.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;For contacts with publish=Yes, this method has no effect; it           MUST return successfully if all contacts given have this state.&lt;/p&gt;          &lt;p&gt;For contacts with publish=Ask, this method accepts the           contact&apos;s request to see the local user&apos;s presence, changing           their publish attribute from Ask to Yes.&lt;/p&gt;          &lt;p&gt;For contacts with publish=No, if the protocol allows it, this           method allows the contacts to see the local user&apos;s presence even           though they have not requested it, changing their publish attribute           from No to Yes. Otherwise, it merely records the fact that           presence publication to those contacts is allowed; if any of           those contacts ask to receive the local user&apos;s presence           later in the lifetime of the connection, the connection SHOULD           immediately allow them to do so, changing their publish           attribute directly from No to Yes.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;This makes it easy to implement the common UI policy that if             the user attempts to subscribe to a contact&apos;s presence, requests             for reciprocal subscription are automatically approved.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;Any state changes that immediately result from this request MUST           be signalled via &lt;tp:member-ref&gt;ContactsChanged&lt;/tp:member-ref&gt;           before this method returns.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;This makes it easy for user interfaces to see what practical             effect this method had.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;This method SHOULD NOT be called until the           &lt;tp:member-ref&gt;ContactListState&lt;/tp:member-ref&gt; changes to Success.           If the &lt;tp:member-ref&gt;ContactListState&lt;/tp:member-ref&gt; changes to           Failure, this method SHOULD raise the same error as           &lt;tp:member-ref&gt;GetContactListAttributes&lt;/tp:member-ref&gt;.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_callback_for_remove_contacts:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RemoveContacts method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_call_remove_contacts:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;One or more contacts to remove.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RemoveContacts method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Remove the given contacts from the contact list entirely. It is           protocol-dependent whether this works, and under which           circumstances.&lt;/p&gt;          &lt;p&gt;If possible, this method SHOULD set the contacts&apos; subscribe and           publish attributes to No, remove any stored aliases for those           contacts, and remove the contacts from the result of           &lt;tp:member-ref&gt;GetContactListAttributes&lt;/tp:member-ref&gt;.&lt;/p&gt;          &lt;p&gt;This method SHOULD succeed even if it was not possible to carry out           the request entirely or for all contacts (for instance, if there is an           outstanding request to subscribe to the contact&apos;s presence, and it&apos;s           not possible to cancel such requests). However, all signals that           immediately result from this method call MUST be emitted before it           returns, so that clients can interpret the result.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;User interfaces removing a contact from the contact list are             unlikely to want spurious failure notifications resulting from             limitations of a particular protocol. However, emitting the             signals first means that if a client does want to check exactly             what happened, it can wait for the method to return (while             applying change-notification signals to its local cache of the             contact list&apos;s state), then consult its local cache of the             contact list&apos;s state to see whether the contact is still there.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;This method SHOULD NOT be called until the           &lt;tp:member-ref&gt;ContactListState&lt;/tp:member-ref&gt; changes to Success.           If the &lt;tp:member-ref&gt;ContactListState&lt;/tp:member-ref&gt; changes to           Failure, this method SHOULD raise the same error as           &lt;tp:member-ref&gt;GetContactListAttributes&lt;/tp:member-ref&gt;.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_callback_for_unsubscribe:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a Unsubscribe method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_call_unsubscribe:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;One or more contacts to remove.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a Unsubscribe method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Attempt to set the given contacts&apos; subscribe attribute to No,           i.e. stop receiving their presence.&lt;/p&gt;          &lt;p&gt;For contacts with subscribe=Ask, this attempts to cancel           an earlier request to subscribe to the contact&apos;s presence; for           contacts with subscribe=Yes, this attempts to           unsubscribe from the contact&apos;s presence.&lt;/p&gt;          &lt;p&gt;As with &lt;tp:member-ref&gt;RemoveContacts&lt;/tp:member-ref&gt;, this method           SHOULD succeed even if it was not possible to carry out the request           entirely or for all contacts; however, all signals that           immediately result from this method call MUST be emitted before it           returns.&lt;/p&gt;          &lt;p&gt;This method SHOULD NOT be called until the           &lt;tp:member-ref&gt;ContactListState&lt;/tp:member-ref&gt; changes to Success.           If the &lt;tp:member-ref&gt;ContactListState&lt;/tp:member-ref&gt; changes to           Failure, this method SHOULD raise the same error as           &lt;tp:member-ref&gt;GetContactListAttributes&lt;/tp:member-ref&gt;.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_callback_for_unpublish:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a Unpublish method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_call_unpublish:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;One or more contacts to remove.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a Unpublish method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Attempt to set the given contacts&apos; publish attribute to No,           i.e. stop sending presence to them.&lt;/p&gt;          &lt;p&gt;For contacts with publish=Ask, this method explicitly rejects the           contact&apos;s request to subscribe to the user&apos;s presence; for           contacts with publish=Yes, this method attempts to prevent the           user&apos;s presence from being received by the contact.&lt;/p&gt;          &lt;p&gt;As with &lt;tp:member-ref&gt;RemoveContacts&lt;/tp:member-ref&gt;, this method           SHOULD succeed even if it was not possible to carry out the request           entirely or for all contacts; however, all signals that           immediately result from this method call MUST be emitted before it           returns.&lt;/p&gt;          &lt;p&gt;This method SHOULD NOT be called until the           &lt;tp:member-ref&gt;ContactListState&lt;/tp:member-ref&gt; changes to Success.           If the &lt;tp:member-ref&gt;ContactListState&lt;/tp:member-ref&gt; changes to           Failure, this method SHOULD raise the same error as           &lt;tp:member-ref&gt;GetContactListAttributes&lt;/tp:member-ref&gt;.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_callback_for_download:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a Download method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contact_list_call_download:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a Download method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Download the contact list from the server. If           &lt;tp:member-ref&gt;DownloadAtConnection&lt;/tp:member-ref&gt; is true,           Download does nothing.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contacts_callback_for_get_contact_attributes:
+ * @proxy: the proxy on which the call was made
+ * @out_Attributes: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A dictionary mapping the contact handles to contact attributes.             If any of the requested handles are in fact invalid, they are             simply omitted from this mapping. If contact attributes are not             immediately known, the behaviour is defined by the interface;             the attribute should either be omitted from the result or             replaced with a default value.&lt;/p&gt;            &lt;p&gt;Each contact&apos;s attributes will always include at least the             identifier that would be obtained by inspecting the handle             (&lt;code&gt;org.freedesktop.Telepathy.Connection/contact-id&lt;/code&gt;).&lt;/p&gt;
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetContactAttributes method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contacts_call_get_contact_attributes:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Handles: Used to pass an 'in' argument: An array of handles representing contacts.
+ * @in_Interfaces: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A list of strings indicating which D-Bus interfaces the calling             process is interested in. All supported attributes from these             interfaces, whose values can be obtained without additional network             activity, will be in the reply.&lt;/p&gt;            &lt;p&gt;Connection managers SHOULD ignore interfaces requested which they             do not support (i.e. those not mentioned in the             &lt;tp:member-ref&gt;ContactAttributeInterfaces&lt;/tp:member-ref&gt;             property.)&lt;/p&gt;            &lt;tp:rationale&gt;             &lt;p&gt;This simplifies client-side code. Clients which care may               distinguish between unsupported interfaces (e.g. this Connection               does not support Avatars), and interfaces on which no information               is known for these contacts (e.g. we don&apos;t know the avatar tokens               of any of the contacts, so we omitted them all) by inspecting               &lt;tp:member-ref&gt;ContactAttributeInterfaces&lt;/tp:member-ref&gt;.&lt;/p&gt;           &lt;/tp:rationale&gt;            &lt;p&gt;Attributes from the interface             &lt;tp:dbus-ref&gt;org.freedesktop.Telepathy.Connection&lt;/tp:dbus-ref&gt;             are always returned, and need not be requested explicitly.&lt;/p&gt;            &lt;p&gt;As well as returning cached information immediately, the             connection MAY start asynchronous requests to obtain better             values for the contact attributes. If better values are later             obtained by this process, they will be indicated with the usual             signals (such as &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection.Interface.Aliasing&quot;&gt;AliasesChanged&lt;/tp:dbus-ref&gt;).&lt;/p&gt;            &lt;tp:rationale&gt;             For instance, an XMPP connection manager could download vCards             in response to a request for &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection.Interface&quot;&gt;Aliasing&lt;/tp:dbus-ref&gt;             attributes.           &lt;/tp:rationale&gt;
+ * @in_Hold: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;If true, all handles that appear as keys in the result have been             held on behalf of the calling process, as if by a call to             &lt;tp:dbus-ref namespace=&quot;ofdT&quot;&gt;Connection.HoldHandles&lt;/tp:dbus-ref&gt;.             (If &lt;tp:dbus-ref namespace=&quot;ofdT.Connection&quot;&gt;HasImmortalHandles&lt;/tp:dbus-ref&gt; is true, which SHOULD be the             case in all new connection managers, this has no effect.)&lt;/p&gt;            &lt;tp:rationale&gt;             &lt;p&gt;For further round-trip avoidance.&lt;/p&gt;           &lt;/tp:rationale&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetContactAttributes method call.
+ *
+ * Return any number of contact attributes for the given handles.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_contacts_callback_for_get_contact_by_id:
+ * @proxy: the proxy on which the call was made
+ * @out_Handle: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;The contact&apos;s handle, as returned by &lt;tp:dbus-ref namespace=&quot;ofdT.Connection&quot;&gt;RequestHandles&lt;/tp:dbus-ref&gt;&lt;/p&gt; (#TpContactHandle)
+ * @out_Attributes: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;All supported attributes of the contact on             the given interfaces that can be returned without network             round-trips. If contact attributes are not immediately known, the             behaviour is defined by the interface; the attribute should either             be omitted from the result or replaced with a default value.&lt;/p&gt;            &lt;p&gt;The contact&apos;s attributes will always include at least the             identifier that would be obtained by inspecting the handle             (&lt;code&gt;org.freedesktop.Telepathy.Connection/contact-id&lt;/code&gt;).&lt;/p&gt;
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetContactByID method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_contacts_call_get_contact_by_id:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Identifier: Used to pass an 'in' argument: An identifier representing a contact.
+ * @in_Interfaces: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A list of strings indicating which D-Bus interfaces the calling             process is interested in. All supported attributes from these             interfaces, whose values can be obtained without additional network             activity, will be in the reply.&lt;/p&gt;           &lt;p&gt;See &lt;tp:member-ref&gt;GetContactAttributes&lt;/tp:member-ref&gt; for             details.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetContactByID method call.
+ *
+ * Return any number of contact attributes for the given identifier.         &lt;tp:rationale&gt;           This is for a single identifier to make it simpler to use for the most           common use case. For multiple contacts case,           &lt;tp:member-ref&gt;GetContactAttributes&lt;/tp:member-ref&gt; should be used.         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_location_signal_callback_location_updated:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_location_connect_to_location_updated ()
+ *  was called
+ * @arg_Contact: The contact (#TpContactHandle)
+ * @arg_Location: The contact&apos;s location, or empty to indicate that nothing is known           about the contact&apos;s location.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal LocationUpdated.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_location_connect_to_location_updated:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal LocationUpdated.
+ *
+ * Emitted when a contact&apos;s location changes or becomes known.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_location_callback_for_get_locations:
+ * @proxy: the proxy on which the call was made
+ * @out_Locations: Used to return an 'out' argument if @error is %NULL: The contacts&apos; locations, if already known. Contacts whose locations           are not already known are omitted from the mapping; contacts known           to have no location information appear in the mapping with an empty           Location dictionary.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetLocations method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_location_call_get_locations:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: The contacts whose locations should be returned or signalled.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetLocations method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Return the current locations of the given contacts, if they are           already known. If any of the given contacts&apos; locations are not known,           request their current locations, but return immediately without waiting           for a reply; if a reply with a non-empty location is later received           for those contacts, the &lt;tp:member-ref&gt;LocationUpdated&lt;/tp:member-ref&gt;           signal will be emitted for them.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;This method is appropriate for &amp;quot;lazy&amp;quot; location finding, for instance             displaying the location (if available) of everyone in your contact             list.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;For backwards compatibility, if this method is called by a client           whose &amp;quot;interest count&amp;quot; for this interface, as defined by &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy&quot;&gt;Connection.AddClientInterest&lt;/tp:dbus-ref&gt;, is zero, the           Connection SHOULD behave as if AddClientInterest had been called for           this interface just before that method call. Clients that do not           explicitly call AddClientInterest SHOULD NOT call &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy&quot;&gt;Connection.RemoveClientInterest&lt;/tp:dbus-ref&gt; either.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_location_callback_for_request_location:
+ * @proxy: the proxy on which the call was made
+ * @out_Location: Used to return an 'out' argument if @error is %NULL: The contact&apos;s location. It MAY be empty, indicating that no location           information was found.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestLocation method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_location_call_request_location:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contact: Used to pass an 'in' argument: The contact whose location should be returned. (#TpContactHandle)
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestLocation method call.
+ *
+ * Return the current location of the given contact. If necessary, make         a request to the server for up-to-date information, and wait for a         reply.          &lt;tp:rationale&gt;           This method is appropriate for use in a &amp;quot;Contact Information...&amp;quot;           dialog; it can be used to show progress information (while waiting           for the method to return), and can distinguish between various error           conditions.         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_location_callback_for_set_location:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a SetLocation method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_location_call_set_location:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Location: Used to pass an 'in' argument: The location to advertise. If the user wants to obscure their           exact location by reducing the precision or accuracy, clients           MUST do this themselves, rather than relying on the connection           manager to do so. Clients that interact with more than one           connection SHOULD advertise the same reduced-accuracy location           to all of them, so that contacts cannot obtain an undesirably           accurate location by assuming that random errors have been added           and averaging the locations advertised on multiple connections.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a SetLocation method call.
+ *
+ * Set the local user&apos;s own location.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_mail_notification_signal_callback_mails_received:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_mail_notification_connect_to_mails_received ()
+ *  was called
+ * @arg_Mails: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;An array of &lt;tp:type&gt;Mail&lt;/tp:type&gt;s. Those e-mail MUST NOT have             the &amp;quot;id&amp;quot; key.&lt;/p&gt;            &lt;tp:rationale&gt;             &lt;p&gt;On connections that emit this signal, it&apos;s impossible to tell               when a mail has been removed, and hence when &amp;quot;id&amp;quot; has become               invalid.&lt;/p&gt;           &lt;/tp:rationale&gt;
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal MailsReceived.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_mail_notification_connect_to_mails_received:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal MailsReceived.
+ *
+ * Emitted when new e-mails messages arrive to the inbox associated with         this connection. This signal is used for protocols that are not able         to maintain the &lt;tp:member-ref&gt;UnreadMails&lt;/tp:member-ref&gt; list, but         do provide real-time notification about newly arrived e-mails. It MUST         NOT be emitted unless &lt;tt&gt;Emits_Mails_Received&lt;/tt&gt; is set in         &lt;tp:member-ref&gt;MailNotificationFlags&lt;/tp:member-ref&gt;.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_mail_notification_signal_callback_unread_mails_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_mail_notification_connect_to_unread_mails_changed ()
+ *  was called
+ * @arg_Count: Number of unread messages in the inbox (the new value of           &lt;tp:member-ref&gt;UnreadMailCount&lt;/tp:member-ref&gt;).
+ * @arg_Mails_Added: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A list of &lt;tp:type&gt;Mail&lt;/tp:type&gt; that are being added or updated             in &lt;tp:member-ref&gt;UnreadMails&lt;/tp:member-ref&gt;.&lt;/p&gt;            &lt;tp:rationale&gt;             &lt;p&gt;Mails may be updated when the URL information (URL and POST data)               have changed, or senders were added or removed from an e-mail               thread.&lt;/p&gt;           &lt;/tp:rationale&gt;            &lt;p&gt;If the &lt;tt&gt;Supports_Unread_Mails&lt;/tt&gt; flag is not set, this list             MUST be empty, even if Count has increased.&lt;/p&gt;
+ * @arg_Mails_Removed: A list of e-mail IDs that are being removed from           &lt;tp:member-ref&gt;UnreadMails&lt;/tp:member-ref&gt;.           If the &lt;tt&gt;Supports_Unread_Mails&lt;/tt&gt; flag is not set, this list           MUST be empty, even if Count has decreased.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal UnreadMailsChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_mail_notification_connect_to_unread_mails_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal UnreadMailsChanged.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Emitted when &lt;tp:member-ref&gt;UnreadMails&lt;/tp:member-ref&gt; or           &lt;tp:member-ref&gt;UnreadMailCount&lt;/tp:member-ref&gt; have changed. It MUST           NOT be emited if &lt;tt&gt;Supports_Unread_Mail_Count&lt;/tt&gt; flag is not set           in &lt;tp:member-ref&gt;MailNotificationFlags&lt;/tp:member-ref&gt;.&lt;/p&gt;          &lt;p&gt;&lt;tt&gt;Mails_Added&lt;/tt&gt; and           &lt;tt&gt;Mails_Removed&lt;/tt&gt; MUST be empty if the           &lt;tt&gt;Supports_Unread_Mails&lt;/tt&gt; flag is not set.&lt;/p&gt;
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_mail_notification_callback_for_request_inbox_url:
+ * @proxy: the proxy on which the call was made
+ * @out_URL: Used to return an 'out' argument if @error is %NULL: A struture containing a URL and optional additional data to open a           webmail client, without re-authentication if possible.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestInboxURL method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_mail_notification_call_request_inbox_url:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestInboxURL method call.
+ *
+ * This method creates and returns a URL and an optional POST data that         allow opening the Inbox folder of a webmail account. This URL MAY         contain tokens with a short lifetime, so clients SHOULD request a new         URL for each visit to the webmail interface. This method is implemented         only if the &lt;tt&gt;Supports_Request_Inbox_URL&lt;/tt&gt; flag is set in         &lt;tp:member-ref&gt;MailNotificationFlags&lt;/tp:member-ref&gt;.          &lt;tp:rationale&gt;           We are not using properties here because the tokens are unsuitable           for sharing between clients, and network round-trips may be required           to obtain the information that leads to authentication free webmail           access.         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_mail_notification_callback_for_request_mail_url:
+ * @proxy: the proxy on which the call was made
+ * @out_URL: Used to return an 'out' argument if @error is %NULL: A struture that contains a URL and optional additional data to open a           webmail client, without re-authentication if possible.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestMailURL method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_mail_notification_call_request_mail_url:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_ID: Used to pass an 'in' argument: The mail&apos;s &lt;tt&gt;id&lt;/tt&gt; as found in the &lt;tp:type&gt;Mail&lt;/tp:type&gt;           structure, or the empty string if no &lt;tt&gt;id&lt;/tt&gt; key was provided.
+ * @in_URL_Data: Used to pass an 'in' argument: Whatever &lt;tt&gt;url-data&lt;/tt&gt; was found in the &lt;tp:type&gt;Mail&lt;/tp:type&gt;           structure, or the boolean value False (D-Bus type &apos;b&apos;) if no           &lt;tt&gt;url-data&lt;/tt&gt; was provided in the Mail.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestMailURL method call.
+ *
+ * This method creates and returns a URL and optional POST data that         allow opening a specific mail in a webmail interface. This         method is implemented only if &lt;tt&gt;Supports_Request_Mail_URL&lt;/tt&gt; flag         is set in &lt;tp:member-ref&gt;MailNotificationFlags&lt;/tp:member-ref&gt;.         &lt;tp:rationale&gt;           See &lt;tp:member-ref&gt;RequestInboxURL&lt;/tp:member-ref&gt; for design           rationale.         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_power_saving_signal_callback_power_saving_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_power_saving_connect_to_power_saving_changed ()
+ *  was called
+ * @arg_Active: The new state of the power saving feature.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal PowerSavingChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_power_saving_connect_to_power_saving_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal PowerSavingChanged.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         The &lt;tp:member-ref&gt;PowerSavingActive&lt;/tp:member-ref&gt;         property changed.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_power_saving_callback_for_set_power_saving:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a SetPowerSaving method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_power_saving_call_set_power_saving:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Activate: Used to pass an 'in' argument: &lt;code&gt;True&lt;/code&gt; if protocol-level power saving features should be           activated; &lt;code&gt;False&lt;/code&gt; if they should be de-activated.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a SetPowerSaving method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Turn power saving mode on or off.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;Depending on the device&apos;s activity level, the             connection can have its power saving mode turned on or off.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;Errors raised by this method indicate that power saving could not be           enabled, which SHOULD NOT generally be treated as fatal.&lt;/p&gt;          &lt;tp:rationale&gt;           If the CM cannot switch modes, either because of the           protocol (&lt;code&gt;NotImplemented&lt;/code&gt;), or because of the service           (&lt;code&gt;NotAvailable&lt;/code&gt;), Mission Control (or whoever manages this)           should be made aware. The error could be ignored or, in the extreme,           be fascist and disconnect the account.         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_presence_signal_callback_presence_update:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_presence_connect_to_presence_update ()
+ *  was called
+ * @arg_Presence: A dictionary of contact handles mapped to a struct containing         a UNIX timestamp of the last activity time (in UTC), and         a dictionary mapping the contact&apos;s current status identifiers to           a dictionary of optional parameter names mapped to their           variant-boxed values
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal PresenceUpdate.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_presence_connect_to_presence_update:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal PresenceUpdate.
+ *
+ * This signal should be emitted when your own presence has been changed,         or the presence of the member of any of the connection&apos;s channels has         been changed, or when the presence requested by         &lt;tp:member-ref&gt;RequestPresence&lt;/tp:member-ref&gt; is available.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_presence_callback_for_add_status:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a AddStatus method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_presence_call_add_status:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Status: Used to pass an 'in' argument: The string identifier of the desired status
+ * @in_Parameters: Used to pass an 'in' argument: A dictionary of optional parameter names mapped to their variant-boxed values
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a AddStatus method call.
+ *
+ * Request that a single presence status is published for the user, along         with any desired parameters. Changes will be indicated by         &lt;tp:member-ref&gt;PresenceUpdate&lt;/tp:member-ref&gt; signals being emitted.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_presence_callback_for_clear_status:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a ClearStatus method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_presence_call_clear_status:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a ClearStatus method call.
+ *
+ * Request that all of a user&apos;s presence statuses be removed. Be aware         that this request may simply result in the statuses being replaced by a         default available status. Changes will be indicated by         &lt;tp:member-ref&gt;PresenceUpdate&lt;/tp:member-ref&gt; signals being emitted.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_presence_callback_for_get_presence:
+ * @proxy: the proxy on which the call was made
+ * @out_Presence: Used to return an 'out' argument if @error is %NULL: Presence information in the same format as for the           &lt;tp:member-ref&gt;PresenceUpdate&lt;/tp:member-ref&gt; signal
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetPresence method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_presence_call_get_presence:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: An array of the contacts whose presence should be obtained
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetPresence method call.
+ *
+ * Get presence previously emitted by         &lt;tp:member-ref&gt;PresenceUpdate&lt;/tp:member-ref&gt; for the given contacts.         Data is returned in the same structure as the PresenceUpdate signal.         Using this method in favour of         &lt;tp:member-ref&gt;RequestPresence&lt;/tp:member-ref&gt; has the advantage that         it will not wake up each client connected to the PresenceUpdate signal.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_presence_callback_for_get_statuses:
+ * @proxy: the proxy on which the call was made
+ * @out_Available_Statuses: Used to return an 'out' argument if @error is %NULL: A dictionary of string identifiers mapped to a struct for each status, containing:         &lt;ul&gt;           &lt;li&gt;a type value from one of the values above&lt;/li&gt;           &lt;li&gt;a boolean to indicate if this status may be set on yourself&lt;/li&gt;           &lt;li&gt;a boolean to indicate if this is an exclusive status which you             may not set alongside any other&lt;/li&gt;           &lt;li&gt;a dictionary of valid optional string argument names mapped to             their types&lt;/li&gt;         &lt;/ul&gt;
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetStatuses method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_presence_call_get_statuses:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetStatuses method call.
+ *
+ * Get a dictionary of the valid presence statuses for this connection.         This is only available when online because only some statuses will         be available on some servers.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_presence_callback_for_remove_status:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RemoveStatus method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_presence_call_remove_status:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Status: Used to pass an 'in' argument: The string identifier of the status not to publish anymore for the user
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RemoveStatus method call.
+ *
+ * Request that the given presence status is no longer published for the         user. Changes will be indicated by         &lt;tp:member-ref&gt;PresenceUpdate&lt;/tp:member-ref&gt; signals being emitted. As         with &lt;tp:member-ref&gt;ClearStatus&lt;/tp:member-ref&gt;, removing a status may         actually result in it being replaced by a default available status.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_presence_callback_for_request_presence:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestPresence method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_presence_call_request_presence:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: An array of the contacts whose presence should be obtained
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestPresence method call.
+ *
+ * Request the presence for contacts on this connection. A &lt;tp:member-ref&gt;PresenceUpdate&lt;/tp:member-ref&gt;         signal will be emitted when they are received. This is not the same as         subscribing to the presence of a contact, which must be done using the         &apos;subscription&apos; &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Channel.Type&quot;&gt;ContactList&lt;/tp:dbus-ref&gt;,         and on some protocols presence information may not be available unless         a subscription exists.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_presence_callback_for_set_last_activity_time:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a SetLastActivityTime method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_presence_call_set_last_activity_time:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Time: Used to pass an 'in' argument: A UNIX timestamp of the user&apos;s last activity time (in UTC) (#TpUnixTimestamp)
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a SetLastActivityTime method call.
+ *
+ * Request that the recorded last activity time for the user be updated on         the server.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_presence_callback_for_set_status:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a SetStatus method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_presence_call_set_status:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Statuses: Used to pass an 'in' argument: A dictionary mapping status identifiers to dictionaries, which           map optional parameter names to their variant-boxed values
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a SetStatus method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Request that the user&apos;s presence be changed to the given statuses           and desired parameters. Changes will be reflected by           &lt;tp:member-ref&gt;PresenceUpdate&lt;/tp:member-ref&gt;           signals being emitted.&lt;/p&gt;          &lt;p&gt;Statuses whose &lt;tp:type&gt;Connection_Presence_Type&lt;/tp:type&gt;           is Offline, Error or Unknown MUST NOT be passed to this           function. Connection managers SHOULD reject these statuses.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;The same rationale as for &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection.Interface&quot;&gt;SimplePresence.SetPresence&lt;/tp:dbus-ref&gt;             applies.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;On certain protocols, this method may be           called on a newly-created connection which is still in the           DISCONNECTED state, and will sign on with the requested status.           If the requested status is not available after signing on,           NotAvailable will be returned and the connection will remain           offline, or if the protocol does not support signing on with           a certain status, Disconnected will be returned.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_renaming_signal_callback_renamed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_renaming_connect_to_renamed ()
+ *  was called
+ * @arg_Original: The handle of the original identifier (#TpContactHandle)
+ * @arg_New: The handle of the new identifier (#TpContactHandle)
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal Renamed.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_renaming_connect_to_renamed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal Renamed.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Emitted when the unique identifier of a contact on the server           changes.&lt;/p&gt;          &lt;p&gt;Any channels associated with the contact&apos;s original handle will           continue to be to that handle, and so are no longer useful (unless           the contact renames back, or another contact connects with that           unique ID). Clients may open a similar channel associated with the           new handle to continue communicating with the contact.&lt;/p&gt;          &lt;p&gt;For example, if a GUI client associates text           channels with chat windows, it should detach the old channel           from the chat window, closing it, and associate a channel to the           new handle with the same window.&lt;/p&gt;          &lt;p&gt;If the contact&apos;s old handle is in any of the member lists of           a channel which has the groups interface, it will be removed from           the channel and the new handle will be added. The resulting           &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Channel.Interface.Group&quot;&gt;MembersChanged&lt;/tp:dbus-ref&gt;           signal must be emitted &lt;em&gt;after&lt;/em&gt; the           &lt;tp:member-ref&gt;Renamed&lt;/tp:member-ref&gt; signal; the reason should be           RENAMED.         &lt;/p&gt;          &lt;p&gt;The handles may be either general-purpose or channel-specific.           If the original handle is general-purpose, the new handle must be           general-purpose; if the original handle is channel-specific, the           new handle must be channel-specific in the same channel.         &lt;/p&gt;
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_renaming_callback_for_request_rename:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a RequestRename method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_renaming_call_request_rename:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Identifier: Used to pass an 'in' argument: The desired identifier
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a RequestRename method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Request that the user&apos;s own identifier is changed on the server.           If successful, a &lt;tp:member-ref&gt;Renamed&lt;/tp:member-ref&gt; signal will           be emitted for the current &amp;quot;self handle&amp;quot; as returned by &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection&quot;&gt;GetSelfHandle&lt;/tp:dbus-ref&gt;.&lt;/p&gt;         &lt;p&gt;It is protocol-dependent how the identifier that&apos;s actually           used will be derived from the supplied identifier; some sort of           normalization might take place.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_requests_signal_callback_new_channels:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_requests_connect_to_new_channels ()
+ *  was called
+ * @arg_Channels: The channels and their details. All channels that are signalled           together like this MUST have the same           &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Channel.FUTURE&quot;&gt;Bundle&lt;/tp:dbus-ref&gt;           property, which may           either refer to an existing bundle, or establish a new bundle.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal NewChannels.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_requests_connect_to_new_channels:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal NewChannels.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;New channels have been created. The connection manager SHOULD emit           a single signal for any group of closely related channels that are           created at the same time, so that the channel dispatcher can try to           dispatch them to a handler as a unit.&lt;/p&gt;          &lt;p&gt;In particular, if additional channels are created as a side-effect           of a call to &lt;tp:member-ref&gt;CreateChannel&lt;/tp:member-ref&gt;,           these channels SHOULD appear in the same NewChannels signal as           the channel that satisfies the request.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;Joining a MUC Tube in XMPP requires joining the corresponding             MUC (chatroom), so a &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Channel.Type&quot;&gt;Text&lt;/tp:dbus-ref&gt;             channel can be created as a side-effect.&lt;/p&gt;         &lt;/tp:rationale&gt;          &lt;p&gt;Every time NewChannels is emitted, it MUST be followed by           a &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy&quot;&gt;Connection.NewChannel&lt;/tp:dbus-ref&gt;           signal for each channel.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;The double signal emission is for the benefit of older Telepathy             clients, which won&apos;t be listening for NewChannels.&lt;/p&gt;            &lt;p&gt;The more informative NewChannels signal comes first so that             clients that did not examine the connection to find             out whether Requests is supported will see the more informative             signal for each channel first, and then ignore the less             informative signal because it announces a new channel of which             they are already aware.&lt;/p&gt;         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_requests_signal_callback_channel_closed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_requests_connect_to_channel_closed ()
+ *  was called
+ * @arg_Removed: The channel which has been removed from the Channels property
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal ChannelClosed.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_requests_connect_to_channel_closed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal ChannelClosed.
+ *
+ * Emitted when a channel is closed and hence disappears from the         &lt;tp:member-ref&gt;Channels&lt;/tp:member-ref&gt; property.          &lt;tp:rationale&gt;           This is redundant with the &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Channel&quot;&gt;Closed&lt;/tp:dbus-ref&gt;           signal on the channel itself, but it does provide full change           notification for the Channels property.         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_requests_callback_for_create_channel:
+ * @proxy: the proxy on which the call was made
+ * @out_Channel: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;The Channel object, which MUST NOT be signalled with             &lt;tp:member-ref&gt;NewChannels&lt;/tp:member-ref&gt; until after this method             returns.&lt;/p&gt;            &lt;tp:rationale&gt;             &lt;p&gt;This allows the requester to alter its handling of               NewChannels by knowing whether one of the channels satisfied               a request it made.&lt;/p&gt;           &lt;/tp:rationale&gt;
+ * @out_Properties: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;Properties of the channel that was produced, equivalent to             the properties in &lt;tp:type&gt;Channel_Details&lt;/tp:type&gt;.             Connection managers MUST NOT include properties here whose             values can change, for the same reasons as in             &lt;tp:type&gt;Channel_Details&lt;/tp:type&gt;.&lt;/p&gt;
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a CreateChannel method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_requests_call_create_channel:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Request: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A dictionary containing desirable properties, which MUST include             &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Channel&quot;&gt;ChannelType&lt;/tp:dbus-ref&gt;.             Some properties             are defined such that only an exact match makes sense, and             connection managers MUST NOT satisfy a request with a channel             where that property does not match; some properties are defined             such that the connection manager MAY treat the request as merely             a hint, and make a best-effort attempt to satisfy it. This is             documented separately for each property.&lt;/p&gt;            &lt;p&gt;If this dictionary contains a property whose semantics             are not known to the connection manager, this method MUST fail             without side-effects (in particular it must not create a new             channel).&lt;/p&gt;            &lt;tp:rationale&gt;             &lt;p&gt;This is necessary if we want to be able to invent properties               in future that, when used in a request, are hard requirements               rather than just hints. A connection manager that did not know               the semantics of those properties could incorrectly return a               new channel that did not satisfy the requirements.&lt;/p&gt;           &lt;/tp:rationale&gt;            &lt;p&gt;The connection manager MUST NOT respond successfully,             and SHOULD NOT create a new channel or cause any other             side-effects, unless it can create a new channel that satisfies             the client&apos;s requirements.&lt;/p&gt;            &lt;p&gt;Properties that will be set by this argument need not have write             access after the channel has been created - indeed, it is             expected that most will be read-only.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a CreateChannel method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Request that an entirely new channel is created.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;There is deliberately no flag corresponding to the             suppress_handler argument to             &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy&quot;&gt;Connection.RequestChannel&lt;/tp:dbus-ref&gt;,             because passing a FALSE value for that argument is deprecated.             Requests made using this interface always behave as though             suppress_handler was TRUE.&lt;/p&gt;         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_requests_callback_for_ensure_channel:
+ * @proxy: the proxy on which the call was made
+ * @out_Yours: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;If false, the caller of EnsureChannel MUST assume that some             other process is handling this channel; if true, the caller of             EnsureChannel SHOULD handle it themselves or delegate it to another             client.&lt;/p&gt;            &lt;p&gt;If the creation of a channel makes several calls to EnsureChannel             (and no other requests) successful, exactly one of those calls MUST             return a true value for this argument.&lt;/p&gt;            &lt;p&gt;If the creation of a channel makes other requests successful,             the value returned for this argument MUST be such that exactly             one of the clients making requests ends up responsible for the             channel. In particular, if             &lt;tp:member-ref&gt;CreateChannel&lt;/tp:member-ref&gt; returns a channel             &lt;em&gt;C&lt;/em&gt;, any EnsureChannel calls that also return &lt;em&gt;C&lt;/em&gt;             MUST return a false value for this argument.&lt;/p&gt;
+ * @out_Channel: Used to return an 'out' argument if @error is %NULL: The Channel object. If it was created as a result of this method           call, it MUST NOT be signalled by           &lt;tp:member-ref&gt;NewChannels&lt;/tp:member-ref&gt; until after this method           returns.            &lt;tp:rationale&gt;             &lt;p&gt;This allows the requester to alter its handling of               NewChannels by knowing whether one of the channels satisfied               a request it made.&lt;/p&gt;           &lt;/tp:rationale&gt;
+ * @out_Properties: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;Properties of the channel that was produced, equivalent to             the properties in &lt;tp:type&gt;Channel_Details&lt;/tp:type&gt;.             Connection managers MUST NOT include properties here whose             values can change, for the same reasons as in             &lt;tp:type&gt;Channel_Details&lt;/tp:type&gt;.&lt;/p&gt;
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a EnsureChannel method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_requests_call_ensure_channel:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Request: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;A dictionary containing desirable properties, with the same             semantics as the corresponding parameter to             &lt;tp:member-ref&gt;CreateChannel&lt;/tp:member-ref&gt;.&lt;/p&gt;
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a EnsureChannel method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Request that channels are ensured to exist.&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;The connection manager is in the best position to determine which             existing channels could satisfy which requests.&lt;/p&gt;         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_service_point_signal_callback_service_points_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_service_point_connect_to_service_points_changed ()
+ *  was called
+ * @arg_Service_Points: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;The new value of             &lt;tp:member-ref&gt;KnownServicePoints&lt;/tp:member-ref&gt;.&lt;/p&gt;
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal ServicePointsChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_service_point_connect_to_service_points_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal ServicePointsChanged.
+ *
+ * Emitted when the list of known service points (or their IDs) has         changed.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_sidecars1_callback_for_ensure_sidecar:
+ * @proxy: the proxy on which the call was made
+ * @out_Path: Used to return an 'out' argument if @error is %NULL: The object path of the sidecar, exported by the same bus           name as the Connection to which it is attached.
+ * @out_Properties: Used to return an 'out' argument if @error is %NULL: Immutable properties of the sidecar.
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a EnsureSidecar method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_sidecars1_call_ensure_sidecar:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Main_Interface: Used to pass an 'in' argument: The &amp;quot;primary&amp;quot; interface implemented by an object attached           to a connection. For example, a Gabble plugin implementing           fine-grained control of XEP-0016 privacy lists might expose an object           implementing &lt;tt&gt;com.example.PrivacyLists&lt;/tt&gt;.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a EnsureSidecar method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Request an object with a particular interface providing additional           connection-specific functionality, together with its immutable           properties. These will often be implemented by plug-ins to the           connection managers; for example, support for an XMPP XEP for which           no generic Telepathy interface exists might be implemented by a           Gabble plugin exposing a sidecar with a particular interface.&lt;/p&gt;          &lt;p&gt;This method may be called at any point during the lifetime of a           connection, even before its &lt;tp:type&gt;Connection_Status&lt;/tp:type&gt;           changes to Connected. It MAY take a long time to           return—perhaps it needs to wait for a connection to be established           and for all the services supported by the server to be discovered           before determining whether necessary server-side support is           available—so callers SHOULD override the default method timeout (25           seconds) with a much higher value (perhaps even MAX_INT32, meaning           “no timeout” in recent versions of libdbus).&lt;/p&gt;          &lt;tp:rationale&gt;           &lt;p&gt;There is an implicit assumption that any connection             manager plugin will only want to export one “primary” object per             feature it implements, since there is a one-to-one mapping between             interface and object. This is reasonable since Sidecars are             (intended to be) analogous to extra interfaces on the connection,             providing once-per-connection shared functionality; it also makes             client code straightforward (look up the interface you care about             in a dictionary, build a proxy object from the value). More             “plural” plugins are likely to want to implement new types of             &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy&quot;&gt;Channel&lt;/tp:dbus-ref&gt;             instead.&lt;/p&gt;         &lt;/tp:rationale&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_simple_presence_signal_callback_presences_changed:
+ * @proxy: The proxy on which /tmp/rv/old_connection_interface_simple_presence_connect_to_presences_changed ()
+ *  was called
+ * @arg_Presence: A dictionary of contact handles mapped to the status,           presence type and status message.
+ * @user_data: User-supplied data
+ * @weak_object: User-supplied weakly referenced object
+ *
+ * Represents the signature of a callback for the signal PresencesChanged.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_simple_presence_connect_to_presences_changed:
+ * @proxy: A #TpConnection or subclass
+ * @callback: Callback to be called when the signal is
+ *   received
+ * @user_data: User-supplied data for the callback
+ * @destroy: Destructor for the user-supplied data, which
+ *   will be called when this signal is disconnected, or
+ *   before this function returns %NULL
+ * @weak_object: A #GObject which will be weakly referenced; 
+ *   if it is destroyed, this callback will automatically be
+ *   disconnected
+ * @error: If not %NULL, used to raise an error if %NULL is
+ *   returned
+ *
+ * Connect a handler to the signal PresencesChanged.
+ *
+ * This signal should be emitted when your own presence has been changed,         or the presence of the member of any of the connection&apos;s channels has         been changed.
+ *
+ * Returns: a #TpProxySignalConnection containing all of the
+ * above, which can be used to disconnect the signal; or
+ * %NULL if the proxy does not have the desired interface
+ * or has become invalid.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_simple_presence_callback_for_set_presence:
+ * @proxy: the proxy on which the call was made
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a SetPresence method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_simple_presence_call_set_presence:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Status: Used to pass an 'in' argument: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;The string identifier of the desired status. Possible status             identifiers are defined in the             &lt;tp:member-ref&gt;Statuses&lt;/tp:member-ref&gt; property.&lt;/p&gt;            &lt;p&gt;Clients MUST NOT set a status whose string value they do not             recognise, even if its presence type in Statuses             matches what the user requested.&lt;/p&gt;            &lt;tp:rationale&gt;             &lt;p&gt;Suppose a protocol has statuses that include &apos;phone&apos; (of type               BUSY) and &apos;in-a-meeting&apos; (of type BUSY), but there is no               generic &apos;busy&apos; status.&lt;/p&gt;              &lt;p&gt;If the user requests &amp;quot;Busy&amp;quot; status from a menu, a               client author might be tempted to pick an arbitrary status               that has type BUSY. However, on this protocol, neither of               the choices would be appropriate, and incorrect information               about the user would be conveyed.&lt;/p&gt;           &lt;/tp:rationale&gt;            &lt;p&gt;Statuses whose &lt;tp:type&gt;Connection_Presence_Type&lt;/tp:type&gt;             is Offline, Error or Unknown MUST NOT be passed to this             function. Connection managers SHOULD reject these statuses.&lt;/p&gt;            &lt;tp:rationale&gt;             &lt;p&gt;To go offline, call &lt;tp:dbus-ref namespace=&quot;org.freedesktop.Telepathy.Connection&quot;&gt;Disconnect&lt;/tp:dbus-ref&gt;             instead. The &amp;quot;error&amp;quot; and &amp;quot;unknown&amp;quot; statuses make no sense.&lt;/p&gt;           &lt;/tp:rationale&gt;
+ * @in_Status_Message: Used to pass an 'in' argument: The status message associated with the current status.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a SetPresence method call.
+ *
+ * &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;         &lt;p&gt;Request that the presence status and status message are published for           the connection.  Changes will be indicated by           &lt;tp:member-ref&gt;PresencesChanged&lt;/tp:member-ref&gt;           signals being emitted.&lt;/p&gt;          &lt;p&gt;This method may be called on a newly-created connection while it           is still in the DISCONNECTED state, to request that when the           connection connects, it will do so with the selected status.&lt;/p&gt;          &lt;p&gt;In DISCONNECTED state the           &lt;tp:member-ref&gt;Statuses&lt;/tp:member-ref&gt;           property will indicate which statuses are allowed to be set           while DISCONNECTED (none, if the Connection Manager doesn&apos;t allow           this). This value MUST NOT be cached, as the set of allowed           presences might change upon connecting.&lt;/p&gt;
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
+
+/**
+ * /tmp/rv/old_connection_interface_simple_presence_callback_for_get_presences:
+ * @proxy: the proxy on which the call was made
+ * @out_Presence: Used to return an 'out' argument if @error is %NULL: &lt;tp:docstring xmlns=&quot;http://www.w3.org/1999/xhtml&quot;&gt;           &lt;p&gt;Presence information in the same format as for the             &lt;tp:member-ref&gt;PresencesChanged&lt;/tp:member-ref&gt; signal.             The returned mapping MUST include an entry for each contact             in the method&apos;s argument.&lt;/p&gt;            &lt;p&gt;The definition of the connection presence types Unknown             and Offline means that if a connection manager will return             Unknown for contacts not on the subscribe list, it MUST delay             the reply to this method call until it has found out which             contacts are, in fact, on the subscribe list.&lt;/p&gt;
+ * @error: %NULL on success, or an error on failure
+ * @user_data: user-supplied data
+ * @weak_object: user-supplied object
+ *
+ * Signature of the callback called when a GetPresences method call
+ * succeeds or fails.
+ */
+
+/**
+ * /tmp/rv/old_connection_interface_simple_presence_call_get_presences:
+ * @proxy: the #TpProxy
+ * @timeout_ms: the timeout in milliseconds, or -1 to use the
+ *   default
+ * @in_Contacts: Used to pass an 'in' argument: An array of the contacts whose presence should be obtained.
+ * @callback: called when the method call succeeds or fails;
+ *   may be %NULL to make a "fire and forget" call with no 
+ *   reply tracking
+ * @user_data: user-supplied data passed to the callback;
+ *   must be %NULL if @callback is %NULL
+ * @destroy: called with the user_data as argument, after the
+ *   call has succeeded, failed or been cancelled;
+ *   must be %NULL if @callback is %NULL
+ * @weak_object: If not %NULL, a #GObject which will be 
+ *   weakly referenced; if it is destroyed, this call 
+ *   will automatically be cancelled. Must be %NULL if 
+ *   @callback is %NULL
+ *
+ * Start a GetPresences method call.
+ *
+ * Get presence previously emitted by         &lt;tp:member-ref&gt;PresencesChanged&lt;/tp:member-ref&gt; for the given         contacts. Data is returned in the same structure as the         PresencesChanged signal; no additional network requests are made.
+ *
+ * Returns: a #TpProxyPendingCall representing the call in
+ *  progress. It is borrowed from the object, and will become
+ *  invalid when the callback is called, the call is
+ *  cancelled or the #TpProxy becomes invalid.
+ */
+
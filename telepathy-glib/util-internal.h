@@ -107,6 +107,11 @@ GPtrArray *_tp_contacts_from_values (GHashTable *table);
 GList *_tp_object_list_copy (GList *l);
 void _tp_object_list_free (GList *l);
 
+GSource *_tp_idle_add_thread_default (gint priority,
+    GSourceFunc function,
+    gpointer data,
+    GDestroyNotify notify);
+
 /* This can be removed once we depend on GLib 2.34 */
 GList *_tp_g_list_copy_deep (GList *list,
     GCopyFunc func,
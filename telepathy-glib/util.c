@@ -39,6 +39,7 @@
 #include <gio/gunixconnection.h>
 #endif /* HAVE_GIO_UNIX */
 
+#include <telepathy-glib/allocation-statistics-internal.h>
 #include <telepathy-glib/enums.h>
 #include <telepathy-glib/errors.h>
 #include <telepathy-glib/util-internal.h>
@@ -187,6 +188,7 @@ tp_g_value_slice_new (GType type)
 {
   GValue *ret = g_slice_new0 (GValue);
 
+  _tp_allocation_statistics_allocated ("GValue");
   g_value_init (ret, type);
   return ret;
 }
@@ -2125,6 +2127,38 @@ _tp_g_list_copy_deep (GList *list,
   return ret;
 }
 
+/*
+ * _tp_idle_add_thread_default:
+ * @priority: the priority of the idle source
+ * @function: called from the idle source
+ * @data: passed to @function
+ * @notify: (allow-none): called on @data when the source is destroyed
+ *
+ * Like g_idle_add_full(), but attach the idle source to the thread-default
+ * main context rather than the global default, so that it is dispatched in
+ * the thread that scheduled it, even if that is one of the worker threads
+ * of a sharded #TpBaseConnectionManager.
+ *
+ * Returns: (transfer none): the source, which remains valid until it is
+ *  destroyed, either by g_source_destroy() or by @function returning
+ *  %FALSE
+ */
+GSource *
+_tp_idle_add_thread_default (gint priority,
+    GSourceFunc function,
+    gpointer data,
+    GDestroyNotify notify)
+{
+  GSource *source = g_idle_source_new ();
+
+  g_source_set_priority (source, priority);
+  g_source_set_callback (source, function, data, notify);
+  g_source_attach (source, g_main_context_get_thread_default ());
+  /* the context keeps it alive until it is destroyed */
+  g_source_unref (source);
+  return source;
+}
+
 /**
  * tp_value_array_free:
  * @va: a #GValueArray
@@ -0,0 +1,527 @@
+/* End-to-end benchmarks for telepathy-glib, using the stand-in connection
+ * managers in tests/lib on a private bus.
+ *
+ * Copyright © 2026 Collabora Ltd. <http://www.collabora.co.uk/>
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+
+#include <telepathy-glib/telepathy-glib.h>
+#include <telepathy-glib/telepathy-glib-dbus.h>
+
+#include "tests/lib/contact-list-manager.h"
+#include "tests/lib/contacts-conn.h"
+#include "tests/lib/echo-conn.h"
+#include "tests/lib/util.h"
+
+/* how many contacts, messages, calls etc. each benchmark uses */
+static gint scale = 1000;
+/* where to write the results, or NULL for stdout */
+static gchar *output = NULL;
+/* owned JSON objects, one per benchmark */
+static GPtrArray *results = NULL;
+
+typedef struct {
+    TpBaseConnection *service_conn;
+    TpConnection *conn;
+    TpHandleRepoIface *contact_repo;
+
+    /* replies and signals still expected */
+    guint pending;
+    gchar *channel_path;
+    GHashTable *channel_props;
+
+    GError *error;
+} Fixture;
+
+static gint
+compare_gint64 (gconstpointer a,
+    gconstpointer b)
+{
+  gint64 x = *(const gint64 *) a;
+  gint64 y = *(const gint64 *) b;
+
+  return (x > y) - (x < y);
+}
+
+static gint64
+percentile (GArray *sorted,
+    guint p)
+{
+  return g_array_index (sorted, gint64, (sorted->len - 1) * p / 100);
+}
+
+/*
+ * record_result:
+ * @name: the benchmark's name
+ * @unit: what was counted
+ * @n: how many were done
+ * @elapsed_us: how long they took altogether
+ * @latencies: (allow-none): how long each one took, if they were done one
+ *  at a time
+ */
+static void
+record_result (const gchar *name,
+    const gchar *unit,
+    guint n,
+    gint64 elapsed_us,
+    GArray *latencies)
+{
+  GString *json = g_string_new ("{");
+  gdouble seconds = elapsed_us / (gdouble) G_USEC_PER_SEC;
+  gchar buf[G_ASCII_DTOSTR_BUF_SIZE];
+
+  g_string_append_printf (json, "\"name\": \"%s\", \"unit\": \"%s\", "
+      "\"n\": %u", name, unit, n);
+  g_string_append_printf (json, ", \"seconds\": %s",
+      g_ascii_formatd (buf, sizeof (buf), "%.6f", seconds));
+  g_string_append_printf (json, ", \"per_second\": %s",
+      g_ascii_formatd (buf, sizeof (buf), "%.1f",
+        seconds > 0 ? n / seconds : 0));
+
+  if (latencies != NULL && latencies->len > 0)
+    {
+      gint64 total = 0;
+      guint i;
+
+      g_array_sort (latencies, compare_gint64);
+
+      for (i = 0; i < latencies->len; i++)
+        total += g_array_index (latencies, gint64, i);
+
+      g_string_append_printf (json, ", \"latency_us\": {"
+          "\"mean\": %" G_GINT64_FORMAT ", "
+          "\"p50\": %" G_GINT64_FORMAT ", "
+          "\"p95\": %" G_GINT64_FORMAT ", "
+          "\"p99\": %" G_GINT64_FORMAT ", "
+          "\"max\": %" G_GINT64_FORMAT "}",
+          total / latencies->len,
+          percentile (latencies, 50),
+          percentile (latencies, 95),
+          percentile (latencies, 99),
+          g_array_index (latencies, gint64, latencies->len - 1));
+    }
+
+  g_string_append_c (json, '}');
+
+  g_test_message ("%s: %u %s in %.3fs", name, n, unit, seconds);
+  g_ptr_array_add (results, g_string_free (json, FALSE));
+}
+
+static gboolean
+write_results (void)
+{
+  GString *json = g_string_new ("{\n");
+  GError *error = NULL;
+  gboolean ret = TRUE;
+  guint i;
+
+  g_string_append (json, "  \"package\": \"" PACKAGE_NAME "\",\n");
+  g_string_append (json, "  \"version\": \"" PACKAGE_VERSION "\",\n");
+  g_string_append_printf (json, "  \"scale\": %d,\n", scale);
+  g_string_append (json, "  \"results\": [\n");
+
+  for (i = 0; i < results->len; i++)
+    g_string_append_printf (json, "    %s%s\n",
+        (const gchar *) g_ptr_array_index (results, i),
+        i + 1 < results->len ? "," : "");
+
+  g_string_append (json, "  ]\n}\n");
+
+  if (output == NULL)
+    {
+      fputs (json->str, stdout);
+    }
+  else if (!g_file_set_contents (output, json->str, json->len, &error))
+    {
+      g_printerr ("%s\n", error->message);
+      g_error_free (error);
+      ret = FALSE;
+    }
+
+  g_string_free (json, TRUE);
+  return ret;
+}
+
+static void
+run_until_done (Fixture *f)
+{
+  while (f->pending > 0)
+    g_main_context_iteration (NULL, TRUE);
+}
+
+static void
+setup_internal (Fixture *f,
+    GType conn_type,
+    gboolean connect)
+{
+  tp_tests_create_conn (conn_type, "me@test.com", connect,
+      &f->service_conn, &f->conn);
+  f->contact_repo = tp_base_connection_get_handles (f->service_conn,
+      TP_HANDLE_TYPE_CONTACT);
+}
+
+static void
+setup_contacts (Fixture *f,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  setup_internal (f, TP_TESTS_TYPE_CONTACTS_CONNECTION, TRUE);
+}
+
+static void
+setup_contacts_offline (Fixture *f,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  setup_internal (f, TP_TESTS_TYPE_CONTACTS_CONNECTION, FALSE);
+}
+
+static void
+setup_echo (Fixture *f,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  setup_internal (f, TP_TESTS_TYPE_ECHO_CONNECTION, TRUE);
+}
+
+static void
+teardown (Fixture *f,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  if (f->conn != NULL)
+    tp_tests_connection_assert_disconnect_succeeds (f->conn);
+
+  g_free (f->channel_path);
+  tp_clear_pointer (&f->channel_props, g_hash_table_unref);
+  tp_clear_object (&f->conn);
+  tp_clear_object (&f->service_conn);
+  g_clear_error (&f->error);
+}
+
+static TpHandle *
+ensure_handles (Fixture *f)
+{
+  TpHandle *handles = g_new (TpHandle, scale);
+  gint i;
+
+  for (i = 0; i < scale; i++)
+    {
+      gchar *id = g_strdup_printf ("contact%d@example.com", i);
+
+      handles[i] = tp_handle_ensure (f->contact_repo, id, NULL, &f->error);
+      g_assert_no_error (f->error);
+      g_free (id);
+    }
+
+  return handles;
+}
+
+/* Upgrade contacts that the client only knows the handles of, as a client
+ * does when a roster or a chat room's members arrive. */
+static void
+bench_contact_upgrade (Fixture *f,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  TpSimpleClientFactory *factory = tp_proxy_get_factory (f->conn);
+  TpContactFeature features[] = { TP_CONTACT_FEATURE_ALIAS,
+      TP_CONTACT_FEATURE_AVATAR_TOKEN, TP_CONTACT_FEATURE_PRESENCE };
+  GPtrArray *contacts = g_ptr_array_new_with_free_func (g_object_unref);
+  TpHandle *handles = ensure_handles (f);
+  GAsyncResult *result = NULL;
+  gint64 start;
+  gint i;
+
+  for (i = 0; i < scale; i++)
+    g_ptr_array_add (contacts,
+        tp_simple_client_factory_ensure_contact (factory, f->conn,
+          handles[i], tp_handle_inspect (f->contact_repo, handles[i])));
+
+  start = g_get_monotonic_time ();
+
+  tp_connection_upgrade_contacts_async (f->conn, contacts->len,
+      (TpContact * const *) contacts->pdata, G_N_ELEMENTS (features),
+      features, tp_tests_result_ready_cb, &result);
+  tp_tests_run_until_result (&result);
+  tp_connection_upgrade_contacts_finish (f->conn, result, NULL, &f->error);
+  g_assert_no_error (f->error);
+
+  record_result ("contact-upgrade", "contacts", scale,
+      g_get_monotonic_time () - start, NULL);
+
+  g_object_unref (result);
+  g_ptr_array_unref (contacts);
+  g_free (handles);
+}
+
+/* Connect with a roster of @scale contacts, until the client has all of
+ * them. */
+static void
+bench_roster_load (Fixture *f,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  GQuark features[] = { TP_CONNECTION_FEATURE_CONNECTED,
+      TP_CONNECTION_FEATURE_CONTACT_LIST, 0 };
+  TpTestsContactListManager *manager;
+  TpHandle *handles = ensure_handles (f);
+  GPtrArray *contacts;
+  gint64 start;
+
+  manager = tp_tests_contacts_connection_get_contact_list_manager (
+      TP_TESTS_CONTACTS_CONNECTION (f->service_conn));
+  tp_tests_contact_list_manager_add_initial_contacts (manager, scale,
+      handles);
+
+  start = g_get_monotonic_time ();
+
+  tp_cli_connection_call_connect (f->conn, -1, NULL, NULL, NULL, NULL);
+  tp_tests_proxy_run_until_prepared (f->conn, features);
+
+  while (tp_connection_get_contact_list_state (f->conn) !=
+      TP_CONTACT_LIST_STATE_SUCCESS)
+    g_main_context_iteration (NULL, TRUE);
+
+  record_result ("roster-load", "contacts", scale,
+      g_get_monotonic_time () - start, NULL);
+
+  contacts = tp_connection_dup_contact_list (f->conn);
+  g_assert_cmpuint (contacts->len, ==, scale);
+  g_ptr_array_unref (contacts);
+  g_free (handles);
+}
+
+static void
+create_channel_cb (TpConnection *conn G_GNUC_UNUSED,
+    const gchar *object_path,
+    GHashTable *properties,
+    const GError *error,
+    gpointer user_data,
+    GObject *weak_object G_GNUC_UNUSED)
+{
+  Fixture *f = user_data;
+
+  g_assert_no_error (error);
+
+  if (f->channel_path == NULL)
+    {
+      f->channel_path = g_strdup (object_path);
+      f->channel_props = g_hash_table_ref (properties);
+    }
+
+  f->pending--;
+}
+
+static void
+request_text_channel (Fixture *f,
+    const gchar *target_id)
+{
+  GHashTable *request = tp_asv_new (
+      TP_PROP_CHANNEL_CHANNEL_TYPE, G_TYPE_STRING,
+        TP_IFACE_CHANNEL_TYPE_TEXT,
+      TP_PROP_CHANNEL_TARGET_HANDLE_TYPE, G_TYPE_UINT,
+        TP_HANDLE_TYPE_CONTACT,
+      TP_PROP_CHANNEL_TARGET_ID, G_TYPE_STRING, target_id,
+      NULL);
+
+  f->pending++;
+  tp_cli_connection_interface_requests_call_create_channel (f->conn, -1,
+      request, create_channel_cb, f, NULL, NULL);
+  g_hash_table_unref (request);
+}
+
+/* Request @scale text channels to different contacts, all at once, as a
+ * channel dispatcher might after reconnecting. */
+static void
+bench_channel_request (Fixture *f,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  gint64 start = g_get_monotonic_time ();
+  gint i;
+
+  for (i = 0; i < scale; i++)
+    {
+      gchar *id = g_strdup_printf ("contact%d@example.com", i);
+
+      request_text_channel (f, id);
+      g_free (id);
+    }
+
+  run_until_done (f);
+
+  record_result ("channel-request", "channels", scale,
+      g_get_monotonic_time () - start, NULL);
+}
+
+static void
+send_cb (TpChannel *channel G_GNUC_UNUSED,
+    const GError *error,
+    gpointer user_data,
+    GObject *weak_object G_GNUC_UNUSED)
+{
+  Fixture *f = user_data;
+
+  g_assert_no_error (error);
+  f->pending--;
+}
+
+static void
+received_cb (TpChannel *channel G_GNUC_UNUSED,
+    guint id G_GNUC_UNUSED,
+    guint timestamp G_GNUC_UNUSED,
+    guint sender G_GNUC_UNUSED,
+    guint type G_GNUC_UNUSED,
+    guint flags G_GNUC_UNUSED,
+    const gchar *text G_GNUC_UNUSED,
+    gpointer user_data,
+    GObject *weak_object G_GNUC_UNUSED)
+{
+  Fixture *f = user_data;
+
+  f->pending--;
+}
+
+/* Send @scale messages, all at once, and wait for all the echoes. */
+static void
+bench_messages (Fixture *f,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  TpChannel *channel;
+  gint64 start;
+  gint i;
+
+  request_text_channel (f, "echo@example.com");
+  run_until_done (f);
+
+  channel = tp_simple_client_factory_ensure_channel (
+      tp_proxy_get_factory (f->conn), f->conn, f->channel_path,
+      f->channel_props, &f->error);
+  g_assert_no_error (f->error);
+
+  tp_cli_channel_type_text_connect_to_received (channel, received_cb, f,
+      NULL, NULL, &f->error);
+  g_assert_no_error (f->error);
+
+  start = g_get_monotonic_time ();
+
+  for (i = 0; i < scale; i++)
+    {
+      gchar *text = g_strdup_printf ("message %d", i);
+
+      /* one for the reply and one for the echo */
+      f->pending += 2;
+      tp_cli_channel_type_text_call_send (channel, -1,
+          TP_CHANNEL_TEXT_MESSAGE_TYPE_NORMAL, text, send_cb, f, NULL, NULL);
+      g_free (text);
+    }
+
+  run_until_done (f);
+
+  record_result ("message-round-trip", "messages", scale,
+      g_get_monotonic_time () - start, NULL);
+
+  g_object_unref (channel);
+}
+
+static void
+get_all_cb (TpProxy *proxy G_GNUC_UNUSED,
+    GHashTable *properties G_GNUC_UNUSED,
+    const GError *error,
+    gpointer user_data,
+    GObject *weak_object G_GNUC_UNUSED)
+{
+  Fixture *f = user_data;
+
+  g_assert_no_error (error);
+  f->pending--;
+}
+
+/* Call GetAll on the connection @scale times, one after another. */
+static void
+bench_get_all (Fixture *f,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  GArray *latencies = g_array_sized_new (FALSE, FALSE, sizeof (gint64),
+      scale);
+  gint64 start = g_get_monotonic_time ();
+  gint i;
+
+  for (i = 0; i < scale; i++)
+    {
+      gint64 call_start = g_get_monotonic_time ();
+      gint64 latency;
+
+      f->pending++;
+      tp_cli_dbus_properties_call_get_all (f->conn, -1,
+          TP_IFACE_CONNECTION, get_all_cb, f, NULL, NULL);
+      run_until_done (f);
+
+      latency = g_get_monotonic_time () - call_start;
+      g_array_append_val (latencies, latency);
+    }
+
+  record_result ("get-all", "calls", scale,
+      g_get_monotonic_time () - start, latencies);
+
+  g_array_unref (latencies);
+}
+
+int
+main (int argc,
+      char **argv)
+{
+  GOptionEntry entries[] = {
+      { "scale", 'n', 0, G_OPTION_ARG_INT, &scale,
+        "How many contacts, messages etc. to use (default 1000)", "N" },
+      { "output", 'o', 0, G_OPTION_ARG_FILENAME, &output,
+        "Write the results to FILE instead of stdout", "FILE" },
+      { NULL }
+  };
+  GOptionContext *context;
+  GError *error = NULL;
+  gint ret;
+
+  /* this takes its own options out of argv first */
+  g_test_init (&argc, &argv, NULL);
+
+  context = g_option_context_new ("- benchmark telepathy-glib");
+  g_option_context_add_main_entries (context, entries, NULL);
+
+  if (!g_option_context_parse (context, &argc, &argv, &error))
+    {
+      g_printerr ("%s\n", error->message);
+      return 2;
+    }
+
+  g_option_context_free (context);
+
+  if (scale < 1)
+    {
+      g_printerr ("--scale must be at least 1\n");
+      return 2;
+    }
+
+  results = g_ptr_array_new_with_free_func (g_free);
+
+  g_test_add ("/benchmark/contact-upgrade", Fixture, NULL,
+      setup_contacts, bench_contact_upgrade, teardown);
+  g_test_add ("/benchmark/roster-load", Fixture, NULL,
+      setup_contacts_offline, bench_roster_load, teardown);
+  g_test_add ("/benchmark/message-round-trip", Fixture, NULL,
+      setup_echo, bench_messages, teardown);
+  g_test_add ("/benchmark/get-all", Fixture, NULL,
+      setup_contacts, bench_get_all, teardown);
+  g_test_add ("/benchmark/channel-request", Fixture, NULL,
+      setup_echo, bench_channel_request, teardown);
+
+  ret = tp_tests_run_with_bus ();
+
+  if (ret == 0 && !write_results ())
+    ret = 1;
+
+  g_ptr_array_unref (results);
+  g_free (output);
+  return ret;
+}
@@ -0,0 +1,251 @@
+/* Tests of TpChannelFilterSet
+ *
+ * Copyright (C) 2026 Collabora Ltd. <http://www.collabora.co.uk/>
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.
+ */
+
+#include "config.h"
+
+#include <telepathy-glib/channel-filter-set.h>
+#include <telepathy-glib/dbus.h>
+#include <telepathy-glib/enums.h>
+#include <telepathy-glib/gtypes.h>
+#include <telepathy-glib/interfaces.h>
+
+#define N_ROOM_FILTERS 500
+
+static GHashTable *
+text_channel (TpHandleType handle_type,
+    const gchar *target_id)
+{
+  return tp_asv_new (
+      TP_PROP_CHANNEL_CHANNEL_TYPE, G_TYPE_STRING, TP_IFACE_CHANNEL_TYPE_TEXT,
+      TP_PROP_CHANNEL_TARGET_HANDLE_TYPE, G_TYPE_UINT, handle_type,
+      TP_PROP_CHANNEL_TARGET_ID, G_TYPE_STRING, target_id,
+      TP_PROP_CHANNEL_REQUESTED, G_TYPE_BOOLEAN, FALSE,
+      NULL);
+}
+
+static void
+test_basics (void)
+{
+  TpChannelFilterSet *set = tp_channel_filter_set_new ();
+  GHashTable *filter;
+  GHashTable *channel;
+  GList *matches;
+  guint any, text, text_contact, incoming_text, call, text_room;
+
+  g_assert_cmpuint (tp_channel_filter_set_get_size (set), ==, 0);
+
+  channel = text_channel (TP_HANDLE_TYPE_CONTACT, "bob@example.com");
+  g_assert (!tp_channel_filter_set_matches (set, channel));
+  g_assert (tp_channel_filter_set_match (set, channel) == NULL);
+
+  filter = tp_asv_new (NULL, NULL);
+  any = tp_channel_filter_set_add (set, filter, "any", NULL);
+  g_hash_table_unref (filter);
+
+  filter = tp_asv_new (
+      TP_PROP_CHANNEL_CHANNEL_TYPE, G_TYPE_STRING, TP_IFACE_CHANNEL_TYPE_CALL,
+      NULL);
+  call = tp_channel_filter_set_add (set, filter, "call", NULL);
+  g_hash_table_unref (filter);
+
+  filter = tp_asv_new (
+      TP_PROP_CHANNEL_CHANNEL_TYPE, G_TYPE_STRING, TP_IFACE_CHANNEL_TYPE_TEXT,
+      NULL);
+  text = tp_channel_filter_set_add (set, filter, "text", NULL);
+
+  /* the filter is copied */
+  tp_asv_set_uint32 (filter, TP_PROP_CHANNEL_TARGET_HANDLE_TYPE,
+      TP_HANDLE_TYPE_ROOM);
+  text_room = tp_channel_filter_set_add (set, filter, "text-room", NULL);
+
+  /* integers match regardless of their signedness and size */
+  tp_asv_set_int32 (filter, TP_PROP_CHANNEL_TARGET_HANDLE_TYPE,
+      TP_HANDLE_TYPE_CONTACT);
+  text_contact = tp_channel_filter_set_add (set, filter, "text-contact",
+      NULL);
+
+  tp_asv_set_boolean (filter, TP_PROP_CHANNEL_REQUESTED, FALSE);
+  incoming_text = tp_channel_filter_set_add (set, filter, "incoming-text",
+      NULL);
+  g_hash_table_unref (filter);
+
+  g_assert_cmpuint (tp_channel_filter_set_get_size (set), ==, 6);
+  g_assert_cmpuint (any, !=, 0);
+  g_assert_cmpuint (call, !=, any);
+
+  /* matches are in the order the filters were added */
+  matches = tp_channel_filter_set_match (set, channel);
+  g_assert_cmpuint (g_list_length (matches), ==, 4);
+  g_assert_cmpstr (g_list_nth_data (matches, 0), ==, "any");
+  g_assert_cmpstr (g_list_nth_data (matches, 1), ==, "text");
+  g_assert_cmpstr (g_list_nth_data (matches, 2), ==, "text-contact");
+  g_assert_cmpstr (g_list_nth_data (matches, 3), ==, "incoming-text");
+  g_list_free (matches);
+
+  /* a requested channel doesn't match the incoming filter */
+  tp_asv_set_boolean (channel, TP_PROP_CHANNEL_REQUESTED, TRUE);
+  matches = tp_channel_filter_set_match (set, channel);
+  g_assert_cmpuint (g_list_length (matches), ==, 3);
+  g_assert_cmpstr (g_list_nth_data (matches, 2), ==, "text-contact");
+  g_list_free (matches);
+
+  /* nor does a channel without the Requested property at all */
+  g_hash_table_remove (channel, TP_PROP_CHANNEL_REQUESTED);
+  matches = tp_channel_filter_set_match (set, channel);
+  g_assert_cmpuint (g_list_length (matches), ==, 3);
+  g_list_free (matches);
+  g_hash_table_unref (channel);
+
+  channel = text_channel (TP_HANDLE_TYPE_ROOM, "#telepathy");
+  matches = tp_channel_filter_set_match (set, channel);
+  g_assert_cmpuint (g_list_length (matches), ==, 3);
+  g_assert_cmpstr (g_list_nth_data (matches, 2), ==, "text-room");
+  g_list_free (matches);
+
+  g_assert (tp_channel_filter_set_remove (set, text_room));
+  g_assert (!tp_channel_filter_set_remove (set, text_room));
+  g_assert (tp_channel_filter_set_remove (set, any));
+  g_assert (tp_channel_filter_set_remove (set, text));
+  g_assert_cmpuint (tp_channel_filter_set_get_size (set), ==, 3);
+
+  g_assert (!tp_channel_filter_set_matches (set, channel));
+  g_hash_table_unref (channel);
+
+  channel = text_channel (TP_HANDLE_TYPE_CONTACT, "bob@example.com");
+  g_assert (tp_channel_filter_set_matches (set, channel));
+  g_hash_table_unref (channel);
+
+  g_assert (tp_channel_filter_set_remove (set, text_contact));
+  g_assert (tp_channel_filter_set_remove (set, incoming_text));
+  g_assert (tp_channel_filter_set_remove (set, call));
+  g_assert_cmpuint (tp_channel_filter_set_get_size (set), ==, 0);
+
+  tp_channel_filter_set_unref (set);
+}
+
+static void
+test_types (void)
+{
+  TpChannelFilterSet *set = tp_channel_filter_set_new ();
+  GHashTable *filter;
+  GHashTable *channel;
+
+  /* a TargetHandleType that isn't an integer can't be indexed, but is still
+   * compared */
+  filter = tp_asv_new (
+      TP_PROP_CHANNEL_TARGET_HANDLE_TYPE, G_TYPE_STRING, "contact",
+      "com.example.Path", DBUS_TYPE_G_OBJECT_PATH, "/com/example/a",
+      NULL);
+  tp_asv_set_bytes (filter, "com.example.Bytes", 3, "abc");
+  tp_channel_filter_set_add (set, filter, NULL, NULL);
+
+  channel = tp_asv_new (
+      TP_PROP_CHANNEL_TARGET_HANDLE_TYPE, G_TYPE_STRING, "contact",
+      "com.example.Path", DBUS_TYPE_G_OBJECT_PATH, "/com/example/a",
+      NULL);
+  tp_asv_set_bytes (channel, "com.example.Bytes", 3, "abc");
+  g_assert (tp_channel_filter_set_matches (set, channel));
+
+  tp_asv_set_bytes (channel, "com.example.Bytes", 3, "abd");
+  g_assert (!tp_channel_filter_set_matches (set, channel));
+
+  tp_asv_set_bytes (channel, "com.example.Bytes", 3, "abc");
+  tp_asv_set_uint32 (channel, TP_PROP_CHANNEL_TARGET_HANDLE_TYPE,
+      TP_HANDLE_TYPE_CONTACT);
+  g_assert (!tp_channel_filter_set_matches (set, channel));
+
+  tp_asv_set_string (channel, TP_PROP_CHANNEL_TARGET_HANDLE_TYPE, "contact");
+  tp_asv_set_object_path (channel, "com.example.Path", "/com/example/b");
+  g_assert (!tp_channel_filter_set_matches (set, channel));
+
+  g_hash_table_unref (channel);
+  g_hash_table_unref (filter);
+
+  /* a negative integer is not equal to a large unsigned one */
+  filter = tp_asv_new (
+      "com.example.Number", G_TYPE_INT64, G_GINT64_CONSTANT (-1),
+      NULL);
+  tp_channel_filter_set_add (set, filter, NULL, NULL);
+  g_hash_table_unref (filter);
+
+  channel = tp_asv_new (
+      "com.example.Number", G_TYPE_UINT64, G_MAXUINT64,
+      NULL);
+  g_assert (!tp_channel_filter_set_matches (set, channel));
+  tp_asv_set_int32 (channel, "com.example.Number", -1);
+  g_assert (tp_channel_filter_set_matches (set, channel));
+  g_hash_table_unref (channel);
+
+  tp_channel_filter_set_unref (set);
+}
+
+static void
+count_destroy (gpointer p)
+{
+  guint *count = p;
+
+  (*count)++;
+}
+
+static void
+test_many (void)
+{
+  TpChannelFilterSet *set = tp_channel_filter_set_new ();
+  guint destroyed = 0;
+  GHashTable *channel;
+  GList *matches;
+  guint i;
+
+  /* lots of filters for specific rooms, of which only one matches */
+  for (i = 0; i < N_ROOM_FILTERS; i++)
+    {
+      gchar *id = g_strdup_printf ("room%u@example.com", i);
+      GHashTable *filter = text_channel (TP_HANDLE_TYPE_ROOM, id);
+
+      g_hash_table_remove (filter, TP_PROP_CHANNEL_REQUESTED);
+      tp_channel_filter_set_add (set, filter, &destroyed, count_destroy);
+      g_hash_table_unref (filter);
+      g_free (id);
+    }
+
+  channel = text_channel (TP_HANDLE_TYPE_ROOM, "room42@example.com");
+  matches = tp_channel_filter_set_match (set, channel);
+  g_assert_cmpuint (g_list_length (matches), ==, 1);
+  g_list_free (matches);
+  g_hash_table_unref (channel);
+
+  /* none of them is considered for a 1-1 channel */
+  channel = text_channel (TP_HANDLE_TYPE_CONTACT, "room42@example.com");
+  g_assert (!tp_channel_filter_set_matches (set, channel));
+  g_hash_table_unref (channel);
+
+  /* removing a filter destroys its user data, and so does freeing the set */
+  g_assert (tp_channel_filter_set_remove (set, 1));
+  g_assert_cmpuint (destroyed, ==, 1);
+
+  tp_channel_filter_set_ref (set);
+  tp_channel_filter_set_unref (set);
+  g_assert_cmpuint (destroyed, ==, 1);
+
+  tp_channel_filter_set_unref (set);
+  g_assert_cmpuint (destroyed, ==, N_ROOM_FILTERS);
+}
+
+int
+main (int argc,
+      char **argv)
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/channel-filter-set/basics", test_basics);
+  g_test_add_func ("/channel-filter-set/types", test_types);
+  g_test_add_func ("/channel-filter-set/many", test_many);
+
+  return g_test_run ();
+}
@@ -552,6 +552,255 @@ test_ensure (Test *test,
   script_append_action (test, assert_failed_action, NULL);
 }
 
+static void
+account_prepared_cb (TpAccountManager *am,
+    TpAccount *account,
+    gpointer user_data)
+{
+  guint *n_prepared = user_data;
+
+  g_assert (tp_proxy_is_prepared (account, TP_ACCOUNT_FEATURE_CORE));
+  (*n_prepared)++;
+}
+
+typedef struct {
+    Test *test;
+    /* object paths of the accounts whose Storage properties were fetched,
+     * in order */
+    GPtrArray *storage_requests;
+} BoundedPreparation;
+
+static DBusHandlerResult
+storage_get_all_filter (DBusConnection *connection,
+    DBusMessage *msg,
+    gpointer user_data)
+{
+  BoundedPreparation *bp = user_data;
+  const gchar *iface;
+  guint n_prepared = 0;
+
+  if (!dbus_message_is_method_call (msg, TP_IFACE_DBUS_PROPERTIES, "GetAll") ||
+      !dbus_message_get_args (msg, NULL,
+        DBUS_TYPE_STRING, &iface,
+        DBUS_TYPE_INVALID) ||
+      tp_strdiff (iface, TP_IFACE_ACCOUNT_INTERFACE_STORAGE))
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+
+  g_ptr_array_add (bp->storage_requests,
+      g_strdup (dbus_message_get_path (msg)));
+
+  if (tp_proxy_is_prepared (bp->test->account1, TP_ACCOUNT_FEATURE_STORAGE))
+    n_prepared++;
+
+  if (tp_proxy_is_prepared (bp->test->account2, TP_ACCOUNT_FEATURE_STORAGE))
+    n_prepared++;
+
+  /* with max-preparing-accounts = 1, each account's preparation has
+   * finished before the next one's starts */
+  g_assert_cmpuint (bp->storage_requests->len - n_prepared, <=, 1);
+
+  return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+}
+
+static void
+test_prepare_bounded (Test *test,
+    gconstpointer data)
+{
+  gboolean progressive = GPOINTER_TO_INT (data);
+  guint n_prepared = 0;
+  GList *accounts;
+  TpSimpleClientFactory *factory;
+  DBusConnection *dbus_connection;
+  BoundedPreparation bp = { test, NULL };
+
+  bp.storage_requests = g_ptr_array_new_with_free_func (g_free);
+
+  /* the first account is disabled, so although it comes first, the rest of
+   * its features are prepared last */
+  tp_tests_simple_account_set_enabled (test->account1_service, FALSE);
+  tp_tests_simple_account_manager_add_account (test->service, ACCOUNT1_PATH,
+      TRUE);
+  tp_tests_simple_account_manager_add_account (test->service, ACCOUNT2_PATH,
+      TRUE);
+
+  test->am = tp_account_manager_new (test->dbus);
+
+  factory = tp_proxy_get_factory (test->am);
+  tp_simple_client_factory_add_account_features_varargs (factory,
+      TP_ACCOUNT_FEATURE_STORAGE,
+      0);
+  test->account1 = tp_simple_client_factory_ensure_account (factory,
+      ACCOUNT1_PATH, NULL, &test->error);
+  g_assert_no_error (test->error);
+  test->account2 = tp_simple_client_factory_ensure_account (factory,
+      ACCOUNT2_PATH, NULL, &test->error);
+  g_assert_no_error (test->error);
+
+  dbus_connection = dbus_g_connection_get_connection (
+      tp_proxy_get_dbus_connection (test->dbus));
+  dbus_connection_add_filter (dbus_connection, storage_get_all_filter, &bp,
+      NULL);
+
+  tp_account_manager_set_max_preparing_accounts (test->am, 1);
+  g_object_set (test->am,
+      "progressive-preparation", progressive,
+      NULL);
+  g_assert_cmpuint (tp_account_manager_get_max_preparing_accounts (test->am),
+      ==, 1);
+  g_assert (tp_account_manager_get_progressive_preparation (test->am) ==
+      progressive);
+
+  g_signal_connect (test->am, "account-prepared",
+      G_CALLBACK (account_prepared_cb), &n_prepared);
+
+  tp_tests_proxy_run_until_prepared (test->am, NULL);
+
+  if (progressive)
+    {
+      /* the accounts are announced one by one */
+      while (n_prepared < 2)
+        g_main_context_iteration (NULL, TRUE);
+    }
+  else
+    {
+      /* the accounts were all ready before the manager was */
+      g_assert_cmpuint (n_prepared, ==, 0);
+    }
+
+  accounts = tp_account_manager_dup_valid_accounts (test->am);
+  g_assert_cmpuint (g_list_length (accounts), ==, 2);
+  g_list_free_full (accounts, g_object_unref);
+
+  dbus_connection_remove_filter (dbus_connection, storage_get_all_filter,
+      &bp);
+
+  g_assert (tp_proxy_is_prepared (test->account1, TP_ACCOUNT_FEATURE_STORAGE));
+  g_assert (tp_proxy_is_prepared (test->account2, TP_ACCOUNT_FEATURE_STORAGE));
+
+  /* the enabled account was fully prepared first */
+  g_assert_cmpuint (bp.storage_requests->len, ==, 2);
+  g_assert_cmpstr (g_ptr_array_index (bp.storage_requests, 0), ==,
+      ACCOUNT2_PATH);
+  g_assert_cmpstr (g_ptr_array_index (bp.storage_requests, 1), ==,
+      ACCOUNT1_PATH);
+  g_ptr_array_unref (bp.storage_requests);
+}
+
+static void
+test_snapshot (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  GList *accounts, *l;
+
+  tp_tests_simple_account_manager_add_account (test->service, ACCOUNT1_PATH,
+      TRUE);
+  tp_tests_simple_account_manager_add_account (test->service, ACCOUNT2_PATH,
+      TRUE);
+
+  /* a first process saves the snapshot, at the latest when it goes away */
+  test->am = tp_account_manager_new (test->dbus);
+  tp_account_manager_set_use_snapshot (test->am, TRUE);
+  g_assert (tp_account_manager_get_use_snapshot (test->am));
+  tp_tests_proxy_run_until_prepared (test->am, NULL);
+  g_clear_object (&test->am);
+
+  /* the next one has provisional accounts straight away */
+  test->am = tp_account_manager_new (test->dbus);
+  g_object_set (test->am,
+      "use-snapshot", TRUE,
+      NULL);
+
+  accounts = tp_account_manager_dup_provisional_accounts (test->am);
+  g_assert_cmpuint (g_list_length (accounts), ==, 2);
+
+  for (l = accounts; l != NULL; l = l->next)
+    {
+      TpAccount *account = l->data;
+
+      g_assert (tp_account_is_provisional (account));
+      g_assert (!tp_proxy_is_prepared (account, TP_ACCOUNT_FEATURE_CORE));
+      g_assert_cmpstr (tp_account_get_display_name (account), ==,
+          "Fake Account");
+      g_assert_cmpstr (tp_account_get_nickname (account), ==, "badger");
+    }
+
+  tp_tests_proxy_run_until_prepared (test->am, NULL);
+
+  /* the same objects are now real */
+  for (l = accounts; l != NULL; l = l->next)
+    {
+      TpAccount *account = l->data;
+
+      g_assert (!tp_account_is_provisional (account));
+      g_assert (tp_proxy_is_prepared (account, TP_ACCOUNT_FEATURE_CORE));
+      g_assert (tp_account_manager_ensure_account (test->am,
+            tp_proxy_get_object_path (account)) == account);
+    }
+
+  g_list_free_full (accounts, g_object_unref);
+
+  accounts = tp_account_manager_dup_provisional_accounts (test->am);
+  g_assert_cmpuint (g_list_length (accounts), ==, 2);
+  g_list_free_full (accounts, g_object_unref);
+}
+
+static void
+test_snapshot_stale (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  GList *accounts;
+  const GError *invalidated;
+
+  tp_tests_simple_account_manager_add_account (test->service, ACCOUNT1_PATH,
+      TRUE);
+  tp_tests_simple_account_manager_add_account (test->service, ACCOUNT2_PATH,
+      TRUE);
+
+  test->am = tp_account_manager_new (test->dbus);
+  tp_account_manager_set_use_snapshot (test->am, TRUE);
+  tp_tests_proxy_run_until_prepared (test->am, NULL);
+  g_clear_object (&test->am);
+
+  /* between processes, one account becomes invalid and the other is
+   * deleted */
+  tp_tests_simple_account_manager_add_account (test->service, ACCOUNT1_PATH,
+      FALSE);
+  tp_tests_simple_account_manager_remove_account (test->service,
+      ACCOUNT2_PATH);
+
+  test->am = tp_account_manager_new (test->dbus);
+  tp_account_manager_set_use_snapshot (test->am, TRUE);
+
+  accounts = tp_account_manager_dup_provisional_accounts (test->am);
+  g_assert_cmpuint (g_list_length (accounts), ==, 2);
+  g_list_free_full (accounts, g_object_unref);
+
+  test->account1 = tp_account_manager_ensure_account (test->am,
+      ACCOUNT1_PATH);
+  g_object_ref (test->account1);
+  test->account2 = tp_account_manager_ensure_account (test->am,
+      ACCOUNT2_PATH);
+  g_object_ref (test->account2);
+  g_assert (tp_account_is_provisional (test->account1));
+  g_assert (tp_account_is_provisional (test->account2));
+
+  tp_tests_proxy_run_until_prepared (test->am, NULL);
+
+  /* neither is offered any more */
+  accounts = tp_account_manager_dup_provisional_accounts (test->am);
+  g_assert_cmpuint (g_list_length (accounts), ==, 0);
+  g_list_free_full (accounts, g_object_unref);
+
+  /* the deleted one has gone away... */
+  invalidated = tp_proxy_get_invalidated (test->account2);
+  g_assert_error (invalidated, TP_DBUS_ERRORS, TP_DBUS_ERROR_OBJECT_REMOVED);
+
+  /* ... but the invalid one is still there */
+  g_assert (tp_proxy_get_invalidated (test->account1) == NULL);
+  g_assert (tp_account_manager_ensure_account (test->am, ACCOUNT1_PATH) ==
+      test->account1);
+}
+
 /* tp_account_manager_get_most_available_presence() tests */
 static void
 create_tp_accounts (gpointer script_data,
@@ -799,6 +1048,15 @@ main (int argc,
   g_test_add ("/am/prepare/unknown_features", Test, NULL, setup_service,
               test_prepare_unknown_features, teardown_service);
 
+  g_test_add ("/am/prepare/bounded", Test, GINT_TO_POINTER (FALSE),
+      setup_service, test_prepare_bounded, teardown_service);
+  g_test_add ("/am/prepare/progressive", Test, GINT_TO_POINTER (TRUE),
+      setup_service, test_prepare_bounded, teardown_service);
+  g_test_add ("/am/snapshot", Test, NULL, setup_service, test_snapshot,
+      teardown_service);
+  g_test_add ("/am/snapshot/stale", Test, NULL, setup_service,
+      test_snapshot_stale, teardown_service);
+
   g_test_add ("/am/ensure", Test, NULL, setup_service,
               test_ensure, teardown_service);
 
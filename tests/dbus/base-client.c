@@ -407,6 +407,34 @@ check_filters (GPtrArray *filters)
         TP_PROP_CHANNEL_TARGET_HANDLE_TYPE, NULL), ==, TP_HANDLE_TYPE_CONTACT);
 }
 
+static void
+check_filter_set (TpChannelFilterSet *set)
+{
+  GHashTable *properties;
+  GList *matches;
+
+  g_assert (set != NULL);
+  g_assert_cmpuint (tp_channel_filter_set_get_size (set), ==, 2);
+
+  properties = tp_asv_new (
+      TP_PROP_CHANNEL_CHANNEL_TYPE, G_TYPE_STRING,
+        TP_IFACE_CHANNEL_TYPE_STREAM_TUBE,
+      TP_PROP_CHANNEL_TARGET_HANDLE_TYPE, G_TYPE_UINT, TP_HANDLE_TYPE_CONTACT,
+      TP_PROP_CHANNEL_TARGET_ID, G_TYPE_STRING, "bob@example.com",
+      NULL);
+  matches = tp_channel_filter_set_match (set, properties);
+  g_assert_cmpuint (g_list_length (matches), ==, 1);
+  g_assert_cmpuint (g_hash_table_size (matches->data), ==, 2);
+  g_list_free (matches);
+
+  tp_asv_set_uint32 (properties, TP_PROP_CHANNEL_TARGET_HANDLE_TYPE,
+      TP_HANDLE_TYPE_ROOM);
+  g_assert (!tp_channel_filter_set_matches (set, properties));
+  g_hash_table_unref (properties);
+
+  tp_channel_filter_set_unref (set);
+}
+
 static void
 get_observer_prop_cb (TpProxy *proxy,
     GHashTable *properties,
@@ -516,6 +544,9 @@ test_observer (Test *test,
   tp_base_client_set_observer_recover (test->base_client, TRUE);
   tp_base_client_set_observer_delay_approvers (test->base_client, TRUE);
 
+  check_filter_set (tp_base_client_dup_observer_filter_set (
+        test->base_client));
+
   tp_base_client_register (test->base_client, &test->error);
   g_assert_no_error (test->error);
 
@@ -55,6 +55,11 @@ typedef struct
   GArray *contacts;
 
   TpCallContent *added_content;
+
+  /* candidates seen in LocalCandidatesAdded so far, and how many
+   * LocalCandidatesAdded signals there were */
+  guint n_candidates_signalled;
+  guint n_candidates_signals;
 } Test;
 
 static void
@@ -1043,6 +1048,156 @@ test_dtmf (Test *test,
   g_assert_no_error (test->error);
 }
 
+static void
+local_candidates_added_cb (TpCallStream *stream,
+    const GPtrArray *candidates,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  Test *test = user_data;
+
+  test->n_candidates_signalled += candidates->len;
+  test->n_candidates_signals++;
+
+  test->wait_count--;
+  if (test->wait_count <= 0)
+    g_main_loop_quit (test->mainloop);
+}
+
+typedef struct {
+    Test *test;
+    /* number of candidates signalled when the reply arrived */
+    guint n_signalled;
+} AddCandidatesCall;
+
+static void
+add_candidates_cb (TpCallStream *stream,
+    const GError *error,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  AddCandidatesCall *call = user_data;
+
+  g_assert_no_error ((GError *) error);
+  call->n_signalled = call->test->n_candidates_signalled;
+
+  call->test->wait_count--;
+  if (call->test->wait_count <= 0)
+    g_main_loop_quit (call->test->mainloop);
+}
+
+static GPtrArray *
+make_candidates (guint port,
+    guint n)
+{
+  GPtrArray *candidates = g_ptr_array_new_with_free_func (
+      (GDestroyNotify) tp_value_array_free);
+  GHashTable *info = tp_asv_new (NULL, NULL);
+  guint i;
+
+  for (i = 0; i < n; i++)
+    g_ptr_array_add (candidates, tp_value_array_build (4,
+          G_TYPE_UINT, TP_STREAM_COMPONENT_DATA,
+          G_TYPE_STRING, "127.0.0.1",
+          G_TYPE_UINT, port + i,
+          TP_HASH_TYPE_CANDIDATE_INFO, info,
+          G_TYPE_INVALID));
+
+  g_hash_table_unref (info);
+  return candidates;
+}
+
+static void
+test_candidates (Test *test,
+    gconstpointer data)
+{
+  guint batch_interval = GPOINTER_TO_UINT (data);
+  GPtrArray *contents;
+  GPtrArray *streams;
+  TpCallStream *stream;
+  GObject *service_stream;
+  GPtrArray *candidates;
+  AddCandidatesCall first = { test, 0 };
+  AddCandidatesCall second = { test, 0 };
+  GPtrArray *local_candidates;
+
+  outgoing_call (test, "candidate-badger", TRUE, FALSE);
+
+  contents = tp_call_channel_get_contents (test->call_chan);
+  g_assert_cmpuint (contents->len, ==, 1);
+  streams = tp_call_content_get_streams (g_ptr_array_index (contents, 0));
+  g_assert_cmpuint (streams->len, ==, 1);
+  stream = g_ptr_array_index (streams, 0);
+  tp_tests_proxy_run_until_prepared (stream, NULL);
+
+  service_stream = dbus_g_connection_lookup_g_object (
+      tp_proxy_get_dbus_connection (test->dbus),
+      tp_proxy_get_object_path (stream));
+  g_assert (TP_IS_BASE_MEDIA_CALL_STREAM (service_stream));
+  g_object_set (service_stream,
+      "batch-interval", batch_interval,
+      NULL);
+
+  tp_cli_call_stream_interface_media_connect_to_local_candidates_added (
+      stream, local_candidates_added_cb, test, NULL, NULL, &test->error);
+  g_assert_no_error (test->error);
+
+  /* trickle in two sets of candidates */
+  candidates = make_candidates (1000, 2);
+  tp_cli_call_stream_interface_media_call_add_candidates (stream, -1,
+      candidates, add_candidates_cb, &first, NULL, NULL);
+  g_ptr_array_unref (candidates);
+
+  candidates = make_candidates (2000, 3);
+  tp_cli_call_stream_interface_media_call_add_candidates (stream, -1,
+      candidates, add_candidates_cb, &second, NULL, NULL);
+  g_ptr_array_unref (candidates);
+
+  if (batch_interval == 0)
+    {
+      /* each call's candidates are signalled before it returns */
+      test->wait_count = 4;
+      g_main_loop_run (test->mainloop);
+
+      g_assert_cmpuint (first.n_signalled, ==, 2);
+      g_assert_cmpuint (second.n_signalled, ==, 5);
+      g_assert_cmpuint (test->n_candidates_signals, ==, 2);
+    }
+  else
+    {
+      /* both calls return straight away... */
+      test->wait_count = 2;
+      g_main_loop_run (test->mainloop);
+
+      g_assert_cmpuint (first.n_signalled, ==, 0);
+      g_assert_cmpuint (second.n_signalled, ==, 0);
+      g_assert_cmpuint (test->n_candidates_signals, ==, 0);
+
+      /* ... but the candidates are already visible on the service side */
+      g_object_get (service_stream,
+          "local-candidates", &local_candidates,
+          NULL);
+      g_assert_cmpuint (local_candidates->len, ==, 5);
+      g_boxed_free (TP_ARRAY_TYPE_CANDIDATE_LIST, local_candidates);
+
+      /* they are all signalled together when the batch is flushed, which
+       * turning batching off does straight away; the interval is far too
+       * long to have run out by itself */
+      g_object_set (service_stream,
+          "batch-interval", 0,
+          NULL);
+      test->wait_count = 1;
+      g_main_loop_run (test->mainloop);
+
+      g_assert_cmpuint (test->n_candidates_signals, ==, 1);
+      g_assert_cmpuint (test->n_candidates_signalled, ==, 5);
+    }
+
+  /* nothing else is signalled */
+  tp_tests_proxy_run_until_dbus_queue_processed (test->conn);
+  g_assert_cmpuint (test->n_candidates_signalled, ==, 5);
+}
+
 static void
 teardown (Test *test,
           gconstpointer data G_GNUC_UNUSED)
@@ -1090,6 +1245,10 @@ main (int argc,
       teardown);
   g_test_add ("/call/dtmf", Test, NULL, setup, test_dtmf,
       teardown);
+  g_test_add ("/call/candidates/unbatched", Test, GUINT_TO_POINTER (0),
+      setup, test_candidates, teardown);
+  g_test_add ("/call/candidates/batched", Test, GUINT_TO_POINTER (10000),
+      setup, test_candidates, teardown);
 
   return tp_tests_run_with_bus ();
 }
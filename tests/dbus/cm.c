@@ -10,6 +10,8 @@
 
 #include "config.h"
 
+#include <glib/gstdio.h>
+
 #include <telepathy-glib/telepathy-glib.h>
 
 #include "tests/lib/echo-cm.h"
@@ -162,6 +164,22 @@ teardown (Test *test,
   test->mainloop = NULL;
 }
 
+static void
+setup_file_cache (Test *test,
+    gconstpointer data)
+{
+  remove_cache_files ();
+  setup (test, data);
+}
+
+static void
+teardown_file_cache (Test *test,
+    gconstpointer data)
+{
+  teardown (test, data);
+  remove_cache_files ();
+}
+
 static void
 test_valid_name (void)
 {
@@ -877,6 +895,236 @@ test_file_ready (Test *test,
   g_list_free_full (l, g_object_unref);
 }
 
+static guint
+count_cache_files (void)
+{
+  gchar *dir_name = g_build_filename (g_get_user_cache_dir (), "telepathy",
+      "managers", NULL);
+  GDir *dir = g_dir_open (dir_name, 0, NULL);
+  guint n = 0;
+
+  if (dir != NULL)
+    {
+      while (g_dir_read_name (dir) != NULL)
+        n++;
+
+      g_dir_close (dir);
+    }
+
+  g_free (dir_name);
+  return n;
+}
+
+static void
+corrupt_cache_files (void)
+{
+  gchar *dir_name = g_build_filename (g_get_user_cache_dir (), "telepathy",
+      "managers", NULL);
+  GDir *dir = g_dir_open (dir_name, 0, NULL);
+  const gchar *base;
+
+  g_assert (dir != NULL);
+
+  while ((base = g_dir_read_name (dir)) != NULL)
+    {
+      gchar *path = g_build_filename (dir_name, base, NULL);
+      GError *error = NULL;
+
+      g_file_set_contents (path, "\xff\x00not a cache", -1, &error);
+      g_assert_no_error (error);
+      g_free (path);
+    }
+
+  g_dir_close (dir);
+  g_free (dir_name);
+}
+
+/* Delete every cache entry, so that a test which tampers with them doesn't
+ * leave entries behind that still look up to date to the next test, or
+ * the next run. */
+static void
+remove_cache_files (void)
+{
+  gchar *dir_name = g_build_filename (g_get_user_cache_dir (), "telepathy",
+      "managers", NULL);
+  GDir *dir = g_dir_open (dir_name, 0, NULL);
+  const gchar *base;
+
+  if (dir != NULL)
+    {
+      while ((base = g_dir_read_name (dir)) != NULL)
+        {
+          gchar *path = g_build_filename (dir_name, base, NULL);
+
+          g_assert_cmpint (g_unlink (path), ==, 0);
+          g_free (path);
+        }
+
+      g_dir_close (dir);
+    }
+
+  g_free (dir_name);
+}
+
+/* Rewrite each cache entry without its last protocol, keeping everything
+ * that's used to decide whether it's up to date. If a protocol goes missing,
+ * the cache was used. */
+static void
+truncate_cache_files (void)
+{
+  gchar *dir_name = g_build_filename (g_get_user_cache_dir (), "telepathy",
+      "managers", NULL);
+  GDir *dir = g_dir_open (dir_name, 0, NULL);
+  const gchar *base;
+
+  g_assert (dir != NULL);
+
+  while ((base = g_dir_read_name (dir)) != NULL)
+    {
+      gchar *path = g_build_filename (dir_name, base, NULL);
+      GError *error = NULL;
+      gchar *contents;
+      gsize len;
+      GVariant *entry, *version, *filename, *mtime, *size, *interfaces;
+      GVariant *protocols, *truncated;
+      GVariantBuilder builder;
+      gsize i;
+
+      g_file_get_contents (path, &contents, &len, &error);
+      g_assert_no_error (error);
+      entry = g_variant_ref_sink (g_variant_new_from_data (
+            G_VARIANT_TYPE ("(usxtasa(sa{sv}))"), contents, len, FALSE,
+            g_free, contents));
+
+      g_variant_get (entry, "(@u@s@x@t@as@a(sa{sv}))", &version, &filename,
+          &mtime, &size, &interfaces, &protocols);
+      g_assert_cmpuint (g_variant_n_children (protocols), >, 1);
+      g_variant_builder_init (&builder, G_VARIANT_TYPE ("a(sa{sv})"));
+
+      for (i = 0; i + 1 < g_variant_n_children (protocols); i++)
+        {
+          GVariant *protocol = g_variant_get_child_value (protocols, i);
+
+          g_variant_builder_add_value (&builder, protocol);
+          g_variant_unref (protocol);
+        }
+
+      truncated = g_variant_ref_sink (g_variant_new ("(@u@s@x@t@as@a(sa{sv}))",
+            version, filename, mtime, size, interfaces,
+            g_variant_builder_end (&builder)));
+
+      g_file_set_contents (path, g_variant_get_data (truncated),
+          g_variant_get_size (truncated), &error);
+      g_assert_no_error (error);
+
+      g_variant_unref (truncated);
+      g_variant_unref (version);
+      g_variant_unref (filename);
+      g_variant_unref (mtime);
+      g_variant_unref (size);
+      g_variant_unref (interfaces);
+      g_variant_unref (protocols);
+      g_variant_unref (entry);
+      g_free (path);
+    }
+
+  g_dir_close (dir);
+  g_free (dir_name);
+}
+
+static guint
+count_protocols (TpConnectionManager *cm)
+{
+  GList *protocols = tp_connection_manager_dup_protocols (cm);
+  guint n = g_list_length (protocols);
+
+  g_list_free_full (protocols, g_object_unref);
+  return n;
+}
+
+static TpConnectionManager *
+load_spurious (Test *test)
+{
+  TpConnectionManager *cm;
+
+  test->error = NULL;
+  cm = tp_connection_manager_new (test->dbus, "spurious", NULL,
+      &test->error);
+  g_assert_no_error (test->error);
+  tp_tests_proxy_run_until_prepared (cm, NULL);
+  g_assert_cmpuint (tp_connection_manager_get_info_source (cm), ==,
+      TP_CM_INFO_SOURCE_FILE);
+
+  return cm;
+}
+
+static void
+assert_same_protocols (TpConnectionManager *expected,
+    TpConnectionManager *actual)
+{
+  GList *protocols, *l;
+
+  protocols = tp_connection_manager_dup_protocols (expected);
+  g_assert_cmpuint (g_list_length (protocols), ==, 2);
+
+  for (l = protocols; l != NULL; l = l->next)
+    {
+      TpProtocol *e = l->data;
+      TpProtocol *a = tp_connection_manager_get_protocol_object (actual,
+          tp_protocol_get_name (e));
+      GVariant *e_immutables, *a_immutables;
+
+      g_assert (a != NULL);
+
+      e_immutables = tp_protocol_dup_immutable_properties (e);
+      a_immutables = tp_protocol_dup_immutable_properties (a);
+      g_assert (g_variant_equal (e_immutables, a_immutables));
+      g_variant_unref (e_immutables);
+      g_variant_unref (a_immutables);
+    }
+
+  g_list_free_full (protocols, g_object_unref);
+}
+
+static void
+test_file_cache (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  TpConnectionManager *cached;
+
+  /* there was no cache before, but there is one now */
+  g_assert_cmpuint (count_cache_files (), ==, 0);
+  test->cm = load_spurious (test);
+  g_assert_cmpuint (count_cache_files (), >, 0);
+
+  /* loading it from the cache gets the same results */
+  cached = load_spurious (test);
+  assert_same_protocols (test->cm, cached);
+  g_object_unref (cached);
+
+  /* ... and really does come from the cache, not the .manager file */
+  truncate_cache_files ();
+  cached = load_spurious (test);
+  g_assert_cmpuint (count_protocols (cached), ==, 1);
+  g_object_unref (cached);
+
+  /* a corrupt cache is ignored, and replaced */
+  corrupt_cache_files ();
+  cached = load_spurious (test);
+  assert_same_protocols (test->cm, cached);
+  g_object_unref (cached);
+
+  cached = load_spurious (test);
+  assert_same_protocols (test->cm, cached);
+  g_object_unref (cached);
+
+  /* the replacement is used next time */
+  truncate_cache_files ();
+  cached = load_spurious (test);
+  g_assert_cmpuint (count_protocols (cached), ==, 1);
+  g_object_unref (cached);
+}
+
 static void
 test_complex_file_ready (Test *test,
                          gconstpointer data)
@@ -1146,6 +1394,8 @@ main (int argc,
       setup, test_file_ready, teardown);
   g_test_add ("/cm/file/cwr", Test, GINT_TO_POINTER (USE_CWR),
       setup, test_file_ready, teardown);
+  g_test_add ("/cm/file/cache", Test, NULL, setup_file_cache,
+      test_file_cache, teardown_file_cache);
   g_test_add ("/cm/file/complex", Test, GINT_TO_POINTER (0), setup,
       test_complex_file_ready, teardown);
   g_test_add ("/cm/file/complex/cwr", Test, GINT_TO_POINTER (USE_CWR), setup,
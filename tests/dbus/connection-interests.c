@@ -20,6 +20,7 @@
 #include <dbus/dbus-glib-lowlevel.h>
 
 #include "tests/lib/simple-conn.h"
+#include "tests/lib/simple-manager.h"
 #include "tests/lib/util.h"
 
 /* an almost-no-op subclass... */
@@ -74,6 +75,18 @@ interested_connection_class_init (InterestedConnectionClass *cls)
   object_class->constructed = interested_connection_constructed;
 }
 
+/* ... and a connection manager which adds Location as a possible interest
+ * to its connections, and tells the current test in which thread they
+ * emit their signals */
+typedef TpTestsSimpleConnectionManager InterestedConnectionManager;
+typedef TpTestsSimpleConnectionManagerClass InterestedConnectionManagerClass;
+
+static GType interested_connection_manager_get_type (void);
+
+G_DEFINE_TYPE (InterestedConnectionManager,
+    interested_connection_manager,
+    TP_TESTS_TYPE_SIMPLE_CONNECTION_MANAGER)
+
 typedef struct {
     TpDBusDaemon *dbus;
     DBusConnection *client_libdbus;
@@ -91,8 +104,81 @@ typedef struct {
     GAsyncResult *prepare_result;
 
     GPtrArray *log;
+
+    /* for the sharded test */
+    TpBaseConnectionManager *service_cm;
+    GMutex lock;
+    GThread *interested_thread;
+    GThread *uninterested_thread;
 } Test;
 
+/* the connection manager's new_connection has no user_data */
+static Test *sharded_test = NULL;
+
+/* called in the thread of the shard that has the connection */
+static void
+sharded_interested_cb (TpBaseConnection *conn,
+    const gchar *token,
+    Test *test)
+{
+  g_mutex_lock (&test->lock);
+  test->interested_thread = g_thread_self ();
+  g_mutex_unlock (&test->lock);
+  g_main_context_wakeup (NULL);
+}
+
+/* called in the thread of the shard that has the connection */
+static void
+sharded_uninterested_cb (TpBaseConnection *conn,
+    const gchar *token,
+    Test *test)
+{
+  g_mutex_lock (&test->lock);
+  test->uninterested_thread = g_thread_self ();
+  g_mutex_unlock (&test->lock);
+  g_main_context_wakeup (NULL);
+}
+
+static TpBaseConnection *
+interested_connection_manager_new_connection (TpBaseConnectionManager *self,
+    const gchar *proto,
+    TpIntset *params_present,
+    gpointer parsed_params,
+    GError **error)
+{
+  TpBaseConnection *conn = TP_BASE_CONNECTION_MANAGER_CLASS (
+      interested_connection_manager_parent_class)->new_connection (self,
+          proto, params_present, parsed_params, error);
+
+  g_assert (conn != NULL);
+  g_assert (sharded_test != NULL);
+
+  tp_base_connection_add_possible_client_interest (conn,
+      TP_IFACE_QUARK_CONNECTION_INTERFACE_LOCATION);
+
+  g_signal_connect (conn, "clients-interested",
+      G_CALLBACK (sharded_interested_cb), sharded_test);
+  g_signal_connect (conn, "clients-uninterested",
+      G_CALLBACK (sharded_uninterested_cb), sharded_test);
+
+  return conn;
+}
+
+static void
+interested_connection_manager_init (InterestedConnectionManager *self)
+{
+}
+
+static void
+interested_connection_manager_class_init (
+    InterestedConnectionManagerClass *cls)
+{
+  TpBaseConnectionManagerClass *base_class =
+    (TpBaseConnectionManagerClass *) cls;
+
+  base_class->new_connection = interested_connection_manager_new_connection;
+}
+
 static void
 connection_prepared_cb (GObject *object,
     GAsyncResult *res,
@@ -386,6 +472,125 @@ test_interest (Test *test,
   g_assert_cmpuint (test->log->len, ==, i);
 }
 
+static void
+setup_sharded (Test *test,
+    gconstpointer data)
+{
+  GHashTable *parameters;
+  TpConnectionManager *cm;
+  GError *error = NULL;
+
+  tp_debug_set_flags ("all");
+  test->dbus = tp_tests_dbus_daemon_dup_or_die ();
+  g_mutex_init (&test->lock);
+  sharded_test = test;
+
+  test->service_cm = tp_tests_object_new_static_class (
+      interested_connection_manager_get_type (), NULL);
+  g_assert (tp_base_connection_manager_set_n_shards (test->service_cm, 1,
+        &error));
+  g_assert_no_error (error);
+  g_assert (tp_base_connection_manager_register (test->service_cm));
+
+  /* the connection is made in the shard */
+  cm = tp_connection_manager_new (test->dbus, "simple", NULL, &error);
+  g_assert_no_error (error);
+
+  parameters = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
+      (GDestroyNotify) tp_g_value_slice_free);
+  g_hash_table_insert (parameters, "account",
+      tp_g_value_slice_new_static_string ("me@example.com"));
+
+  tp_cli_connection_manager_run_request_connection (cm, -1, "simple",
+      parameters, &test->conn_name, &test->conn_path, &error, NULL);
+  g_assert_no_error (error);
+
+  g_hash_table_unref (parameters);
+  g_object_unref (cm);
+
+  /* the client has its own bus connection, so that it can go away */
+  test->client_libdbus = dbus_bus_get_private (DBUS_BUS_STARTER, NULL);
+  g_assert (test->client_libdbus != NULL);
+  dbus_connection_setup_with_g_main (test->client_libdbus, NULL);
+  dbus_connection_set_exit_on_disconnect (test->client_libdbus, FALSE);
+  test->client_dbusglib = dbus_connection_get_g_connection (
+      test->client_libdbus);
+  dbus_g_connection_ref (test->client_dbusglib);
+  test->client_bus = tp_dbus_daemon_new (test->client_dbusglib);
+  g_assert (test->client_bus != NULL);
+
+  test->conn = tp_connection_new (test->client_bus, test->conn_name,
+      test->conn_path, &error);
+  g_assert_no_error (error);
+}
+
+static void
+teardown_sharded (Test *test,
+    gconstpointer data)
+{
+  TpConnection *conn;
+  GError *error = NULL;
+
+  g_clear_object (&test->conn);
+
+  conn = tp_connection_new (test->dbus, test->conn_name, test->conn_path,
+      &error);
+  g_assert_no_error (error);
+  tp_tests_connection_assert_disconnect_succeeds (conn);
+  g_object_unref (conn);
+
+  /* this stops the shard */
+  g_clear_object (&test->service_cm);
+  sharded_test = NULL;
+  g_mutex_clear (&test->lock);
+
+  g_free (test->conn_name);
+  g_free (test->conn_path);
+
+  g_clear_object (&test->client_bus);
+  dbus_g_connection_unref (test->client_dbusglib);
+  dbus_connection_unref (test->client_libdbus);
+  g_clear_object (&test->dbus);
+}
+
+static void
+test_sharded (Test *test,
+    gconstpointer nil G_GNUC_UNUSED)
+{
+  static const gchar * location[] = {
+      TP_IFACE_CONNECTION_INTERFACE_LOCATION,
+      NULL
+  };
+  GError *error = NULL;
+  gboolean done;
+
+  tp_cli_connection_run_add_client_interest (test->conn, -1, location,
+      &error, NULL);
+  g_assert_no_error (error);
+
+  /* The interest is dropped when the shard's TpDBusDaemon sees the client
+   * leave the bus. The connection lives in the shard, so that has to be
+   * handled there too, rather than in this thread. */
+  dbus_connection_flush (test->client_libdbus);
+  dbus_connection_close (test->client_libdbus);
+
+  do
+    {
+      g_main_context_iteration (NULL, TRUE);
+
+      g_mutex_lock (&test->lock);
+      done = (test->uninterested_thread != NULL);
+      g_mutex_unlock (&test->lock);
+    }
+  while (!done);
+
+  g_mutex_lock (&test->lock);
+  g_assert (test->interested_thread != NULL);
+  g_assert (test->interested_thread != g_thread_self ());
+  g_assert (test->uninterested_thread == test->interested_thread);
+  g_mutex_unlock (&test->lock);
+}
+
 int
 main (int argc,
       char **argv)
@@ -395,6 +600,8 @@ main (int argc,
   g_test_add ("/conn/interest", Test, NULL, setup, test_interest, teardown);
   g_test_add ("/conn/interested-client", Test, NULL, setup,
       test_interested_client, teardown);
+  g_test_add ("/conn/interest/sharded", Test, NULL, setup_sharded,
+      test_sharded, teardown_sharded);
 
   return tp_tests_run_with_bus ();
 }
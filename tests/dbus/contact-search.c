@@ -0,0 +1,374 @@
+/* Tests of TpContactSearch
+ *
+ * Copyright © 2026 Collabora Ltd. <http://www.collabora.co.uk/>
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.
+ */
+
+#include "config.h"
+
+#include <telepathy-glib/telepathy-glib.h>
+
+#include "tests/lib/contacts-conn.h"
+#include "tests/lib/contact-search-chan.h"
+#include "tests/lib/util.h"
+#include "tests/lib/simple-channel-dispatcher.h"
+
+#define SERVER "TestServer"
+/* the test channel sends results in pages of this size */
+#define PAGE 5
+
+typedef struct {
+    GMainLoop *mainloop;
+    TpDBusDaemon *dbus;
+
+    /* Service side objects */
+    TpBaseConnection *base_connection;
+    TpTestsSimpleChannelDispatcher *cd_service;
+
+    /* Client side objects */
+    TpAccount *account;
+    TpConnection *connection;
+    TpContactSearch *search;
+
+    GError *error /* initialized where needed */;
+    gint wait;
+
+    /* quit the main loop when the search is in this state, with this many
+     * results */
+    TpChannelContactSearchState wanted_state;
+    guint wanted_results;
+} Test;
+
+#define ACCOUNT_PATH TP_ACCOUNT_OBJECT_PATH_BASE "what/ev/er"
+
+static void
+new_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  Test *test = user_data;
+
+  test->search = tp_contact_search_new_finish (result, &test->error);
+
+  test->wait--;
+  if (test->wait <= 0)
+    g_main_loop_quit (test->mainloop);
+}
+
+static void
+create_search (Test *test,
+    guint limit)
+{
+  tp_clear_object (&test->search);
+
+  tp_contact_search_new_async (test->account, SERVER, limit, new_cb, test);
+
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+  g_assert (TP_IS_CONTACT_SEARCH (test->search));
+}
+
+static void
+setup (Test *test,
+       gconstpointer data)
+{
+  test->mainloop = g_main_loop_new (NULL, FALSE);
+  test->dbus = tp_tests_dbus_daemon_dup_or_die ();
+
+  test->error = NULL;
+
+  test->account = tp_account_new (test->dbus, ACCOUNT_PATH, NULL);
+  g_assert (test->account != NULL);
+
+  tp_tests_create_and_connect_conn (TP_TESTS_TYPE_CONTACTS_CONNECTION,
+      "me@test.com", &test->base_connection, &test->connection);
+
+  tp_dbus_daemon_request_name (test->dbus,
+          TP_CHANNEL_DISPATCHER_BUS_NAME, FALSE, &test->error);
+  g_assert_no_error (test->error);
+
+  test->cd_service = tp_tests_object_new_static_class (
+      TP_TESTS_TYPE_SIMPLE_CHANNEL_DISPATCHER,
+      "connection", test->base_connection,
+      NULL);
+
+  tp_dbus_daemon_register_object (test->dbus,
+      TP_CHANNEL_DISPATCHER_OBJECT_PATH, test->cd_service);
+}
+
+static void
+teardown (Test *test,
+          gconstpointer data)
+{
+  g_clear_error (&test->error);
+
+  tp_clear_object (&test->search);
+
+  tp_dbus_daemon_release_name (test->dbus, TP_CHANNEL_DISPATCHER_BUS_NAME,
+      &test->error);
+  g_assert_no_error (test->error);
+
+  tp_clear_object (&test->cd_service);
+
+  tp_clear_object (&test->dbus);
+  g_main_loop_unref (test->mainloop);
+  test->mainloop = NULL;
+
+  tp_tests_connection_assert_disconnect_succeeds (test->connection);
+  tp_clear_object (&test->account);
+  g_object_unref (test->connection);
+  g_object_unref (test->base_connection);
+}
+
+static TpChannelContactSearchState
+get_state (Test *test)
+{
+  guint state;
+
+  g_object_get (test->search,
+      "state", &state,
+      NULL);
+  return state;
+}
+
+static void
+state_cb (GObject *object,
+    GParamSpec *spec,
+    Test *test)
+{
+  if (tp_contact_search_get_n_results (test->search) ==
+        test->wanted_results &&
+      get_state (test) == test->wanted_state)
+    g_main_loop_quit (test->mainloop);
+}
+
+/* Run until @test->search is in @state with @n_results, and then until
+ * anything it might have asked the CM for has arrived, to make sure that it
+ * stays that way */
+static void
+run_until (Test *test,
+    TpChannelContactSearchState state,
+    guint n_results)
+{
+  gulong id;
+
+  test->wanted_state = state;
+  test->wanted_results = n_results;
+
+  id = g_signal_connect (test->search, "notify::state",
+      G_CALLBACK (state_cb), test);
+
+  if (tp_contact_search_get_n_results (test->search) != n_results ||
+      get_state (test) != state)
+    g_main_loop_run (test->mainloop);
+
+  g_signal_handler_disconnect (test->search, id);
+
+  tp_tests_proxy_run_until_dbus_queue_processed (test->connection);
+  g_assert_cmpuint (get_state (test), ==, state);
+  g_assert_cmpuint (tp_contact_search_get_n_results (test->search), ==,
+      n_results);
+}
+
+static void
+start_search (Test *test,
+    const gchar *name)
+{
+  GHashTable *criteria = g_hash_table_new (g_str_hash, g_str_equal);
+
+  g_hash_table_insert (criteria, "fn", (gchar *) name);
+  tp_contact_search_start (test->search, criteria);
+  g_hash_table_unref (criteria);
+}
+
+static void
+assert_n_results (Test *test,
+    guint offset,
+    guint limit,
+    guint expected)
+{
+  GList *results = tp_contact_search_get_results (test->search, offset,
+      limit);
+
+  g_assert_cmpuint (g_list_length (results), ==, expected);
+  g_list_free (results);
+}
+
+static void
+test_search (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  const gchar * const *keys;
+
+  create_search (test, 0);
+
+  g_assert_cmpstr (tp_contact_search_get_server (test->search), ==, SERVER);
+  g_assert_cmpuint (get_state (test), ==,
+      TP_CHANNEL_CONTACT_SEARCH_STATE_NOT_STARTED);
+  keys = tp_contact_search_get_search_keys (test->search);
+  g_assert (keys != NULL);
+  g_assert (tp_strv_contains (keys, "fn"));
+
+  /* with no limit, everything arrives at once; with no window, nothing is
+   * kept, but the results are still counted */
+  start_search (test, "alice");
+  run_until (test, TP_CHANNEL_CONTACT_SEARCH_STATE_COMPLETED,
+      TP_TESTS_CONTACT_SEARCH_CHAN_N_RESULTS);
+  assert_n_results (test, 0, 0, 0);
+}
+
+static void
+test_window (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  create_search (test, PAGE);
+  tp_contact_search_set_window_size (test->search, 2 * PAGE);
+  g_assert_cmpuint (tp_contact_search_get_limit (test->search), ==, PAGE);
+
+  /* More() is only called until the window is full */
+  start_search (test, "alice");
+  run_until (test, TP_CHANNEL_CONTACT_SEARCH_STATE_MORE_AVAILABLE, 2 * PAGE);
+
+  assert_n_results (test, 0, 0, 2 * PAGE);
+  assert_n_results (test, 3, 4, 4);
+  assert_n_results (test, 8, 0, 2);
+  assert_n_results (test, 2 * PAGE, 0, 0);
+
+  /* releasing some makes room for another page */
+  tp_contact_search_release_results (test->search, 7);
+  assert_n_results (test, 0, 7, 0);
+  assert_n_results (test, 0, 8, 1);
+  run_until (test, TP_CHANNEL_CONTACT_SEARCH_STATE_MORE_AVAILABLE, 3 * PAGE);
+  assert_n_results (test, 0, 0, 3 * PAGE - 7);
+
+  /* releasing the same ones again does nothing */
+  tp_contact_search_release_results (test->search, 7);
+  assert_n_results (test, 0, 0, 3 * PAGE - 7);
+
+  /* releasing everything lets the search run to completion */
+  tp_contact_search_release_results (test->search, 3 * PAGE);
+  run_until (test, TP_CHANNEL_CONTACT_SEARCH_STATE_COMPLETED,
+      TP_TESTS_CONTACT_SEARCH_CHAN_N_RESULTS);
+  assert_n_results (test, 0, 0,
+      TP_TESTS_CONTACT_SEARCH_CHAN_N_RESULTS - 3 * PAGE);
+}
+
+static void
+test_stop (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  create_search (test, PAGE);
+  tp_contact_search_set_window_size (test->search, PAGE);
+
+  start_search (test, "alice");
+  run_until (test, TP_CHANNEL_CONTACT_SEARCH_STATE_MORE_AVAILABLE, PAGE);
+
+  /* the results so far are kept */
+  tp_contact_search_stop (test->search);
+  run_until (test, TP_CHANNEL_CONTACT_SEARCH_STATE_FAILED, PAGE);
+  assert_n_results (test, 0, 0, PAGE);
+
+  /* and no more are asked for */
+  tp_contact_search_release_results (test->search, PAGE);
+  run_until (test, TP_CHANNEL_CONTACT_SEARCH_STATE_FAILED, PAGE);
+}
+
+typedef struct {
+    Test *test;
+    GError *error;
+    gboolean done;
+} RestartResult;
+
+static void
+restart_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  RestartResult *r = user_data;
+
+  g_assert (!r->done);
+  tp_contact_search_restart_finish (TP_CONTACT_SEARCH (source), result,
+      &r->error);
+  r->done = TRUE;
+
+  r->test->wait--;
+  if (r->test->wait <= 0)
+    g_main_loop_quit (r->test->mainloop);
+}
+
+static void
+test_restart (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  RestartResult first = { test, NULL, FALSE };
+  RestartResult second = { test, NULL, FALSE };
+  GHashTable *criteria1, *criteria2;
+  GList *results, *l;
+
+  create_search (test, PAGE);
+  tp_contact_search_set_window_size (test->search, 2 * PAGE);
+
+  start_search (test, "alice");
+  run_until (test, TP_CHANNEL_CONTACT_SEARCH_STATE_MORE_AVAILABLE, 2 * PAGE);
+
+  /* refine the search twice in quick succession, as if the user was
+   * typing: the first restart is cancelled by the second */
+  criteria1 = g_hash_table_new (g_str_hash, g_str_equal);
+  g_hash_table_insert (criteria1, "fn", "bo");
+  tp_contact_search_restart_async (test->search, criteria1, restart_cb,
+      &first);
+  criteria2 = g_hash_table_new (g_str_hash, g_str_equal);
+  g_hash_table_insert (criteria2, "fn", "bob");
+  tp_contact_search_restart_async (test->search, criteria2, restart_cb,
+      &second);
+  g_hash_table_unref (criteria1);
+  g_hash_table_unref (criteria2);
+
+  /* the earlier results were discarded */
+  g_assert_cmpuint (tp_contact_search_get_n_results (test->search), ==, 0);
+
+  test->wait = 2;
+  g_main_loop_run (test->mainloop);
+
+  g_assert (first.done);
+  g_assert_error (first.error, G_IO_ERROR, G_IO_ERROR_CANCELLED);
+  g_clear_error (&first.error);
+  g_assert (second.done);
+  g_assert_no_error (second.error);
+
+  /* the window and limit are kept, and only the last search's results
+   * arrive */
+  run_until (test, TP_CHANNEL_CONTACT_SEARCH_STATE_MORE_AVAILABLE, 2 * PAGE);
+
+  results = tp_contact_search_get_results (test->search, 0, 0);
+  g_assert_cmpuint (g_list_length (results), ==, 2 * PAGE);
+
+  for (l = results; l != NULL; l = l->next)
+    g_assert (g_str_has_prefix (
+          tp_contact_search_result_get_identifier (l->data), "bob-"));
+
+  g_list_free (results);
+}
+
+int
+main (int argc,
+      char **argv)
+{
+  tp_tests_init (&argc, &argv);
+  g_test_bug_base ("http://bugs.freedesktop.org/show_bug.cgi?id=");
+
+  g_test_add ("/contact-search/search", Test, NULL, setup,
+      test_search, teardown);
+  g_test_add ("/contact-search/window", Test, NULL, setup,
+      test_window, teardown);
+  g_test_add ("/contact-search/stop", Test, NULL, setup,
+      test_stop, teardown);
+  g_test_add ("/contact-search/restart", Test, NULL, setup,
+      test_restart, teardown);
+
+  return tp_tests_run_with_bus ();
+}
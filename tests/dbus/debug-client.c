@@ -28,6 +28,8 @@ typedef struct {
 
     GPtrArray *messages;
     TpDebugMessage *message;
+    /* signalled TpDebugMessage */
+    GPtrArray *received;
     GError *error /* initialized where needed */;
     gint wait;
 } Test;
@@ -64,6 +66,7 @@ teardown (Test *test,
 
   tp_clear_pointer (&test->messages, g_ptr_array_unref);
   tp_clear_object (&test->message);
+  tp_clear_pointer (&test->received, g_ptr_array_unref);
 }
 
 static void
@@ -294,6 +297,405 @@ test_new_debug_message (Test *test,
       "new message");
 }
 
+static void
+subscribe_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  Test *test = user_data;
+
+  tp_debug_client_subscribe_finish (TP_DEBUG_CLIENT (source), result,
+      &test->error);
+
+  test->wait--;
+  if (test->wait <= 0)
+    g_main_loop_quit (test->mainloop);
+}
+
+static void
+unsubscribe_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  Test *test = user_data;
+
+  tp_debug_client_unsubscribe_finish (TP_DEBUG_CLIENT (source), result,
+      &test->error);
+
+  test->wait--;
+  if (test->wait <= 0)
+    g_main_loop_quit (test->mainloop);
+}
+
+static void
+collect_debug_message_cb (TpDebugClient *client,
+    TpDebugMessage *message,
+    Test *test)
+{
+  g_ptr_array_add (test->received, g_object_ref (message));
+
+  test->wait--;
+  if (test->wait <= 0)
+    g_main_loop_quit (test->mainloop);
+}
+
+static void
+test_subscribe (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  const gchar * const domains[] = { "domain", NULL };
+  TpDebugMessage *msg;
+
+  test->received = g_ptr_array_new_with_free_func (g_object_unref);
+  g_signal_connect (test->client, "new-debug-message",
+      G_CALLBACK (collect_debug_message_cb), test);
+
+  tp_debug_client_subscribe_async (test->client, domains,
+      G_LOG_LEVEL_WARNING, 50, subscribe_cb, test);
+
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+
+  tp_debug_sender_add_message (test->sender, NULL, "domain",
+      G_LOG_LEVEL_WARNING, "wanted");
+  tp_debug_sender_add_message (test->sender, NULL, "domain",
+      G_LOG_LEVEL_DEBUG, "too verbose");
+  tp_debug_sender_add_message (test->sender, NULL, "other",
+      G_LOG_LEVEL_WARNING, "wrong domain");
+  tp_debug_sender_add_message (test->sender, NULL, "domainfoo",
+      G_LOG_LEVEL_CRITICAL, "not a category");
+  tp_debug_sender_add_message (test->sender, NULL, "domain/category",
+      G_LOG_LEVEL_CRITICAL, "also wanted");
+
+  /* both arrive in one batch */
+  test->wait = 2;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+  g_assert_cmpuint (test->received->len, ==, 2);
+
+  msg = g_ptr_array_index (test->received, 0);
+  g_assert_cmpstr (tp_debug_message_get_domain (msg), ==, "domain");
+  g_assert_cmpuint (tp_debug_message_get_level (msg), ==,
+      G_LOG_LEVEL_WARNING);
+  g_assert_cmpstr (tp_debug_message_get_message (msg), ==, "wanted");
+
+  msg = g_ptr_array_index (test->received, 1);
+  g_assert_cmpstr (tp_debug_message_get_domain (msg), ==, "domain");
+  g_assert_cmpstr (tp_debug_message_get_category (msg), ==, "category");
+  g_assert_cmpstr (tp_debug_message_get_message (msg), ==, "also wanted");
+
+  /* anything still waiting is sent before Unsubscribe returns */
+  tp_debug_sender_add_message (test->sender, NULL, "domain",
+      G_LOG_LEVEL_ERROR, "last one");
+  tp_debug_client_unsubscribe_async (test->client, unsubscribe_cb, test);
+
+  test->wait = 2;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+  g_assert_cmpuint (test->received->len, ==, 3);
+
+  msg = g_ptr_array_index (test->received, 2);
+  g_assert_cmpstr (tp_debug_message_get_message (msg), ==, "last one");
+
+  /* and nothing after that */
+  tp_debug_sender_add_message (test->sender, NULL, "domain",
+      G_LOG_LEVEL_ERROR, "too late");
+  tp_debug_client_get_messages_async (test->client, get_messages_cb, test);
+
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+  g_assert_cmpuint (test->received->len, ==, 3);
+}
+
+/* Returns: (transfer full): the statistics for Debug.@method, or NULL */
+static GVariant *
+find_method_statistics (GVariant *snapshot,
+    const gchar *method,
+    gboolean outgoing)
+{
+  gsize i;
+
+  for (i = 0; i < g_variant_n_children (snapshot); i++)
+    {
+      GVariant *stats = g_variant_get_child_value (snapshot, i);
+      const gchar *s_iface, *s_method;
+      gboolean s_outgoing;
+
+      g_variant_get_child (stats, 0, "&s", &s_iface);
+      g_variant_get_child (stats, 1, "&s", &s_method);
+      g_variant_get_child (stats, 2, "b", &s_outgoing);
+
+      if (!tp_strdiff (s_iface, TP_IFACE_DEBUG) &&
+          !tp_strdiff (s_method, method) &&
+          s_outgoing == outgoing)
+        return stats;
+
+      g_variant_unref (stats);
+    }
+
+  return NULL;
+}
+
+static void
+assert_method_statistics (GVariant *stats,
+    guint expected_calls,
+    gboolean expect_bytes)
+{
+  guint calls, errors, in_flight;
+  guint64 bytes, total_latency, max_latency;
+  GVariant *histogram;
+  guint32 sum = 0;
+  gsize i;
+
+  g_assert (stats != NULL);
+  g_variant_get (stats, "(&s&sbuuuttt@au)", NULL, NULL, NULL, &calls,
+      &errors, &in_flight, &bytes, &total_latency, &max_latency, &histogram);
+
+  g_assert_cmpuint (calls, ==, expected_calls);
+  g_assert_cmpuint (errors, ==, 0);
+  g_assert_cmpuint (in_flight, ==, 0);
+  g_assert_cmpuint (max_latency, <=, total_latency);
+
+  if (expect_bytes)
+    g_assert_cmpuint (bytes, >, 0);
+  else
+    g_assert_cmpuint (bytes, ==, 0);
+
+  for (i = 0; i < g_variant_n_children (histogram); i++)
+    {
+      guint32 n;
+
+      g_variant_get_child (histogram, i, "u", &n);
+      sum += n;
+    }
+
+  g_assert_cmpuint (sum, ==, calls);
+
+  g_variant_unref (histogram);
+  g_variant_unref (stats);
+}
+
+static void
+test_method_statistics (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  GVariant *snapshot;
+  gboolean enabled;
+
+  /* nothing is collected until it's enabled */
+  tp_debug_client_get_messages_async (test->client, get_messages_cb, test);
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+
+  snapshot = tp_method_statistics_dup_snapshot ();
+  g_assert (find_method_statistics (snapshot, "GetMessages", TRUE) == NULL);
+  g_assert (find_method_statistics (snapshot, "GetMessages", FALSE) == NULL);
+  g_variant_unref (snapshot);
+
+  /* the D-Bus property and the C API are the same thing */
+  g_object_set (test->sender, "method-statistics-enabled", TRUE, NULL);
+  g_assert (tp_method_statistics_get_enabled ());
+
+  tp_debug_client_get_messages_async (test->client, get_messages_cb, test);
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+
+  tp_debug_client_get_messages_async (test->client, get_messages_cb, test);
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+
+  /* we called our own TpDebugSender, so both ends were counted */
+  snapshot = tp_method_statistics_dup_snapshot ();
+  assert_method_statistics (
+      find_method_statistics (snapshot, "GetMessages", TRUE), 2, FALSE);
+  assert_method_statistics (
+      find_method_statistics (snapshot, "GetMessages", FALSE), 2, TRUE);
+  g_variant_unref (snapshot);
+
+  tp_method_statistics_set_enabled (FALSE);
+  g_object_get (test->sender, "method-statistics-enabled", &enabled, NULL);
+  g_assert (!enabled);
+
+  tp_method_statistics_reset ();
+
+  snapshot = tp_method_statistics_dup_snapshot ();
+  assert_method_statistics (
+      find_method_statistics (snapshot, "GetMessages", TRUE), 0, FALSE);
+  g_variant_unref (snapshot);
+}
+
+static void
+get_allocation_statistics (const gchar *type,
+    guint *live,
+    guint *peak,
+    guint64 *total)
+{
+  GVariant *snapshot = tp_allocation_statistics_dup_snapshot ();
+  gsize i;
+
+  *live = 0;
+  *peak = 0;
+  *total = 0;
+
+  for (i = 0; i < g_variant_n_children (snapshot); i++)
+    {
+      const gchar *s_type;
+      guint s_live, s_peak;
+      guint64 s_total;
+
+      g_variant_get_child (snapshot, i, "(&suut)", &s_type, &s_live,
+          &s_peak, &s_total);
+
+      if (!tp_strdiff (s_type, type))
+        {
+          *live = s_live;
+          *peak = s_peak;
+          *total = s_total;
+        }
+    }
+
+  g_variant_unref (snapshot);
+}
+
+static void
+test_allocation_statistics (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  TpMessage *a, *b;
+  GValue *v;
+  guint live, peak, baseline;
+  guint64 total;
+  gboolean enabled;
+
+  /* nothing is counted until it's enabled */
+  a = tp_client_message_new_text (TP_CHANNEL_TEXT_MESSAGE_TYPE_NORMAL, "1");
+  get_allocation_statistics ("TpClientMessage", &live, &peak, &total);
+  g_assert_cmpuint (live, ==, 0);
+  g_assert_cmpuint (total, ==, 0);
+
+  /* the D-Bus property and the C API are the same thing */
+  g_object_set (test->sender, "allocation-statistics-enabled", TRUE, NULL);
+  g_assert (tp_allocation_statistics_get_enabled ());
+
+  /* an instance created before counting started isn't counted when it's
+   * freed, either */
+  g_object_unref (a);
+
+  tp_allocation_statistics_reset ();
+  get_allocation_statistics ("TpClientMessage", &baseline, &peak, &total);
+  g_assert_cmpuint (peak, ==, baseline);
+  g_assert_cmpuint (total, ==, 0);
+
+  a = tp_client_message_new_text (TP_CHANNEL_TEXT_MESSAGE_TYPE_NORMAL, "1");
+  b = tp_client_message_new_text (TP_CHANNEL_TEXT_MESSAGE_TYPE_NORMAL, "2");
+  g_object_unref (a);
+
+  get_allocation_statistics ("TpClientMessage", &live, &peak, &total);
+  g_assert_cmpuint (live, ==, baseline + 1);
+  g_assert_cmpuint (peak, ==, baseline + 2);
+  g_assert_cmpuint (total, ==, 2);
+
+  /* the counts are kept when counting stops */
+  tp_allocation_statistics_set_enabled (FALSE);
+  g_object_get (test->sender, "allocation-statistics-enabled", &enabled,
+      NULL);
+  g_assert (!enabled);
+
+  /* an instance that was counted is still counted when it's freed */
+  g_object_unref (b);
+
+  get_allocation_statistics ("TpClientMessage", &live, &peak, &total);
+  g_assert_cmpuint (live, ==, baseline);
+  g_assert_cmpuint (peak, ==, baseline + 2);
+  g_assert_cmpuint (total, ==, 2);
+
+  tp_allocation_statistics_reset ();
+  get_allocation_statistics ("TpClientMessage", &live, &peak, &total);
+  g_assert_cmpuint (peak, ==, baseline);
+  g_assert_cmpuint (total, ==, 0);
+
+  /* GValues can't remember whether they were counted, so only their total
+   * is counted; freeing one that wasn't counted doesn't disturb anything */
+  v = tp_g_value_slice_new_uint (1);
+  tp_allocation_statistics_set_enabled (TRUE);
+  tp_allocation_statistics_reset ();
+  tp_g_value_slice_free (v);
+  tp_g_value_slice_free (tp_g_value_slice_new_uint (2));
+  v = tp_g_value_slice_new_uint (3);
+
+  get_allocation_statistics ("GValue", &live, &peak, &total);
+  g_assert_cmpuint (live, ==, 0);
+  g_assert_cmpuint (peak, ==, 0);
+  g_assert_cmpuint (total, ==, 2);
+
+  tp_g_value_slice_free (v);
+  tp_allocation_statistics_set_enabled (FALSE);
+}
+
+static void
+slow_get_messages_cb (TpDebugClient *client,
+    const GPtrArray *messages,
+    const GError *error,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  Test *test = user_data;
+
+  g_assert_no_error (error);
+
+  /* well over the threshold */
+  g_usleep (200 * G_USEC_PER_SEC / 1000);
+
+  test->wait--;
+  if (test->wait <= 0)
+    g_main_loop_quit (test->mainloop);
+}
+
+static void
+test_stall_detector (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  TpDebugMessage *stall = NULL;
+  guint i;
+
+  tp_debug_sender_set_stall_threshold (test->sender, 100);
+
+  tp_cli_debug_call_get_messages (test->client, -1, slow_get_messages_cb,
+      test, NULL, NULL);
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+
+  /* the stall is reported when the main loop next polls, before this call
+   * is handled */
+  tp_debug_client_get_messages_async (test->client, get_messages_cb, test);
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+
+  tp_debug_sender_set_stall_threshold (test->sender, 0);
+
+  for (i = 0; i < test->messages->len; i++)
+    {
+      TpDebugMessage *msg = g_ptr_array_index (test->messages, i);
+
+      /* on a busy machine, other iterations might be slow too */
+      if (!tp_strdiff (tp_debug_message_get_domain (msg), "tp-glib") &&
+          !tp_strdiff (tp_debug_message_get_category (msg), "stall") &&
+          strstr (tp_debug_message_get_message (msg),
+            "reply callback for " TP_IFACE_DEBUG ".GetMessages") != NULL)
+        stall = msg;
+    }
+
+  g_assert (stall != NULL);
+  g_assert_cmpuint (tp_debug_message_get_level (stall), ==,
+      G_LOG_LEVEL_WARNING);
+}
+
 static void
 test_get_messages_failed (Test *test,
     gconstpointer data G_GNUC_UNUSED)
@@ -329,6 +731,14 @@ main (int argc,
       test_get_messages, teardown);
   g_test_add ("/debug-client/new-debug-message", Test, NULL, setup,
       test_new_debug_message, teardown);
+  g_test_add ("/debug-client/subscribe", Test, NULL, setup,
+      test_subscribe, teardown);
+  g_test_add ("/debug-client/method-statistics", Test, NULL, setup,
+      test_method_statistics, teardown);
+  g_test_add ("/debug-client/allocation-statistics", Test, NULL, setup,
+      test_allocation_statistics, teardown);
+  g_test_add ("/debug-client/stall-detector", Test, NULL, setup,
+      test_stall_detector, teardown);
   g_test_add ("/debug-client/get-messages-failed", Test, NULL, setup,
       test_get_messages_failed, teardown);
 
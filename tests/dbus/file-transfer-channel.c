@@ -11,12 +11,14 @@
 #include "config.h"
 
 #include <glib.h>
+#include <glib/gstdio.h>
 #include <string.h>
 
 #include <telepathy-glib/file-transfer-channel.h>
 #include <telepathy-glib/debug.h>
 #include <telepathy-glib/defs.h>
 #include <telepathy-glib/dbus.h>
+#include <telepathy-glib/svc-channel.h>
 
 #include "tests/lib/util.h"
 #include "tests/lib/debug.h"
@@ -57,8 +59,26 @@ typedef struct {
 
     GError *error /* initialized where needed */;
     gint wait;
+
+    /* for the throughput tests */
+    gchar *tmpdir;
+    GFile *file;
+    guint64 size;
+    guint64 received;
+    guchar *buffer;
+
+    /* for the progress test */
+    guint n_notified;
+    guint64 notified_bytes;
 } Test;
 
+/* The throughput tests move THROUGHPUT_SIZE bytes normally, to check that
+ * the data arrives intact, or THROUGHPUT_PERF_SIZE bytes with -m perf, to
+ * measure how fast it happens. Byte n of the file is always n % 256. */
+#define THROUGHPUT_CHUNK (1024 * 1024)
+#define THROUGHPUT_SIZE (4 * THROUGHPUT_CHUNK)
+#define THROUGHPUT_PERF_SIZE (256 * THROUGHPUT_CHUNK)
+
 
 /* Callbacks */
 
@@ -104,6 +124,21 @@ file_provide_cb (GObject *source,
     g_main_loop_quit (test->mainloop);
 }
 
+static void
+file_resume_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  Test *test = user_data;
+
+  tp_file_transfer_channel_resume_file_finish (
+      TP_FILE_TRANSFER_CHANNEL (source), result, &test->error);
+
+  test->wait--;
+  if (test->wait <= 0)
+    g_main_loop_quit (test->mainloop);
+}
+
 static void
 file_accept_cb (GObject *source,
     GAsyncResult *result,
@@ -258,6 +293,20 @@ teardown (Test *test,
   tp_clear_object (&test->chan_service);
   tp_clear_object (&test->cm_stream);
 
+  if (test->file != NULL)
+    {
+      g_file_delete (test->file, NULL, NULL);
+      g_clear_object (&test->file);
+    }
+
+  if (test->tmpdir != NULL)
+    {
+      g_rmdir (test->tmpdir);
+      tp_clear_pointer (&test->tmpdir, g_free);
+    }
+
+  tp_clear_pointer (&test->buffer, g_free);
+
   tp_tests_connection_assert_disconnect_succeeds (test->connection);
   g_object_unref (test->connection);
   g_object_unref (test->base_connection);
@@ -323,6 +372,22 @@ socket_connected (GObject *source,
     g_main_loop_quit (test->mainloop);
 }
 
+static void
+incoming_connection_cb (TpTestsFileTransferChannel *chan,
+    GSocketConnection *connection,
+    Test *test)
+{
+  g_assert (test->cm_stream == NULL);
+  test->cm_stream = g_object_ref (connection);
+
+  /* the clock starts when the client is ready to transfer */
+  g_test_timer_start ();
+
+  test->wait--;
+  if (test->wait <= 0)
+    g_main_loop_quit (test->mainloop);
+}
+
 static void
 run_file_transfer_test (const char *test_path,
     TestFunc ftest)
@@ -580,6 +645,462 @@ test_accept_outgoing (Test *test, gconstpointer data G_GNUC_UNUSED)
   g_assert_error (test->error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT);
 }
 
+static GBytes *
+throughput_chunk_new (void)
+{
+  guchar *chunk = g_malloc (THROUGHPUT_CHUNK);
+  guint i;
+
+  for (i = 0; i < THROUGHPUT_CHUNK; i++)
+    chunk[i] = i % 256;
+
+  return g_bytes_new_take (chunk, THROUGHPUT_CHUNK);
+}
+
+static void
+throughput_setup (Test *test,
+    gboolean requested)
+{
+  GFile *dir;
+
+  test->size = g_test_perf () ? THROUGHPUT_PERF_SIZE : THROUGHPUT_SIZE;
+  test->received = 0;
+
+  test->tmpdir = g_dir_make_tmp ("tp-glib-tests.XXXXXX", &test->error);
+  g_assert_no_error (test->error);
+  dir = g_file_new_for_path (test->tmpdir);
+  test->file = g_file_get_child (dir, "log-bundle");
+  g_object_unref (dir);
+
+  create_file_transfer_channel (test, requested, TP_SOCKET_ADDRESS_TYPE_UNIX,
+      TP_SOCKET_ACCESS_CONTROL_LOCALHOST);
+
+  g_signal_connect (test->chan_service, "incoming-connection",
+      G_CALLBACK (incoming_connection_cb), test);
+}
+
+static void
+throughput_report (Test *test,
+    const gchar *direction)
+{
+  gdouble elapsed = g_test_timer_elapsed ();
+  gdouble mib_per_sec = test->size / (elapsed * THROUGHPUT_CHUNK);
+
+  g_test_maximized_result (mib_per_sec, "%s %" G_GUINT64_FORMAT
+      " MiB in %.3fs: %.1f MiB/s", direction, test->size / THROUGHPUT_CHUNK,
+      elapsed, mib_per_sec);
+}
+
+static void
+cm_splice_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  Test *test = user_data;
+  gssize spliced;
+
+  spliced = g_output_stream_splice_finish (G_OUTPUT_STREAM (source), result,
+      &test->error);
+  g_assert_no_error (test->error);
+  g_assert_cmpint (spliced, ==, test->size);
+
+  /* the client sees the end of the file when the CM closes its end */
+  g_io_stream_close (test->cm_stream, NULL, &test->error);
+  g_assert_no_error (test->error);
+
+  test->wait--;
+  if (test->wait <= 0)
+    g_main_loop_quit (test->mainloop);
+}
+
+static gboolean
+poll_file_size_cb (gpointer user_data)
+{
+  Test *test = user_data;
+  GFileInfo *info;
+
+  info = g_file_query_info (test->file, G_FILE_ATTRIBUTE_STANDARD_SIZE,
+      G_FILE_QUERY_INFO_NONE, NULL, NULL);
+
+  if (info != NULL &&
+      (guint64) g_file_info_get_size (info) == test->size)
+    {
+      g_object_unref (info);
+
+      test->wait--;
+      if (test->wait <= 0)
+        g_main_loop_quit (test->mainloop);
+
+      return FALSE;
+    }
+
+  g_clear_object (&info);
+  return TRUE;
+}
+
+/* The CM sends the client a file */
+static void
+test_throughput_accept (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  GBytes *chunk = throughput_chunk_new ();
+  GInputStream *source = g_memory_input_stream_new ();
+  GMappedFile *mapped;
+  const guchar *contents;
+  gchar *path;
+  guint64 i;
+
+  throughput_setup (test, FALSE);
+
+  for (i = 0; i < test->size; i += THROUGHPUT_CHUNK)
+    g_memory_input_stream_add_bytes (G_MEMORY_INPUT_STREAM (source), chunk);
+
+  tp_file_transfer_channel_accept_file_async (test->channel,
+      test->file, 0, file_accept_cb, test);
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+
+  /* wait for the client to connect when the transfer is opened */
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+  g_assert (test->cm_stream != NULL);
+
+  g_output_stream_splice_async (g_io_stream_get_output_stream (test->cm_stream),
+      source, G_OUTPUT_STREAM_SPLICE_CLOSE_SOURCE, G_PRIORITY_DEFAULT, NULL,
+      cm_splice_cb, test);
+
+  g_timeout_add (10, poll_file_size_cb, test);
+  test->wait = 2;
+  g_main_loop_run (test->mainloop);
+  throughput_report (test, "received");
+
+  path = g_file_get_path (test->file);
+  mapped = g_mapped_file_new (path, FALSE, &test->error);
+  g_assert_no_error (test->error);
+  g_free (path);
+  g_assert_cmpuint (g_mapped_file_get_length (mapped), ==, test->size);
+  contents = (const guchar *) g_mapped_file_get_contents (mapped);
+
+  for (i = 0; i < test->size; i += THROUGHPUT_CHUNK)
+    g_assert (memcmp (contents + i, g_bytes_get_data (chunk, NULL),
+          THROUGHPUT_CHUNK) == 0);
+
+  g_mapped_file_unref (mapped);
+  g_object_unref (source);
+  g_bytes_unref (chunk);
+}
+
+static void
+cm_read_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  Test *test = user_data;
+  gssize n;
+
+  n = g_input_stream_read_finish (G_INPUT_STREAM (source), result,
+      &test->error);
+  g_assert_no_error (test->error);
+
+  if (n == 0)
+    {
+      g_main_loop_quit (test->mainloop);
+      return;
+    }
+
+  if (!g_test_perf ())
+    {
+      gssize j;
+
+      for (j = 0; j < n; j++)
+        g_assert_cmpuint (test->buffer[j], ==, (test->received + j) % 256);
+    }
+
+  test->received += n;
+
+  g_input_stream_read_async (G_INPUT_STREAM (source), test->buffer,
+      THROUGHPUT_CHUNK, G_PRIORITY_DEFAULT, NULL, cm_read_cb, test);
+}
+
+/* The client sends the CM a file */
+static void
+test_throughput_provide (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  GBytes *chunk = throughput_chunk_new ();
+  GFileOutputStream *out;
+  guint64 i;
+
+  throughput_setup (test, TRUE);
+
+  out = g_file_create (test->file, G_FILE_CREATE_NONE, NULL, &test->error);
+  g_assert_no_error (test->error);
+
+  for (i = 0; i < test->size; i += THROUGHPUT_CHUNK)
+    {
+      g_output_stream_write_all (G_OUTPUT_STREAM (out),
+          g_bytes_get_data (chunk, NULL), THROUGHPUT_CHUNK, NULL, NULL,
+          &test->error);
+      g_assert_no_error (test->error);
+    }
+
+  g_output_stream_close (G_OUTPUT_STREAM (out), NULL, &test->error);
+  g_assert_no_error (test->error);
+  g_object_unref (out);
+
+  tp_file_transfer_channel_provide_file_async (test->channel,
+      test->file, file_provide_cb, test);
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+
+  /* wait for the client to connect when the transfer is opened */
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+  g_assert (test->cm_stream != NULL);
+
+  test->buffer = g_malloc (THROUGHPUT_CHUNK);
+  g_input_stream_read_async (g_io_stream_get_input_stream (test->cm_stream),
+      test->buffer, THROUGHPUT_CHUNK, G_PRIORITY_DEFAULT, NULL, cm_read_cb,
+      test);
+  g_main_loop_run (test->mainloop);
+
+  throughput_report (test, "sent");
+  g_assert_cmpuint (test->received, ==, test->size);
+
+  g_bytes_unref (chunk);
+}
+
+static void
+transferred_bytes_notify_cb (GObject *source,
+    GParamSpec *pspec,
+    Test *test)
+{
+  test->n_notified++;
+  test->notified_bytes = tp_file_transfer_channel_get_transferred_bytes (
+      test->channel);
+}
+
+static void
+emit_transferred_bytes (Test *test,
+    guint64 count)
+{
+  tp_svc_channel_type_file_transfer_emit_transferred_bytes_changed (
+      test->chan_service, count);
+  tp_tests_proxy_run_until_dbus_queue_processed (test->channel);
+  g_assert_cmpuint (tp_file_transfer_channel_get_transferred_bytes (
+        test->channel), ==, count);
+}
+
+static void
+test_progress (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  guint interval;
+  guint64 step;
+
+  create_file_transfer_channel (test, FALSE, TP_SOCKET_ADDRESS_TYPE_UNIX,
+      TP_SOCKET_ACCESS_CONTROL_LOCALHOST);
+
+  g_signal_connect (test->channel, "notify::transferred-bytes",
+      G_CALLBACK (transferred_bytes_notify_cb), test);
+
+  /* by default, every change is notified */
+  emit_transferred_bytes (test, 50);
+  emit_transferred_bytes (test, 60);
+  g_assert_cmpuint (test->n_notified, ==, 2);
+  g_assert_cmpuint (test->notified_bytes, ==, 60);
+
+  /* only notify every 1000 bytes */
+  tp_file_transfer_channel_set_progress_coalescing (test->channel, 0, 1000);
+  g_object_get (test->channel,
+      "progress-interval", &interval,
+      "progress-step", &step,
+      NULL);
+  g_assert_cmpuint (interval, ==, 0);
+  g_assert_cmpuint (step, ==, 1000);
+
+  emit_transferred_bytes (test, 100);
+  emit_transferred_bytes (test, 500);
+  g_assert_cmpuint (test->n_notified, ==, 2);
+  emit_transferred_bytes (test, 1200);
+  g_assert_cmpuint (test->n_notified, ==, 3);
+  g_assert_cmpuint (test->notified_bytes, ==, 1200);
+  emit_transferred_bytes (test, 1300);
+  emit_transferred_bytes (test, 2300);
+  g_assert_cmpuint (test->n_notified, ==, 4);
+  g_assert_cmpuint (test->notified_bytes, ==, 2300);
+
+  /* smaller steps are held back until the state changes */
+  emit_transferred_bytes (test, 2400);
+  g_assert_cmpuint (test->n_notified, ==, 4);
+  tp_svc_channel_type_file_transfer_emit_file_transfer_state_changed (
+      test->chan_service, TP_FILE_TRANSFER_STATE_OPEN,
+      TP_FILE_TRANSFER_STATE_CHANGE_REASON_NONE);
+  tp_tests_proxy_run_until_dbus_queue_processed (test->channel);
+  g_assert_cmpuint (test->n_notified, ==, 5);
+  g_assert_cmpuint (test->notified_bytes, ==, 2400);
+
+  /* ... or the transfer finishes */
+  emit_transferred_bytes (test, 9001);
+  g_assert_cmpuint (test->n_notified, ==, 6);
+  g_assert_cmpuint (test->notified_bytes, ==, 9001);
+
+  /* at most one notification every 500ms; going backwards is notified
+   * straight away, and the last change is always notified eventually */
+  g_object_set (test->channel,
+      "progress-interval", 500,
+      "progress-step", (guint64) 0,
+      NULL);
+  emit_transferred_bytes (test, 3000);
+  g_assert_cmpuint (test->n_notified, ==, 7);
+  emit_transferred_bytes (test, 3100);
+  emit_transferred_bytes (test, 3200);
+  g_assert_cmpuint (test->n_notified, ==, 7);
+  g_assert_cmpuint (test->notified_bytes, ==, 3000);
+
+  while (test->notified_bytes != 3200)
+    g_main_context_iteration (NULL, TRUE);
+
+  g_assert_cmpuint (test->n_notified, ==, 8);
+}
+
+/* Resume an incoming transfer into a file which already has the first
+ * RESUME_OFFSET bytes */
+#define RESUME_OFFSET 1000
+
+static void
+test_accept_resume (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  GFileOutputStream *out;
+  guchar *contents;
+  gsize len;
+  guint64 i;
+
+  throughput_setup (test, FALSE);
+  test->size = tp_file_transfer_channel_get_size (test->channel);
+
+  test->buffer = g_malloc (test->size);
+
+  for (i = 0; i < test->size; i++)
+    test->buffer[i] = i % 256;
+
+  out = g_file_create (test->file, G_FILE_CREATE_NONE, NULL, &test->error);
+  g_assert_no_error (test->error);
+  g_output_stream_write_all (G_OUTPUT_STREAM (out), test->buffer,
+      RESUME_OFFSET, NULL, NULL, &test->error);
+  g_assert_no_error (test->error);
+  g_output_stream_close (G_OUTPUT_STREAM (out), NULL, &test->error);
+  g_assert_no_error (test->error);
+  g_object_unref (out);
+
+  tp_file_transfer_channel_resume_file_async (test->channel, test->file,
+      file_resume_cb, test);
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+
+  g_assert_cmpuint (tp_file_transfer_channel_get_state (test->channel, NULL),
+      ==, TP_FILE_TRANSFER_STATE_ACCEPTED);
+
+  /* wait for the client to connect when the transfer is opened */
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+  g_assert (test->cm_stream != NULL);
+
+  g_object_get (test->channel,
+      "initial-offset", &i,
+      NULL);
+  g_assert_cmpuint (i, ==, RESUME_OFFSET);
+
+  /* the CM only sends the rest of the file */
+  g_output_stream_write_all (g_io_stream_get_output_stream (test->cm_stream),
+      test->buffer + RESUME_OFFSET, test->size - RESUME_OFFSET, NULL, NULL,
+      &test->error);
+  g_assert_no_error (test->error);
+  g_io_stream_close (test->cm_stream, NULL, &test->error);
+  g_assert_no_error (test->error);
+
+  g_timeout_add (10, poll_file_size_cb, test);
+  test->wait = 1;
+  g_main_loop_run (test->mainloop);
+
+  g_file_load_contents (test->file, NULL, (gchar **) &contents, &len, NULL,
+      &test->error);
+  g_assert_no_error (test->error);
+  g_assert_cmpuint (len, ==, test->size);
+  g_assert (memcmp (contents, test->buffer, len) == 0);
+  g_free (contents);
+}
+
+static void
+invalidated_cb (TpProxy *proxy,
+    guint domain,
+    gint code,
+    gchar *message,
+    Test *test)
+{
+  test->wait--;
+  if (test->wait <= 0)
+    g_main_loop_quit (test->mainloop);
+}
+
+/* The CM wants to resume beyond the end of what we have */
+static void
+test_accept_resume_beyond_eof (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  GFileOutputStream *out;
+  GFileInfo *info;
+  guint64 i;
+
+  throughput_setup (test, FALSE);
+  test->size = tp_file_transfer_channel_get_size (test->channel);
+  g_assert_cmpuint (test->size, >, 2 * RESUME_OFFSET);
+
+  test->buffer = g_malloc (RESUME_OFFSET);
+
+  for (i = 0; i < RESUME_OFFSET; i++)
+    test->buffer[i] = i % 256;
+
+  out = g_file_create (test->file, G_FILE_CREATE_NONE, NULL, &test->error);
+  g_assert_no_error (test->error);
+  g_output_stream_write_all (G_OUTPUT_STREAM (out), test->buffer,
+      RESUME_OFFSET, NULL, NULL, &test->error);
+  g_assert_no_error (test->error);
+  g_output_stream_close (G_OUTPUT_STREAM (out), NULL, &test->error);
+  g_assert_no_error (test->error);
+  g_object_unref (out);
+
+  g_object_set (test->chan_service,
+      "forced-initial-offset", (guint64) 2 * RESUME_OFFSET,
+      NULL);
+
+  g_signal_connect (test->channel, "invalidated",
+      G_CALLBACK (invalidated_cb), test);
+
+  /* the operation fails, and the channel is closed */
+  tp_file_transfer_channel_resume_file_async (test->channel, test->file,
+      file_resume_cb, test);
+  test->wait = 2;
+  g_main_loop_run (test->mainloop);
+  g_assert_error (test->error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT);
+  g_clear_error (&test->error);
+  g_assert (tp_proxy_get_invalidated (test->channel) != NULL);
+
+  /* the file was left alone */
+  info = g_file_query_info (test->file, G_FILE_ATTRIBUTE_STANDARD_SIZE,
+      G_FILE_QUERY_INFO_NONE, NULL, &test->error);
+  g_assert_no_error (test->error);
+  g_assert_cmpuint (g_file_info_get_size (info), ==, RESUME_OFFSET);
+  g_object_unref (info);
+}
+
 int
 main (int argc,
       char **argv)
@@ -612,6 +1133,17 @@ main (int argc,
       test_accept_outgoing, teardown);
   g_test_add ("/file-transfer-channel/provide/cancel", Test, NULL, setup,
       test_cancel_transfer, teardown);
+  g_test_add ("/file-transfer-channel/accept/resume", Test, NULL, setup,
+      test_accept_resume, teardown);
+  g_test_add ("/file-transfer-channel/accept/resume-beyond-eof", Test, NULL,
+      setup, test_accept_resume_beyond_eof, teardown);
+  g_test_add ("/file-transfer-channel/progress", Test, NULL, setup,
+      test_progress, teardown);
+
+  g_test_add ("/file-transfer-channel/throughput/accept", Test, NULL, setup,
+      test_throughput_accept, teardown);
+  g_test_add ("/file-transfer-channel/throughput/provide", Test, NULL, setup,
+      test_throughput_provide, teardown);
 
   return tp_tests_run_with_bus ();
 }
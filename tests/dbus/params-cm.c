@@ -54,9 +54,10 @@ typedef struct
 
 static void
 setup (Test *test,
-       gconstpointer data G_GNUC_UNUSED)
+       gconstpointer data)
 {
   TpBaseConnectionManager *service_cm_as_base;
+  guint n_shards = GPOINTER_TO_UINT (data);
   gboolean ok;
 
   tp_debug_set_flags ("all");
@@ -72,6 +73,14 @@ setup (Test *test,
   service_cm_as_base = TP_BASE_CONNECTION_MANAGER (test->service_cm);
   g_assert (service_cm_as_base != NULL);
 
+  ok = tp_base_connection_manager_set_n_shards (service_cm_as_base, n_shards,
+      &test->error);
+  g_assert_no_error (test->error);
+  g_assert (ok);
+  g_assert_cmpuint (
+      tp_base_connection_manager_get_n_shards (service_cm_as_base), ==,
+      n_shards);
+
   ok = tp_base_connection_manager_register (service_cm_as_base);
   g_assert (ok);
 
@@ -339,6 +348,128 @@ test_get_parameters_bad_proto (Test *test,
   g_clear_error (&test->error);
 }
 
+static void
+test_n_shards (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  TpBaseConnectionManager *service_cm_as_base =
+    TP_BASE_CONNECTION_MANAGER (test->service_cm);
+  guint n_shards;
+  gboolean ok;
+
+  ok = tp_base_connection_manager_set_n_shards (service_cm_as_base, 4,
+      &test->error);
+  g_assert_no_error (test->error);
+  g_assert (ok);
+
+  g_object_get (test->service_cm,
+      "n-shards", &n_shards,
+      NULL);
+  g_assert_cmpuint (n_shards, ==, 4);
+
+  /* the failed requests must not leave the shards thinking they're busy */
+  test_missing_required (test, NULL);
+  test_wrong_type (test, NULL);
+
+  ok = tp_base_connection_manager_set_n_shards (service_cm_as_base, 0,
+      &test->error);
+  g_assert_no_error (test->error);
+  g_assert (ok);
+  g_assert_cmpuint (
+      tp_base_connection_manager_get_n_shards (service_cm_as_base), ==, 0);
+
+  /* back to the old behaviour */
+  test_defaults (test, NULL);
+}
+
+typedef struct {
+    Test *test;
+    guint n_pending;
+    guint n_not_implemented;
+    guint n_invalid;
+} ConcurrentRequests;
+
+static void
+concurrent_request_cb (TpConnectionManager *cm,
+    const gchar *bus_name,
+    const gchar *object_path,
+    const GError *error,
+    gpointer user_data,
+    GObject *weak_object G_GNUC_UNUSED)
+{
+  ConcurrentRequests *requests = user_data;
+
+  /* the test CM never actually makes a connection */
+  g_assert (error != NULL);
+  g_assert (error->domain == TP_ERROR);
+
+  if (error->code == TP_ERROR_NOT_IMPLEMENTED)
+    requests->n_not_implemented++;
+  else if (error->code == TP_ERROR_INVALID_ARGUMENT)
+    requests->n_invalid++;
+  else
+    g_error ("unexpected error: %s", error->message);
+
+  if (--requests->n_pending == 0)
+    g_main_loop_quit (requests->test->mainloop);
+}
+
+static void
+test_concurrent (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  ConcurrentRequests requests = { test, 0, 0, 0 };
+  GHashTable *good;
+  GHashTable *bad;
+  TpTestsCMParams *params;
+  guint i;
+
+  good = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
+      (GDestroyNotify) tp_g_value_slice_free);
+  g_hash_table_insert (good, "a-boolean",
+      tp_g_value_slice_new_boolean (FALSE));
+  g_hash_table_insert (good, "a-string",
+      tp_g_value_slice_new_static_string ("a string"));
+
+  bad = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
+      (GDestroyNotify) tp_g_value_slice_free);
+  g_hash_table_insert (bad, "a-boolean",
+      tp_g_value_slice_new_string ("FALSE"));
+
+  /* don't wait for any replies, so that several shards are asked to make
+   * connections at the same time */
+  for (i = 0; i < 20; i++)
+    {
+      tp_cli_connection_manager_call_request_connection (test->cm, -1,
+          "example", (i % 4 == 3 ? bad : good), concurrent_request_cb,
+          &requests, NULL, NULL);
+      requests.n_pending++;
+    }
+
+  g_main_loop_run (test->mainloop);
+
+  g_assert_cmpuint (requests.n_not_implemented, ==, 15);
+  g_assert_cmpuint (requests.n_invalid, ==, 5);
+
+  /* the invalid parameters are rejected before they reach a shard, so the
+   * last connection attempt was with the good ones */
+  params = tp_tests_param_connection_manager_steal_params_last_conn ();
+  g_assert (params != NULL);
+  g_assert (params->would_have_been_freed);
+  g_assert_cmpstr (params->a_string, ==, "a string");
+  tp_tests_param_connection_manager_free_params (params);
+
+  /* the failed requests must not leave the shards thinking they're busy */
+  g_assert_cmpuint (tp_base_connection_manager_get_n_shards (
+        TP_BASE_CONNECTION_MANAGER (test->service_cm)), ==, 4);
+  tp_base_connection_manager_set_n_shards (
+      TP_BASE_CONNECTION_MANAGER (test->service_cm), 0, &test->error);
+  g_assert_no_error (test->error);
+
+  g_hash_table_unref (good);
+  g_hash_table_unref (bad);
+}
+
 int
 main (int argc,
       char **argv)
@@ -361,5 +492,18 @@ main (int argc,
   g_test_add ("/params-cm/get-parameters-bad-proto", Test, NULL, setup,
       test_get_parameters_bad_proto, teardown);
 
+  g_test_add ("/params-cm/sharded/set-params", Test, GUINT_TO_POINTER (2),
+      setup, test_set_params, teardown);
+  g_test_add ("/params-cm/sharded/defaults", Test, GUINT_TO_POINTER (2),
+      setup, test_defaults, teardown);
+  g_test_add ("/params-cm/sharded/missing-required", Test,
+      GUINT_TO_POINTER (2), setup, test_missing_required, teardown);
+  g_test_add ("/params-cm/sharded/wrong-type", Test, GUINT_TO_POINTER (2),
+      setup, test_wrong_type, teardown);
+  g_test_add ("/params-cm/sharded/n-shards", Test, NULL, setup,
+      test_n_shards, teardown);
+  g_test_add ("/params-cm/sharded/concurrent", Test, GUINT_TO_POINTER (4),
+      setup, test_concurrent, teardown);
+
   return tp_tests_run_with_bus ();
 }
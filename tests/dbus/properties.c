@@ -8,6 +8,7 @@
 #include <telepathy-glib/dbus.h>
 #include <telepathy-glib/dbus-properties-mixin.h>
 #include <telepathy-glib/debug.h>
+#include <telepathy-glib/errors.h>
 #include <telepathy-glib/proxy.h>
 #include <telepathy-glib/svc-generic.h>
 #include <telepathy-glib/util.h>
@@ -16,6 +17,45 @@
 #include "tests/lib/util.h"
 
 #define WITH_PROPERTIES_IFACE "com.example.WithProperties"
+#define UNSORTED_IFACE "com.example.Unsorted"
+
+/* A GInterface whose properties are declared by hand, not in the sorted
+ * order used by glib-ginterface-gen.py */
+typedef struct _TestSvcUnsorted TestSvcUnsorted;
+typedef struct _TestSvcUnsortedClass TestSvcUnsortedClass;
+
+struct _TestSvcUnsortedClass {
+    GTypeInterface parent;
+};
+
+GType test_svc_unsorted_get_type (void);
+
+#define TEST_TYPE_SVC_UNSORTED \
+  (test_svc_unsorted_get_type ())
+
+static void
+test_svc_unsorted_default_init (TestSvcUnsortedClass *iface)
+{
+  static TpDBusPropertiesMixinPropInfo properties[] = {
+      { 0, TP_DBUS_PROPERTIES_MIXIN_FLAG_READ, "u", 0 }, /* Zebra */
+      { 0, TP_DBUS_PROPERTIES_MIXIN_FLAG_READ, "u", 0 }, /* Aardvark */
+      { 0, TP_DBUS_PROPERTIES_MIXIN_FLAG_WRITE, "u", 0 }, /* Mongoose */
+      { 0 }
+  };
+  static TpDBusPropertiesMixinIfaceInfo interface = { 0, properties };
+
+  interface.dbus_interface = g_quark_from_static_string (UNSORTED_IFACE);
+  properties[0].name = g_quark_from_static_string ("Zebra");
+  properties[0].type = G_TYPE_UINT;
+  properties[1].name = g_quark_from_static_string ("Aardvark");
+  properties[1].type = G_TYPE_UINT;
+  properties[2].name = g_quark_from_static_string ("Mongoose");
+  properties[2].type = G_TYPE_UINT;
+  tp_svc_interface_set_dbus_properties_info (TEST_TYPE_SVC_UNSORTED,
+      &interface);
+}
+
+G_DEFINE_INTERFACE (TestSvcUnsorted, test_svc_unsorted, G_TYPE_OBJECT)
 
 typedef struct _TestProperties {
     GObject parent;
@@ -47,6 +87,7 @@ G_DEFINE_TYPE_WITH_CODE (TestProperties,
     test_properties,
     G_TYPE_OBJECT,
     G_IMPLEMENT_INTERFACE (TEST_TYPE_SVC_WITH_PROPERTIES, NULL);
+    G_IMPLEMENT_INTERFACE (TEST_TYPE_SVC_UNSORTED, NULL);
     G_IMPLEMENT_INTERFACE (TP_TYPE_SVC_DBUS_PROPERTIES,
       tp_dbus_properties_mixin_iface_init));
 
@@ -62,6 +103,20 @@ prop_getter (GObject *object,
              GValue *value,
              gpointer user_data)
 {
+  if (!tp_strdiff (user_data, "zebra"))
+    {
+      g_assert_cmpstr (g_quark_to_string (name), ==, "Zebra");
+      g_value_set_uint (value, 26);
+      return;
+    }
+
+  if (!tp_strdiff (user_data, "aardvark"))
+    {
+      g_assert_cmpstr (g_quark_to_string (name), ==, "Aardvark");
+      g_value_set_uint (value, 1);
+      return;
+    }
+
   if (tp_strdiff (user_data, "read"))
     g_assert_cmpstr (user_data, ==, "full-access");
 
@@ -94,9 +149,16 @@ test_properties_class_init (TestPropertiesClass *cls)
         { "WriteOnly", "black-hole", "BLACK HOLE" },
         { NULL }
   };
+  static TpDBusPropertiesMixinPropImpl unsorted_props[] = {
+        { "Aardvark", "aardvark", NULL },
+        { "Mongoose", NULL, "mongoose" },
+        { "Zebra", "zebra", NULL },
+        { NULL }
+  };
   static TpDBusPropertiesMixinIfaceImpl interfaces[] = {
       { WITH_PROPERTIES_IFACE, prop_getter, prop_setter,
         with_properties_props },
+      { UNSORTED_IFACE, prop_getter, NULL, unsorted_props },
       { NULL }
   };
 
@@ -216,6 +278,52 @@ test_emit_changed (Context *ctx)
   tp_proxy_signal_connection_disconnect (signal_conn);
 }
 
+static void
+test_unsorted (Context *ctx)
+{
+  GObject *obj = G_OBJECT (ctx->obj);
+  GValue value = { 0, };
+  GHashTable *hash;
+  GError *error = NULL;
+
+  g_assert (tp_dbus_properties_mixin_get (obj, UNSORTED_IFACE, "Zebra",
+        &value, &error));
+  g_assert_no_error (error);
+  g_assert_cmpuint (g_value_get_uint (&value), ==, 26);
+  g_value_unset (&value);
+
+  g_assert (tp_dbus_properties_mixin_get (obj, UNSORTED_IFACE, "Aardvark",
+        &value, &error));
+  g_assert_no_error (error);
+  g_assert_cmpuint (g_value_get_uint (&value), ==, 1);
+  g_value_unset (&value);
+
+  g_assert (!tp_dbus_properties_mixin_get (obj, UNSORTED_IFACE, "Mongoose",
+        &value, &error));
+  g_assert_error (error, TP_ERROR, TP_ERROR_PERMISSION_DENIED);
+  g_assert (!G_IS_VALUE (&value));
+  g_clear_error (&error);
+
+  g_assert (!tp_dbus_properties_mixin_get (obj, UNSORTED_IFACE, "Badger",
+        &value, &error));
+  g_assert_error (error, TP_ERROR, TP_ERROR_NOT_IMPLEMENTED);
+  g_clear_error (&error);
+
+  /* "ReadOnly" exists, but not on this interface */
+  g_assert (!tp_dbus_properties_mixin_get (obj, UNSORTED_IFACE, "ReadOnly",
+        &value, &error));
+  g_assert_error (error, TP_ERROR, TP_ERROR_NOT_IMPLEMENTED);
+  g_clear_error (&error);
+
+  hash = tp_dbus_properties_mixin_dup_all (obj, UNSORTED_IFACE);
+  g_assert_cmpuint (g_hash_table_size (hash), ==, 2);
+  g_assert_cmpuint (g_value_get_uint (g_hash_table_lookup (hash, "Zebra")),
+      ==, 26);
+  g_assert_cmpuint (g_value_get_uint (g_hash_table_lookup (hash,
+          "Aardvark")), ==, 1);
+  g_hash_table_unref (hash);
+}
+
 int
 main (int argc, char **argv)
 {
@@ -242,6 +350,8 @@ main (int argc, char **argv)
   g_test_add_data_func ("/properties/get-all", ctx.proxy, (GTestDataFunc) test_get_all);
 
   g_test_add_data_func ("/properties/changed", &ctx, (GTestDataFunc) test_emit_changed);
+  g_test_add_data_func ("/properties/unsorted", &ctx,
+      (GTestDataFunc) test_unsorted);
 
   tp_tests_run_with_bus ();
 
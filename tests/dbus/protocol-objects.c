@@ -723,6 +723,64 @@ test_id (Test *test,
   g_assert_cmpstr (s, ==, NULL);
   g_clear_object (&result);
   g_clear_error (&test->error);
+
+  tp_protocol_identify_account_async (test->protocol,
+      g_variant_new_parsed ("{ 'account': <42> }"),
+      NULL, tp_tests_result_ready_cb, &result);
+  tp_tests_run_until_result (&result);
+  s = tp_protocol_identify_account_finish (test->protocol, result,
+      &test->error);
+  g_assert_error (test->error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT);
+  g_assert_cmpstr (s, ==, NULL);
+  g_clear_object (&result);
+  g_clear_error (&test->error);
+}
+
+static void
+test_id_many (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  guint i;
+
+  tp_tests_proxy_run_until_prepared (test->cm, NULL);
+  test->protocol = g_object_ref (
+      tp_connection_manager_get_protocol_object (test->cm, "example"));
+
+  /* the protocol only works out how to check its parameters once, but
+   * every set of parameters must still be checked properly */
+  for (i = 0; i < 100; i++)
+    {
+      GAsyncResult *result = NULL;
+      gchar *account = g_strdup_printf ("User%u", i);
+      gchar *expected = g_strdup_printf ("user%u", i);
+      gchar *s;
+
+      tp_protocol_identify_account_async (test->protocol,
+          g_variant_new_parsed ("{ 'account': <%s> }", account),
+          NULL, tp_tests_result_ready_cb, &result);
+      tp_tests_run_until_result (&result);
+      s = tp_protocol_identify_account_finish (test->protocol, result,
+          &test->error);
+      g_assert_no_error (test->error);
+      g_assert_cmpstr (s, ==, expected);
+      g_clear_object (&result);
+      g_free (s);
+
+      tp_protocol_identify_account_async (test->protocol,
+          g_variant_new_parsed ("{ 'account': <%s>, %s: <true> }", account,
+            expected),
+          NULL, tp_tests_result_ready_cb, &result);
+      tp_tests_run_until_result (&result);
+      s = tp_protocol_identify_account_finish (test->protocol, result,
+          &test->error);
+      g_assert_error (test->error, TP_ERROR, TP_ERROR_INVALID_ARGUMENT);
+      g_assert_cmpstr (s, ==, NULL);
+      g_clear_object (&result);
+      g_clear_error (&test->error);
+
+      g_free (account);
+      g_free (expected);
+    }
 }
 
 int
@@ -752,6 +810,8 @@ main (int argc,
       test_normalize, teardown);
   g_test_add ("/protocol-objects/id", Test, NULL, setup,
       test_id, teardown);
+  g_test_add ("/protocol-objects/id-many", Test, NULL, setup,
+      test_id_many, teardown);
 
   return tp_tests_run_with_bus ();
 }
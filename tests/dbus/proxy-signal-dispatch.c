@@ -0,0 +1,189 @@
+/* Feature test for sharing one signal collector between signal connections
+ *
+ * Copyright (C) 2026 Collabora Ltd. <http://www.collabora.co.uk/>
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.
+ */
+
+#include "config.h"
+
+#include <telepathy-glib/connection.h>
+#include <telepathy-glib/dbus.h>
+#include <telepathy-glib/debug.h>
+#include <telepathy-glib/svc-connection.h>
+#include <telepathy-glib/util.h>
+
+#include "tests/lib/simple-conn.h"
+#include "tests/lib/util.h"
+
+#define N_CONNECTIONS 50
+#define N_DISCONNECTED 10
+
+typedef struct {
+  TpDBusDaemon *dbus;
+  TpTestsSimpleConnection *service_conn;
+  TpBaseConnection *service_conn_as_base;
+  TpConnection *conn;
+  TpProxySignalConnection *signals[N_CONNECTIONS];
+  guint calls[N_CONNECTIONS];
+  guint destroyed;
+  /* the details passed to the first callback, which are shared by all
+   * the other callbacks for the same signal */
+  GHashTable *details;
+} Test;
+
+typedef struct {
+  Test *test;
+  guint i;
+} Subscriber;
+
+static void
+setup (Test *test,
+    gconstpointer nil G_GNUC_UNUSED)
+{
+  tp_debug_set_flags ("all");
+
+  test->dbus = tp_tests_dbus_daemon_dup_or_die ();
+
+  tp_tests_create_and_connect_conn (TP_TESTS_TYPE_SIMPLE_CONNECTION,
+      "me@example.com", &test->service_conn_as_base, &test->conn);
+  test->service_conn = TP_TESTS_SIMPLE_CONNECTION (test->service_conn_as_base);
+
+  memset (test->calls, 0, sizeof (test->calls));
+  test->destroyed = 0;
+  test->details = NULL;
+}
+
+static void
+teardown (Test *test,
+    gconstpointer nil G_GNUC_UNUSED)
+{
+  tp_tests_connection_assert_disconnect_succeeds (test->conn);
+  g_object_unref (test->conn);
+  g_object_unref (test->service_conn_as_base);
+  g_object_unref (test->dbus);
+}
+
+static void
+subscriber_destroy (gpointer p)
+{
+  Subscriber *subscriber = p;
+
+  subscriber->test->destroyed++;
+  g_slice_free (Subscriber, subscriber);
+}
+
+static void
+on_connection_error (TpConnection *conn,
+    const gchar *error,
+    GHashTable *details,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  Subscriber *subscriber = user_data;
+
+  g_assert_cmpstr (error, ==, "com.example.Wobbly");
+  g_assert_cmpuint (g_hash_table_size (details), ==, 1);
+  g_assert_cmpstr (tp_asv_get_string (details, "debug-message"), ==,
+      "wobbling");
+
+  /* the signal's arguments are collected once, not copied for each
+   * signal connection */
+  if (subscriber->test->details == NULL)
+    subscriber->test->details = details;
+  else
+    g_assert (details == subscriber->test->details);
+
+  subscriber->test->calls[subscriber->i]++;
+}
+
+static void
+test_subscribe (Test *test,
+    guint i)
+{
+  Subscriber *subscriber = g_slice_new0 (Subscriber);
+
+  subscriber->test = test;
+  subscriber->i = i;
+
+  test->signals[i] = tp_cli_connection_connect_to_connection_error (
+      test->conn, on_connection_error, subscriber, subscriber_destroy,
+      NULL, NULL);
+  g_assert (test->signals[i] != NULL);
+}
+
+static void
+test_fan_out (Test *test,
+    gconstpointer nil G_GNUC_UNUSED)
+{
+  GHashTable *details = tp_asv_new (
+      "debug-message", G_TYPE_STRING, "wobbling",
+      NULL);
+  guint64 received_before, matched_before, delivered_before;
+  guint64 received, matched, delivered;
+  guint i;
+
+  for (i = 0; i < N_CONNECTIONS; i++)
+    test_subscribe (test, i);
+
+  for (i = 0; i < N_DISCONNECTED; i++)
+    tp_proxy_signal_connection_disconnect (test->signals[i]);
+
+  g_assert_cmpuint (test->destroyed, ==, N_DISCONNECTED);
+
+  tp_proxy_signal_connection_get_dispatch_stats (&received_before,
+      &matched_before, &delivered_before);
+
+  tp_svc_connection_emit_connection_error (test->service_conn,
+      "com.example.Wobbly", details);
+  tp_tests_proxy_run_until_dbus_queue_processed (test->conn);
+
+  for (i = 0; i < N_CONNECTIONS; i++)
+    g_assert_cmpuint (test->calls[i], ==, (i < N_DISCONNECTED ? 0 : 1));
+
+  tp_proxy_signal_connection_get_dispatch_stats (&received, &matched,
+      &delivered);
+
+  /* The signal was only collected once, although TpConnection itself might
+   * have seen some other signals in the meantime; it matched our remaining
+   * signal connections, plus TpConnection's own */
+  g_assert_cmpuint (received - received_before, >=, 1);
+  g_assert_cmpuint (received - received_before, <,
+      N_CONNECTIONS - N_DISCONNECTED);
+  g_assert_cmpuint (matched - matched_before, >=,
+      N_CONNECTIONS - N_DISCONNECTED);
+  g_assert_cmpuint (delivered - delivered_before, ==,
+      matched - matched_before);
+
+  for (i = N_DISCONNECTED; i < N_CONNECTIONS; i++)
+    tp_proxy_signal_connection_disconnect (test->signals[i]);
+
+  g_assert_cmpuint (test->destroyed, ==, N_CONNECTIONS);
+
+  /* now that everyone has gone, a new connection still works */
+  test->details = NULL;
+  test_subscribe (test, 0);
+  tp_svc_connection_emit_connection_error (test->service_conn,
+      "com.example.Wobbly", details);
+  tp_tests_proxy_run_until_dbus_queue_processed (test->conn);
+  g_assert_cmpuint (test->calls[0], ==, 1);
+
+  tp_proxy_signal_connection_disconnect (test->signals[0]);
+  g_assert_cmpuint (test->destroyed, ==, N_CONNECTIONS + 1);
+
+  g_hash_table_unref (details);
+}
+
+int
+main (int argc,
+      char **argv)
+{
+  tp_tests_init (&argc, &argv);
+
+  g_test_add ("/proxy-signal-dispatch/fan-out", Test, NULL, setup,
+      test_fan_out, teardown);
+
+  return tp_tests_run_with_bus ();
+}
@@ -14,6 +14,7 @@
 #include <telepathy-glib/telepathy-glib.h>
 
 #include "tests/lib/contacts-conn.h"
+#include "tests/lib/room-list-chan.h"
 #include "tests/lib/util.h"
 #include "tests/lib/simple-channel-dispatcher.h"
 
@@ -35,6 +36,12 @@ typedef struct {
     GPtrArray *rooms; /* reffed TpRoomInfo */
     GError *error /* initialized where needed */;
     gint wait;
+
+    /* for streaming tests */
+    guint n_rooms;
+    guint max_pending_seen;
+    gboolean pop;
+    guint n_dropped_notified;
 } Test;
 
 #define ACCOUNT_PATH TP_ACCOUNT_OBJECT_PATH_BASE "what/ev/er"
@@ -298,6 +305,267 @@ test_invalidated (Test *test,
   g_signal_handler_disconnect (test->room_list, id);
 }
 
+static void
+listing_changed_cb (GObject *object,
+    GParamSpec *spec,
+    Test *test)
+{
+  if (tp_room_list_is_listing (test->room_list))
+    return;
+
+  g_main_loop_quit (test->mainloop);
+}
+
+static void
+unexpected_got_room_cb (TpRoomList *room_list,
+    TpRoomInfo *room,
+    Test *test)
+{
+  g_assert_not_reached ();
+}
+
+static void
+rooms_available_cb (TpRoomList *room_list,
+    Test *test)
+{
+  TpRoomInfo *room;
+
+  test->max_pending_seen = MAX (test->max_pending_seen,
+      tp_room_list_get_n_pending_rooms (room_list));
+
+  if (!test->pop)
+    return;
+
+  while ((room = tp_room_list_pop_room (room_list)) != NULL)
+    {
+      gchar *expected = g_strdup_printf ("room %u", test->n_rooms);
+
+      g_assert_cmpstr (tp_room_info_get_name (room), ==, expected);
+      g_free (expected);
+      g_object_unref (room);
+      test->n_rooms++;
+    }
+}
+
+static void
+test_streaming (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  gint64 start;
+
+  create_room_list (test, "ManyRooms");
+  g_assert_no_error (test->error);
+
+  tp_room_list_set_max_pending_rooms (test->room_list, 1000);
+  test->pop = TRUE;
+
+  g_signal_connect (test->room_list, "got-room",
+      G_CALLBACK (unexpected_got_room_cb), test);
+  g_signal_connect (test->room_list, "rooms-available",
+      G_CALLBACK (rooms_available_cb), test);
+  g_signal_connect (test->room_list, "notify::listing",
+      G_CALLBACK (listing_changed_cb), test);
+
+  start = g_get_monotonic_time ();
+  tp_room_list_start (test->room_list);
+  g_main_loop_run (test->mainloop);
+
+  g_test_message ("Pulled %u rooms in %" G_GINT64_FORMAT " us", test->n_rooms,
+      g_get_monotonic_time () - start);
+
+  /* everything arrived, and no more than a batch was ever waiting */
+  g_assert_cmpuint (test->n_rooms, ==, TP_TESTS_ROOM_LIST_CHAN_MANY_ROOMS);
+  g_assert_cmpuint (test->max_pending_seen, <=, 100);
+  g_assert_cmpuint (tp_room_list_get_n_pending_rooms (test->room_list), ==,
+      0);
+  g_assert_cmpuint (tp_room_list_get_n_dropped_rooms (test->room_list), ==,
+      0);
+}
+
+static void
+test_streaming_small_queue (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  create_room_list (test, "ManyRooms");
+  g_assert_no_error (test->error);
+
+  /* smaller than the batches the CM sends */
+  tp_room_list_set_max_pending_rooms (test->room_list, 30);
+  test->pop = TRUE;
+
+  g_signal_connect (test->room_list, "got-room",
+      G_CALLBACK (unexpected_got_room_cb), test);
+  g_signal_connect (test->room_list, "rooms-available",
+      G_CALLBACK (rooms_available_cb), test);
+  g_signal_connect (test->room_list, "notify::listing",
+      G_CALLBACK (listing_changed_cb), test);
+
+  tp_room_list_start (test->room_list);
+  g_main_loop_run (test->mainloop);
+
+  /* rooms-available was emitted each time the queue filled up, and we
+   * emptied it each time, so the listing was never stopped */
+  g_assert_cmpuint (test->n_rooms, ==, TP_TESTS_ROOM_LIST_CHAN_MANY_ROOMS);
+  g_assert_cmpuint (test->max_pending_seen, ==, 30);
+  g_assert_cmpuint (tp_room_list_get_n_dropped_rooms (test->room_list), ==,
+      0);
+}
+
+static void
+test_streaming_scaled (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  guint sizes[] = { TP_TESTS_ROOM_LIST_CHAN_MANY_ROOMS, 100000, 500000 };
+  guint n_sizes = g_test_perf () ? G_N_ELEMENTS (sizes) : 1;
+  guint i;
+
+  for (i = 0; i < n_sizes; i++)
+    {
+      gchar *server = g_strdup_printf ("ManyRooms:%u", sizes[i]);
+      gint64 start, elapsed;
+
+      create_room_list (test, server);
+      g_assert_no_error (test->error);
+      g_free (server);
+
+      tp_room_list_set_max_pending_rooms (test->room_list, 1000);
+      test->pop = TRUE;
+      test->n_rooms = 0;
+      test->max_pending_seen = 0;
+
+      g_signal_connect (test->room_list, "rooms-available",
+          G_CALLBACK (rooms_available_cb), test);
+      g_signal_connect (test->room_list, "notify::listing",
+          G_CALLBACK (listing_changed_cb), test);
+
+      start = g_get_monotonic_time ();
+      tp_room_list_start (test->room_list);
+      g_main_loop_run (test->mainloop);
+      elapsed = g_get_monotonic_time () - start;
+
+      g_test_message ("Pulled %u rooms in %" G_GINT64_FORMAT " us "
+          "(%" G_GINT64_FORMAT " ns/room); at most %u were queued",
+          test->n_rooms, elapsed, elapsed * 1000 / test->n_rooms,
+          test->max_pending_seen);
+
+      /* however many rooms there are, no more than a batch of them is
+       * held at once */
+      g_assert_cmpuint (test->n_rooms, ==, sizes[i]);
+      g_assert_cmpuint (test->max_pending_seen, <=, 100);
+      g_assert_cmpuint (tp_room_list_get_n_dropped_rooms (test->room_list),
+          ==, 0);
+    }
+
+  if (n_sizes < G_N_ELEMENTS (sizes))
+    g_test_message ("Run with -m perf to measure up to %u rooms",
+        sizes[G_N_ELEMENTS (sizes) - 1]);
+}
+
+static void
+n_dropped_rooms_cb (TpRoomList *room_list,
+    GParamSpec *pspec,
+    Test *test)
+{
+  test->n_dropped_notified++;
+}
+
+static void
+test_streaming_overflow (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  TpRoomInfo *room;
+  guint n_dropped;
+
+  create_room_list (test, "ManyRooms");
+  g_assert_no_error (test->error);
+
+  /* not a whole number of batches, so the batch that fills the queue
+   * doesn't fit in it */
+  g_object_set (test->room_list,
+      "max-pending-rooms", 450,
+      NULL);
+  test->pop = FALSE;
+
+  g_signal_connect (test->room_list, "rooms-available",
+      G_CALLBACK (rooms_available_cb), test);
+  g_signal_connect (test->room_list, "notify::listing",
+      G_CALLBACK (listing_changed_cb), test);
+  g_signal_connect (test->room_list, "notify::n-dropped-rooms",
+      G_CALLBACK (n_dropped_rooms_cb), test);
+
+  /* nobody pops the rooms, so the listing is stopped once the queue is
+   * full */
+  tp_room_list_start (test->room_list);
+  g_main_loop_run (test->mainloop);
+
+  g_assert_cmpuint (test->max_pending_seen, ==, 450);
+  g_assert_cmpuint (tp_room_list_get_n_pending_rooms (test->room_list), ==,
+      450);
+
+  /* the rest of that batch was lost, and so were any batches that were
+   * already on their way when we asked the CM to stop, but no more */
+  g_object_get (test->room_list,
+      "n-dropped-rooms", &n_dropped,
+      NULL);
+  g_assert_cmpuint (n_dropped, ==,
+      tp_room_list_get_n_dropped_rooms (test->room_list));
+  g_assert_cmpuint (n_dropped, >=, 50);
+  g_assert_cmpuint (n_dropped % 100, ==, 50);
+  g_assert_cmpuint (450 + n_dropped, <, TP_TESTS_ROOM_LIST_CHAN_MANY_ROOMS);
+  /* change notification was emitted once for each batch with losses */
+  g_assert_cmpuint (test->n_dropped_notified, ==, 1 + n_dropped / 100);
+
+  /* the rooms which were queued are the first ones */
+  test->pop = TRUE;
+  rooms_available_cb (test->room_list, test);
+  g_assert_cmpuint (test->n_rooms, ==, 450);
+
+  room = tp_room_list_pop_room (test->room_list);
+  g_assert (room == NULL);
+}
+
+static void
+count_room_cb (TpRoomList *room_list,
+    TpRoomInfo *room,
+    Test *test)
+{
+  g_assert (strstr (tp_room_info_get_name (room), "room 1") != NULL);
+  test->n_rooms++;
+}
+
+static void
+test_name_filter (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  guint expected = 0;
+  guint i;
+
+  for (i = 0; i < TP_TESTS_ROOM_LIST_CHAN_MANY_ROOMS; i++)
+    {
+      gchar *name = g_strdup_printf ("room %u", i);
+
+      if (strstr (name, "room 1") != NULL)
+        expected++;
+
+      g_free (name);
+    }
+
+  create_room_list (test, "ManyRooms");
+  g_assert_no_error (test->error);
+
+  tp_room_list_set_name_filter (test->room_list, "room 1");
+
+  g_signal_connect (test->room_list, "got-room",
+      G_CALLBACK (count_room_cb), test);
+  g_signal_connect (test->room_list, "notify::listing",
+      G_CALLBACK (listing_changed_cb), test);
+
+  tp_room_list_start (test->room_list);
+  g_main_loop_run (test->mainloop);
+
+  g_assert_cmpuint (test->n_rooms, ==, expected);
+}
+
 int
 main (int argc,
       char **argv)
@@ -315,6 +583,16 @@ main (int argc,
       test_list_room_fails, teardown);
   g_test_add ("/room-list-channel/invalidated", Test, NULL, setup,
       test_invalidated, teardown);
+  g_test_add ("/room-list-channel/streaming", Test, NULL, setup,
+      test_streaming, teardown);
+  g_test_add ("/room-list-channel/streaming-overflow", Test, NULL, setup,
+      test_streaming_overflow, teardown);
+  g_test_add ("/room-list-channel/streaming-small-queue", Test, NULL, setup,
+      test_streaming_small_queue, teardown);
+  g_test_add ("/room-list-channel/streaming-scaled", Test, NULL, setup,
+      test_streaming_scaled, teardown);
+  g_test_add ("/room-list-channel/name-filter", Test, NULL, setup,
+      test_name_filter, teardown);
 
   return tp_tests_run_with_bus ();
 }
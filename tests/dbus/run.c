@@ -0,0 +1,315 @@
+/* Tests of tp_run_connection_manager()
+ *
+ * Copyright © 2026 Collabora Ltd. <http://www.collabora.co.uk/>
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.
+ */
+
+#include "config.h"
+
+#include <telepathy-glib/telepathy-glib.h>
+
+#include "tests/lib/simple-manager.h"
+#include "tests/lib/util.h"
+
+/* bounds for the idle timeout, in milliseconds */
+#define MIN_IDLE 1000
+#define MAX_IDLE 5000
+/* how long /run/idle-exit/adaptive waits between one connection going
+ * away and asking for the next, in milliseconds. This must be well under
+ * MIN_IDLE, so that a slow machine still gets the request in before the CM
+ * exits, but more than half of it, so that the adapted wait is longer than
+ * MIN_IDLE */
+#define GAP 600
+
+typedef struct {
+    TpDBusDaemon *dbus;
+    GError *error /* initialized where needed */;
+
+    TpBaseConnectionManager *service_cm;
+    TpConnectionManager *cm;
+    TpConnection *conn;
+
+    guint n_connections;
+    guint n_idle;
+    gint64 started;
+    gint64 idle_since;
+    gint64 gap;
+
+    /* the number of shards construct_cm asks for */
+    guint n_shards;
+    /* the number of shards once the CM was running */
+    guint running_n_shards;
+} Test;
+
+/* tp_run_connection_manager() gives construct_cm no user_data */
+static Test *current_test = NULL;
+
+static void
+new_connection_cb (TpBaseConnectionManager *service_cm,
+    const gchar *bus_name,
+    const gchar *object_path,
+    const gchar *proto,
+    Test *test)
+{
+  if (test->idle_since != 0)
+    test->gap = g_get_monotonic_time () - test->idle_since;
+
+  test->idle_since = 0;
+  test->n_connections++;
+}
+
+static void
+disconnect_cb (TpConnection *conn,
+    const GError *error,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  g_assert_no_error (error);
+}
+
+static void
+request_connection_cb (TpConnectionManager *cm,
+    const gchar *bus_name,
+    const gchar *object_path,
+    const GError *error,
+    gpointer user_data,
+    GObject *weak_object)
+{
+  Test *test = user_data;
+
+  g_assert_no_error (error);
+
+  g_clear_object (&test->conn);
+  test->conn = tp_connection_new (test->dbus, bus_name, object_path,
+      &test->error);
+  g_assert_no_error (test->error);
+
+  tp_cli_connection_call_disconnect (test->conn, -1, disconnect_cb,
+      NULL, NULL, NULL);
+}
+
+static gboolean
+request_connection (gpointer user_data)
+{
+  Test *test = user_data;
+  GHashTable *parameters;
+
+  parameters = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
+      (GDestroyNotify) tp_g_value_slice_free);
+  g_hash_table_insert (parameters, "account",
+      tp_g_value_slice_new_static_string ("me@example.com"));
+
+  tp_cli_connection_manager_call_request_connection (test->cm, -1,
+      "simple", parameters, request_connection_cb, test, NULL, NULL);
+
+  g_hash_table_unref (parameters);
+  return G_SOURCE_REMOVE;
+}
+
+static void
+no_more_connections_cb (TpBaseConnectionManager *service_cm,
+    Test *test)
+{
+  test->idle_since = g_get_monotonic_time ();
+  test->n_idle++;
+
+  /* come back once, a little sooner than the CM would give up on us */
+  if (test->n_idle == 1)
+    g_timeout_add (GAP, request_connection, test);
+}
+
+static TpBaseConnectionManager *
+construct_cm (void)
+{
+  Test *test = current_test;
+
+  /* the previous startup's timings, if any, have been forgotten */
+  g_assert (!tp_run_connection_manager_get_startup_time (NULL, NULL, NULL));
+
+  test->service_cm = tp_tests_object_new_static_class (
+      TP_TESTS_TYPE_SIMPLE_CONNECTION_MANAGER,
+      NULL);
+  g_object_add_weak_pointer ((GObject *) test->service_cm,
+      (gpointer *) &test->service_cm);
+
+  if (test->n_shards > 0)
+    {
+      g_assert (tp_base_connection_manager_set_n_shards (test->service_cm,
+            test->n_shards, &test->error));
+      g_assert_no_error (test->error);
+    }
+
+  g_signal_connect (test->service_cm, "new-connection",
+      G_CALLBACK (new_connection_cb), test);
+  g_signal_connect (test->service_cm, "no-more-connections",
+      G_CALLBACK (no_more_connections_cb), test);
+
+  return test->service_cm;
+}
+
+static void
+setup (Test *test,
+    gconstpointer data)
+{
+  tp_debug_set_flags ("all");
+
+  test->dbus = tp_tests_dbus_daemon_dup_or_die ();
+
+  test->cm = tp_connection_manager_new (test->dbus, "simple", NULL,
+      &test->error);
+  g_assert_no_error (test->error);
+  g_assert (test->cm != NULL);
+
+  current_test = test;
+}
+
+static void
+teardown (Test *test,
+    gconstpointer data)
+{
+  current_test = NULL;
+  g_unsetenv ("TP_CM_SHARDS");
+
+  /* tp_run_connection_manager() unreffed it when it exited */
+  g_assert (test->service_cm == NULL);
+
+  g_clear_object (&test->conn);
+  g_clear_object (&test->cm);
+  g_clear_object (&test->dbus);
+}
+
+static void
+test_startup (Test *test,
+    gconstpointer data)
+{
+  gint64 connect_us = -1, construct_us = -1, register_us = -1;
+  gint64 elapsed;
+  int ret;
+
+  tp_run_connection_manager_set_idle_exit (MIN_IDLE, MAX_IDLE);
+
+  test->started = g_get_monotonic_time ();
+  ret = tp_run_connection_manager ("test-run", VERSION, construct_cm, 0,
+      NULL);
+  elapsed = g_get_monotonic_time () - test->started;
+
+  g_assert_cmpint (ret, ==, 0);
+  g_assert_cmpuint (test->n_connections, ==, 0);
+
+  /* with nothing to do, it waits for MIN_IDLE, not the default 5 seconds */
+  g_assert_cmpint (elapsed / 1000, >=, MIN_IDLE);
+  g_assert_cmpint (elapsed / 1000, <, MAX_IDLE);
+
+  g_assert (tp_run_connection_manager_get_startup_time (&connect_us,
+        &construct_us, &register_us));
+  g_assert_cmpint (connect_us, >=, 0);
+  g_assert_cmpint (construct_us, >=, 0);
+  g_assert_cmpint (register_us, >=, 0);
+  g_assert_cmpint (connect_us + construct_us + register_us, <=, elapsed);
+
+  /* any of them may be omitted */
+  g_assert (tp_run_connection_manager_get_startup_time (NULL, NULL, NULL));
+}
+
+static void
+test_adaptive (Test *test,
+    gconstpointer data)
+{
+  gint64 idle;
+  int ret;
+
+  tp_run_connection_manager_set_idle_exit (MIN_IDLE, MAX_IDLE);
+
+  /* this runs when the CM's main loop starts, after it has registered */
+  g_idle_add (request_connection, test);
+
+  ret = tp_run_connection_manager ("test-run", VERSION, construct_cm, 0,
+      NULL);
+  idle = g_get_monotonic_time () - test->idle_since;
+
+  g_assert_cmpint (ret, ==, 0);
+  g_assert_cmpuint (test->n_connections, ==, 2);
+  g_assert_cmpuint (test->n_idle, ==, 2);
+
+  /* the second connection came back after about GAP, while the CM was
+   * still waiting... */
+  g_assert_cmpint (test->gap / 1000, >=, GAP);
+  g_assert_cmpint (test->gap / 1000, <, MIN_IDLE);
+
+  /* ... so after the second one went away it waited for twice that,
+   * which is longer than MIN_IDLE; allow for the rounding down to whole
+   * milliseconds */
+  g_assert_cmpint (idle / 1000, >=, 2 * (test->gap / 1000) - 1);
+  g_assert_cmpint (idle / 1000, >, MIN_IDLE);
+  g_assert_cmpint (idle / 1000, <, MAX_IDLE);
+}
+
+static gboolean
+record_n_shards (gpointer user_data)
+{
+  Test *test = user_data;
+
+  test->running_n_shards = tp_base_connection_manager_get_n_shards (
+      test->service_cm);
+  return G_SOURCE_REMOVE;
+}
+
+static void
+test_shards_from_env (Test *test,
+    gconstpointer data)
+{
+  int ret;
+
+  tp_run_connection_manager_set_idle_exit (MIN_IDLE, MAX_IDLE);
+
+  /* the CM uses shards, so the environment can say how many */
+  test->n_shards = 1;
+  g_setenv ("TP_CM_SHARDS", "3", TRUE);
+  g_idle_add (record_n_shards, test);
+
+  ret = tp_run_connection_manager ("test-run", VERSION, construct_cm, 0,
+      NULL);
+
+  g_assert_cmpint (ret, ==, 0);
+  g_assert_cmpuint (test->running_n_shards, ==, 3);
+}
+
+static void
+test_shards_from_env_unsharded (Test *test,
+    gconstpointer data)
+{
+  int ret;
+
+  tp_run_connection_manager_set_idle_exit (MIN_IDLE, MAX_IDLE);
+
+  /* the CM doesn't use shards, so it might not be thread-safe: the
+   * environment is ignored */
+  g_setenv ("TP_CM_SHARDS", "3", TRUE);
+  g_idle_add (record_n_shards, test);
+
+  ret = tp_run_connection_manager ("test-run", VERSION, construct_cm, 0,
+      NULL);
+
+  g_assert_cmpint (ret, ==, 0);
+  g_assert_cmpuint (test->running_n_shards, ==, 0);
+}
+
+int
+main (int argc,
+    char **argv)
+{
+  tp_tests_init (&argc, &argv);
+
+  g_test_add ("/run/startup", Test, NULL, setup, test_startup, teardown);
+  g_test_add ("/run/idle-exit/adaptive", Test, NULL, setup, test_adaptive,
+      teardown);
+  g_test_add ("/run/shards-from-env", Test, NULL, setup,
+      test_shards_from_env, teardown);
+  g_test_add ("/run/shards-from-env/unsharded", Test, NULL, setup,
+      test_shards_from_env_unsharded, teardown);
+
+  return tp_tests_run_with_bus ();
+}
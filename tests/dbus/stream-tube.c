@@ -21,6 +21,8 @@
 #include "tests/lib/stream-tube-chan.h"
 
 #ifdef HAVE_GIO_UNIX
+#include <sys/socket.h>
+
 #include <gio/gio.h>
 #include <gio/gunixcredentialsmessage.h>
 #endif
@@ -1096,6 +1098,211 @@ finally:
   return ret;
 }
 
+#ifdef HAVE_GIO_UNIX
+
+/* The relay test sends RELAY_SIZE bytes in each direction, through a relay
+ * which only holds RELAY_BUFFER_SIZE bytes at a time. Byte n is n % 251, so
+ * that it doesn't line up with the buffer. */
+#define RELAY_SIZE (256 * 1024)
+#define RELAY_BUFFER_SIZE 4096
+
+typedef struct {
+    Test *test;
+    GByteArray *data;
+    guchar buffer[BUFFER_SIZE];
+} RelayReader;
+
+static GIOStream *
+socket_connection_new_from_fd (gint fd)
+{
+  GSocket *socket;
+  GSocketConnection *connection;
+  GError *error = NULL;
+
+  socket = g_socket_new_from_fd (fd, &error);
+  g_assert_no_error (error);
+  connection = g_socket_connection_factory_create_connection (socket);
+  g_object_unref (socket);
+
+  return G_IO_STREAM (connection);
+}
+
+static GInputStream *
+relay_source_new (void)
+{
+  guchar *data = g_malloc (RELAY_SIZE);
+  guint i;
+
+  for (i = 0; i < RELAY_SIZE; i++)
+    data[i] = i % 251;
+
+  return g_memory_input_stream_new_from_data (data, RELAY_SIZE, g_free);
+}
+
+static void
+relay_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  Test *test = user_data;
+
+  tp_stream_tube_connection_relay_finish (TP_STREAM_TUBE_CONNECTION (source),
+      result, &test->error);
+  g_assert_no_error (test->error);
+
+  test->wait--;
+  if (test->wait <= 0)
+    g_main_loop_quit (test->mainloop);
+}
+
+static void
+relay_write_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  GSocketConnection *connection = user_data;
+  Test *test = g_object_get_data (G_OBJECT (connection), "test");
+  gssize n;
+
+  n = g_output_stream_splice_finish (G_OUTPUT_STREAM (source), result,
+      &test->error);
+  g_assert_no_error (test->error);
+  g_assert_cmpint (n, ==, RELAY_SIZE);
+
+  /* tell the other end we're done */
+  g_socket_shutdown (g_socket_connection_get_socket (connection), FALSE,
+      TRUE, &test->error);
+  g_assert_no_error (test->error);
+
+  test->wait--;
+  if (test->wait <= 0)
+    g_main_loop_quit (test->mainloop);
+}
+
+static void
+relay_write (Test *test,
+    GIOStream *stream)
+{
+  GInputStream *source = relay_source_new ();
+
+  g_object_set_data (G_OBJECT (stream), "test", test);
+  g_output_stream_splice_async (g_io_stream_get_output_stream (stream),
+      source, G_OUTPUT_STREAM_SPLICE_CLOSE_SOURCE, G_PRIORITY_DEFAULT, NULL,
+      relay_write_cb, stream);
+  g_object_unref (source);
+}
+
+static void
+relay_read_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  RelayReader *reader = user_data;
+  Test *test = reader->test;
+  gssize n;
+
+  n = g_input_stream_read_finish (G_INPUT_STREAM (source), result,
+      &test->error);
+  g_assert_no_error (test->error);
+
+  if (n == 0)
+    {
+      test->wait--;
+      if (test->wait <= 0)
+        g_main_loop_quit (test->mainloop);
+
+      return;
+    }
+
+  g_byte_array_append (reader->data, reader->buffer, n);
+  g_input_stream_read_async (G_INPUT_STREAM (source), reader->buffer,
+      BUFFER_SIZE, G_PRIORITY_DEFAULT, NULL, relay_read_cb, reader);
+}
+
+static void
+relay_read (RelayReader *reader,
+    Test *test,
+    GIOStream *stream)
+{
+  reader->test = test;
+  reader->data = g_byte_array_new ();
+  g_input_stream_read_async (g_io_stream_get_input_stream (stream),
+      reader->buffer, BUFFER_SIZE, G_PRIORITY_DEFAULT, NULL, relay_read_cb,
+      reader);
+}
+
+static void
+assert_relayed (GByteArray *data)
+{
+  guint i;
+
+  g_assert_cmpuint (data->len, ==, RELAY_SIZE);
+
+  for (i = 0; i < RELAY_SIZE; i++)
+    g_assert_cmpuint (data->data[i], ==, i % 251);
+}
+
+/* The tube connection is relayed to a local service, represented by one end
+ * of a socket pair, and both sides send the other some data */
+static void
+test_relay (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  GIOStream *app_stream, *relay_stream;
+  RelayReader cm_reader, app_reader;
+  guint64 received, sent;
+  gint64 mean_latency, max_latency;
+  gint fds[2];
+
+  create_tube_service (test, FALSE, TP_SOCKET_ADDRESS_TYPE_UNIX,
+      TP_SOCKET_ACCESS_CONTROL_LOCALHOST, FALSE);
+
+  g_signal_connect (test->tube_chan_service, "incoming-connection",
+      G_CALLBACK (chan_incoming_connection_cb), test);
+
+  tp_stream_tube_channel_accept_async (test->tube, tube_accept_cb, test);
+
+  test->wait = 2;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+  g_assert (test->tube_conn != NULL);
+  g_assert (G_IS_SOCKET_CONNECTION (test->cm_stream));
+
+  g_assert_cmpint (socketpair (AF_UNIX, SOCK_STREAM, 0, fds), ==, 0);
+  app_stream = socket_connection_new_from_fd (fds[0]);
+  relay_stream = socket_connection_new_from_fd (fds[1]);
+
+  tp_stream_tube_connection_relay_async (test->tube_conn, relay_stream,
+      RELAY_BUFFER_SIZE, NULL, relay_cb, test);
+
+  relay_write (test, test->cm_stream);
+  relay_write (test, app_stream);
+  relay_read (&cm_reader, test, test->cm_stream);
+  relay_read (&app_reader, test, app_stream);
+
+  /* both writes, both reads reaching EOF, and the relay itself */
+  test->wait = 5;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+
+  assert_relayed (app_reader.data);
+  assert_relayed (cm_reader.data);
+
+  tp_stream_tube_connection_get_relay_stats (test->tube_conn, &received,
+      &sent, &mean_latency, &max_latency);
+  g_assert_cmpuint (received, ==, RELAY_SIZE);
+  g_assert_cmpuint (sent, ==, RELAY_SIZE);
+  g_assert_cmpint (mean_latency, >=, 0);
+  g_assert_cmpint (max_latency, >=, mean_latency);
+
+  g_byte_array_unref (cm_reader.data);
+  g_byte_array_unref (app_reader.data);
+  g_object_unref (app_stream);
+  g_object_unref (relay_stream);
+}
+
+#endif /* HAVE_GIO_UNIX */
+
 int
 main (int argc,
       char **argv)
@@ -1129,5 +1336,9 @@ main (int argc,
   g_test_add ("/stream-tube/offer/bad-connection/sig-first", Test, NULL, setup,
       test_offer_bad_connection_sig_first, teardown);
 
+#ifdef HAVE_GIO_UNIX
+  g_test_add ("/stream-tube/relay", Test, NULL, setup, test_relay, teardown);
+#endif
+
   return tp_tests_run_with_bus ();
 }
@@ -306,6 +306,102 @@ test_reject (Test *test,
   g_object_unref (cert);
 }
 
+static void
+test_verification_cache (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  TpTLSCertificate *cert;
+  TpTLSCertificateRejection *rej;
+  gboolean accepted;
+
+  prepare_cert (test, test->cert);
+
+  g_assert (!tp_tls_certificate_lookup_verification (test->cert,
+        "example.com", &accepted));
+
+  /* another proxy for the same chain, as if after reconnecting */
+  cert = tp_tls_certificate_new (TP_PROXY (test->connection),
+      tp_proxy_get_object_path (test->cert), &test->error);
+  g_assert_no_error (test->error);
+  prepare_cert (test, cert);
+
+  /* an acceptable chain */
+  tp_tls_certificate_cache_verification (test->cert, "good.example.com",
+      TRUE);
+  accepted = FALSE;
+  g_assert (tp_tls_certificate_lookup_verification (cert,
+        "good.example.com", &accepted));
+  g_assert (accepted);
+
+  /* the verdict is recorded, rejections and all */
+  tp_tls_certificate_add_rejection (test->cert,
+      TP_TLS_CERTIFICATE_REJECT_REASON_REVOKED, NULL, NULL);
+  tp_tls_certificate_cache_verification (test->cert, "example.com", FALSE);
+
+  g_assert (!tp_tls_certificate_lookup_verification (cert,
+        "other.example.com", &accepted));
+
+  accepted = TRUE;
+  g_assert (tp_tls_certificate_lookup_verification (cert, "EXAMPLE.com",
+        &accepted));
+  g_assert (!accepted);
+
+  /* the cached rejection was added to the new proxy */
+  g_signal_connect (cert, "notify::state", G_CALLBACK (notify_cb), test);
+  tp_tls_certificate_reject_async (cert, reject_cb, test);
+
+  test->wait = 2;
+  g_main_loop_run (test->mainloop);
+  g_assert_no_error (test->error);
+
+  rej = tp_tls_certificate_get_rejection (cert);
+  g_assert_cmpuint (tp_tls_certificate_rejection_get_reason (rej), ==,
+      TP_TLS_CERTIFICATE_REJECT_REASON_REVOKED);
+
+  /* a change to the trust store forgets everything */
+  tp_tls_certificate_invalidate_verifications ();
+  g_assert (!tp_tls_certificate_lookup_verification (cert, "example.com",
+        &accepted));
+  g_assert (!tp_tls_certificate_lookup_verification (cert,
+        "good.example.com", &accepted));
+
+  /* a rejected certificate can never be remembered as accepted, even now
+   * that its rejections have been used up */
+  g_assert_cmpuint (tp_tls_certificate_get_state (cert), ==,
+      TP_TLS_CERTIFICATE_STATE_REJECTED);
+  g_test_expect_message ("tp-glib", G_LOG_LEVEL_CRITICAL, "*REJECTED*");
+  tp_tls_certificate_cache_verification (cert, "example.com", TRUE);
+  g_test_assert_expected_messages ();
+  g_assert (!tp_tls_certificate_lookup_verification (cert, "example.com",
+        &accepted));
+
+  /* nor can one with rejections waiting to be sent; and a rejection has to
+   * say why */
+  g_assert (test->cert != cert);
+  g_test_expect_message ("tp-glib", G_LOG_LEVEL_CRITICAL,
+      "*has_rejections*");
+  tp_tls_certificate_cache_verification (cert, "example.com", FALSE);
+  g_test_assert_expected_messages ();
+
+  tp_tls_certificate_add_rejection (test->cert,
+      TP_TLS_CERTIFICATE_REJECT_REASON_EXPIRED, NULL, NULL);
+  g_test_expect_message ("tp-glib", G_LOG_LEVEL_CRITICAL,
+      "*has_rejections*");
+  tp_tls_certificate_cache_verification (test->cert, "example.com", TRUE);
+  g_test_assert_expected_messages ();
+  g_assert (!tp_tls_certificate_lookup_verification (cert, "example.com",
+        &accepted));
+
+  /* a zero TTL turns the cache off */
+  tp_tls_certificate_set_verification_ttl (0);
+  tp_tls_certificate_cache_verification (test->cert, "example.com", FALSE);
+  g_assert (!tp_tls_certificate_lookup_verification (cert, "example.com",
+        &accepted));
+
+  tp_tls_certificate_set_verification_ttl (300);
+  g_object_unref (cert);
+}
+
 static void
 invalidated_cb (TpProxy *cert,
     guint domain,
@@ -348,6 +444,8 @@ main (int argc,
       test_accept, teardown);
   g_test_add ("/tls-certificate/reject", Test, NULL, setup,
       test_reject, teardown);
+  g_test_add ("/tls-certificate/verification-cache", Test, NULL, setup,
+      test_verification_cache, teardown);
   g_test_add ("/tls-certificate/invalidated", Test, NULL, setup,
       test_invalidated, teardown);
 
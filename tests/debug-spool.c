@@ -0,0 +1,274 @@
+/* Tests of the binary debug spool
+ *
+ * Copyright © 2026 Collabora Ltd. <http://www.collabora.co.uk/>
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.
+ */
+
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <glib.h>
+#include <glib/gstdio.h>
+
+#include "telepathy-glib/debug-spool-internal.h"
+
+#include <telepathy-glib/enums.h>
+
+#define DOMAIN "test/spool"
+#define N_MESSAGES 20
+/* each record is 4 + 12 + strlen (DOMAIN) + strlen ("message 00") = 36
+ * bytes, so 5 of them fit after the header */
+#define RECORD_SIZE 36
+#define RECORDS_PER_FILE 5
+#define MAX_FILE_SIZE \
+  (TP_DEBUG_SPOOL_HEADER_SIZE + RECORDS_PER_FILE * RECORD_SIZE + 10)
+
+typedef struct {
+    gchar *dir;
+    gchar *filename;
+} Test;
+
+static void
+setup (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  GError *error = NULL;
+
+  test->dir = g_dir_make_tmp ("tp-glib-debug-spool.XXXXXX", &error);
+  g_assert_no_error (error);
+  test->filename = g_build_filename (test->dir, "spool", NULL);
+}
+
+static void
+teardown (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  GDir *dir = g_dir_open (test->dir, 0, NULL);
+  const gchar *name;
+
+  while (dir != NULL && (name = g_dir_read_name (dir)) != NULL)
+    {
+      gchar *path = g_build_filename (test->dir, name, NULL);
+
+      g_unlink (path);
+      g_free (path);
+    }
+
+  if (dir != NULL)
+    g_dir_close (dir);
+
+  g_rmdir (test->dir);
+  g_free (test->dir);
+  g_free (test->filename);
+}
+
+static guint32
+get_u32 (const guchar *p)
+{
+  guint32 v;
+
+  memcpy (&v, p, sizeof (v));
+  return GUINT32_FROM_LE (v);
+}
+
+/* Check that @filename is a complete spool file, and return the
+ * numbers of the messages in it, in order */
+static GArray *
+read_spool (const gchar *filename)
+{
+  GArray *numbers = g_array_new (FALSE, FALSE, sizeof (guint));
+  gchar *contents;
+  gsize len, offset;
+  GError *error = NULL;
+
+  g_file_get_contents (filename, &contents, &len, &error);
+  g_assert_no_error (error);
+
+  /* rotation kept the file within its limit */
+  g_assert_cmpuint (len, <=, MAX_FILE_SIZE);
+
+  g_assert_cmpuint (len, >=, TP_DEBUG_SPOOL_HEADER_SIZE);
+  g_assert (memcmp (contents, TP_DEBUG_SPOOL_MAGIC, 4) == 0);
+  g_assert_cmpuint ((guchar) contents[4], ==, TP_DEBUG_SPOOL_VERSION);
+  g_assert_cmpuint (contents[5], ==, 0);
+  g_assert_cmpuint (contents[6], ==, 0);
+  g_assert_cmpuint (contents[7], ==, 0);
+
+  for (offset = TP_DEBUG_SPOOL_HEADER_SIZE; offset < len; )
+    {
+      const guchar *p = (const guchar *) contents + offset;
+      guint32 rec_len;
+      gint64 time_us;
+      guint16 domain_len;
+      gchar *message;
+      guint n;
+
+      g_assert_cmpuint (len - offset, >=,
+          4 + TP_DEBUG_SPOOL_RECORD_FIXED_SIZE);
+      rec_len = get_u32 (p);
+      g_assert_cmpuint (rec_len, ==, RECORD_SIZE - 4);
+      /* no truncated records */
+      g_assert_cmpuint (len - offset, >=, 4 + rec_len);
+
+      memcpy (&time_us, p + 4, sizeof (time_us));
+      time_us = GINT64_FROM_LE (time_us);
+      g_assert_cmpuint (p[12], ==, TP_DEBUG_LEVEL_DEBUG);
+      g_assert_cmpuint (p[13], ==, 0);
+      memcpy (&domain_len, p + 14, sizeof (domain_len));
+      domain_len = GUINT16_FROM_LE (domain_len);
+      g_assert_cmpuint (domain_len, ==, strlen (DOMAIN));
+      g_assert (memcmp (p + 16, DOMAIN, domain_len) == 0);
+
+      message = g_strndup ((const gchar *) p + 16 + domain_len,
+          rec_len - TP_DEBUG_SPOOL_RECORD_FIXED_SIZE - domain_len);
+      g_assert (g_str_has_prefix (message, "message "));
+      n = atoi (message + strlen ("message "));
+      g_assert_cmpint (time_us, ==, (gint64) n * G_USEC_PER_SEC);
+      g_array_append_val (numbers, n);
+      g_free (message);
+
+      offset += 4 + rec_len;
+    }
+
+  g_assert_cmpuint (offset, ==, len);
+  g_free (contents);
+  return numbers;
+}
+
+static void
+test_rotation (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  TpDebugSpool *spool;
+  GError *error = NULL;
+  GArray *numbers;
+  gchar *old, *older;
+  guint i;
+
+  spool = _tp_debug_spool_new (test->filename, MAX_FILE_SIZE, 1, &error);
+  g_assert_no_error (error);
+  g_assert (spool != NULL);
+
+  for (i = 0; i < N_MESSAGES; i++)
+    {
+      gchar *message = g_strdup_printf ("message %02u", i);
+
+      _tp_debug_spool_append (spool, (gint64) i * G_USEC_PER_SEC, DOMAIN,
+          TP_DEBUG_LEVEL_DEBUG, message);
+      g_free (message);
+    }
+
+  /* this writes out everything that's still queued */
+  _tp_debug_spool_free (spool);
+
+  old = g_strdup_printf ("%s.1", test->filename);
+  older = g_strdup_printf ("%s.2", test->filename);
+
+  /* the files were rotated several times, but only one old one was kept */
+  g_assert (g_file_test (old, G_FILE_TEST_EXISTS));
+  g_assert (!g_file_test (older, G_FILE_TEST_EXISTS));
+
+  numbers = read_spool (old);
+  g_assert_cmpuint (numbers->len, ==, RECORDS_PER_FILE);
+
+  for (i = 0; i < numbers->len; i++)
+    g_assert_cmpuint (g_array_index (numbers, guint, i), ==,
+        N_MESSAGES - 2 * RECORDS_PER_FILE + i);
+
+  g_array_unref (numbers);
+
+  numbers = read_spool (test->filename);
+  g_assert_cmpuint (numbers->len, ==, RECORDS_PER_FILE);
+
+  for (i = 0; i < numbers->len; i++)
+    g_assert_cmpuint (g_array_index (numbers, guint, i), ==,
+        N_MESSAGES - RECORDS_PER_FILE + i);
+
+  g_array_unref (numbers);
+
+  g_free (old);
+  g_free (older);
+}
+
+static void
+test_decoder (Test *test,
+    gconstpointer data G_GNUC_UNUSED)
+{
+  const gchar *srcdir = g_getenv ("abs_top_srcdir");
+  const gchar *python = g_getenv ("PYTHON");
+  TpDebugSpool *spool;
+  GError *error = NULL;
+  gchar *script;
+  gchar *argv[] = { NULL, NULL, "--all", NULL, NULL };
+  gchar *output;
+  gchar **lines;
+  gint status;
+  guint i;
+
+  if (srcdir == NULL)
+    {
+      g_message ("abs_top_srcdir not set, skipping test of the decoder");
+      return;
+    }
+
+  spool = _tp_debug_spool_new (test->filename, MAX_FILE_SIZE, 1, &error);
+  g_assert_no_error (error);
+
+  for (i = 0; i < N_MESSAGES; i++)
+    {
+      gchar *message = g_strdup_printf ("message %02u", i);
+
+      _tp_debug_spool_append (spool, g_get_real_time (), DOMAIN,
+          TP_DEBUG_LEVEL_DEBUG, message);
+      g_free (message);
+    }
+
+  _tp_debug_spool_free (spool);
+
+  script = g_build_filename (srcdir, "tools", "tp-debug-spool.py", NULL);
+  argv[0] = (gchar *) (python != NULL ? python : "python");
+  argv[1] = script;
+  argv[3] = test->filename;
+
+  g_spawn_sync (NULL, argv, NULL, G_SPAWN_SEARCH_PATH, NULL, NULL,
+      &output, NULL, &status, &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (status, ==, 0);
+
+  /* the decoder reads the old file, then the current one */
+  lines = g_strsplit (output, "\n", -1);
+  g_assert_cmpuint (g_strv_length (lines), ==, 2 * RECORDS_PER_FILE + 1);
+  g_assert_cmpstr (lines[2 * RECORDS_PER_FILE], ==, "");
+
+  for (i = 0; i < 2 * RECORDS_PER_FILE; i++)
+    {
+      gchar *expected = g_strdup_printf (" " DOMAIN " DEBUG: message %02u",
+          N_MESSAGES - 2 * RECORDS_PER_FILE + i);
+
+      g_assert (g_str_has_suffix (lines[i], expected));
+      g_free (expected);
+    }
+
+  g_strfreev (lines);
+  g_free (output);
+  g_free (script);
+}
+
+int
+main (int argc,
+    char **argv)
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add ("/debug-spool/rotation", Test, NULL, setup, test_rotation,
+      teardown);
+  g_test_add ("/debug-spool/decoder", Test, NULL, setup, test_decoder,
+      teardown);
+
+  return g_test_run ();
+}
@@ -36,6 +36,9 @@ typedef struct {
     TpDTMFPlayer *dtmf_player;
     GString *log;
     GError *error /* initially NULL */ ;
+    /* when each line of the log was written */
+    gint64 times[16];
+    guint n_times;
 } Fixture;
 
 static void
@@ -45,6 +48,9 @@ fixture_log (Fixture *f,
 {
   va_list ap;
 
+  if (f->n_times < G_N_ELEMENTS (f->times))
+    f->times[f->n_times++] = g_get_monotonic_time ();
+
   va_start (ap, format);
   g_string_append_vprintf (f->log, format, ap);
   g_string_append_c (f->log, '\n');
@@ -293,6 +299,109 @@ test_wait (Fixture *f,
       "finished\n");
 }
 
+static void
+test_timing (Fixture *f,
+    gconstpointer nil G_GNUC_UNUSED)
+{
+  gboolean ok;
+
+  ok = tp_dtmf_player_play (f->dtmf_player, "12,3", 40, 20, 100,
+      &f->error);
+  g_assert_no_error (f->error);
+  g_assert (ok);
+
+  while (tp_dtmf_player_is_active (f->dtmf_player))
+    g_main_context_iteration (NULL, TRUE);
+
+  fixture_assert_log (f,
+      "started '1'\n"
+      "stopped\n"
+      "started '2'\n"
+      "stopped\n"
+      "started '3'\n"
+      "stopped\n"
+      "finished\n");
+  g_assert_cmpuint (f->n_times, ==, 7);
+
+  /* Tones, gaps and pauses may be late if the machine is busy, but must
+   * never be early */
+  g_assert_cmpint (f->times[1] - f->times[0], >=, 40 * 1000);
+  g_assert_cmpint (f->times[2] - f->times[1], >=, 20 * 1000);
+  g_assert_cmpint (f->times[3] - f->times[2], >=, 40 * 1000);
+  /* the pause replaces the gap */
+  g_assert_cmpint (f->times[4] - f->times[3], >=, 100 * 1000);
+  g_assert_cmpint (f->times[5] - f->times[4], >=, 40 * 1000);
+
+  /* ... and shouldn't be very late either */
+  g_assert_cmpint (f->times[5] - f->times[0], <, 2 * G_USEC_PER_SEC);
+}
+
+typedef struct {
+    guint finished;
+    guint cancelled;
+} Counts;
+
+static void
+count_finished_cb (TpDTMFPlayer *dtmf_player G_GNUC_UNUSED,
+    gboolean cancelled,
+    Counts *counts)
+{
+  if (cancelled)
+    counts->cancelled++;
+  else
+    counts->finished++;
+}
+
+#define N_PLAYERS 1000
+
+static void
+test_many (Fixture *f G_GNUC_UNUSED,
+    gconstpointer nil G_GNUC_UNUSED)
+{
+  TpDTMFPlayer *players[N_PLAYERS];
+  Counts counts = { 0, 0 };
+  gint64 start = g_get_monotonic_time ();
+  guint i;
+
+  for (i = 0; i < N_PLAYERS; i++)
+    {
+      gboolean ok;
+
+      players[i] = tp_dtmf_player_new ();
+      g_signal_connect (players[i], "finished",
+          G_CALLBACK (count_finished_cb), &counts);
+
+      /* spread the players over several slots of the timer wheel, and
+       * further than one turn of its finest level */
+      ok = tp_dtmf_player_play (players[i], "1p2", 1 + (i % 7), 1,
+          1 + (i % 100), &f->error);
+      g_assert_no_error (f->error);
+      g_assert (ok);
+    }
+
+  /* cancel some of them, while their timers are in the same lists as
+   * other players' */
+  for (i = 0; i < N_PLAYERS; i += 3)
+    tp_dtmf_player_cancel (players[i]);
+
+  g_assert_cmpuint (counts.cancelled, ==, (N_PLAYERS + 2) / 3);
+
+  while (counts.finished + counts.cancelled < N_PLAYERS)
+    g_main_context_iteration (NULL, TRUE);
+
+  g_assert_cmpuint (counts.cancelled, ==, (N_PLAYERS + 2) / 3);
+  g_assert_cmpuint (counts.finished, ==, N_PLAYERS - (N_PLAYERS + 2) / 3);
+
+  /* player 199 wasn't cancelled, and paused for 100ms */
+  g_assert_cmpint (g_get_monotonic_time () - start, >=, 100 * 1000);
+
+  for (i = 0; i < N_PLAYERS; i++)
+    {
+      g_assert (!tp_dtmf_player_is_active (players[i]));
+      g_object_unref (players[i]);
+    }
+}
+
 int
 main (int argc,
     char **argv)
@@ -313,6 +422,8 @@ main (int argc,
   FIXTURE_TEST (cancel_in_pause);
   FIXTURE_TEST (sequence);
   FIXTURE_TEST (wait);
+  FIXTURE_TEST (timing);
+  FIXTURE_TEST (many);
 
   return g_test_run ();
 }
@@ -9,6 +9,9 @@
 #include <gio/gio.h>
 
 #ifdef HAVE_GIO_UNIX
+#include <sys/socket.h>
+#include <unistd.h>
+
 #include <gio/gunixsocketaddress.h>
 #endif /* HAVE_GIO_UNIX */
 
@@ -297,6 +300,250 @@ test_sockaddr_to_variant_abstract_unix (void)
 
   tp_g_value_slice_free (variant);
 }
+
+static void
+unix_connection_pair (GSocketConnection **a,
+    GSocketConnection **b)
+{
+  GSocket *socket;
+  GError *error = NULL;
+  int fds[2];
+
+  g_assert_cmpint (socketpair (AF_UNIX, SOCK_STREAM, 0, fds), ==, 0);
+
+  socket = g_socket_new_from_fd (fds[0], &error);
+  g_assert_no_error (error);
+  *a = g_socket_connection_factory_create_connection (socket);
+  g_object_unref (socket);
+
+  socket = g_socket_new_from_fd (fds[1], &error);
+  g_assert_no_error (error);
+  *b = g_socket_connection_factory_create_connection (socket);
+  g_object_unref (socket);
+}
+
+static void
+test_send_receive_message (void)
+{
+  GSocketConnection *sender, *receiver;
+  GOutputVector out[2] = { { "hel", 3 }, { "lo", 2 } };
+  GInputVector in;
+  gchar buffer[16];
+  int pipes[2][2];
+  gint sent_fds[2];
+  gint *fds = NULL;
+  gint n_fds = -1;
+  GCredentials *credentials = NULL;
+  GError *error = NULL;
+  gssize n;
+  gchar c;
+
+  unix_connection_pair (&sender, &receiver);
+
+  g_assert_cmpint (pipe (pipes[0]), ==, 0);
+  g_assert_cmpint (pipe (pipes[1]), ==, 0);
+  sent_fds[0] = pipes[0][1];
+  sent_fds[1] = pipes[1][1];
+
+  /* the payload from both vectors, both fds and our credentials are sent
+   * in one go */
+  n = tp_unix_connection_send_message (sender, out, 2, sent_fds, 2, TRUE,
+      NULL, &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (n, ==, 5);
+
+  /* the fds are still ours */
+  g_assert_cmpint (write (sent_fds[0], "a", 1), ==, 1);
+
+  in.buffer = buffer;
+  in.size = sizeof (buffer);
+  n = tp_unix_connection_receive_message (receiver, &in, 1, &fds, &n_fds,
+      &credentials, NULL, &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (n, ==, 5);
+  g_assert (memcmp (buffer, "hello", 5) == 0);
+
+  g_assert (credentials != NULL);
+  g_assert_cmpuint (g_credentials_get_unix_user (credentials, NULL), ==,
+      geteuid ());
+
+  /* the received fds are new descriptors for the same pipes */
+  g_assert_cmpint (n_fds, ==, 2);
+  g_assert_cmpint (fds[0], !=, sent_fds[0]);
+  g_assert_cmpint (write (fds[1], "b", 1), ==, 1);
+
+  g_assert_cmpint (read (pipes[0][0], &c, 1), ==, 1);
+  g_assert_cmpint (c, ==, 'a');
+  g_assert_cmpint (read (pipes[1][0], &c, 1), ==, 1);
+  g_assert_cmpint (c, ==, 'b');
+
+  /* without credentials or fds, only the payload arrives */
+  n = tp_unix_connection_send_message (sender, out, 1, NULL, 0, FALSE,
+      NULL, &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (n, ==, 3);
+
+  tp_clear_object (&credentials);
+  close (fds[0]);
+  close (fds[1]);
+  g_free (fds);
+  fds = NULL;
+  n = tp_unix_connection_receive_message (receiver, &in, 1, &fds, &n_fds,
+      &credentials, NULL, &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (n, ==, 3);
+  g_assert (fds == NULL);
+  g_assert_cmpint (n_fds, ==, 0);
+  g_assert (credentials == NULL);
+
+  close (pipes[0][0]);
+  close (pipes[0][1]);
+  close (pipes[1][0]);
+  close (pipes[1][1]);
+  g_object_unref (sender);
+  g_object_unref (receiver);
+}
+
+static void
+credentials_sent_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  guint *pending = user_data;
+  GError *error = NULL;
+
+  tp_unix_connection_send_credentials_with_byte_finish (
+      G_SOCKET_CONNECTION (source), result, &error);
+  g_assert_no_error (error);
+  (*pending)--;
+}
+
+static void
+credentials_received_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  guint *pending = user_data;
+  GCredentials *credentials;
+  guchar byte;
+  GError *error = NULL;
+
+  credentials = tp_unix_connection_receive_credentials_with_byte_finish (
+      G_SOCKET_CONNECTION (source), result, &byte, &error);
+  g_assert_no_error (error);
+  g_assert_cmpuint (byte, ==, 42);
+  g_assert_cmpuint (g_credentials_get_unix_user (credentials, NULL), ==,
+      geteuid ());
+  g_object_unref (credentials);
+  (*pending)--;
+}
+
+static void
+test_credentials_with_byte_async (void)
+{
+  GSocketConnection *sender, *receiver;
+  guint pending = 2;
+
+  unix_connection_pair (&sender, &receiver);
+
+  /* receive first, so it has to wait for the socket */
+  tp_unix_connection_receive_credentials_with_byte_async (receiver, NULL,
+      credentials_received_cb, &pending);
+  tp_unix_connection_send_credentials_with_byte_async (sender, 42, NULL,
+      credentials_sent_cb, &pending);
+
+  while (pending > 0)
+    g_main_context_iteration (NULL, TRUE);
+
+  g_object_unref (sender);
+  g_object_unref (receiver);
+}
+
+static void
+message_sent_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  guint *pending = user_data;
+  GError *error = NULL;
+  gssize n;
+
+  n = tp_unix_connection_send_message_finish (G_SOCKET_CONNECTION (source),
+      result, &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (n, ==, 5);
+  (*pending)--;
+}
+
+static void
+message_received_cb (GObject *source,
+    GAsyncResult *result,
+    gpointer user_data)
+{
+  guint *pending = user_data;
+  GCredentials *credentials = NULL;
+  gint *fds = NULL;
+  gint n_fds = -1;
+  GError *error = NULL;
+  gssize n;
+
+  n = tp_unix_connection_receive_message_finish (G_SOCKET_CONNECTION (source),
+      result, &fds, &n_fds, &credentials, &error);
+  g_assert_no_error (error);
+  g_assert_cmpint (n, ==, 5);
+
+  g_assert (credentials != NULL);
+  g_assert_cmpuint (g_credentials_get_unix_user (credentials, NULL), ==,
+      geteuid ());
+
+  g_assert_cmpint (n_fds, ==, 1);
+  g_assert_cmpint (write (fds[0], "c", 1), ==, 1);
+  close (fds[0]);
+
+  g_free (fds);
+  g_object_unref (credentials);
+  (*pending)--;
+}
+
+static void
+test_send_receive_message_async (void)
+{
+  GSocketConnection *sender, *receiver;
+  GOutputVector out[2] = { { "hel", 3 }, { "lo", 2 } };
+  GInputVector in[2];
+  gchar head[2], tail[8];
+  int pipes[2];
+  guint pending = 2;
+  gchar c;
+
+  unix_connection_pair (&sender, &receiver);
+  g_assert_cmpint (pipe (pipes), ==, 0);
+
+  /* receive first, so it has to wait for the socket; the payload is
+   * scattered across both buffers */
+  in[0].buffer = head;
+  in[0].size = sizeof (head);
+  in[1].buffer = tail;
+  in[1].size = sizeof (tail);
+  tp_unix_connection_receive_message_async (receiver, in, 2, TRUE, NULL,
+      message_received_cb, &pending);
+  tp_unix_connection_send_message_async (sender, out, 2, &pipes[1], 1, TRUE,
+      NULL, message_sent_cb, &pending);
+
+  while (pending > 0)
+    g_main_context_iteration (NULL, TRUE);
+
+  g_assert (memcmp (head, "he", 2) == 0);
+  g_assert (memcmp (tail, "llo", 3) == 0);
+
+  g_assert_cmpint (read (pipes[0], &c, 1), ==, 1);
+  g_assert_cmpint (c, ==, 'c');
+
+  close (pipes[0]);
+  close (pipes[1]);
+  g_object_unref (sender);
+  g_object_unref (receiver);
+}
 #endif /* HAVE_GIO_UNIX */
 
 int
@@ -313,6 +560,9 @@ main (int argc, char **argv)
   test_variant_to_sockaddr_abstract_unix ();
   test_sockaddr_to_variant_unix ();
   test_sockaddr_to_variant_abstract_unix ();
+  test_send_receive_message ();
+  test_send_receive_message_async ();
+  test_credentials_with_byte_async ();
 #endif /* HAVE_GIO_UNIX */
 
   return 0;
@@ -0,0 +1,360 @@
+/*
+ * contact-search-chan.c - a ContactSearch channel which always finds
+ *  something
+ *
+ * Copyright (C) 2026 Collabora Ltd. <http://www.collabora.co.uk/>
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.
+ */
+
+#include "config.h"
+
+#include "contact-search-chan.h"
+
+#include <telepathy-glib/telepathy-glib.h>
+
+static void contact_search_iface_init (gpointer iface,
+    gpointer data);
+
+G_DEFINE_TYPE_WITH_CODE (TpTestsContactSearchChan,
+    tp_tests_contact_search_chan,
+    TP_TYPE_BASE_CHANNEL,
+    G_IMPLEMENT_INTERFACE (TP_TYPE_SVC_CHANNEL_TYPE_CONTACT_SEARCH,
+      contact_search_iface_init))
+
+enum {
+  PROP_SERVER = 1,
+  PROP_LIMIT,
+  PROP_SEARCH_STATE,
+  PROP_AVAILABLE_SEARCH_KEYS,
+  LAST_PROPERTY,
+};
+
+static const gchar * const search_keys[] = { "fn", "email", NULL };
+
+struct _TpTestsContactSearchChanPriv {
+  gchar *server;
+  guint limit;
+  TpChannelContactSearchState state;
+
+  /* what we're searching for */
+  gchar *term;
+  /* how many results have been sent */
+  guint n_sent;
+  guint send_page_id;
+};
+
+static void
+tp_tests_contact_search_chan_get_property (GObject *object,
+    guint property_id,
+    GValue *value,
+    GParamSpec *pspec)
+{
+  TpTestsContactSearchChan *self = TP_TESTS_CONTACT_SEARCH_CHAN (object);
+
+  switch (property_id)
+    {
+      case PROP_SERVER:
+        g_value_set_string (value, self->priv->server);
+        break;
+      case PROP_LIMIT:
+        g_value_set_uint (value, self->priv->limit);
+        break;
+      case PROP_SEARCH_STATE:
+        g_value_set_uint (value, self->priv->state);
+        break;
+      case PROP_AVAILABLE_SEARCH_KEYS:
+        g_value_set_boxed (value, search_keys);
+        break;
+      default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+        break;
+    }
+}
+
+static void
+tp_tests_contact_search_chan_set_property (GObject *object,
+    guint property_id,
+    const GValue *value,
+    GParamSpec *pspec)
+{
+  TpTestsContactSearchChan *self = TP_TESTS_CONTACT_SEARCH_CHAN (object);
+
+  switch (property_id)
+    {
+      case PROP_SERVER:
+        g_assert (self->priv->server == NULL); /* construct only */
+        self->priv->server = g_value_dup_string (value);
+        break;
+      case PROP_LIMIT:
+        self->priv->limit = g_value_get_uint (value);
+        break;
+      default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+        break;
+    }
+}
+
+static void
+tp_tests_contact_search_chan_constructed (GObject *object)
+{
+  TpTestsContactSearchChan *self = TP_TESTS_CONTACT_SEARCH_CHAN (object);
+  void (*chain_up) (GObject *) =
+      ((GObjectClass *) tp_tests_contact_search_chan_parent_class)->constructed;
+
+  if (chain_up != NULL)
+    chain_up (object);
+
+  tp_base_channel_register (TP_BASE_CHANNEL (self));
+}
+
+static void
+tp_tests_contact_search_chan_finalize (GObject *object)
+{
+  TpTestsContactSearchChan *self = TP_TESTS_CONTACT_SEARCH_CHAN (object);
+  void (*chain_up) (GObject *) =
+      ((GObjectClass *) tp_tests_contact_search_chan_parent_class)->finalize;
+
+  if (self->priv->send_page_id != 0)
+    g_source_remove (self->priv->send_page_id);
+
+  g_free (self->priv->server);
+  g_free (self->priv->term);
+
+  if (chain_up != NULL)
+    chain_up (object);
+}
+
+static void
+fill_immutable_properties (TpBaseChannel *chan,
+    GHashTable *properties)
+{
+  TpBaseChannelClass *klass = TP_BASE_CHANNEL_CLASS (
+      tp_tests_contact_search_chan_parent_class);
+
+  klass->fill_immutable_properties (chan, properties);
+
+  tp_dbus_properties_mixin_fill_properties_hash (
+      G_OBJECT (chan), properties,
+      TP_IFACE_CHANNEL_TYPE_CONTACT_SEARCH, "Server",
+      TP_IFACE_CHANNEL_TYPE_CONTACT_SEARCH, "Limit",
+      TP_IFACE_CHANNEL_TYPE_CONTACT_SEARCH, "AvailableSearchKeys",
+      NULL);
+}
+
+static void
+contact_search_chan_close (TpBaseChannel *channel)
+{
+  tp_base_channel_destroyed (channel);
+}
+
+static void
+tp_tests_contact_search_chan_class_init (
+    TpTestsContactSearchChanClass *klass)
+{
+  GObjectClass *oclass = G_OBJECT_CLASS (klass);
+  TpBaseChannelClass *base_class = TP_BASE_CHANNEL_CLASS (klass);
+  GParamSpec *spec;
+  static TpDBusPropertiesMixinPropImpl contact_search_props[] = {
+      { "Server", "server", NULL, },
+      { "Limit", "limit", NULL, },
+      { "SearchState", "search-state", NULL, },
+      { "AvailableSearchKeys", "available-search-keys", NULL, },
+      { NULL }
+  };
+
+  oclass->get_property = tp_tests_contact_search_chan_get_property;
+  oclass->set_property = tp_tests_contact_search_chan_set_property;
+  oclass->constructed = tp_tests_contact_search_chan_constructed;
+  oclass->finalize = tp_tests_contact_search_chan_finalize;
+
+  base_class->channel_type = TP_IFACE_CHANNEL_TYPE_CONTACT_SEARCH;
+  base_class->target_handle_type = TP_HANDLE_TYPE_NONE;
+  base_class->fill_immutable_properties = fill_immutable_properties;
+  base_class->close = contact_search_chan_close;
+
+  spec = g_param_spec_string ("server", "server",
+      "Server",
+      "",
+      G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY | G_PARAM_STATIC_STRINGS);
+  g_object_class_install_property (oclass, PROP_SERVER, spec);
+
+  spec = g_param_spec_uint ("limit", "limit",
+      "Limit",
+      0, G_MAXUINT32, 0,
+      G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY | G_PARAM_STATIC_STRINGS);
+  g_object_class_install_property (oclass, PROP_LIMIT, spec);
+
+  spec = g_param_spec_uint ("search-state", "search state",
+      "SearchState",
+      0, G_MAXUINT32, 0,
+      G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+  g_object_class_install_property (oclass, PROP_SEARCH_STATE, spec);
+
+  spec = g_param_spec_boxed ("available-search-keys", "search keys",
+      "AvailableSearchKeys",
+      G_TYPE_STRV,
+      G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+  g_object_class_install_property (oclass, PROP_AVAILABLE_SEARCH_KEYS, spec);
+
+  tp_dbus_properties_mixin_implement_interface (oclass,
+      TP_IFACE_QUARK_CHANNEL_TYPE_CONTACT_SEARCH,
+      tp_dbus_properties_mixin_getter_gobject_properties, NULL,
+      contact_search_props);
+
+  g_type_class_add_private (klass, sizeof (TpTestsContactSearchChanPriv));
+}
+
+static void
+tp_tests_contact_search_chan_init (TpTestsContactSearchChan *self)
+{
+  self->priv = G_TYPE_INSTANCE_GET_PRIVATE (self,
+      TP_TESTS_TYPE_CONTACT_SEARCH_CHAN, TpTestsContactSearchChanPriv);
+}
+
+static void
+change_state (TpTestsContactSearchChan *self,
+    TpChannelContactSearchState state,
+    const gchar *error)
+{
+  GHashTable *details = tp_asv_new (NULL, NULL);
+
+  self->priv->state = state;
+  tp_svc_channel_type_contact_search_emit_search_state_changed (self,
+      state, error == NULL ? "" : error, details);
+  g_hash_table_unref (details);
+}
+
+static gboolean
+send_page (gpointer data)
+{
+  TpTestsContactSearchChan *self = TP_TESTS_CONTACT_SEARCH_CHAN (data);
+  GHashTable *results;
+  guint i;
+
+  self->priv->send_page_id = 0;
+
+  results = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+      (GDestroyNotify) g_ptr_array_unref);
+
+  for (i = 0; self->priv->n_sent < TP_TESTS_CONTACT_SEARCH_CHAN_N_RESULTS &&
+      (self->priv->limit == 0 || i < self->priv->limit); i++)
+    {
+      const gchar * const no_parameters[] = { NULL };
+      const gchar *values[] = { self->priv->term, NULL };
+      GPtrArray *info = g_ptr_array_new_with_free_func (
+          (GDestroyNotify) tp_value_array_free);
+
+      g_ptr_array_add (info, tp_value_array_build (3,
+            G_TYPE_STRING, "fn",
+            G_TYPE_STRV, no_parameters,
+            G_TYPE_STRV, values,
+            G_TYPE_INVALID));
+
+      g_hash_table_insert (results,
+          g_strdup_printf ("%s-%02u@example.com", self->priv->term,
+            self->priv->n_sent++),
+          info);
+    }
+
+  tp_svc_channel_type_contact_search_emit_search_result_received (self,
+      results);
+  g_hash_table_unref (results);
+
+  if (self->priv->n_sent < TP_TESTS_CONTACT_SEARCH_CHAN_N_RESULTS)
+    change_state (self, TP_CHANNEL_CONTACT_SEARCH_STATE_MORE_AVAILABLE, NULL);
+  else
+    change_state (self, TP_CHANNEL_CONTACT_SEARCH_STATE_COMPLETED, NULL);
+
+  return FALSE;
+}
+
+static void
+contact_search_search (TpSvcChannelTypeContactSearch *chan,
+    GHashTable *terms,
+    DBusGMethodInvocation *context)
+{
+  TpTestsContactSearchChan *self = TP_TESTS_CONTACT_SEARCH_CHAN (chan);
+  const gchar *term = g_hash_table_lookup (terms, "fn");
+
+  if (self->priv->state != TP_CHANNEL_CONTACT_SEARCH_STATE_NOT_STARTED)
+    {
+      GError error = { TP_ERROR, TP_ERROR_NOT_AVAILABLE,
+          "Already searched" };
+
+      dbus_g_method_return_error (context, &error);
+      return;
+    }
+
+  if (term == NULL)
+    {
+      GError error = { TP_ERROR, TP_ERROR_INVALID_ARGUMENT,
+          "Only searching by fn is supported" };
+
+      dbus_g_method_return_error (context, &error);
+      return;
+    }
+
+  self->priv->term = g_strdup (term);
+  change_state (self, TP_CHANNEL_CONTACT_SEARCH_STATE_IN_PROGRESS, NULL);
+  self->priv->send_page_id = g_idle_add (send_page, self);
+
+  tp_svc_channel_type_contact_search_return_from_search (context);
+}
+
+static void
+contact_search_more (TpSvcChannelTypeContactSearch *chan,
+    DBusGMethodInvocation *context)
+{
+  TpTestsContactSearchChan *self = TP_TESTS_CONTACT_SEARCH_CHAN (chan);
+
+  if (self->priv->state != TP_CHANNEL_CONTACT_SEARCH_STATE_MORE_AVAILABLE)
+    {
+      GError error = { TP_ERROR, TP_ERROR_NOT_AVAILABLE,
+          "No more results" };
+
+      dbus_g_method_return_error (context, &error);
+      return;
+    }
+
+  change_state (self, TP_CHANNEL_CONTACT_SEARCH_STATE_IN_PROGRESS, NULL);
+  self->priv->send_page_id = g_idle_add (send_page, self);
+
+  tp_svc_channel_type_contact_search_return_from_more (context);
+}
+
+static void
+contact_search_stop (TpSvcChannelTypeContactSearch *chan,
+    DBusGMethodInvocation *context)
+{
+  TpTestsContactSearchChan *self = TP_TESTS_CONTACT_SEARCH_CHAN (chan);
+
+  if (self->priv->send_page_id != 0)
+    {
+      g_source_remove (self->priv->send_page_id);
+      self->priv->send_page_id = 0;
+    }
+
+  if (self->priv->state == TP_CHANNEL_CONTACT_SEARCH_STATE_IN_PROGRESS ||
+      self->priv->state == TP_CHANNEL_CONTACT_SEARCH_STATE_MORE_AVAILABLE)
+    change_state (self, TP_CHANNEL_CONTACT_SEARCH_STATE_FAILED,
+        TP_ERROR_STR_CANCELLED);
+
+  tp_svc_channel_type_contact_search_return_from_stop (context);
+}
+
+static void
+contact_search_iface_init (gpointer iface,
+    gpointer data)
+{
+  TpSvcChannelTypeContactSearchClass *klass = iface;
+
+#define IMPLEMENT(x) \
+  tp_svc_channel_type_contact_search_implement_##x (klass, contact_search_##x)
+  IMPLEMENT(search);
+  IMPLEMENT(more);
+  IMPLEMENT(stop);
+#undef IMPLEMENT
+}
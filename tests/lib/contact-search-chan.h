@@ -0,0 +1,65 @@
+/*
+ * contact-search-chan.h - a ContactSearch channel which always finds
+ *  something
+ *
+ * Copyright (C) 2026 Collabora Ltd. <http://www.collabora.co.uk/>
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.
+ */
+
+#ifndef __TP_TESTS_CONTACT_SEARCH_CHAN_H__
+#define __TP_TESTS_CONTACT_SEARCH_CHAN_H__
+
+#include <glib-object.h>
+#include <telepathy-glib/telepathy-glib.h>
+
+G_BEGIN_DECLS
+
+typedef struct _TpTestsContactSearchChan TpTestsContactSearchChan;
+typedef struct _TpTestsContactSearchChanClass TpTestsContactSearchChanClass;
+typedef struct _TpTestsContactSearchChanPriv TpTestsContactSearchChanPriv;
+
+struct _TpTestsContactSearchChanClass {
+    TpBaseChannelClass parent_class;
+    TpDBusPropertiesMixinClass dbus_properties_class;
+};
+
+struct _TpTestsContactSearchChan {
+    TpBaseChannel parent;
+    TpTestsContactSearchChanPriv *priv;
+};
+
+GType tp_tests_contact_search_chan_get_type (void);
+
+/* how many results every search finds; they are sent in pages of at most
+ * #TpTestsContactSearchChan:limit results, and a search with a nonzero limit
+ * waits for More() between pages */
+#define TP_TESTS_CONTACT_SEARCH_CHAN_N_RESULTS 25
+
+/* TYPE MACROS */
+#define TP_TESTS_TYPE_CONTACT_SEARCH_CHAN \
+  (tp_tests_contact_search_chan_get_type ())
+#define TP_TESTS_CONTACT_SEARCH_CHAN(obj) \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj), \
+    TP_TESTS_TYPE_CONTACT_SEARCH_CHAN, \
+    TpTestsContactSearchChan))
+#define TP_TESTS_CONTACT_SEARCH_CHAN_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_CAST((klass), \
+    TP_TESTS_TYPE_CONTACT_SEARCH_CHAN, \
+    TpTestsContactSearchChanClass))
+#define TP_TESTS_IS_CONTACT_SEARCH_CHAN(obj) \
+  (G_TYPE_CHECK_INSTANCE_TYPE((obj), \
+    TP_TESTS_TYPE_CONTACT_SEARCH_CHAN))
+#define TP_TESTS_IS_CONTACT_SEARCH_CHAN_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_TYPE((klass), \
+    TP_TESTS_TYPE_CONTACT_SEARCH_CHAN))
+#define TP_TESTS_CONTACT_SEARCH_CHAN_GET_CLASS(obj) \
+  (G_TYPE_INSTANCE_GET_CLASS ((obj), \
+    TP_TESTS_TYPE_CONTACT_SEARCH_CHAN, \
+    TpTestsContactSearchChanClass))
+
+G_END_DECLS
+
+#endif /* #ifndef __TP_TESTS_CONTACT_SEARCH_CHAN_H__*/
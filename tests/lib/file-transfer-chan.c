@@ -46,9 +46,18 @@ enum /* properties */
   PROP_URI,
   PROP_SERVICE_NAME,
   PROP_METADATA,
+  PROP_FORCED_INITIAL_OFFSET,
   N_PROPS,
 };
 
+enum
+{
+  SIG_INCOMING_CONNECTION,
+  LAST_SIGNAL
+};
+
+static guint signals[LAST_SIGNAL] = {0, };
+
 struct _TpTestsFileTransferChannelPrivate {
     /* Exposed properties */
     gchar *content_type;
@@ -67,6 +76,8 @@ struct _TpTestsFileTransferChannelPrivate {
     gchar *content_hash;
     GHashTable *available_socket_types;
     gint64 initial_offset;
+    /* if nonzero, the InitialOffset to use whatever the client asks for */
+    guint64 forced_initial_offset;
 
     /* Accepting side */
     GSocketService *service;
@@ -232,6 +243,10 @@ get_property (GObject *object,
         g_value_set_boxed (value, self->priv->metadata);
         break;
 
+      case PROP_FORCED_INITIAL_OFFSET:
+        g_value_set_uint64 (value, self->priv->forced_initial_offset);
+        break;
+
       default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
         break;
@@ -303,6 +318,10 @@ set_property (GObject *object,
         self->priv->metadata = g_value_dup_boxed (value);
         break;
 
+      case PROP_FORCED_INITIAL_OFFSET:
+        self->priv->forced_initial_offset = g_value_get_uint64 (value);
+        break;
+
       default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
         break;
@@ -440,6 +459,8 @@ service_incoming_cb (GSocketService *service,
 
       g_object_unref (addr);
     }
+
+  g_signal_emit (self, signals[SIG_INCOMING_CONNECTION], 0, connection);
 }
 
 static void
@@ -494,8 +515,13 @@ file_transfer_provide_file (TpSvcChannelTypeFileTransfer *iface,
         goto fail;
       }
 
+  tp_g_signal_connect_object (self->priv->service, "incoming",
+      G_CALLBACK (service_incoming_cb), self, 0);
+
   self->priv->address_type = address_type;
   self->priv->access_control = access_control;
+  self->priv->access_control_param = tp_g_value_slice_dup (
+      access_control_param);
 
   DEBUG ("Waiting 500ms and setting state to OPEN");
   self->priv->timer_id = g_timeout_add (500, start_file_transfer, self);
@@ -561,6 +587,15 @@ file_transfer_accept_file (TpSvcChannelTypeFileTransfer *iface,
   self->priv->access_control_param = tp_g_value_slice_dup (
       access_control_param);
 
+  /* we can always start wherever the client asks us to, unless the test
+   * wants something else */
+  if (self->priv->forced_initial_offset != 0)
+    offset = self->priv->forced_initial_offset;
+
+  self->priv->initial_offset = offset;
+  tp_svc_channel_type_file_transfer_emit_initial_offset_defined (self,
+      offset);
+
   DEBUG ("Setting TP_FILE_TRANSFER_STATE_ACCEPTED");
   change_state (self, TP_FILE_TRANSFER_STATE_ACCEPTED,
       TP_FILE_TRANSFER_STATE_CHANGE_REASON_REQUESTED);
@@ -666,6 +701,14 @@ tp_tests_file_transfer_channel_class_init (
   g_object_class_install_property (object_class, PROP_INITIAL_OFFSET,
       param_spec);
 
+  param_spec = g_param_spec_uint64 ("forced-initial-offset",
+      "Forced InitialOffset",
+      "If nonzero, the InitialOffset to use, whatever the client asks for",
+      0, G_MAXUINT64, 0,
+      G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+  g_object_class_install_property (object_class, PROP_FORCED_INITIAL_OFFSET,
+      param_spec);
+
   param_spec = g_param_spec_uint64 ("size",
       "Size",
       "The Size property of this channel",
@@ -714,6 +757,15 @@ tp_tests_file_transfer_channel_class_init (
   g_object_class_install_property (object_class, PROP_METADATA,
       param_spec);
 
+  /* emitted with the connection made by the client to the socket passed to
+   * AcceptFile or ProvideFile, after checking its access control */
+  signals[SIG_INCOMING_CONNECTION] = g_signal_new ("incoming-connection",
+      G_OBJECT_CLASS_TYPE (klass),
+      G_SIGNAL_RUN_LAST,
+      0, NULL, NULL, NULL,
+      G_TYPE_NONE,
+      1, G_TYPE_SOCKET_CONNECTION);
+
   tp_dbus_properties_mixin_implement_interface (object_class,
       TP_IFACE_QUARK_CHANNEL_TYPE_FILE_TRANSFER,
       tp_dbus_properties_mixin_getter_gobject_properties, NULL,
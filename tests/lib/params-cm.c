@@ -130,22 +130,31 @@ static TpCMParamSpec param_example_params[] = {
   { NULL }
 };
 
+/* the params of the last connection attempt; connections can be attempted
+ * in several threads at once if the CM has shards */
+G_LOCK_DEFINE_STATIC (params);
 static TpTestsCMParams *params = NULL;
 
 static gpointer
 alloc_params (void)
 {
-  params = g_slice_new0 (TpTestsCMParams);
-
-  return params;
+  return g_slice_new0 (TpTestsCMParams);
 }
 
 static void
 free_params (gpointer p)
 {
-  /* CM user is responsible to free params so he can check their values */
+  /* CM user is responsible to free params so he can check their values,
+   * but only the last ones are kept */
+  G_LOCK (params);
+
+  if (params != NULL)
+    tp_tests_param_connection_manager_free_params (params);
+
   params = (TpTestsCMParams *) p;
   params->would_have_been_freed = TRUE;
+
+  G_UNLOCK (params);
 }
 
 static const TpCMProtocolSpec example_protocols[] = {
@@ -190,9 +199,13 @@ tp_tests_param_connection_manager_class_init (
 TpTestsCMParams *
 tp_tests_param_connection_manager_steal_params_last_conn (void)
 {
-  TpTestsCMParams *p = params;
+  TpTestsCMParams *p;
 
+  G_LOCK (params);
+  p = params;
   params = NULL;
+  G_UNLOCK (params);
+
   return p;
 }
 
@@ -3,6 +3,8 @@
 
 #include "room-list-chan.h"
 
+#include <string.h>
+
 #include <telepathy-glib/telepathy-glib.h>
 
 static void room_list_iface_init (gpointer iface,
@@ -24,9 +26,18 @@ enum {
 static guint signals[LAST_SIGNAL];
 */
 
+/* with this server, lots of rooms are found, in batches; "ManyRooms:N"
+ * lists N rooms rather than TP_TESTS_ROOM_LIST_CHAN_MANY_ROOMS */
+#define MANY_ROOMS_SERVER "ManyRooms"
+#define MANY_ROOMS_BATCH 100
+
 struct _TpTestsRoomListChanPriv {
   gchar *server;
   gboolean listing;
+
+  guint n_rooms;
+  guint n_many_rooms;
+  guint find_rooms_id;
 };
 
 static void
@@ -88,6 +99,9 @@ tp_tests_room_list_chan_finalize (GObject *object)
   void (*chain_up) (GObject *) =
       ((GObjectClass *) tp_tests_room_list_chan_parent_class)->finalize;
 
+  if (self->priv->find_rooms_id != 0)
+    g_source_remove (self->priv->find_rooms_id);
+
   g_free (self->priv->server);
 
   if (chain_up != NULL)
@@ -159,13 +173,14 @@ tp_tests_room_list_chan_init (TpTestsRoomListChan *self)
 }
 
 static void
-add_room (GPtrArray *rooms)
+add_room (GPtrArray *rooms,
+    const gchar *name)
 {
   GHashTable *hash;
 
   hash = tp_asv_new (
       "handle-name", G_TYPE_STRING, "the handle name",
-      "name", G_TYPE_STRING, "the name",
+      "name", G_TYPE_STRING, name,
       "description", G_TYPE_STRING, "the description",
       "subject", G_TYPE_STRING, "the subject",
       "members", G_TYPE_UINT, 10,
@@ -190,22 +205,54 @@ find_rooms (gpointer data)
   TpTestsRoomListChan *self = TP_TESTS_ROOM_LIST_CHAN (data);
   GPtrArray *rooms;
 
+  self->priv->find_rooms_id = 0;
+
   rooms = g_ptr_array_new_with_free_func ((GDestroyNotify) tp_value_array_free);
 
   /* Find 2 rooms */
-  add_room (rooms);
-  add_room (rooms);
+  add_room (rooms, "the name");
+  add_room (rooms, "the name");
   tp_svc_channel_type_room_list_emit_got_rooms (self, rooms);
   g_ptr_array_set_size (rooms, 0);
 
   /* Find 1 room */
-  add_room (rooms);
+  add_room (rooms, "the name");
   tp_svc_channel_type_room_list_emit_got_rooms (self, rooms);
   g_ptr_array_unref (rooms);
 
   return FALSE;
 }
 
+static gboolean
+find_many_rooms (gpointer data)
+{
+  TpTestsRoomListChan *self = TP_TESTS_ROOM_LIST_CHAN (data);
+  GPtrArray *rooms;
+  guint i;
+
+  rooms = g_ptr_array_new_with_free_func ((GDestroyNotify) tp_value_array_free);
+
+  for (i = 0; i < MANY_ROOMS_BATCH &&
+      self->priv->n_rooms < self->priv->n_many_rooms; i++)
+    {
+      gchar *name = g_strdup_printf ("room %u", self->priv->n_rooms++);
+
+      add_room (rooms, name);
+      g_free (name);
+    }
+
+  tp_svc_channel_type_room_list_emit_got_rooms (self, rooms);
+  g_ptr_array_unref (rooms);
+
+  if (self->priv->n_rooms < self->priv->n_many_rooms)
+    return TRUE;
+
+  self->priv->find_rooms_id = 0;
+  self->priv->listing = FALSE;
+  tp_svc_channel_type_room_list_emit_listing_rooms (self, FALSE);
+  return FALSE;
+}
+
 static void
 room_list_list_rooms (TpSvcChannelTypeRoomList *chan,
     DBusGMethodInvocation *context)
@@ -233,11 +280,49 @@ room_list_list_rooms (TpSvcChannelTypeRoomList *chan,
   self->priv->listing = TRUE;
   tp_svc_channel_type_room_list_emit_listing_rooms (self, TRUE);
 
-  g_idle_add (find_rooms, self);
+  if (!tp_strdiff (self->priv->server, MANY_ROOMS_SERVER))
+    {
+      self->priv->n_rooms = 0;
+      self->priv->n_many_rooms = TP_TESTS_ROOM_LIST_CHAN_MANY_ROOMS;
+      self->priv->find_rooms_id = g_idle_add (find_many_rooms, self);
+    }
+  else if (self->priv->server != NULL &&
+      g_str_has_prefix (self->priv->server, MANY_ROOMS_SERVER ":"))
+    {
+      self->priv->n_rooms = 0;
+      self->priv->n_many_rooms = g_ascii_strtoull (
+          self->priv->server + strlen (MANY_ROOMS_SERVER ":"), NULL, 10);
+      self->priv->find_rooms_id = g_idle_add (find_many_rooms, self);
+    }
+  else
+    {
+      self->priv->find_rooms_id = g_idle_add (find_rooms, self);
+    }
 
   tp_svc_channel_type_room_list_return_from_list_rooms (context);
 }
 
+static void
+room_list_stop_listing (TpSvcChannelTypeRoomList *chan,
+    DBusGMethodInvocation *context)
+{
+  TpTestsRoomListChan *self = TP_TESTS_ROOM_LIST_CHAN (chan);
+
+  if (self->priv->find_rooms_id != 0)
+    {
+      g_source_remove (self->priv->find_rooms_id);
+      self->priv->find_rooms_id = 0;
+    }
+
+  if (self->priv->listing)
+    {
+      self->priv->listing = FALSE;
+      tp_svc_channel_type_room_list_emit_listing_rooms (self, FALSE);
+    }
+
+  tp_svc_channel_type_room_list_return_from_stop_listing (context);
+}
+
 static void
 room_list_iface_init (gpointer iface,
     gpointer data)
@@ -247,5 +332,6 @@ room_list_iface_init (gpointer iface,
 #define IMPLEMENT(x) \
   tp_svc_channel_type_room_list_implement_##x (klass, room_list_##x)
   IMPLEMENT(list_rooms);
+  IMPLEMENT(stop_listing);
 #undef IMPLEMENT
 }
@@ -23,6 +23,9 @@ struct _TpTestsRoomListChan {
 
 GType tp_tests_room_list_chan_get_type (void);
 
+/* how many rooms are listed on the "ManyRooms" server */
+#define TP_TESTS_ROOM_LIST_CHAN_MANY_ROOMS 20000
+
 /* TYPE MACROS */
 #define TP_TESTS_TYPE_ROOM_LIST_CHAN \
   (tp_tests_room_list_chan_get_type ())
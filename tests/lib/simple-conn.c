@@ -20,6 +20,7 @@
 #include <telepathy-glib/telepathy-glib.h>
 #include <telepathy-glib/telepathy-glib-dbus.h>
 
+#include "contact-search-chan.h"
 #include "textchan-null.h"
 #include "room-list-chan.h"
 #include "util.h"
@@ -61,6 +62,9 @@ struct _TpTestsSimpleConnectionPrivate
   /* TpHandle => reffed TpTestsTextChannelNull */
   GHashTable *text_channels;
   TpTestsRoomListChan *room_list_chan;
+  /* reffed TpTestsContactSearchChan => itself */
+  GHashTable *contact_search_chans;
+  guint n_contact_search_chans;
 
   GError *get_self_handle_error /* initially NULL */ ;
 };
@@ -73,6 +77,8 @@ tp_tests_simple_connection_init (TpTestsSimpleConnection *self)
 
   self->priv->text_channels = g_hash_table_new_full (NULL, NULL, NULL,
       (GDestroyNotify) g_object_unref);
+  self->priv->contact_search_chans = g_hash_table_new_full (NULL, NULL,
+      g_object_unref, NULL);
 }
 
 static void
@@ -135,6 +141,7 @@ dispose (GObject *object)
 
   g_hash_table_unref (self->priv->text_channels);
   g_clear_object (&self->priv->room_list_chan);
+  tp_clear_pointer (&self->priv->contact_search_chans, g_hash_table_unref);
 
   G_OBJECT_CLASS (tp_tests_simple_connection_parent_class)->dispose (object);
 }
@@ -264,6 +271,7 @@ pretend_disconnected (gpointer data)
   /* We are disconnected, all our channels are invalidated */
   g_hash_table_remove_all (self->priv->text_channels);
   g_clear_object (&self->priv->room_list_chan);
+  g_hash_table_remove_all (self->priv->contact_search_chans);
 
   tp_base_connection_finish_shutdown (TP_BASE_CONNECTION (data));
   self->priv->disconnect_source = 0;
@@ -472,6 +480,48 @@ tp_tests_simple_connection_ensure_room_list_chan (TpTestsSimpleConnection *self,
   return chan_path;
 }
 
+static void
+contact_search_chan_closed_cb (TpBaseChannel *channel,
+    TpTestsSimpleConnection *self)
+{
+  g_hash_table_remove (self->priv->contact_search_chans, channel);
+}
+
+/* unlike room lists, every request gets a new channel, because each one
+ * can only be used for one search */
+gchar *
+tp_tests_simple_connection_new_contact_search_chan (
+    TpTestsSimpleConnection *self,
+    const gchar *server,
+    guint limit,
+    GHashTable **props)
+{
+  TpBaseConnection *base_conn = (TpBaseConnection *) self;
+  TpTestsContactSearchChan *chan;
+  gchar *chan_path;
+
+  chan_path = g_strdup_printf ("%s/ContactSearchChannel%u",
+      tp_base_connection_get_object_path (base_conn),
+      self->priv->n_contact_search_chans++);
+
+  chan = tp_tests_object_new_static_class (
+      TP_TESTS_TYPE_CONTACT_SEARCH_CHAN,
+      "connection", self,
+      "object-path", chan_path,
+      "server", server ? server : "",
+      "limit", limit,
+      NULL);
+
+  g_signal_connect (chan, "closed",
+      G_CALLBACK (contact_search_chan_closed_cb), self);
+  g_hash_table_add (self->priv->contact_search_chans, chan);
+
+  if (props != NULL)
+    g_object_get (chan, "channel-properties", props, NULL);
+
+  return chan_path;
+}
+
 void
 tp_tests_simple_connection_set_get_self_handle_error (
     TpTestsSimpleConnection *self,
@@ -77,6 +77,12 @@ gchar * tp_tests_simple_connection_ensure_room_list_chan (
     const gchar *server,
     GHashTable **props);
 
+gchar * tp_tests_simple_connection_new_contact_search_chan (
+    TpTestsSimpleConnection *self,
+    const gchar *server,
+    guint limit,
+    GHashTable **props);
+
 G_END_DECLS
 
 #endif /* #ifndef __TP_TESTS_SIMPLE_CONN_H__ */
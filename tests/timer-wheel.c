@@ -0,0 +1,181 @@
+/* Tests of the per-thread timer wheel
+ *
+ * Copyright © 2026 Collabora Ltd. <http://www.collabora.co.uk/>
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.
+ */
+
+#include "config.h"
+
+#include <glib.h>
+
+#include "telepathy-glib/timer-wheel-internal.h"
+
+typedef struct {
+    TpTimer timer;
+    guint interval;
+    gint64 scheduled_at;
+    gint64 fired_at;
+    guint *n_fired;
+} Timer;
+
+static void
+timer_cb (gpointer user_data)
+{
+  Timer *t = user_data;
+
+  t->fired_at = g_get_monotonic_time ();
+  (*t->n_fired)++;
+}
+
+static void
+schedule (Timer *t,
+    guint interval,
+    guint *n_fired)
+{
+  _tp_timer_init (&t->timer, timer_cb, t);
+  t->interval = interval;
+  t->n_fired = n_fired;
+  t->fired_at = 0;
+  t->scheduled_at = g_get_monotonic_time ();
+  _tp_timer_schedule (&t->timer, interval);
+}
+
+/* Returns the number of main loop iterations that dispatched something
+ * before *n_fired reached @target. Nothing but the wheel is attached to the
+ * default main context, so that's how many times the wheel woke up. */
+static guint
+run_until (guint *n_fired,
+    guint target)
+{
+  guint wakeups = 0;
+
+  while (*n_fired < target)
+    {
+      if (g_main_context_iteration (NULL, TRUE))
+        wakeups++;
+    }
+
+  return wakeups;
+}
+
+static void
+assert_not_early (Timer *t)
+{
+  g_assert (t->fired_at != 0);
+  g_assert_cmpint (t->fired_at - t->scheduled_at, >=,
+      (gint64) t->interval * 1000);
+}
+
+static void
+test_order (void)
+{
+  static const guint intervals[] = { 70, 5, 1000, 5, 64, 0, 300 };
+  Timer timers[G_N_ELEMENTS (intervals)];
+  Timer cancelled;
+  guint n_fired = 0;
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (intervals); i++)
+    schedule (&timers[i], intervals[i], &n_fired);
+
+  schedule (&cancelled, 10, &n_fired);
+  _tp_timer_cancel (&cancelled);
+  g_assert (!_tp_timer_is_scheduled (&cancelled));
+
+  run_until (&n_fired, G_N_ELEMENTS (intervals));
+
+  for (i = 0; i < G_N_ELEMENTS (intervals); i++)
+    {
+      assert_not_early (&timers[i]);
+      g_assert (!_tp_timer_is_scheduled (&timers[i].timer));
+    }
+
+  /* timers were called in order of expiry */
+  g_assert_cmpint (timers[5].fired_at, <=, timers[1].fired_at);
+  g_assert_cmpint (timers[1].fired_at, <=, timers[3].fired_at);
+  g_assert_cmpint (timers[3].fired_at, <=, timers[4].fired_at);
+  g_assert_cmpint (timers[4].fired_at, <=, timers[0].fired_at);
+  g_assert_cmpint (timers[0].fired_at, <=, timers[6].fired_at);
+  g_assert_cmpint (timers[6].fired_at, <=, timers[2].fired_at);
+
+  g_assert_cmpint (cancelled.fired_at, ==, 0);
+}
+
+static void
+test_few_wakeups (void)
+{
+  Timer t;
+  guint n_fired = 0;
+  guint wakeups;
+
+  /* a timer a few seconds away, like the DTMF pause, is in a higher level
+   * of the wheel; it must not make the wheel wake up every time level 0
+   * turns round (which would be about 47 times), only when the timer's
+   * slot needs cascading and when it expires */
+  schedule (&t, 3000, &n_fired);
+  wakeups = run_until (&n_fired, 1);
+
+  assert_not_early (&t);
+  g_assert_cmpuint (wakeups, <=, 3);
+
+  /* the same is true once the wheel has been running for a while */
+  schedule (&t, 3000, &n_fired);
+  wakeups = run_until (&n_fired, 2);
+
+  assert_not_early (&t);
+  g_assert_cmpuint (wakeups, <=, 3);
+}
+
+static gpointer
+bound_thread (gpointer data)
+{
+  GMainContext *context = g_main_context_new ();
+  GMainContext *other = g_main_context_new ();
+  Timer t;
+  guint n_fired = 0;
+
+  g_main_context_push_thread_default (context);
+  _tp_timer_wheel_bind (context);
+
+  /* the wheel stays with the context it was bound to, even while some
+   * other context is temporarily the thread-default */
+  g_main_context_push_thread_default (other);
+  schedule (&t, 10, &n_fired);
+  g_main_context_pop_thread_default (other);
+
+  while (n_fired < 1)
+    g_main_context_iteration (context, TRUE);
+
+  assert_not_early (&t);
+  g_assert (!g_main_context_pending (other));
+
+  _tp_timer_wheel_release ();
+  g_main_context_pop_thread_default (context);
+  g_main_context_unref (other);
+  g_main_context_unref (context);
+  return NULL;
+}
+
+static void
+test_bound (void)
+{
+  GThread *thread = g_thread_new ("bound", bound_thread, NULL);
+
+  g_thread_join (thread);
+}
+
+int
+main (int argc,
+    char **argv)
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/timer-wheel/order", test_order);
+  g_test_add_func ("/timer-wheel/few-wakeups", test_few_wakeups);
+  g_test_add_func ("/timer-wheel/bound", test_bound);
+
+  return g_test_run ();
+}
@@ -34,6 +34,15 @@ from libglibcodegen import (Signature, type_to_gtype,
 
 NS_TP = "http://telepathy.freedesktop.org/wiki/DbusSpec#extensions-v0"
 
+# Sorts after any released version, so that --tp-proxy-api=0.UNRELEASED
+# can be used for API that is not in a release yet; the UNRELEASED is
+# replaced by the real version number when it is released.
+UNRELEASED = float('inf')
+
+def parse_version(s):
+    return tuple([v == 'UNRELEASED' and UNRELEASED or int(v)
+                  for v in s.split('.')])
+
 class Generator(object):
 
     def __init__(self, dom, prefix, basename, opts):
@@ -48,8 +57,7 @@ class Generator(object):
         self.basename = basename
         self.group = opts.get('--group', None)
         self.iface_quark_prefix = opts.get('--iface-quark-prefix', None)
-        self.tp_proxy_api = tuple(map(int,
-                opts.get('--tp-proxy-api', '0').split('.')))
+        self.tp_proxy_api = parse_version(opts.get('--tp-proxy-api', '0'))
         self.proxy_cls = opts.get('--subclass', 'TpProxy') + ' *'
         self.proxy_arg = opts.get('--subclass', 'void') + ' *'
         self.proxy_assert = opts.get('--subclass-assert', 'TP_IS_PROXY')
@@ -58,37 +66,533 @@ class Generator(object):
         if self.proxy_arg == 'void *':
             self.proxy_arg = 'gpointer '
 
-        self.reentrant_symbols = set()
-        try:
-            filename = opts['--generate-reentrant']
-            with open(filename, 'r') as f:
-                for line in f.readlines():
-                    self.reentrant_symbols.add(line.strip())
-        except KeyError:
-            pass
+        self.reentrant_symbols = set()
+        try:
+            filename = opts['--generate-reentrant']
+            with open(filename, 'r') as f:
+                for line in f.readlines():
+                    self.reentrant_symbols.add(line.strip())
+        except KeyError:
+            pass
+
+        self.deprecate_reentrant = opts.get('--deprecate-reentrant', None)
+        self.deprecation_attribute = opts.get('--deprecation-attribute',
+                'G_GNUC_DEPRECATED')
+
+        self.guard = opts.get('--guard', None)
+
+        # Since 0.UNRELEASED, TpProxy can pass the results of method calls
+        # and signals around as an opaque structure, so we collect them into
+        # one of those, with a member of the right C type per argument,
+        # instead of boxing each of them into a GValueArray
+        self.typed_results = (self.tp_proxy_api >= (0, UNRELEASED))
+
+        # the version of tp_proxy_pending_call_*_new() and
+        # tp_proxy_signal_connection_*_new() to use
+        self.proxy_abi = self.typed_results and 'v1' or 'v0'
+
+    def h(self, s):
+        self.__header.append(s)
+
+    def b(self, s):
+        self.__body.append(s)
+
+    def d(self, s):
+        self.__docs.append(s)
+
+    def get_iface_quark(self):
+        assert self.iface_dbus is not None
+        assert self.iface_uc is not None
+        if self.iface_quark_prefix is None:
+            return 'g_quark_from_static_string (\"%s\")' % self.iface_dbus
+        else:
+            return '%s_%s' % (self.iface_quark_prefix, self.iface_uc)
+
+    def do_results_struct(self, struct_name, free_name, args):
+        # A structure with one member per argument, and a function to free
+        # it, for TpProxyInvokeResultsFunc. Members are owned by the
+        # structure, and might be NULL if a method call failed.
+        self.b('typedef struct {')
+
+        for arg in args:
+            name, info, tp_type, elt = arg
+            ctype, gtype, marshaller, pointer = info
+
+            self.b('    %s%s;' % (ctype, name))
+
+        self.b('} %s;' % struct_name)
+        self.b('')
+        self.b('static void')
+        self.b('%s (gpointer p)' % free_name)
+        self.b('{')
+        self.b('  %s *results = p;' % struct_name)
+        self.b('')
+
+        for arg in args:
+            name, info, tp_type, elt = arg
+            ctype, gtype, marshaller, pointer = info
+
+            if gtype == 'G_TYPE_VALUE':
+                # dbus-glib doesn't initialize it if the call fails
+                self.b('  if (results->%s != NULL)' % name)
+                self.b('    {')
+                self.b('      if (G_IS_VALUE (results->%s))' % name)
+                self.b('        g_value_unset (results->%s);' % name)
+                self.b('')
+                self.b('      g_free (results->%s);' % name)
+                self.b('    }')
+                self.b('')
+            elif marshaller == 'BOXED':
+                self.b('  if (results->%s != NULL)' % name)
+                self.b('    g_boxed_free (%s, results->%s);' % (gtype, name))
+                self.b('')
+            elif marshaller == 'STRING':
+                self.b('  g_free (results->%s);' % name)
+                self.b('')
+
+        self.b('  g_slice_free (%s, results);' % struct_name)
+        self.b('}')
+        self.b('')
+
+    def do_callback_args(self, struct_var, args, indent):
+        # Pass each member of a results structure to a callback
+        for arg in args:
+            name, info, tp_type, elt = arg
+
+            self.b('%s%s->%s,' % (indent, struct_var, name))
+
+    def do_signal_typed(self, args, callback_name, collect_name,
+            invoke_name, struct_name, free_name):
+        if args:
+            self.do_results_struct(struct_name, free_name, args)
+
+            # dbus-glib owns the arguments, so we have to copy them, but
+            # only once per signal, however many signal connections there are
+            self.b('static void')
+            self.b('%s (DBusGProxy *proxy G_GNUC_UNUSED,' % collect_name)
+
+            for arg in args:
+                name, info, tp_type, elt = arg
+                ctype, gtype, marshaller, pointer = info
+
+                const = pointer and 'const ' or ''
+
+                self.b('    %s%s%s,' % (const, ctype, name))
+
+            self.b('    TpProxySignalConnection *sc)')
+            self.b('{')
+            self.b('  %s *args = g_slice_new (%s);'
+                   % (struct_name, struct_name))
+            self.b('')
+
+            for arg in args:
+                name, info, tp_type, elt = arg
+                ctype, gtype, marshaller, pointer = info
+
+                if marshaller == 'BOXED':
+                    self.b('  args->%s = g_boxed_copy (%s, %s);'
+                           % (name, gtype, name))
+                elif marshaller == 'STRING':
+                    self.b('  args->%s = g_strdup (%s);' % (name, name))
+                else:
+                    self.b('  args->%s = %s;' % (name, name))
+
+            self.b('')
+            self.b('  tp_proxy_signal_connection_v1_take_results (sc, args,')
+            self.b('      %s);' % free_name)
+            self.b('}')
+
+        self.b('static void')
+        self.b('%s (TpProxy *tpproxy,' % invoke_name)
+        self.b('    const GError *error G_GNUC_UNUSED,')
+
+        if args:
+            self.b('    gconstpointer results,')
+        else:
+            self.b('    gconstpointer results G_GNUC_UNUSED,')
+
+        self.b('    GCallback generic_callback,')
+        self.b('    gpointer user_data,')
+        self.b('    GObject *weak_object)')
+        self.b('{')
+
+        if args:
+            self.b('  const %s *args = results;' % struct_name)
+
+        self.b('  %s callback =' % callback_name)
+        self.b('      (%s) generic_callback;' % callback_name)
+        self.b('')
+        self.b('  if (callback != NULL)')
+        self.b('    callback (g_object_ref (tpproxy),')
+        self.do_callback_args('args', args, '      ')
+        self.b('      user_data,')
+        self.b('      weak_object);')
+        self.b('')
+        self.b('  g_object_unref (tpproxy);')
+        self.b('}')
+
+    def do_method_typed(self, out_args, callback_name, collect_callback,
+            invoke_callback, struct_name, free_name):
+        if out_args:
+            self.do_results_struct(struct_name, free_name, out_args)
+
+        # The callback called by dbus-glib; this ends the call and collects
+        # the results directly into their structure.
+        self.b('static void')
+        self.b('%s (DBusGProxy *proxy,' % collect_callback)
+        self.b('    DBusGProxyCall *call,')
+        self.b('    gpointer user_data)')
+        self.b('{')
+        self.b('  GError *error = NULL;')
+
+        if out_args:
+            self.b('  %s *results = g_slice_new0 (%s);'
+                   % (struct_name, struct_name))
+
+            for arg in out_args:
+                name, info, tp_type, elt = arg
+                ctype, gtype, marshaller, pointer = info
+
+                # "We handle variants specially; the caller is expected to
+                # have already allocated storage for them". Thanks,
+                # dbus-glib...
+                if gtype == 'G_TYPE_VALUE':
+                    self.b('')
+                    self.b('  results->%s = g_new0 (GValue, 1);' % name)
+
+        self.b('')
+        self.b('  dbus_g_proxy_end_call (proxy, call, &error,')
+
+        for arg in out_args:
+            name, info, tp_type, elt = arg
+            ctype, gtype, marshaller, pointer = info
+
+            if gtype == 'G_TYPE_VALUE':
+                self.b('      %s, results->%s,' % (gtype, name))
+            else:
+                self.b('      %s, &results->%s,' % (gtype, name))
+
+        self.b('      G_TYPE_INVALID);')
+
+        if out_args:
+            self.b('')
+            self.b('  if (error != NULL)')
+            self.b('    {')
+            self.b('      %s (results);' % free_name)
+            self.b('      tp_proxy_pending_call_v1_take_results (user_data, '
+                   'error,')
+            self.b('          NULL, NULL);')
+            self.b('      return;')
+            self.b('    }')
+            self.b('')
+            self.b('  tp_proxy_pending_call_v1_take_results (user_data, NULL,')
+            self.b('      results, %s);' % free_name)
+        else:
+            self.b('  tp_proxy_pending_call_v1_take_results (user_data, error,')
+            self.b('      NULL, NULL);')
+
+        self.b('}')
+
+        self.b('static void')
+        self.b('%s (TpProxy *self,' % invoke_callback)
+        self.b('    const GError *error,')
+
+        if out_args:
+            self.b('    gconstpointer p,')
+        else:
+            self.b('    gconstpointer p G_GNUC_UNUSED,')
+
+        self.b('    GCallback generic_callback,')
+        self.b('    gpointer user_data,')
+        self.b('    GObject *weak_object)')
+        self.b('{')
+        self.b('  %s callback = (%s) generic_callback;'
+               % (callback_name, callback_name))
+
+        if out_args:
+            self.b('  const %s *results = p;' % struct_name)
+            self.b('')
+            self.b('  if (error != NULL)')
+            self.b('    {')
+            self.b('      callback ((%s) self,' % self.proxy_cls)
+
+            for arg in out_args:
+                name, info, tp_type, elt = arg
+                ctype, gtype, marshaller, pointer = info
+
+                if marshaller == 'BOXED' or pointer:
+                    self.b('          NULL,')
+                elif gtype == 'G_TYPE_DOUBLE':
+                    self.b('          0.0,')
+                else:
+                    self.b('          0,')
+
+            self.b('          error, user_data, weak_object);')
+            self.b('      return;')
+            self.b('    }')
+
+        self.b('')
+        self.b('  callback ((%s) self,' % self.proxy_cls)
+        self.do_callback_args('results', out_args, '      ')
+        self.b('      error, user_data, weak_object);')
+        self.b('}')
+        self.b('')
+
+    def do_signal_boxed(self, args, callback_name, collect_name,
+            invoke_name):
+        if args:
+            self.b('static void')
+            self.b('%s (DBusGProxy *proxy G_GNUC_UNUSED,' % collect_name)
+
+            for arg in args:
+                name, info, tp_type, elt = arg
+                ctype, gtype, marshaller, pointer = info
+
+                const = pointer and 'const ' or ''
+
+                self.b('    %s%s%s,' % (const, ctype, name))
+
+            self.b('    TpProxySignalConnection *sc)')
+            self.b('{')
+            self.b('  G_GNUC_BEGIN_IGNORE_DEPRECATIONS')
+            self.b('  GValueArray *args = g_value_array_new (%d);' % len(args))
+            self.b('  GValue blank = { 0 };')
+            self.b('  guint i;')
+            self.b('')
+            self.b('  g_value_init (&blank, G_TYPE_INT);')
+            self.b('')
+            self.b('  for (i = 0; i < %d; i++)' % len(args))
+            self.b('    g_value_array_append (args, &blank);')
+            self.b('  G_GNUC_END_IGNORE_DEPRECATIONS')
+            self.b('')
+
+            for i, arg in enumerate(args):
+                name, info, tp_type, elt = arg
+                ctype, gtype, marshaller, pointer = info
+
+                self.b('  g_value_unset (args->values + %d);' % i)
+                self.b('  g_value_init (args->values + %d, %s);' % (i, gtype))
+
+                self.b('  ' + copy_into_gvalue('args->values + %d' % i,
+                    gtype, marshaller, name))
+                self.b('')
+
+            self.b('  tp_proxy_signal_connection_v0_take_results (sc, args);')
+            self.b('}')
+
+        self.b('static void')
+        self.b('%s (TpProxy *tpproxy,' % invoke_name)
+        self.b('    GError *error G_GNUC_UNUSED,')
+        self.b('    GValueArray *args,')
+        self.b('    GCallback generic_callback,')
+        self.b('    gpointer user_data,')
+        self.b('    GObject *weak_object)')
+        self.b('{')
+        self.b('  %s callback =' % callback_name)
+        self.b('      (%s) generic_callback;' % callback_name)
+        self.b('')
+        self.b('  if (callback != NULL)')
+        self.b('    callback (g_object_ref (tpproxy),')
+
+        # FIXME: factor out into a function
+        for i, arg in enumerate(args):
+            name, info, tp_type, elt = arg
+            ctype, gtype, marshaller, pointer = info
+
+            if marshaller == 'BOXED':
+                self.b('      g_value_get_boxed (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_STRING':
+                self.b('      g_value_get_string (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_UCHAR':
+                self.b('      g_value_get_uchar (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_BOOLEAN':
+                self.b('      g_value_get_boolean (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_UINT':
+                self.b('      g_value_get_uint (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_INT':
+                self.b('      g_value_get_int (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_UINT64':
+                self.b('      g_value_get_uint64 (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_INT64':
+                self.b('      g_value_get_int64 (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_DOUBLE':
+                self.b('      g_value_get_double (args->values + %d),' % i)
+            else:
+                assert False, "Don't know how to get %s from a GValue" % gtype
+
+        self.b('      user_data,')
+        self.b('      weak_object);')
+        self.b('')
+
+        self.b('  G_GNUC_BEGIN_IGNORE_DEPRECATIONS')
+        if len(args) > 0:
+            self.b('  g_value_array_free (args);')
+        else:
+            self.b('  if (args != NULL)')
+            self.b('    g_value_array_free (args);')
+            self.b('')
+        self.b('  G_GNUC_END_IGNORE_DEPRECATIONS')
+
+        self.b('  g_object_unref (tpproxy);')
+        self.b('}')
+
+    def do_method_boxed(self, out_args, callback_name, collect_callback,
+            invoke_callback):
+        # The callback called by dbus-glib; this ends the call and collects
+        # the results into a GValueArray.
+        self.b('static void')
+        self.b('%s (DBusGProxy *proxy,' % collect_callback)
+        self.b('    DBusGProxyCall *call,')
+        self.b('    gpointer user_data)')
+        self.b('{')
+        self.b('  GError *error = NULL;')
+
+        if len(out_args) > 0:
+            self.b('  GValueArray *args;')
+            self.b('  GValue blank = { 0 };')
+            self.b('  guint i;')
+
+            for arg in out_args:
+                name, info, tp_type, elt = arg
+                ctype, gtype, marshaller, pointer = info
+
+                # "We handle variants specially; the caller is expected to
+                # have already allocated storage for them". Thanks,
+                # dbus-glib...
+                if gtype == 'G_TYPE_VALUE':
+                    self.b('  GValue *%s = g_new0 (GValue, 1);' % name)
+                else:
+                    self.b('  %s%s;' % (ctype, name))
+
+        self.b('')
+        self.b('  dbus_g_proxy_end_call (proxy, call, &error,')
+
+        for arg in out_args:
+            name, info, tp_type, elt = arg
+            ctype, gtype, marshaller, pointer = info
+
+            if gtype == 'G_TYPE_VALUE':
+                self.b('      %s, %s,' % (gtype, name))
+            else:
+                self.b('      %s, &%s,' % (gtype, name))
+
+        self.b('      G_TYPE_INVALID);')
+
+        if len(out_args) == 0:
+            self.b('  tp_proxy_pending_call_v0_take_results (user_data, error,'
+                   'NULL);')
+        else:
+            self.b('')
+            self.b('  if (error != NULL)')
+            self.b('    {')
+            self.b('      tp_proxy_pending_call_v0_take_results (user_data, error,')
+            self.b('          NULL);')
+
+            for arg in out_args:
+                name, info, tp_type, elt = arg
+                ctype, gtype, marshaller, pointer = info
+                if gtype == 'G_TYPE_VALUE':
+                    self.b('      g_free (%s);' % name)
+
+            self.b('      return;')
+            self.b('    }')
+            self.b('')
+            self.b('  G_GNUC_BEGIN_IGNORE_DEPRECATIONS')
+            self.b('  args = g_value_array_new (%d);' % len(out_args))
+            self.b('  g_value_init (&blank, G_TYPE_INT);')
+            self.b('')
+            self.b('  for (i = 0; i < %d; i++)' % len(out_args))
+            self.b('    g_value_array_append (args, &blank);')
+            self.b('  G_GNUC_END_IGNORE_DEPRECATIONS')
+
+            for i, arg in enumerate(out_args):
+                name, info, tp_type, elt = arg
+                ctype, gtype, marshaller, pointer = info
+
+                self.b('')
+                self.b('  g_value_unset (args->values + %d);' % i)
+                self.b('  g_value_init (args->values + %d, %s);' % (i, gtype))
+
+                self.b('  ' + move_into_gvalue('args->values + %d' % i,
+                    gtype, marshaller, name))
+
+            self.b('  tp_proxy_pending_call_v0_take_results (user_data, '
+                   'NULL, args);')
+
+        self.b('}')
+
+        self.b('static void')
+        self.b('%s (TpProxy *self,' % invoke_callback)
+        self.b('    GError *error,')
+        self.b('    GValueArray *args,')
+        self.b('    GCallback generic_callback,')
+        self.b('    gpointer user_data,')
+        self.b('    GObject *weak_object)')
+        self.b('{')
+        self.b('  %s callback = (%s) generic_callback;'
+               % (callback_name, callback_name))
+        self.b('')
+        self.b('  if (error != NULL)')
+        self.b('    {')
+        self.b('      callback ((%s) self,' % self.proxy_cls)
+
+        for arg in out_args:
+            name, info, tp_type, elt = arg
+            ctype, gtype, marshaller, pointer = info
+
+            if marshaller == 'BOXED' or pointer:
+                self.b('          NULL,')
+            elif gtype == 'G_TYPE_DOUBLE':
+                self.b('          0.0,')
+            else:
+                self.b('          0,')
 
-        self.deprecate_reentrant = opts.get('--deprecate-reentrant', None)
-        self.deprecation_attribute = opts.get('--deprecation-attribute',
-                'G_GNUC_DEPRECATED')
+        self.b('          error, user_data, weak_object);')
+        self.b('      g_error_free (error);')
+        self.b('      return;')
+        self.b('    }')
 
-        self.guard = opts.get('--guard', None)
+        self.b('  callback ((%s) self,' % self.proxy_cls)
 
-    def h(self, s):
-        self.__header.append(s)
+        # FIXME: factor out into a function
+        for i, arg in enumerate(out_args):
+            name, info, tp_type, elt = arg
+            ctype, gtype, marshaller, pointer = info
 
-    def b(self, s):
-        self.__body.append(s)
+            if marshaller == 'BOXED':
+                self.b('      g_value_get_boxed (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_STRING':
+                self.b('      g_value_get_string (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_UCHAR':
+                self.b('      g_value_get_uchar (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_BOOLEAN':
+                self.b('      g_value_get_boolean (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_UINT':
+                self.b('      g_value_get_uint (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_INT':
+                self.b('      g_value_get_int (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_UINT64':
+                self.b('      g_value_get_uint64 (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_INT64':
+                self.b('      g_value_get_int64 (args->values + %d),' % i)
+            elif gtype == 'G_TYPE_DOUBLE':
+                self.b('      g_value_get_double (args->values + %d),' % i)
+            else:
+                assert False, "Don't know how to get %s from a GValue" % gtype
 
-    def d(self, s):
-        self.__docs.append(s)
+        self.b('      error, user_data, weak_object);')
+        self.b('')
 
-    def get_iface_quark(self):
-        assert self.iface_dbus is not None
-        assert self.iface_uc is not None
-        if self.iface_quark_prefix is None:
-            return 'g_quark_from_static_string (\"%s\")' % self.iface_dbus
+        self.b('  G_GNUC_BEGIN_IGNORE_DEPRECATIONS')
+        if len(out_args) > 0:
+            self.b('  g_value_array_free (args);')
         else:
-            return '%s_%s' % (self.iface_quark_prefix, self.iface_uc)
+            self.b('  if (args != NULL)')
+            self.b('    g_value_array_free (args);')
+        self.b('  G_GNUC_END_IGNORE_DEPRECATIONS')
+
+        self.b('}')
+        self.b('')
 
     def do_signal(self, iface, signal):
         iface_lc = iface.lower()
@@ -125,6 +629,10 @@ class Generator(object):
                         % (self.prefix_lc, iface_lc, member_lc))
         invoke_name = ('_%s_%s_invoke_callback_for_%s'
                        % (self.prefix_lc, iface_lc, member_lc))
+        struct_name = ('_%s_%s_args_of_%s'
+                       % (self.prefix_lc, iface_lc, member_lc))
+        free_name = ('_%s_%s_free_args_of_%s'
+                     % (self.prefix_lc, iface_lc, member_lc))
 
         # Example:
         #
@@ -172,101 +680,12 @@ class Generator(object):
 
         self.h('    gpointer user_data, GObject *weak_object);')
 
-        if args:
-            self.b('static void')
-            self.b('%s (DBusGProxy *proxy G_GNUC_UNUSED,' % collect_name)
-
-            for arg in args:
-                name, info, tp_type, elt = arg
-                ctype, gtype, marshaller, pointer = info
-
-                const = pointer and 'const ' or ''
-
-                self.b('    %s%s%s,' % (const, ctype, name))
-
-            self.b('    TpProxySignalConnection *sc)')
-            self.b('{')
-            self.b('  G_GNUC_BEGIN_IGNORE_DEPRECATIONS')
-            self.b('  GValueArray *args = g_value_array_new (%d);' % len(args))
-            self.b('  GValue blank = { 0 };')
-            self.b('  guint i;')
-            self.b('')
-            self.b('  g_value_init (&blank, G_TYPE_INT);')
-            self.b('')
-            self.b('  for (i = 0; i < %d; i++)' % len(args))
-            self.b('    g_value_array_append (args, &blank);')
-            self.b('  G_GNUC_END_IGNORE_DEPRECATIONS')
-            self.b('')
-
-            for i, arg in enumerate(args):
-                name, info, tp_type, elt = arg
-                ctype, gtype, marshaller, pointer = info
-
-                self.b('  g_value_unset (args->values + %d);' % i)
-                self.b('  g_value_init (args->values + %d, %s);' % (i, gtype))
-
-                self.b('  ' + copy_into_gvalue('args->values + %d' % i,
-                    gtype, marshaller, name))
-                self.b('')
-
-            self.b('  tp_proxy_signal_connection_v0_take_results (sc, args);')
-            self.b('}')
-
-        self.b('static void')
-        self.b('%s (TpProxy *tpproxy,' % invoke_name)
-        self.b('    GError *error G_GNUC_UNUSED,')
-        self.b('    GValueArray *args,')
-        self.b('    GCallback generic_callback,')
-        self.b('    gpointer user_data,')
-        self.b('    GObject *weak_object)')
-        self.b('{')
-        self.b('  %s callback =' % callback_name)
-        self.b('      (%s) generic_callback;' % callback_name)
-        self.b('')
-        self.b('  if (callback != NULL)')
-        self.b('    callback (g_object_ref (tpproxy),')
-
-        # FIXME: factor out into a function
-        for i, arg in enumerate(args):
-            name, info, tp_type, elt = arg
-            ctype, gtype, marshaller, pointer = info
-
-            if marshaller == 'BOXED':
-                self.b('      g_value_get_boxed (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_STRING':
-                self.b('      g_value_get_string (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_UCHAR':
-                self.b('      g_value_get_uchar (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_BOOLEAN':
-                self.b('      g_value_get_boolean (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_UINT':
-                self.b('      g_value_get_uint (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_INT':
-                self.b('      g_value_get_int (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_UINT64':
-                self.b('      g_value_get_uint64 (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_INT64':
-                self.b('      g_value_get_int64 (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_DOUBLE':
-                self.b('      g_value_get_double (args->values + %d),' % i)
-            else:
-                assert False, "Don't know how to get %s from a GValue" % gtype
-
-        self.b('      user_data,')
-        self.b('      weak_object);')
-        self.b('')
-
-        self.b('  G_GNUC_BEGIN_IGNORE_DEPRECATIONS')
-        if len(args) > 0:
-            self.b('  g_value_array_free (args);')
+        if self.typed_results:
+            self.do_signal_typed(args, callback_name, collect_name,
+                    invoke_name, struct_name, free_name)
         else:
-            self.b('  if (args != NULL)')
-            self.b('    g_value_array_free (args);')
-            self.b('')
-        self.b('  G_GNUC_END_IGNORE_DEPRECATIONS')
-
-        self.b('  g_object_unref (tpproxy);')
-        self.b('}')
+            self.do_signal_boxed(args, callback_name, collect_name,
+                    invoke_name)
 
         # Example:
         #
@@ -342,7 +761,8 @@ class Generator(object):
                % self.proxy_assert)
         self.b('  g_return_val_if_fail (callback != NULL, NULL);')
         self.b('')
-        self.b('  return tp_proxy_signal_connection_v0_new ((TpProxy *) proxy,')
+        self.b('  return tp_proxy_signal_connection_%s_new ((TpProxy *) proxy,'
+               % self.proxy_abi)
         self.b('      %s, \"%s\",' % (self.get_iface_quark(), member))
         self.b('      expected_types,')
 
@@ -404,227 +824,85 @@ class Generator(object):
         # void (*tp_cli_properties_interface_callback_for_get_properties)
         #   (TpProxy *proxy,
         #       const GPtrArray *out0,
-        #       const GError *error,
-        #       gpointer user_data,
-        #       GObject *weak_object);
-
-        self.d('/**')
-        self.d(' * %s_%s_callback_for_%s:'
-               % (self.prefix_lc, iface_lc, member_lc))
-        self.d(' * @proxy: the proxy on which the call was made')
-
-        for arg in out_args:
-            name, info, tp_type, elt = arg
-            ctype, gtype, marshaller, pointer = info
-
-            docs = xml_escape(get_docstring(elt) or '(Undocumented)')
-
-            if ctype == 'guint ' and tp_type != '':
-                docs +=  ' (#%s)' % ('Tp' + tp_type.replace('_', ''))
-
-            self.d(' * @%s: Used to return an \'out\' argument if @error is '
-                   '%%NULL: %s'
-                   % (name, docs))
-
-        self.d(' * @error: %NULL on success, or an error on failure')
-        self.d(' * @user_data: user-supplied data')
-        self.d(' * @weak_object: user-supplied object')
-        self.d(' *')
-        self.d(' * Signature of the callback called when a %s method call'
-               % member)
-        self.d(' * succeeds or fails.')
-
-        deprecated = method.getElementsByTagName('tp:deprecated')
-        if deprecated:
-            d = deprecated[0]
-            self.d(' *')
-            self.d(' * Deprecated: %s' % xml_escape(get_deprecated(d)))
-
-        self.d(' */')
-        self.d('')
-
-        callback_name = '%s_%s_callback_for_%s' % (self.prefix_lc, iface_lc,
-                                                   member_lc)
-
-        self.h('typedef void (*%s) (%sproxy,'
-               % (callback_name, self.proxy_cls))
-
-        for arg in out_args:
-            name, info, tp_type, elt = arg
-            ctype, gtype, marshaller, pointer = info
-            const = pointer and 'const ' or ''
-
-            self.h('    %s%s%s,' % (const, ctype, name))
-
-        self.h('    const GError *error, gpointer user_data,')
-        self.h('    GObject *weak_object);')
-        self.h('')
-
-        # Async callback implementation
-
-        invoke_callback = '_%s_%s_invoke_callback_%s' % (self.prefix_lc,
-                                                         iface_lc,
-                                                         member_lc)
-
-        collect_callback = '_%s_%s_collect_callback_%s' % (self.prefix_lc,
-                                                           iface_lc,
-                                                           member_lc)
-
-        # The callback called by dbus-glib; this ends the call and collects
-        # the results into a GValueArray.
-        self.b('static void')
-        self.b('%s (DBusGProxy *proxy,' % collect_callback)
-        self.b('    DBusGProxyCall *call,')
-        self.b('    gpointer user_data)')
-        self.b('{')
-        self.b('  GError *error = NULL;')
-
-        if len(out_args) > 0:
-            self.b('  GValueArray *args;')
-            self.b('  GValue blank = { 0 };')
-            self.b('  guint i;')
-
-            for arg in out_args:
-                name, info, tp_type, elt = arg
-                ctype, gtype, marshaller, pointer = info
-
-                # "We handle variants specially; the caller is expected to
-                # have already allocated storage for them". Thanks,
-                # dbus-glib...
-                if gtype == 'G_TYPE_VALUE':
-                    self.b('  GValue *%s = g_new0 (GValue, 1);' % name)
-                else:
-                    self.b('  %s%s;' % (ctype, name))
+        #       const GError *error,
+        #       gpointer user_data,
+        #       GObject *weak_object);
 
-        self.b('')
-        self.b('  dbus_g_proxy_end_call (proxy, call, &error,')
+        self.d('/**')
+        self.d(' * %s_%s_callback_for_%s:'
+               % (self.prefix_lc, iface_lc, member_lc))
+        self.d(' * @proxy: the proxy on which the call was made')
 
         for arg in out_args:
             name, info, tp_type, elt = arg
             ctype, gtype, marshaller, pointer = info
 
-            if gtype == 'G_TYPE_VALUE':
-                self.b('      %s, %s,' % (gtype, name))
-            else:
-                self.b('      %s, &%s,' % (gtype, name))
-
-        self.b('      G_TYPE_INVALID);')
-
-        if len(out_args) == 0:
-            self.b('  tp_proxy_pending_call_v0_take_results (user_data, error,'
-                   'NULL);')
-        else:
-            self.b('')
-            self.b('  if (error != NULL)')
-            self.b('    {')
-            self.b('      tp_proxy_pending_call_v0_take_results (user_data, error,')
-            self.b('          NULL);')
-
-            for arg in out_args:
-                name, info, tp_type, elt = arg
-                ctype, gtype, marshaller, pointer = info
-                if gtype == 'G_TYPE_VALUE':
-                    self.b('      g_free (%s);' % name)
+            docs = xml_escape(get_docstring(elt) or '(Undocumented)')
 
-            self.b('      return;')
-            self.b('    }')
-            self.b('')
-            self.b('  G_GNUC_BEGIN_IGNORE_DEPRECATIONS')
-            self.b('  args = g_value_array_new (%d);' % len(out_args))
-            self.b('  g_value_init (&blank, G_TYPE_INT);')
-            self.b('')
-            self.b('  for (i = 0; i < %d; i++)' % len(out_args))
-            self.b('    g_value_array_append (args, &blank);')
-            self.b('  G_GNUC_END_IGNORE_DEPRECATIONS')
+            if ctype == 'guint ' and tp_type != '':
+                docs +=  ' (#%s)' % ('Tp' + tp_type.replace('_', ''))
 
-            for i, arg in enumerate(out_args):
-                name, info, tp_type, elt = arg
-                ctype, gtype, marshaller, pointer = info
+            self.d(' * @%s: Used to return an \'out\' argument if @error is '
+                   '%%NULL: %s'
+                   % (name, docs))
 
-                self.b('')
-                self.b('  g_value_unset (args->values + %d);' % i)
-                self.b('  g_value_init (args->values + %d, %s);' % (i, gtype))
+        self.d(' * @error: %NULL on success, or an error on failure')
+        self.d(' * @user_data: user-supplied data')
+        self.d(' * @weak_object: user-supplied object')
+        self.d(' *')
+        self.d(' * Signature of the callback called when a %s method call'
+               % member)
+        self.d(' * succeeds or fails.')
 
-                self.b('  ' + move_into_gvalue('args->values + %d' % i,
-                    gtype, marshaller, name))
+        deprecated = method.getElementsByTagName('tp:deprecated')
+        if deprecated:
+            d = deprecated[0]
+            self.d(' *')
+            self.d(' * Deprecated: %s' % xml_escape(get_deprecated(d)))
 
-            self.b('  tp_proxy_pending_call_v0_take_results (user_data, '
-                   'NULL, args);')
+        self.d(' */')
+        self.d('')
 
-        self.b('}')
+        callback_name = '%s_%s_callback_for_%s' % (self.prefix_lc, iface_lc,
+                                                   member_lc)
 
-        self.b('static void')
-        self.b('%s (TpProxy *self,' % invoke_callback)
-        self.b('    GError *error,')
-        self.b('    GValueArray *args,')
-        self.b('    GCallback generic_callback,')
-        self.b('    gpointer user_data,')
-        self.b('    GObject *weak_object)')
-        self.b('{')
-        self.b('  %s callback = (%s) generic_callback;'
-               % (callback_name, callback_name))
-        self.b('')
-        self.b('  if (error != NULL)')
-        self.b('    {')
-        self.b('      callback ((%s) self,' % self.proxy_cls)
+        self.h('typedef void (*%s) (%sproxy,'
+               % (callback_name, self.proxy_cls))
 
         for arg in out_args:
             name, info, tp_type, elt = arg
             ctype, gtype, marshaller, pointer = info
+            const = pointer and 'const ' or ''
 
-            if marshaller == 'BOXED' or pointer:
-                self.b('          NULL,')
-            elif gtype == 'G_TYPE_DOUBLE':
-                self.b('          0.0,')
-            else:
-                self.b('          0,')
+            self.h('    %s%s%s,' % (const, ctype, name))
 
-        self.b('          error, user_data, weak_object);')
-        self.b('      g_error_free (error);')
-        self.b('      return;')
-        self.b('    }')
+        self.h('    const GError *error, gpointer user_data,')
+        self.h('    GObject *weak_object);')
+        self.h('')
 
-        self.b('  callback ((%s) self,' % self.proxy_cls)
+        # Async callback implementation
 
-        # FIXME: factor out into a function
-        for i, arg in enumerate(out_args):
-            name, info, tp_type, elt = arg
-            ctype, gtype, marshaller, pointer = info
+        invoke_callback = '_%s_%s_invoke_callback_%s' % (self.prefix_lc,
+                                                         iface_lc,
+                                                         member_lc)
 
-            if marshaller == 'BOXED':
-                self.b('      g_value_get_boxed (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_STRING':
-                self.b('      g_value_get_string (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_UCHAR':
-                self.b('      g_value_get_uchar (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_BOOLEAN':
-                self.b('      g_value_get_boolean (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_UINT':
-                self.b('      g_value_get_uint (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_INT':
-                self.b('      g_value_get_int (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_UINT64':
-                self.b('      g_value_get_uint64 (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_INT64':
-                self.b('      g_value_get_int64 (args->values + %d),' % i)
-            elif gtype == 'G_TYPE_DOUBLE':
-                self.b('      g_value_get_double (args->values + %d),' % i)
-            else:
-                assert False, "Don't know how to get %s from a GValue" % gtype
+        collect_callback = '_%s_%s_collect_callback_%s' % (self.prefix_lc,
+                                                           iface_lc,
+                                                           member_lc)
 
-        self.b('      error, user_data, weak_object);')
-        self.b('')
+        struct_name = '_%s_%s_results_of_%s' % (self.prefix_lc,
+                                                 iface_lc, member_lc)
+        free_name = '_%s_%s_free_results_of_%s' % (self.prefix_lc,
+                                                   iface_lc,
+                                                   member_lc)
 
-        self.b('  G_GNUC_BEGIN_IGNORE_DEPRECATIONS')
-        if len(out_args) > 0:
-            self.b('  g_value_array_free (args);')
+        if self.typed_results:
+            self.do_method_typed(out_args, callback_name,
+                    collect_callback, invoke_callback, struct_name,
+                    free_name)
         else:
-            self.b('  if (args != NULL)')
-            self.b('    g_value_array_free (args);')
-        self.b('  G_GNUC_END_IGNORE_DEPRECATIONS')
-
-        self.b('}')
-        self.b('')
+            self.do_method_boxed(out_args, callback_name,
+                    collect_callback, invoke_callback)
 
         # Async stub
 
@@ -777,7 +1055,8 @@ class Generator(object):
         self.b('    {')
         self.b('      TpProxyPendingCall *data;')
         self.b('')
-        self.b('      data = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,')
+        self.b('      data = tp_proxy_pending_call_%s_new ((TpProxy *) proxy,'
+               % self.proxy_abi)
         self.b('          interface, "%s", iface,' % member)
         self.b('          %s,' % invoke_callback)
         self.b('          G_CALLBACK (callback), user_data, destroy,')
@@ -806,15 +1085,75 @@ class Generator(object):
         self.b('')
 
         self.do_method_reentrant(method, iface_lc, member, member_lc,
-                                 in_args, out_args, collect_callback)
+                                 in_args, out_args, collect_callback,
+                                 struct_name)
 
         # leave a gap for the end of the method
         self.d('')
         self.b('')
         self.h('')
 
+    def do_reentrant_finish_typed(self, iface_lc, member_lc, out_args,
+            reentrant_invoke, struct_name):
+        self.b('static void')
+        self.b('%s (TpProxy *self G_GNUC_UNUSED,' % reentrant_invoke)
+        self.b('    const GError *error,')
+
+        if out_args:
+            self.b('    gconstpointer p,')
+        else:
+            self.b('    gconstpointer p G_GNUC_UNUSED,')
+
+        self.b('    GCallback unused G_GNUC_UNUSED,')
+        self.b('    gpointer user_data G_GNUC_UNUSED,')
+        self.b('    GObject *unused2 G_GNUC_UNUSED)')
+        self.b('{')
+        self.b('  _%s_%s_run_state_%s *state = user_data;'
+               % (self.prefix_lc, iface_lc, member_lc))
+
+        if out_args:
+            self.b('  const %s *results = p;' % struct_name)
+
+        self.b('')
+        self.b('  state->success = (error == NULL);')
+        self.b('  state->completed = TRUE;')
+        self.b('  g_main_loop_quit (state->loop);')
+        self.b('')
+        self.b('  if (error != NULL)')
+        self.b('    {')
+        self.b('      if (state->error != NULL)')
+        self.b('        *state->error = g_error_copy (error);')
+        self.b('')
+        self.b('      return;')
+        self.b('    }')
+        self.b('')
+
+        # the results are freed when we return, so copy them
+        for arg in out_args:
+            name, info, tp_type, elt = arg
+            ctype, gtype, marshaller, pointer = info
+
+            self.b('  if (state->%s != NULL)' % name)
+
+            if marshaller == 'BOXED':
+                self.b('    *state->%s = g_boxed_copy (%s, results->%s);'
+                       % (name, gtype, name))
+            elif marshaller == 'STRING':
+                self.b('    *state->%s = g_strdup (results->%s);'
+                       % (name, name))
+            elif marshaller in ('UCHAR', 'BOOLEAN', 'INT', 'UINT',
+                    'INT64', 'UINT64', 'DOUBLE'):
+                self.b('    *state->%s = results->%s;' % (name, name))
+            else:
+                assert False, "Don't know how to copy %s" % gtype
+
+            self.b('')
+
+        self.b('}')
+        self.b('')
+
     def do_method_reentrant(self, method, iface_lc, member, member_lc, in_args,
-            out_args, collect_callback):
+            out_args, collect_callback, struct_name):
         # Reentrant blocking calls
         # Example:
         # gboolean tp_cli_properties_interface_run_get_properties
@@ -848,62 +1187,66 @@ class Generator(object):
                                                          iface_lc,
                                                          member_lc)
 
-        self.b('static void')
-        self.b('%s (TpProxy *self G_GNUC_UNUSED,' % reentrant_invoke)
-        self.b('    GError *error,')
-        self.b('    GValueArray *args,')
-        self.b('    GCallback unused G_GNUC_UNUSED,')
-        self.b('    gpointer user_data G_GNUC_UNUSED,')
-        self.b('    GObject *unused2 G_GNUC_UNUSED)')
-        self.b('{')
-        self.b('  _%s_%s_run_state_%s *state = user_data;'
-               % (self.prefix_lc, iface_lc, member_lc))
-        self.b('')
-        self.b('  state->success = (error == NULL);')
-        self.b('  state->completed = TRUE;')
-        self.b('  g_main_loop_quit (state->loop);')
-        self.b('')
-        self.b('  if (error != NULL)')
-        self.b('    {')
-        self.b('      if (state->error != NULL)')
-        self.b('        *state->error = error;')
-        self.b('      else')
-        self.b('        g_error_free (error);')
-        self.b('')
-        self.b('      return;')
-        self.b('    }')
-        self.b('')
+        if self.typed_results:
+            self.do_reentrant_finish_typed(iface_lc, member_lc, out_args,
+                    reentrant_invoke, struct_name)
+        else:
+            self.b('static void')
+            self.b('%s (TpProxy *self G_GNUC_UNUSED,' % reentrant_invoke)
+            self.b('    GError *error,')
+            self.b('    GValueArray *args,')
+            self.b('    GCallback unused G_GNUC_UNUSED,')
+            self.b('    gpointer user_data G_GNUC_UNUSED,')
+            self.b('    GObject *unused2 G_GNUC_UNUSED)')
+            self.b('{')
+            self.b('  _%s_%s_run_state_%s *state = user_data;'
+                   % (self.prefix_lc, iface_lc, member_lc))
+            self.b('')
+            self.b('  state->success = (error == NULL);')
+            self.b('  state->completed = TRUE;')
+            self.b('  g_main_loop_quit (state->loop);')
+            self.b('')
+            self.b('  if (error != NULL)')
+            self.b('    {')
+            self.b('      if (state->error != NULL)')
+            self.b('        *state->error = error;')
+            self.b('      else')
+            self.b('        g_error_free (error);')
+            self.b('')
+            self.b('      return;')
+            self.b('    }')
+            self.b('')
 
-        for i, arg in enumerate(out_args):
-            name, info, tp_type, elt = arg
-            ctype, gtype, marshaller, pointer = info
+            for i, arg in enumerate(out_args):
+                name, info, tp_type, elt = arg
+                ctype, gtype, marshaller, pointer = info
 
-            self.b('  if (state->%s != NULL)' % name)
-            if marshaller == 'BOXED':
-                self.b('    *state->%s = g_value_dup_boxed ('
-                       'args->values + %d);' % (name, i))
-            elif marshaller == 'STRING':
-                self.b('    *state->%s = g_value_dup_string '
-                       '(args->values + %d);' % (name, i))
-            elif marshaller in ('UCHAR', 'BOOLEAN', 'INT', 'UINT',
-                    'INT64', 'UINT64', 'DOUBLE'):
-                self.b('    *state->%s = g_value_get_%s (args->values + %d);'
-                       % (name, marshaller.lower(), i))
-            else:
-                assert False, "Don't know how to copy %s" % gtype
+                self.b('  if (state->%s != NULL)' % name)
+                if marshaller == 'BOXED':
+                    self.b('    *state->%s = g_value_dup_boxed ('
+                           'args->values + %d);' % (name, i))
+                elif marshaller == 'STRING':
+                    self.b('    *state->%s = g_value_dup_string '
+                           '(args->values + %d);' % (name, i))
+                elif marshaller in ('UCHAR', 'BOOLEAN', 'INT', 'UINT',
+                        'INT64', 'UINT64', 'DOUBLE'):
+                    self.b('    *state->%s = g_value_get_%s (args->values + %d);'
+                           % (name, marshaller.lower(), i))
+                else:
+                    assert False, "Don't know how to copy %s" % gtype
 
-            self.b('')
+                self.b('')
 
-        self.b('  G_GNUC_BEGIN_IGNORE_DEPRECATIONS')
-        if len(out_args) > 0:
-            self.b('  g_value_array_free (args);')
-        else:
-            self.b('  if (args != NULL)')
-            self.b('    g_value_array_free (args);')
-        self.b('  G_GNUC_END_IGNORE_DEPRECATIONS')
+            self.b('  G_GNUC_BEGIN_IGNORE_DEPRECATIONS')
+            if len(out_args) > 0:
+                self.b('  g_value_array_free (args);')
+            else:
+                self.b('  if (args != NULL)')
+                self.b('    g_value_array_free (args);')
+            self.b('  G_GNUC_END_IGNORE_DEPRECATIONS')
 
-        self.b('}')
-        self.b('')
+            self.b('}')
+            self.b('')
 
         if self.deprecate_reentrant:
             self.h('#ifndef %s' % self.deprecate_reentrant)
@@ -1024,7 +1367,8 @@ class Generator(object):
         self.b('')
         self.b('  state.loop = g_main_loop_new (NULL, FALSE);')
         self.b('')
-        self.b('  pc = tp_proxy_pending_call_v0_new ((TpProxy *) proxy,')
+        self.b('  pc = tp_proxy_pending_call_%s_new ((TpProxy *) proxy,'
+               % self.proxy_abi)
         self.b('      interface, "%s", iface,' % member)
         self.b('      %s,' % reentrant_invoke)
         self.b('      NULL, &state, NULL, NULL, TRUE);')
@@ -47,7 +47,8 @@ class Generator(object):
 
     def __init__(self, dom, prefix, basename, signal_marshal_prefix,
                  headers, end_headers, not_implemented_func,
-                 allow_havoc):
+                 allow_havoc, dispatched_func='',
+                 dispatch_time_func=''):
         self.dom = dom
         self.__header = []
         self.__body = []
@@ -83,6 +84,8 @@ class Generator(object):
         self.end_headers = end_headers
         self.not_implemented_func = not_implemented_func
         self.allow_havoc = allow_havoc
+        self.dispatched_func = dispatched_func
+        self.dispatch_time_func = dispatch_time_func
 
     def h(self, s):
         self.__header.append(s)
@@ -261,10 +264,16 @@ class Generator(object):
         self.b('{')
 
         if properties:
+            # TpDBusPropertiesMixin looks properties up by binary search,
+            # so sort them here rather than at runtime. Sorting by the UTF-8
+            # encoding gives the same order as strcmp().
+            properties = sorted(properties,
+                    key=lambda m: m.getAttribute('name').encode('utf-8'))
+
             self.b('  static TpDBusPropertiesMixinPropInfo properties[%d] = {'
                    % (len(properties) + 1))
 
-            for m in properties:
+            for i, m in enumerate(properties):
                 access = m.getAttribute('access')
                 assert access in ('read', 'write', 'readwrite')
 
@@ -286,8 +295,9 @@ class Generator(object):
                 elif prop_emits_changed == 'invalidates':
                     flags += ' | TP_DBUS_PROPERTIES_MIXIN_FLAG_EMITS_INVALIDATED'
 
-                self.b('      { 0, %s, "%s", 0, NULL, NULL }, /* %s */'
-                       % (flags, m.getAttribute('type'), m.getAttribute('name')))
+                self.b('      { 0, %s, "%s", 0, NULL, NULL }, /* [%d] %s */'
+                       % (flags, m.getAttribute('type'), i,
+                          m.getAttribute('name')))
 
             self.b('      { 0, 0, NULL, 0, NULL, NULL }')
             self.b('  };')
@@ -538,7 +548,20 @@ class Generator(object):
         self.b('  if (impl != NULL)')
         tmp = ['self'] + [name for (ctype, name) in in_args] + ['context']
         self.b('    {')
+        if self.dispatched_func:
+            self.b('      gint64 dispatch_started = %s ();'
+                   % (self.dispatch_time_func or 'g_get_monotonic_time'))
+            self.b('')
         self.b('      (impl) (%s);' % ',\n        '.join(tmp))
+        if self.dispatched_func:
+            indent = '      '
+            if self.dispatch_time_func:
+                self.b('')
+                self.b('      if (dispatch_started != 0)')
+                indent = '        '
+            self.b('%s%s ("%s", "%s", dispatch_started);'
+                   % (indent, self.dispatched_func, self.iface_name,
+                      dbus_method_name))
         self.b('    }')
         self.b('  else')
         self.b('    {')
@@ -780,6 +803,20 @@ options:
             void symbol (DBusGMethodInvocation *context)
         and return some sort of "not implemented" error via
             dbus_g_method_return_error (context, ...)
+    --dispatched-func='symbol'
+        Call symbol after each method implementation returns, for
+        instrumentation. symbol must have signature
+            void symbol (const gchar *interface, const gchar *method,
+                gint64 started)
+        where started is g_get_monotonic_time() just before the
+        implementation was called.
+    --dispatch-time-func='symbol'
+        With --dispatched-func, get started from symbol instead of
+        g_get_monotonic_time(), and only call the --dispatched-func if it
+        is nonzero. symbol must have signature
+            gint64 symbol (void)
+        and can return 0 when instrumentation is off, to avoid reading
+        the clock.
 """)
     sys.exit(1)
 
@@ -791,7 +828,9 @@ if __name__ == '__main__':
                                ['filename=', 'signal-marshal-prefix=',
                                 'include=', 'include-end=',
                                 'allow-unstable',
-                                'not-implemented-func='])
+                                'not-implemented-func=',
+                                'dispatched-func=',
+                                'dispatch-time-func='])
 
     try:
         prefix = argv[1]
@@ -803,6 +842,8 @@ if __name__ == '__main__':
     headers = []
     end_headers = []
     not_implemented_func = ''
+    dispatched_func = ''
+    dispatch_time_func = ''
     allow_havoc = False
 
     for option, value in options:
@@ -820,6 +861,10 @@ if __name__ == '__main__':
             end_headers.append(value)
         elif option == '--not-implemented-func':
             not_implemented_func = value
+        elif option == '--dispatched-func':
+            dispatched_func = value
+        elif option == '--dispatch-time-func':
+            dispatch_time_func = value
         elif option == '--allow-unstable':
             allow_havoc = True
 
@@ -829,4 +874,5 @@ if __name__ == '__main__':
         cmdline_error()
 
     Generator(dom, prefix, basename, signal_marshal_prefix, headers,
-              end_headers, not_implemented_func, allow_havoc)()
+              end_headers, not_implemented_func, allow_havoc,
+              dispatched_func, dispatch_time_func)()
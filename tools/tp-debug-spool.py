@@ -0,0 +1,237 @@
+#!/usr/bin/env python2
+
+# tp-debug-spool.py: decode the files written by tp_debug_sender_set_spool()
+#
+# Copyright (C) 2026 Collabora Ltd. <http://www.collabora.co.uk/>
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+# The format is described in telepathy-glib/debug-spool-internal.h.
+
+import os
+import struct
+import sys
+import time
+from optparse import OptionParser
+
+MAGIC = b'TpDS'
+VERSION = 1
+HEADER_SIZE = 8
+# length, then time, level, padding and domain length
+RECORD_PREFIX = struct.Struct('<IqBBH')
+
+LEVELS = ['error', 'critical', 'warning', 'message', 'info', 'debug']
+
+
+class FormatError(Exception):
+    pass
+
+
+class SpoolReader(object):
+    """Reads records from one file, remembering where it got to so that it
+    can be asked again once the file has grown."""
+
+    def __init__(self, filename):
+        self.filename = filename
+        self.f = open(filename, 'rb')
+        self.ino = os.fstat(self.f.fileno()).st_ino
+        self.offset = 0
+
+    def close(self):
+        self.f.close()
+
+    def replaced(self):
+        """Return True if the file has been rotated away since we opened
+        it."""
+        try:
+            st = os.stat(self.filename)
+        except OSError:
+            return False
+
+        return (st.st_ino != self.ino or
+                st.st_size < max(self.offset, HEADER_SIZE))
+
+    def records(self):
+        """Yield (time_us, level, domain, message) for each complete record
+        after the last one returned. A record that hasn't been completely
+        written yet is left for next time."""
+
+        self.f.seek(self.offset)
+
+        if self.offset == 0:
+            header = self.f.read(HEADER_SIZE)
+
+            if len(header) < HEADER_SIZE:
+                return
+
+            if header[:4] != MAGIC:
+                raise FormatError('%s is not a debug spool' % self.filename)
+
+            if bytearray(header)[4] != VERSION:
+                raise FormatError('%s has unknown version %d'
+                        % (self.filename, bytearray(header)[4]))
+
+            self.offset = HEADER_SIZE
+
+        while True:
+            prefix = self.f.read(RECORD_PREFIX.size)
+
+            if len(prefix) < RECORD_PREFIX.size:
+                return
+
+            length, time_us, level, _, domain_len = \
+                    RECORD_PREFIX.unpack(prefix)
+            rest = self.f.read(length - (RECORD_PREFIX.size - 4))
+
+            if len(rest) < length - (RECORD_PREFIX.size - 4):
+                return
+
+            self.offset += 4 + length
+
+            domain = rest[:domain_len].decode('utf-8', 'replace')
+            message = rest[domain_len:].decode('utf-8', 'replace')
+            yield time_us, level, domain, message
+
+
+def parse_level(s):
+    if s.isdigit():
+        return int(s)
+
+    try:
+        return LEVELS.index(s.lower())
+    except ValueError:
+        raise SystemExit('unknown level %r: expected one of %s'
+                % (s, ', '.join(LEVELS)))
+
+
+def wanted(options, level, domain):
+    if options.level is not None and level > options.level:
+        return False
+
+    if not options.domains:
+        return True
+
+    for prefix in options.domains:
+        if domain == prefix or domain.startswith(prefix + '/'):
+            return True
+
+    return False
+
+
+def show(options, record):
+    time_us, level, domain, message = record
+
+    if not wanted(options, level, domain):
+        return
+
+    if level < len(LEVELS):
+        level_name = LEVELS[level].upper()
+    else:
+        level_name = str(level)
+
+    stamp = time.strftime('%Y-%m-%d %H:%M:%S',
+            time.localtime(time_us // 1000000))
+    line = u'%s.%06d %s %s: %s\n' % (stamp, time_us % 1000000, domain,
+            level_name, message)
+
+    if sys.version_info[0] < 3:
+        line = line.encode('utf-8')
+
+    sys.stdout.write(line)
+
+
+def old_files(filename):
+    """Return the rotated-away copies of filename, oldest first."""
+    found = []
+    i = 1
+
+    while os.path.exists('%s.%d' % (filename, i)):
+        found.append('%s.%d' % (filename, i))
+        i += 1
+
+    found.reverse()
+    return found
+
+
+def main():
+    parser = OptionParser(usage='%prog [options] FILE',
+            description='Print the debug messages that a Telepathy service '
+            'has written to FILE with tp_debug_sender_set_spool().')
+    parser.add_option('-a', '--all', action='store_true', default=False,
+            help='first print the older files, FILE.1, FILE.2 and so on')
+    parser.add_option('-d', '--domain', action='append', dest='domains',
+            default=[], metavar='DOMAIN',
+            help='only print messages from DOMAIN or its subdomains '
+            '(DOMAIN/...); may be repeated')
+    parser.add_option('-l', '--level', metavar='LEVEL',
+            help='only print messages at least as severe as LEVEL (one '
+            'of %s)' % ', '.join(LEVELS))
+    parser.add_option('-f', '--follow', action='store_true', default=False,
+            help='keep printing messages as they are written, following '
+            'FILE when it is rotated')
+    parser.add_option('-i', '--interval', type='float', default=0.5,
+            help='with --follow, how often to check for new messages, in '
+            'seconds (default %default)')
+
+    options, args = parser.parse_args()
+
+    if len(args) != 1:
+        parser.error('expected exactly one FILE')
+
+    if options.level is not None:
+        options.level = parse_level(options.level)
+
+    filename = args[0]
+
+    try:
+        if options.all:
+            for old in old_files(filename):
+                reader = SpoolReader(old)
+
+                for record in reader.records():
+                    show(options, record)
+
+                reader.close()
+
+        reader = SpoolReader(filename)
+
+        for record in reader.records():
+            show(options, record)
+
+        while options.follow:
+            sys.stdout.flush()
+            time.sleep(options.interval)
+
+            # read whatever was finished before the rotation, then start on
+            # the new file
+            if reader.replaced():
+                for record in reader.records():
+                    show(options, record)
+
+                reader.close()
+                reader = SpoolReader(filename)
+
+            for record in reader.records():
+                show(options, record)
+    except FormatError as e:
+        raise SystemExit(str(e))
+    except (IOError, OSError) as e:
+        raise SystemExit('%s: %s' % (e.filename or filename, e.strerror))
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()